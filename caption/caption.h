@@ -51,6 +51,37 @@ static inline libcaption_stauts_t libcaption_status_update(libcaption_stauts_t o
     return (LIBCAPTION_ERROR == old_stat || LIBCAPTION_ERROR == new_stat) ? LIBCAPTION_ERROR : (LIBCAPTION_READY == old_stat) ? LIBCAPTION_READY : new_stat;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Integer timebase. Times that are ordered or compared are kept as ticks of the
+// 90 kHz MPEG system clock, which represents PTS/DTS exactly and 1/1000 or
+// 1001/30000 second units without drift. Seconds are only used by the text formats
+#define CAPTION_TICKS_PER_SECOND 90000
+typedef int64_t caption_ticks_t;
+
+/*! \brief Computes value * mul / div rounded to the nearest integer, halves away from zero
+    \param value Any value that fits once divided by div and multiplied by mul
+    \param mul Multiplier, magnitude below 2^31 so the product cannot overflow
+    \param div Divisor, greater than 0 and below 2^31
+*/
+static inline int64_t caption_ticks_rescale(int64_t value, int64_t mul, int64_t div)
+{
+    int64_t q = value / div, r = value % div;
+    int64_t n = r * mul, f = n / div, e = n % div;
+    f += (2 * e >= div) ? 1 : (2 * e <= -div) ? -1 : 0;
+    return q * mul + f;
+}
+/*! \brief Converts a count of num / den second units to ticks
+    \param value Time in units of num / den seconds, for example 1001 / 30000 for 29.97 frames
+    \param num Numerator, at most 23860
+    \param den Denominator
+*/
+static inline caption_ticks_t caption_ticks_from_rational(int64_t value, int64_t num, int64_t den) { return caption_ticks_rescale(value, num * CAPTION_TICKS_PER_SECOND, den); }
+static inline caption_ticks_t caption_ticks_to_rational(caption_ticks_t ticks, int64_t num, int64_t den) { return caption_ticks_rescale(ticks, den, num * CAPTION_TICKS_PER_SECOND); }
+static inline caption_ticks_t caption_ticks_from_ms(int64_t ms) { return ms * (CAPTION_TICKS_PER_SECOND / 1000); }
+static inline int64_t caption_ticks_to_ms(caption_ticks_t ticks) { return caption_ticks_rescale(ticks, 1, CAPTION_TICKS_PER_SECOND / 1000); }
+static inline caption_ticks_t caption_ticks_from_seconds(double seconds) { return (caption_ticks_t)(seconds * CAPTION_TICKS_PER_SECOND + (0 > seconds ? -0.5 : 0.5)); }
+static inline double caption_ticks_to_seconds(caption_ticks_t ticks) { return ticks / (double)CAPTION_TICKS_PER_SECOND; }
+
 #define SCREEN_ROWS 15
 #define SCREEN_COLS 32
 
@@ -72,14 +103,23 @@ typedef struct {
     uint16_t cc_data;
 } caption_frame_state_t;
 
+// Buffer currently receiving text. Stored as an index rather than a pointer so
+// caption_frame_t can be copied, pooled or persisted
+typedef enum {
+    caption_frame_write_none = 0,
+    caption_frame_write_front = 1,
+    caption_frame_write_back = 2,
+} caption_frame_write_t;
+
 // timestamp and duration are in seconds
 typedef struct {
     double timestamp;
+    caption_ticks_t ticks; //< timestamp in ticks, compared to detect the start of a new frame
     xds_t xds;
     caption_frame_state_t state;
     caption_frame_buffer_t front;
     caption_frame_buffer_t back;
-    caption_frame_buffer_t* write;
+    caption_frame_write_t write;
     libcaption_stauts_t status;
 } caption_frame_t;
 
@@ -91,11 +131,11 @@ void caption_frame_init(caption_frame_t* frame);
 /*! \brief
     \param
 */
-static inline int caption_frame_popon(caption_frame_t* frame) { return (frame->write == &frame->back) ? 1 : 0; }
+static inline int caption_frame_popon(caption_frame_t* frame) { return (caption_frame_write_back == frame->write) ? 1 : 0; }
 /*! \brief
     \param
 */
-static inline int caption_frame_painton(caption_frame_t* frame) { return (frame->write == &frame->front) ? 1 : 0; }
+static inline int caption_frame_painton(caption_frame_t* frame) { return (caption_frame_write_front == frame->write) ? 1 : 0; }
 /*! \brief
     \param
 */
@@ -105,6 +145,10 @@ static inline int caption_frame_rollup(caption_frame_t* frame) { return _caption
     \param
 */
 static inline double caption_frame_timestamp(caption_frame_t* frame) { return frame->timestamp; }
+/*! \brief Timestamp of the frame in ticks, -1 before any data was decoded
+    \param frame Frame
+*/
+static inline caption_ticks_t caption_frame_ticks(caption_frame_t* frame) { return frame->ticks; }
 /*! \brief Writes a single charcter to a caption_frame_t object
     \param frame A pointer to an allocted and initialized caption_frame_t object
     \param row Row position to write charcter, must be between 0 and SCREEN_ROWS-1
@@ -122,6 +166,26 @@ const utf8_char_t* caption_frame_read_char(caption_frame_t* frame, int row, int
     \param
 */
 libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_data, double timestamp);
+/*! \brief Same as caption_frame_decode with the timestamp in 90 kHz ticks
+    \param frame Frame to decode into
+    \param cc_data Field 1 cc_data word
+    \param ticks Timestamp in ticks. frame->timestamp is derived from it
+*/
+libcaption_stauts_t caption_frame_decode_ticks(caption_frame_t* frame, uint16_t cc_data, caption_ticks_t ticks);
+/*! \brief Decodes a run of cc_data words that share a timestamp
+
+    Equivalent to calling caption_frame_decode for each word and combining the
+    results with libcaption_status_update, but padding and parity errors are
+    detected several words at a time and never enter the state machine.
+    \param frame Frame to decode into
+    \param cc_data Array of field 1 cc_data words
+    \param size Number of words in cc_data
+    \param timestamp Timestamp applied to every word
+*/
+libcaption_stauts_t caption_frame_decode_block(caption_frame_t* frame, const uint16_t* cc_data, size_t size, double timestamp);
+/*! \brief Same as caption_frame_decode_block with the timestamp in 90 kHz ticks
+*/
+libcaption_stauts_t caption_frame_decode_block_ticks(caption_frame_t* frame, const uint16_t* cc_data, size_t size, caption_ticks_t ticks);
 /*! \brief
     \param
 */
@@ -137,6 +201,26 @@ size_t caption_frame_to_text(caption_frame_t* frame, utf8_char_t* data);
 #define CAPTION_FRAME_DUMP_BUF_SIZE 8192
 size_t caption_frame_dump_buffer(caption_frame_t* frame, utf8_char_t* buf);
 void caption_frame_dump(caption_frame_t* frame);
+/*! \brief Serializes the complete decoder state into a fixed size blob
+
+    The blob captures both buffers, cursor, roll-up state, XDS progress and the last
+    cc_data used for duplicate detection. Layout is byte oriented and independent of
+    struct packing, so it may be persisted and restored in another process.
+    \param frame Frame to serialize
+    \param data Destination, must be at least CAPTION_FRAME_SNAPSHOT_SIZE bytes
+    \return Number of bytes written, or 0 if size is too small
+*/
+#define CAPTION_FRAME_SNAPSHOT_HEADER_SIZE 62
+#define CAPTION_FRAME_SNAPSHOT_CELL_SIZE 5
+#define CAPTION_FRAME_SNAPSHOT_SIZE (CAPTION_FRAME_SNAPSHOT_HEADER_SIZE + (2 * SCREEN_ROWS * SCREEN_COLS * CAPTION_FRAME_SNAPSHOT_CELL_SIZE))
+size_t caption_frame_snapshot(const caption_frame_t* frame, uint8_t* data, size_t size);
+/*! \brief Restores a frame from a blob created by caption_frame_snapshot
+    \param frame Frame to overwrite
+    \param data Blob returned from caption_frame_snapshot
+    \param size Size of blob in bytes
+    \return LIBCAPTION_ERROR if the blob is truncated or not recognized, frame is left unmodified.
+*/
+libcaption_stauts_t caption_frame_restore(caption_frame_t* frame, const uint8_t* data, size_t size);
 
 #ifdef __cplusplus
 }
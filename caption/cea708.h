@@ -45,6 +45,9 @@ typedef struct {
     unsigned int cc_data : 16;
 } cc_data_t;
 
+// cc_count is 5 bits
+#define CEA708_MAX_CC_COUNT 31
+
 typedef struct {
     unsigned int process_em_data_flag : 1;
     unsigned int process_cc_data_flag : 1;
@@ -85,6 +88,7 @@ typedef struct {
     uint8_t directv_user_data_length;
     user_data_t user_data;
     double timestamp;
+    caption_ticks_t ticks; //< timestamp in ticks, used to order frames
 } cea708_t;
 
 const static uint32_t GA94 = (('G' << 24) | ('A' << 16) | ('9' << 8) | '4');
@@ -106,6 +110,12 @@ libcaption_stauts_t cea708_parse_h262(const uint8_t* data, size_t size, cea708_t
     \param
 */
 libcaption_stauts_t cea708_to_caption_frame(caption_frame_t* frame, cea708_t* cea708);
+/*! \brief Returns 1 if cea708_to_caption_frame would not decode anything
+
+    That is, the payload is not GA94 or contains only invalid, non field 1 or padding triples.
+    \param cea708 parsed payload
+*/
+int cea708_is_padding(cea708_t* cea708);
 /*! \brief
     \param
 */
@@ -118,6 +128,63 @@ int cea708_render(cea708_t* cea708, uint8_t* data, size_t size);
     \param
 */
 void cea708_dump(cea708_t* cea708);
+////////////////////////////////////////////////////////////////////////////////
+// 608 decoders expect one cc_data word per field every 1/29.97 seconds. The pacer
+// queues words and releases the correct number per output frame
+#define CEA708_PACER_QUEUE_SIZE 1024
+
+typedef struct {
+    uint16_t cc_data[CEA708_PACER_QUEUE_SIZE];
+    size_t front, size;
+    uint16_t last; //< last word queued
+    int gap; //< padding was dropped since the last word queued
+} cea708_pacer_queue_t;
+
+typedef struct {
+    cea708_pacer_queue_t field[2];
+    uint32_t num, den; //< output frame rate
+    uint64_t credit; //< 608 bandwidth not yet used, in units of 1 / (1001 * num) words
+} cea708_pacer_t;
+
+/*! \brief Initializes a pacer for an output frame rate of num / den
+    \param pacer Pacer to initialize
+    \param num Frame rate numerator, for example 30000 for 29.97
+    \param den Frame rate denominator, for example 1001 for 29.97
+*/
+void cea708_pacer_init(cea708_pacer_t* pacer, uint32_t num, uint32_t den);
+/*! \brief Changes the output frame rate. Queued words are kept
+*/
+void cea708_pacer_set_rate(cea708_pacer_t* pacer, uint32_t num, uint32_t den);
+/*! \brief Queues 608 words for a field
+
+    Padding is dropped, the pacer inserts its own when a field has nothing to send.
+    If padding separated two identical control codes one is kept, so they are not
+    mistaken for a doubled control code.
+
+    \param pacer Pacer
+    \param type cc_type_ntsc_cc_field_1 or cc_type_ntsc_cc_field_2
+    \param cc_data Words to queue. Doubled control codes must be queued in the same call
+    \param size Number of words in cc_data
+    \return LIBCAPTION_ERROR, and nothing is queued, if the queue is full
+*/
+libcaption_stauts_t cea708_pacer_push_cc_data(cea708_pacer_t* pacer, cea708_cc_type_t type, const uint16_t* cc_data, size_t size);
+/*! \brief Queues the valid 608 words of a parsed payload, used to re-pace an existing stream
+*/
+libcaption_stauts_t cea708_pacer_push(cea708_pacer_t* pacer, cea708_t* cea708);
+/*! \brief Number of words waiting to be sent for a field
+*/
+static inline size_t cea708_pacer_queued(cea708_pacer_t* pacer, cea708_cc_type_t type) { return pacer->field[type & 0x01].size; }
+/*! \brief Builds the payload for the next output frame
+
+    Contains a word for each field for every 1/29.97 seconds the frame covers, padding
+    is used if a field has nothing queued. At 59.94 fps every other frame is empty.
+
+    \param pacer Pacer
+    \param cea708 Initialized with cea708_init and filled
+    \param timestamp Timestamp of the output frame
+    \return Number of cc_data triples in cea708
+*/
+int cea708_pacer_pop(cea708_pacer_t* pacer, cea708_t* cea708, double timestamp);
 #ifdef __cplusplus
 }
 #endif
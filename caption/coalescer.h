@@ -0,0 +1,85 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_COALESCER_H
+#define LIBCAPTION_COALESCER_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "caption.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Paint-on and roll-up decoders are READY after every charcter, backspace and
+// erase. The coalescer turns those frames into one event per screen change that
+// is worth showing, suitable for writing as cues
+#define CAPTION_COALESCER_MIN_DURATION 1.0
+#define CAPTION_COALESCER_MERGE_WINDOW 0.5
+
+typedef struct {
+    double min_duration; //< seconds an event is displayed before the next one may start
+    double merge_window; //< changes this soon after an event starts update it instead of starting another
+    int rollup_on_cr; //< roll-up text is only shown once a carriage return completes its line
+} caption_coalescer_config_t;
+
+typedef struct {
+    caption_coalescer_config_t config;
+    int pending; //< pending holds an event that may still change
+    caption_frame_t pending_frame; //< timestamp is the event start
+    caption_frame_t event; //< last event returned, timestamp is negative until there is one
+} caption_coalescer_t;
+
+/*! \brief Initializes a coalescer
+    \param coalescer Coalescer to initialize
+    \param config Settings, or NULL for CAPTION_COALESCER_MIN_DURATION,
+           CAPTION_COALESCER_MERGE_WINDOW and roll-up lines committed on carriage return
+*/
+void caption_coalescer_init(caption_coalescer_t* coalescer, const caption_coalescer_config_t* config);
+/*! \brief Adds a frame returned as LIBCAPTION_READY by the decoder
+
+    Frames that do not change the display are ignored. With rollup_on_cr the base
+    row of a roll-up caption is left out of events, so a line is shown once the
+    carriage return after it scrolls it up, and a line still being typed when the
+    stream ends is never shown. A change that arrives within merge_window of the start of
+    the pending event replaces its content, later changes finish it. A new event
+    starts no sooner than min_duration after the previous one. Returns at most one
+    event per call, an event is returned once a later frame shows it can no longer
+    change, so events are at least one frame behind the decoder.
+
+    \param coalescer Coalescer
+    \param frame Decoded frame, frame->ticks is the time of the change
+    \return LIBCAPTION_READY when coalescer->event holds a finished event, otherwise LIBCAPTION_OK
+*/
+libcaption_stauts_t caption_coalescer_push(caption_coalescer_t* coalescer, caption_frame_t* frame);
+/*! \brief Finishes the pending event at the end of a stream
+    \return LIBCAPTION_READY when coalescer->event holds the final event
+*/
+libcaption_stauts_t caption_coalescer_flush(caption_coalescer_t* coalescer);
+/*! \brief Last event returned by caption_coalescer_push or caption_coalescer_flush
+*/
+static inline caption_frame_t* caption_coalescer_event(caption_coalescer_t* coalescer) { return &coalescer->event; }
+
+#ifdef __cplusplus
+}
+#endif
+#endif
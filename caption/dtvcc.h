@@ -0,0 +1,114 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_DTVCC_H
+#define LIBCAPTION_DTVCC_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cea708.h"
+#include "eia608_encoder.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// CEA-708 caption channel packets are carried two bytes at a time in cc_data
+// triples. The first pair of a packet is cc_type_dtvcc_packet_start
+#define DTVCC_PACKET_MAX_SIZE 128
+#define DTVCC_SERVICE_BLOCK_MAX_SIZE 31
+#define DTVCC_SERVICE_PRIMARY 1
+
+typedef enum {
+    dtvcc_c0_etx = 0x03,
+    dtvcc_c0_bs = 0x08,
+    dtvcc_c0_ff = 0x0C,
+    dtvcc_c0_cr = 0x0D,
+    dtvcc_c0_hcr = 0x0E,
+    dtvcc_c0_ext1 = 0x10,
+    dtvcc_c1_cw0 = 0x80, //< SetCurrentWindow 0-7
+    dtvcc_c1_clw = 0x88, //< ClearWindows
+    dtvcc_c1_dsw = 0x89, //< DisplayWindows
+    dtvcc_c1_hdw = 0x8A, //< HideWindows
+    dtvcc_c1_tgw = 0x8B, //< ToggleWindows
+    dtvcc_c1_dlw = 0x8C, //< DeleteWindows
+    dtvcc_c1_dly = 0x8D, //< Delay
+    dtvcc_c1_dlc = 0x8E, //< DelayCancel
+    dtvcc_c1_rst = 0x8F, //< Reset
+    dtvcc_c1_spa = 0x90, //< SetPenAttributes
+    dtvcc_c1_spc = 0x91, //< SetPenColor
+    dtvcc_c1_spl = 0x92, //< SetPenLocation
+    dtvcc_c1_swa = 0x97, //< SetWindowAttributes
+    dtvcc_c1_df0 = 0x98, //< DefineWindow 0-7
+} dtvcc_command_t;
+
+/*! \brief Encodes a utf8 charcter for a DTVCC service
+    \param c utf8 charcter
+    \param data Receives one byte from G0 or G1, or two bytes for G2
+    \return Number of bytes written, 0 if the charcter can not be represented
+*/
+size_t dtvcc_from_utf8(const utf8_char_t* c, uint8_t* data);
+////////////////////////////////////////////////////////////////////////////////
+// Worst case triples for one call to dtvcc_encoder_from_caption_frame. Every 608
+// word and every service byte is counted as a full triple
+#define DTVCC_ENCODER_MAX_608_WORDS (4 + SCREEN_ROWS * 4 * SCREEN_COLS)
+#define DTVCC_ENCODER_MAX_SERVICE_BYTES (32 + SCREEN_ROWS * (3 + 9 * SCREEN_COLS))
+#define DTVCC_ENCODER_MAX_CC_DATA (DTVCC_ENCODER_MAX_608_WORDS + DTVCC_ENCODER_MAX_SERVICE_BYTES)
+
+// Pop-on captions for a 608 channel and the equivalent 708 service
+typedef struct {
+    eia608_encoder_t eia608;
+    int service;
+    unsigned int sequence; //< sequence number of the next packet
+    int window; //< 708 window currently displayed, -1 if none
+} dtvcc_encoder_t;
+
+/*! \brief Initializes an encoder. Receiving decoders are assumed to be blank
+    \param enc Encoder to initialize
+    \param cc 608 caption channel. 0 = CC1, 1 = CC2, 2 = CC3, 3 = CC4
+    \param service 708 service number, 1 to 6. DTVCC_SERVICE_PRIMARY is normally paired with CC1
+*/
+void dtvcc_encoder_init(dtvcc_encoder_t* enc, int cc, int service);
+/*! \brief Encodes frame as a pop-on caption for both 608 and 708 decoders
+
+    608 words are produced by eia608_encoder_from_caption_frame. The displayed 608
+    caption is translated in the same call: the caption is written to a hidden
+    window covering the 608 grid (SCREEN_ROWS x SCREEN_COLS, transparent fill),
+    using SetPenLocation for placement and SetPenAttributes/SetPenColor for 608
+    styles. The window is then displayed and the previous one deleted, mirroring
+    end of caption. A blank frame deletes the windows.
+
+    Triples are written in groups of CEA708_MAX_CC_COUNT, one group per cea708_t,
+    with each group carrying a proportional share of both streams and its 608
+    words first. Nothing is written if frame matches what was last sent.
+
+    \param enc Encoder
+    \param frame Frame to display, read from the front buffer
+    \param cc_data Destination
+    \param size Number of triples available, must be at least DTVCC_ENCODER_MAX_CC_DATA
+    \return Number of triples written
+*/
+size_t dtvcc_encoder_from_caption_frame(dtvcc_encoder_t* enc, caption_frame_t* frame, cc_data_t* cc_data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -196,6 +196,55 @@ uint16_t eia608_from_basicna(uint16_t bna1, uint16_t bna2);
     \param
 */
 int eia608_to_utf8(uint16_t c, int* chan, utf8_char_t* char1, utf8_char_t* char2);
+/*! \brief Same as eia608_to_utf8, but returns eia608_char_map indexes
+    \param c1 First index, -1 if none
+    \param c2 Second index, -1 if none
+    \return Number of charcters
+*/
+int eia608_to_index(uint16_t cc_data, int* chan, int* c1, int* c2);
+////////////////////////////////////////////////////////////////////////////////
+// decode table
+typedef enum {
+    eia608_class_parity_error = 0,
+    eia608_class_padding = 1,
+    eia608_class_xds = 2,
+    eia608_class_control = 3,
+    eia608_class_basicna = 4,
+    eia608_class_specialna = 5,
+    eia608_class_westeu = 6,
+    eia608_class_preamble = 7,
+    eia608_class_midrowchange = 8,
+    eia608_class_unhandled = 9,
+} eia608_class_t;
+
+// Packed result of classifying a raw (parity included) cc_data word
+//   bits 0-3   eia608_class_t
+//   bit  4     second channel bit
+//   bit  5     word is dropped when repeated (control and specialna)
+//   text:      bits 8-15 first eia608_char_map index, bits 16-23 second index, 0xFF if absent
+//   control:   bits 8-23 eia608_control_t
+//   preamble:  bits 8-11 row (0xF if invalid), bits 12-16 column
+//   preamble and midrowchange: bits 17-19 style, bit 20 underline
+typedef uint32_t eia608_decoded_t;
+
+/*! \brief Returns the 65536 entry table indexed by raw cc_data. The table is constant
+    data generated from the eia608_is_* predicates, see src/eia608_decode_table.c
+*/
+const eia608_decoded_t* eia608_decode_table();
+/*! \brief
+    \param
+*/
+static inline eia608_decoded_t eia608_decode(uint16_t cc_data) { return eia608_decode_table()[cc_data]; }
+static inline eia608_class_t eia608_decoded_class(eia608_decoded_t word) { return (eia608_class_t)(word & 0x0F); }
+static inline int eia608_decoded_chan(eia608_decoded_t word) { return (word >> 4) & 0x01; }
+static inline int eia608_decoded_dedupe(eia608_decoded_t word) { return (word >> 5) & 0x01; }
+static inline int eia608_decoded_char1(eia608_decoded_t word) { return 0xFF == ((word >> 8) & 0xFF) ? -1 : (int)((word >> 8) & 0xFF); }
+static inline int eia608_decoded_char2(eia608_decoded_t word) { return 0xFF == ((word >> 16) & 0xFF) ? -1 : (int)((word >> 16) & 0xFF); }
+static inline eia608_control_t eia608_decoded_control(eia608_decoded_t word) { return (eia608_control_t)((word >> 8) & 0xFFFF); }
+static inline int eia608_decoded_row(eia608_decoded_t word) { return 0x0F == ((word >> 8) & 0x0F) ? -1 : (int)((word >> 8) & 0x0F); }
+static inline int eia608_decoded_col(eia608_decoded_t word) { return (word >> 12) & 0x1F; }
+static inline eia608_style_t eia608_decoded_style(eia608_decoded_t word) { return (eia608_style_t)((word >> 17) & 0x07); }
+static inline int eia608_decoded_underline(eia608_decoded_t word) { return (word >> 20) & 0x01; }
 ////////////////////////////////////////////////////////////////////////////////
 /*! \brief
     \param
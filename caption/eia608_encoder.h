@@ -0,0 +1,135 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_EIA608_ENCODER_H
+#define LIBCAPTION_EIA608_ENCODER_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "caption.h"
+#include "eia608.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Worst case words for a full screen: a preamble, an unpaired charcter and two
+// words per charcter (extended charcter plus fallback, or specialna plus breaker)
+#define EIA608_ENCODE_TEXT_MAX_WORDS (SCREEN_ROWS * (2 + 2 * SCREEN_COLS))
+
+/*! \brief Encodes a utf8 string as the body of a pop-on caption
+
+    Text is wrapped exactly as caption_frame_from_text does. For each non blank row a
+    row preamble is written followed by the row's charcters: Basic North American
+    charcters are paired two per word, extended charcters are preceded by a basic
+    fallback for decoders that do not support them. Charcters with no 608 equivalent
+    are skipped. The caller is responsible for the surrounding control codes
+    (ENM, RCL ... EOC). Words include parity.
+
+    \param text null terminated utf8 string
+    \param cc Caption channel. 0 = CC1, 1 = CC2, 2 = CC3, 3 = CC4
+    \param cc_data Destination buffer
+    \param size Number of words available in cc_data. EIA608_ENCODE_TEXT_MAX_WORDS is always enough
+    \return Number of words written. If size is too small encoding stops at the last charcter that fit.
+*/
+size_t eia608_encode_text(const utf8_char_t* text, int cc, uint16_t* cc_data, size_t size);
+////////////////////////////////////////////////////////////////////////////////
+typedef enum {
+    eia608_encoder_popon = 0,
+    eia608_encoder_painton = 1,
+    eia608_encoder_rollup_2 = 2,
+    eia608_encoder_rollup_3 = 3,
+    eia608_encoder_rollup_4 = 4,
+} eia608_encoder_mode_t;
+
+// Worst case words for a single step of the encoder: moving the cursor to a cell
+// and writing it. Steps are never split, when cc_data has less room than this the
+// step is encoded into the encoder and returned across the following calls
+#define EIA608_ENCODER_STEP_WORDS 10
+
+// Remembers what has been transmitted so that only changes need to be sent
+typedef struct {
+    eia608_encoder_mode_t mode;
+    int cc;
+    int loading; //< pop-on caption is partially written to non-displayed memory
+    caption_frame_t shadow; //< decoder state after every word encoded so far, including queued words
+    size_t queued;
+    uint16_t queue[EIA608_ENCODER_STEP_WORDS]; //< encoded words that did not fit in cc_data
+} eia608_encoder_t;
+
+/*! \brief Initializes an encoder. Receiving decoders are assumed to be blank
+    \param enc Encoder to initialize
+    \param mode Caption mode to encode in
+    \param cc Caption channel. 0 = CC1, 1 = CC2, 2 = CC3, 3 = CC4
+*/
+void eia608_encoder_init(eia608_encoder_t* enc, eia608_encoder_mode_t mode, int cc);
+/*! \brief Encodes the changes required to make decoders display frame
+
+    Nothing is written if frame matches what was last sent.
+
+    Pop-on: a caption is only reloaded when it changes, a blank frame is sent as a
+    single erase displayed memory.
+
+    Paint-on: changed cells are rewritten in place using row preambles and tabs to
+    move the cursor, mid-row codes for style changes and backspace or delete to end
+    of row to erase.
+
+    Roll-up: the window is scrolled with carriage returns when the frame looks like
+    the displayed window moved up, then the base row is edited like paint-on. Rows
+    outside the window are ignored.
+
+    Control codes are sent once. If size is too small the remaining changes are
+    written by the next call. Words left over from a previous call are written
+    first, any size above 0 makes progress.
+
+    \param enc Encoder
+    \param frame Frame to display, read from the front buffer
+    \param cc_data Destination buffer
+    \param size Number of words available in cc_data
+    \return Number of words written
+*/
+size_t eia608_encoder_from_caption_frame(eia608_encoder_t* enc, caption_frame_t* frame, uint16_t* cc_data, size_t size);
+/*! \brief Appends text at the cursor of a roll-up or paint-on caption
+
+    Intended for live feeds where text arrives a few words at a time. Only the new
+    charcters are sent. Lines are word wrapped at SCREEN_COLS, a new line is also
+    started for each '\n'. Roll-up starts a new line with a carriage return on the
+    bottom row. Paint-on moves to the next row using a preamble, once the bottom
+    row is full the display is erased and text continues on row
+    EIA608_ENCODER_PAINTON_TOP. Pop-on encoders write nothing.
+
+    \param enc Encoder in a roll-up or paint-on mode
+    \param text null terminated utf8 string
+    \param cc_data Destination buffer
+    \param size Number of words available in cc_data
+    \param used If not NULL, receives the number of bytes of text that were encoded.
+           When cc_data fills up, the caller should append the rest of text later.
+           Words left over from a previous call are written first, so used can be 0
+           while words are returned. Any size above 0 makes progress.
+    \return Number of words written
+*/
+#define EIA608_ENCODER_PAINTON_TOP (SCREEN_ROWS - 4)
+size_t eia608_encoder_append_text(eia608_encoder_t* enc, const utf8_char_t* text, uint16_t* cc_data, size_t size, size_t* used);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
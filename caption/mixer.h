@@ -0,0 +1,98 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_MIXER_H
+#define LIBCAPTION_MIXER_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cea708.h"
+#include "eia608_encoder.h"
+#include "mpeg.h"
+#include "vtt.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Combines timed cue sources, one per 608 channel, into a single caption stream.
+// CC1 and CC2 are sent on field 1, CC3 and CC4 on field 2
+#define CAPTION_MIXER_CHANNELS 4
+
+typedef struct {
+    vtt_block_t* cue; //< next cue to display, not owned
+    double offset; //< added to cue timestamps
+    double clear; //< time the displayed cue ends, negative if nothing needs clearing
+    int loaded; //< cue is queued in non-displayed memory, waiting for end of caption
+    size_t size; //< words in cc_data, the encoded cue has not been queued yet
+    uint16_t cc_data[2 + EIA608_ENCODE_TEXT_MAX_WORDS];
+} caption_mixer_source_t;
+
+typedef struct {
+    double timestamp;
+    int cc;
+} caption_mixer_event_t;
+
+typedef struct {
+    cea708_pacer_t pacer;
+    caption_mixer_source_t source[CAPTION_MIXER_CHANNELS];
+    // min heap of the next timed action of each source
+    caption_mixer_event_t heap[CAPTION_MIXER_CHANNELS];
+    size_t heap_size;
+} caption_mixer_t;
+
+/*! \brief Initializes a mixer for an output frame rate of num / den
+    \param mixer Mixer to initialize
+    \param num Frame rate numerator, for example 30000 for 29.97
+    \param den Frame rate denominator, for example 1001 for 29.97
+*/
+void caption_mixer_init(caption_mixer_t* mixer, uint32_t num, uint32_t den);
+/*! \brief Assigns a list of cues to a channel
+
+    Cues are sent as pop-on captions. The next cue is loaded into non-displayed
+    memory as soon as bandwidth allows, so only end of caption has to be sent at
+    its timestamp. A cue is cleared at the end of its duration unless the next
+    cue replaces it first. Replaces any source previously assigned to the channel.
+
+    \param mixer Mixer
+    \param cc Caption channel. 0 = CC1, 1 = CC2, 2 = CC3, 3 = CC4
+    \param cue First cue, for example vtt->cue_head or srt->cue_head. Cues must outlive the mixer
+    \param offset Seconds added to every cue timestamp
+*/
+libcaption_stauts_t caption_mixer_add_source(caption_mixer_t* mixer, int cc, vtt_block_t* cue, double offset);
+/*! \brief Produces the captions for the next video frame
+
+    Must be called for every frame, in presentation order, so bandwidth is shared
+    evenly. A single 708 message carrying both fields is appended to sei.
+
+    \param mixer Mixer
+    \param sei Destination, initialized with sei_init
+    \param timestamp Presentation time of the frame in seconds
+*/
+libcaption_stauts_t caption_mixer_frame(caption_mixer_t* mixer, sei_t* sei, double timestamp);
+/*! \brief Returns 1 once every cue of every source has been queued
+*/
+int caption_mixer_done(caption_mixer_t* mixer);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -39,18 +39,32 @@ extern "C" {
 #define H262_SEI_PACKET 0xB2
 #define H264_SEI_PACKET 0x06
 #define H265_SEI_PACKET 0x27 // There is also 0x28
+#define H262_EXTENSION_PACKET 0xB5
+#define H264_SPS_PACKET 0x07
+#define H265_SPS_PACKET 0x21
 #define MAX_NALU_SIZE (6 * 1024 * 1024)
 #define MAX_REFRENCE_FRAMES 64
+// H.264 and H.265 never reorder more than 16 frames
+#define MPEG_BITSTREAM_MAX_REORDER 16
 typedef struct {
     size_t size;
     uint8_t data[MAX_NALU_SIZE + 1];
-    double dts, cts;
+    caption_ticks_t dts, cts; //< timestamps of the most recent parse
     libcaption_stauts_t status;
     // Priority queue for out of order frame processing
     // Should probablly be a linked list
     size_t front;
     size_t latent;
     cea708_t cea708[MAX_REFRENCE_FRAMES];
+    // Frames waiting to be presented, with or without captions. Once more than
+    // reorder are waiting the earliest can be presented, as a decoder would
+    int reorder; //< from the SPS or sequence extension, -1 until one is seen
+    int frame_known; //< frame_pts has been set
+    caption_ticks_t frame_pts; //< frame currently being received
+    size_t waiting;
+    caption_ticks_t waiting_pts[MPEG_BITSTREAM_MAX_REORDER + 1];
+    int presented_known;
+    caption_ticks_t presented; //< every frame up to this pts has been presented
 } mpeg_bitstream_t;
 
 void mpeg_bitstream_init(mpeg_bitstream_t* packet);
@@ -60,10 +74,40 @@ void mpeg_bitstream_init(mpeg_bitstream_t* packet);
     \param
 */
 size_t mpeg_bitstream_parse(mpeg_bitstream_t* packet, caption_frame_t* frame, const uint8_t* data, size_t size, unsigned stream_type, double dts, double cts);
+/*! \brief Same as mpeg_bitstream_parse with timestamps in 90 kHz ticks
+
+    Preferred when the container provides integer timestamps, such as MPEG-TS PTS/DTS
+    or FLV milliseconds (see caption_ticks_from_ms). Frames are reordered by exact
+    integer comparison. Decoded frames still report seconds.
+    \param dts Decode timestamp in ticks
+    \param cts Composition offset in ticks, pts - dts
+*/
+size_t mpeg_bitstream_parse_ticks(mpeg_bitstream_t* packet, caption_frame_t* frame, const uint8_t* data, size_t size, unsigned stream_type, caption_ticks_t dts, caption_ticks_t cts);
 /*! \brief
     \param
 */
 static inline libcaption_stauts_t mpeg_bitstream_status(mpeg_bitstream_t* packet) { return packet->status; }
+/*! \brief Signals that the data parsed so far ends on a NALU boundary, usually the end of an access unit
+
+    A NALU is normally processed once the next start code arrives, so the last NALU of
+    each buffer waits for the next call. This processes it immediately using the
+    timestamps of the most recent parse. Only call it when the buffer is known to end
+    with a complete NALU, for example after each FLV tag or complete PES packet.
+    Returns LIBCAPTION_READY when a frame was decoded, call again until it returns
+    LIBCAPTION_OK to process the rest.
+    \param stream_type Same as passed to mpeg_bitstream_parse
+*/
+libcaption_stauts_t mpeg_bitstream_end(mpeg_bitstream_t* packet, caption_frame_t* frame, unsigned stream_type);
+/*! \brief Number of frames the stream may be reordered by, as declared by its sequence parameters
+
+    H.264 max_num_reorder_frames, H.265 sps_max_num_reorder_pics or 0 for a low_delay
+    H.262 stream. When the H.264 VUI omits it, it is derived from the picture order count
+    type and level. Captions are decoded as soon as their frame would be presented, so a
+    value of 0 adds no latency. Until it is known, a caption waits for a frame with a
+    later decode time.
+    \return -1 if unknown
+*/
+static inline int mpeg_bitstream_reorder(mpeg_bitstream_t* packet) { return packet->reorder; }
 /*! \brief
         Flushes latent packets caused by out or order frames.
         Returns number of latent frames remaining, 0 when complete;
@@ -104,6 +148,7 @@ typedef struct _sei_message_t {
 
 typedef struct {
     double timestamp;
+    caption_ticks_t ticks; //< timestamp in ticks
     sei_message_t* head;
     sei_message_t* tail;
 } sei_t;
@@ -128,6 +173,10 @@ void sei_message_append(sei_t* sei, sei_message_t* msg);
     \param
 */
 libcaption_stauts_t sei_parse(sei_t* sei, const uint8_t* data, size_t size, double timestamp);
+/*! \brief Same as sei_parse with the timestamp in 90 kHz ticks
+    \param ticks Timestamp in ticks. sei->timestamp is derived from it
+*/
+libcaption_stauts_t sei_parse_ticks(sei_t* sei, const uint8_t* data, size_t size, caption_ticks_t ticks);
 /*! \brief
     \param
 */
@@ -189,6 +238,23 @@ void sei_dump(sei_t* sei);
 */
 void sei_dump_messages(sei_message_t* head, double timestamp);
 ////////////////////////////////////////////////////////////////////////////////
+/*! \brief Renders cea708 as a new message appended to sei. cea708 is reinitialized afterwards
+    \param sei Destination
+    \param cea708 Payload, for example from cea708_pacer_pop
+*/
+void sei_append_708(sei_t* sei, cea708_t* cea708);
+/*! \brief Packs field 1 cc_data words into as many 708 messages as required
+    \param sei Destination, messages are appended
+    \param cc_data Words to send, for example from eia608_encoder_from_caption_frame
+    \param size Number of words in cc_data
+*/
+libcaption_stauts_t sei_from_cc_data(sei_t* sei, const uint16_t* cc_data, size_t size);
+/*! \brief Packs cc_data triples of any type into as many 708 messages as required
+    \param sei Destination, messages are appended
+    \param cc_data Triples to send, for example from dtvcc_encoder_from_caption_frame
+    \param size Number of triples in cc_data
+*/
+libcaption_stauts_t sei_from_cc_triples(sei_t* sei, const cc_data_t* cc_data, size_t size);
 /*! \brief
     \param
 */
@@ -27,7 +27,9 @@
 extern "C" {
 #endif
 
+#include "caption.h"
 #include "eia608.h"
+#include "eia608_encoder.h"
 
 typedef struct _scc_t {
     double timestamp;
@@ -40,6 +42,120 @@ scc_t* scc_new(int cc_count);
 scc_t* scc_free(scc_t* scc);
 
 size_t scc_to_608(scc_t** scc, const utf8_char_t* data);
+/*! \brief Converts an SCC timecode to seconds
+
+    SCC frames are 1001/30000 of a second. Non-drop timecodes count every frame, so
+    they run slower than the clock. Drop-frame timecodes (';' before the frames)
+    skip frame numbers 0 and 1 each minute except every tenth and track the clock.
+    \param hh Hours
+    \param mm Minutes
+    \param ss Seconds
+    \param ff Frames
+    \param drop_frame 1 for drop-frame timecode
+*/
+double scc_timecode_to_timestamp(int hh, int mm, int ss, int ff, int drop_frame);
+////////////////////////////////////////////////////////////////////////////////
+// A whole SCC file. The words of every line are stored back to back in cc_data
+typedef struct {
+    double timestamp;
+    size_t offset; //< index of the first word in cc_data
+    size_t size; //< number of words
+} scc_line_t;
+
+typedef struct {
+    size_t line_size, line_capacity;
+    scc_line_t* line;
+    size_t cc_size;
+    uint16_t* cc_data;
+} scc_file_t;
+
+/*! \brief Parses a complete SCC document
+
+    Lines that do not start with a timecode are ignored. A line ends at the first
+    token that is not a 4 digit hex word.
+    \param scc File to initialize, must be released with scc_file_free even on error
+    \param data SCC document, need not be null terminated
+    \param size Size of data in bytes
+    \return LIBCAPTION_ERROR on an unsupported version or if memory could not be allocated
+*/
+libcaption_stauts_t scc_file_parse(scc_file_t* scc, const utf8_char_t* data, size_t size);
+/*! \brief Maps and parses an SCC file, see scc_file_parse
+*/
+libcaption_stauts_t scc_file_load(scc_file_t* scc, const char* path);
+/*! \brief Releases memory held by scc
+*/
+void scc_file_free(scc_file_t* scc);
+/*! \brief Returns the first line with a timestamp at or after timestamp, O(log n)
+
+    Lines are assumed to be in timestamp order, as they are in valid SCC files.
+    \return Line number, scc->line_size if every line is earlier
+*/
+size_t scc_file_seek(const scc_file_t* scc, double timestamp);
+/*! \brief Returns the words of a line
+*/
+static inline const uint16_t* scc_file_cc_data(const scc_file_t* scc, size_t line) { return scc->cc_data + scc->line[line].offset; }
+////////////////////////////////////////////////////////////////////////////////
+/*! \brief Converts seconds to the nearest SCC frame number, negative values become 0
+*/
+int64_t scc_timestamp_to_frame(double timestamp);
+/*! \brief Converts ticks to the nearest SCC frame number, negative values become 0
+*/
+int64_t scc_ticks_to_frame(caption_ticks_t ticks);
+/*! \brief Formats a frame number as HH:MM:SS:FF, or HH:MM:SS;FF for drop-frame
+    \param data Destination, SCC_TIMECODE_SIZE bytes. Not null terminated
+    \return Number of bytes written
+*/
+#define SCC_TIMECODE_SIZE 11
+size_t scc_format_timecode(utf8_char_t* data, int64_t frame, int drop_frame);
+/*! \brief Encodes text as a pop-on caption for an SCC file
+
+    Words are RCL ENM, the caption body from eia608_encode_text, then EOC. As is
+    customary in SCC files every control code is sent twice, decoders ignore the
+    repeat. The first EOC is at index size - 2.
+    \param text null terminated utf8 string
+    \param cc Caption channel. 0 = CC1, 1 = CC2, 2 = CC3, 3 = CC4
+    \param cc_data Destination, SCC_ENCODE_POPON_MAX_WORDS is always enough
+    \param size Number of words available in cc_data
+    \return Number of words written, 0 if size is too small
+*/
+#define SCC_ENCODE_POPON_MAX_WORDS (6 + 2 * EIA608_ENCODE_TEXT_MAX_WORDS)
+size_t scc_encode_popon(const utf8_char_t* text, int cc, uint16_t* cc_data, size_t size);
+
+// Lays out pop-on captions on the SCC timeline
+typedef struct {
+    utf8_writer_t* writer;
+    int cc;
+    int drop_frame;
+    int64_t next_frame; //< first frame not used by a written line
+    int64_t clear_frame; //< frame of a pending erase display memory, -1 if none
+} scc_writer_t;
+
+/*! \brief Initializes writer and writes the SCC header
+    \param writer SCC writer
+    \param dest Output
+    \param cc Caption channel used for erase display memory
+    \param drop_frame 1 to write drop-frame timecodes
+*/
+int scc_writer_init(scc_writer_t* writer, utf8_writer_t* dest, int cc, int drop_frame);
+/*! \brief Writes a cue encoded with scc_encode_popon
+
+    The line starts early enough for the first EOC to land on start. If that would
+    overlap the previous line the cue is delayed. The caption is erased at end,
+    unless the next cue starts before the erase could be sent, in which case the
+    next EOC replaces it.
+    \param writer SCC writer
+    \param start Cue start in ticks, cues must be written in start order
+    \param end Cue end in ticks
+    \param cc_data Words from scc_encode_popon
+    \param size Number of words
+*/
+int scc_writer_cue(scc_writer_t* writer, caption_ticks_t start, caption_ticks_t end, const uint16_t* cc_data, size_t size);
+/*! \brief Writes the erase for the last cue
+*/
+int scc_writer_finish(scc_writer_t* writer);
+/*! \brief Writes one line of an SCC file
+*/
+int scc_write_line(utf8_writer_t* writer, int64_t frame, const uint16_t* cc_data, size_t size, int drop_frame);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,91 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_SEI_CACHE_H
+#define LIBCAPTION_SEI_CACHE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "caption.h"
+#include <stddef.h>
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Rendered SEI for one caption. Entries are immutable and reference counted, so a
+// single entry may be written into any number of renditions from any thread
+typedef struct _sei_cache_entry_t sei_cache_entry_t;
+// Maps caption text to entries. One cache should be used per caption channel
+typedef struct _sei_cache_t sei_cache_t;
+
+#define SEI_CACHE_DEFAULT_CAPACITY 256
+
+/*! \brief Allocates an empty cache. All functions may be called from multiple threads
+    \param capacity Maximum number of entries kept, the oldest entries are dropped first
+    \return New cache or NULL on allocation failure
+*/
+sei_cache_t* sei_cache_new(size_t capacity);
+/*! \brief Frees a cache. Entries still retained by the caller remain valid until released
+    \param cache Cache to free
+*/
+void sei_cache_free(sei_cache_t* cache);
+/*! \brief Returns the SEI for a pop-on caption displaying text
+
+    The SEI is rendered exactly as caption_frame_from_text followed by
+    sei_from_caption_frame would. Text is only rendered the first time it is seen.
+    The payload contains no timestamps, so the same bytes are valid for every
+    rendition and every presentation of the cue.
+
+    \param cache Cache
+    \param text null terminated utf8 string, or NULL to clear the display as sei_from_caption_clear does
+    \return Retained entry that must be passed to sei_cache_entry_release, or NULL on allocation failure
+*/
+sei_cache_entry_t* sei_cache_text(sei_cache_t* cache, const utf8_char_t* text);
+/*! \brief Adds a reference to entry
+    \param entry Entry returned from sei_cache_text
+*/
+sei_cache_entry_t* sei_cache_entry_retain(sei_cache_entry_t* entry);
+/*! \brief Drops a reference to entry, the last reference frees it
+    \param entry Entry returned from sei_cache_text or sei_cache_entry_retain
+*/
+void sei_cache_entry_release(sei_cache_entry_t* entry);
+/*! \brief Escaped SEI NAL unit, starting with the NAL header. Same bytes as sei_render
+    \param entry Entry
+    \param size Receives the size in bytes
+*/
+const uint8_t* sei_cache_entry_nalu(const sei_cache_entry_t* entry, size_t* size);
+/*! \brief NAL unit preceded by a 4 byte big endian length, as used by FLV and MP4
+    \param entry Entry
+    \param size Receives the size in bytes, including the length
+*/
+const uint8_t* sei_cache_entry_avcc(const sei_cache_entry_t* entry, size_t* size);
+/*! \brief NAL unit preceded by a 4 byte start code, as used by MPEG-TS
+    \param entry Entry
+    \param size Receives the size in bytes, including the start code
+*/
+const uint8_t* sei_cache_entry_annexb(const sei_cache_entry_t* entry, size_t* size);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
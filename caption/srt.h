@@ -48,10 +48,20 @@ srt_t* srt_free_head(srt_t* head);
     \param
 */
 srt_t* srt_parse(const utf8_char_t* data, size_t size);
+/*! \brief Maps a file and parses it in place, see vtt_parse_in_place
+    \param path SRT file
+*/
+srt_t* srt_parse_file(const char* path);
 /*! \brief
     \param
 */
 void srt_free(srt_t* srt);
+/*! \brief Initializes a push parser for SRT input, see vtt_parser_init
+    \param parser Parser to initialize
+    \param callback Receives each complete cue
+    \param opaque Passed to callback
+*/
+static inline void srt_parser_init(vtt_parser_t* parser, vtt_parser_callback_t callback, void* opaque) { vtt_parser_init(parser, 1, callback, opaque); }
 
 /*! \brief
     \param
@@ -83,7 +93,28 @@ static inline srt_cue_t* srt_cue_new(srt_t* srt, const utf8_char_t* data, size_t
 */
 static inline int srt_cue_to_caption_frame(srt_cue_t* cue, caption_frame_t* frame) { return vtt_cue_to_caption_frame(cue, frame); };
 
+/*! \brief Writes a single cue
+    \param writer Destination
+    \param cue Cue to write
+    \param index Cue number, SRT cues are numbered from 1
+    \return 1 on success, 0 on error
+*/
+int srt_write_cue(utf8_writer_t* writer, srt_cue_t* cue, unsigned int index);
+/*! \brief Writes a complete SRT file
+    \param writer Destination
+    \param srt Source
+    \return 1 on success, 0 on error
+*/
+int srt_write(utf8_writer_t* writer, srt_t* srt);
+/*! \brief Writes srt to stdout
+    \param srt Source
+*/
 void srt_dump(srt_t* srt);
+/*! \brief Initializes a sink that writes SRT, see vtt_sink_init
+    \param sink Sink to initialize
+    \param writer Destination
+*/
+static inline int srt_sink_init(vtt_sink_t* sink, utf8_writer_t* writer) { return vtt_sink_init(sink, writer, 1); }
 /*! \brief
     \param
 */
@@ -77,6 +77,17 @@ size_t utf8_char_copy(utf8_char_t* dst, const utf8_char_t* src);
     to coutn until the a null terminator, pass 0 for size
 */
 utf8_size_t utf8_char_count(const char* data, size_t size);
+/*! \brief Validates utf8
+
+    Sequences must be well formed as defined by the Unicode standard: no overlong
+    encodings, surrogates, values above U+10FFFF or truncated sequences. 0x00 is
+    valid and does not end the string.
+    \param data Bytes to validate
+    \param size Number of bytes in data
+    \return Number of leading bytes that are valid. Equal to size if all of data is valid
+*/
+size_t utf8_valid_length(const utf8_char_t* data, size_t size);
+static inline int utf8_validate(const utf8_char_t* data, size_t size) { return size == utf8_valid_length(data, size); }
 /*! \brief
     \param
 
@@ -112,6 +123,87 @@ int utf8_line_count(const utf8_char_t* data);
 #define UFTF_DEFAULT_MAX_FILE_SIZE = (50 * 1024 * 1024);
 
 utf8_char_t* utf8_load_text_file(const char* path, size_t* size);
+/*! \brief Maps a text file into memory so it can be parsed in place
+
+    The mapping is private and writable, changes are never written back to the file.
+    data[size] is always 0. Where memory mapping is not available the file is read
+    into an allocated buffer instead.
+    \param path File to map
+    \param size Receives the file size
+    \return NULL on error. Must be released with utf8_unmap_text_file
+*/
+utf8_char_t* utf8_map_text_file(const char* path, size_t* size);
+/*! \brief Releases data returned from utf8_map_text_file
+    \param data Mapped file
+    \param size Size returned from utf8_map_text_file
+*/
+void utf8_unmap_text_file(utf8_char_t* data, size_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Buffered output for the text formats. Writes to a growable memory buffer, or
+// to a file descriptor in large blocks
+#define UTF8_WRITER_FLUSH_SIZE (256 * 1024)
+
+typedef struct {
+    utf8_char_t* data;
+    size_t size; //< bytes in data
+    size_t capacity;
+    int fd; //< -1 when writing to memory
+    int error;
+} utf8_writer_t;
+
+/*! \brief Initializes a writer that renders into memory
+    \param writer Writer to initialize
+    \param data Initial buffer, allocated with malloc. May be NULL. The writer reallocates it as needed
+    \param capacity Size of data in bytes
+*/
+void utf8_writer_init(utf8_writer_t* writer, utf8_char_t* data, size_t capacity);
+/*! \brief Initializes a writer that renders to a file descriptor
+    \param writer Writer to initialize
+    \param fd Open file descriptor, not closed by the writer
+*/
+void utf8_writer_init_fd(utf8_writer_t* writer, int fd);
+/*! \brief Frees the writer buffer. An fd writer is flushed first
+
+    To keep the output of a memory writer, take writer->data before calling
+    utf8_writer_free and set it to NULL.
+*/
+int utf8_writer_free(utf8_writer_t* writer);
+/*! \brief Appends size bytes of data
+    \return 1 on success, 0 if memory could not be allocated or the fd could not be written.
+            Errors are sticky, later calls do nothing and return 0
+*/
+int utf8_writer_write(utf8_writer_t* writer, const utf8_char_t* data, size_t size);
+/*! \brief Appends a null terminated string
+*/
+int utf8_writer_string(utf8_writer_t* writer, const utf8_char_t* data);
+/*! \brief Appends an unsigned integer in decimal
+*/
+int utf8_writer_uint(utf8_writer_t* writer, uint64_t value);
+/*! \brief Appends a timestamp as HH:MM:SS followed by separator and milliseconds
+    \param writer Writer
+    \param timestamp Seconds, rounded to the nearest millisecond. Negative values are written as zero
+    \param separator '.' for WebVTT, ',' for SRT
+*/
+int utf8_writer_timestamp(utf8_writer_t* writer, double timestamp, utf8_char_t separator);
+/*! \brief Same as utf8_writer_timestamp with an exact time in milliseconds
+    \param ms Milliseconds, negative values are written as zero
+*/
+int utf8_writer_ms(utf8_writer_t* writer, int64_t ms, utf8_char_t separator);
+/*! \brief Writes buffered data to the fd. Memory writers are always flushed
+*/
+int utf8_writer_flush(utf8_writer_t* writer);
+/*! \brief Formats a timestamp as utf8_writer_timestamp does, without a null terminator
+    \param data Destination, UTF8_TIMESTAMP_MAX_SIZE bytes
+    \return Number of bytes written
+*/
+#define UTF8_TIMESTAMP_MAX_SIZE 32
+size_t utf8_format_timestamp(utf8_char_t* data, double timestamp, utf8_char_t separator);
+/*! \brief Formats milliseconds as utf8_writer_ms does, without a null terminator
+    \param data Destination, UTF8_TIMESTAMP_MAX_SIZE bytes
+    \return Number of bytes written
+*/
+size_t utf8_format_ms(utf8_char_t* data, int64_t ms, utf8_char_t separator);
 
 /*! \brief
     \param
@@ -41,9 +41,11 @@ enum VTT_BLOCK_TYPE {
 typedef struct _vtt_block_t {
     struct _vtt_block_t* next;
     enum VTT_BLOCK_TYPE type;
-    // CUE-Only
+    // CUE-Only. Seconds are derived from ticks, the writers use ticks
     double timestamp;
     double duration; // -1.0 for no duration
+    caption_ticks_t ticks; //< timestamp in ticks
+    caption_ticks_t duration_ticks; //< duration in ticks, negative for no duration
     char* cue_settings;
     char* cue_id;
     // Standard block data
@@ -51,6 +53,19 @@ typedef struct _vtt_block_t {
     char* block_text;
 } vtt_block_t;
 
+// Heap allocated block linked into a vtt_t that was parsed in place
+typedef struct _vtt_arena_heap_t {
+    struct _vtt_arena_heap_t* next;
+    vtt_block_t* block;
+} vtt_arena_heap_t;
+
+// Blocks parsed in place are carved out of a few large allocations
+typedef struct {
+    void* chunk; //< newest allocation, each starts with a pointer to the previous one
+    size_t used, capacity;
+    vtt_arena_heap_t* heap; //< blocks appended by the caller, freed with the arena
+} vtt_arena_t;
+
 // VTT files are a collection of REGION, STYLE and CUE blocks.
 // XXX: Comments (NOTE blocks) are ignored
 typedef struct _vtt_t {
@@ -60,6 +75,11 @@ typedef struct _vtt_t {
     vtt_block_t* style_tail;
     vtt_block_t* cue_head;
     vtt_block_t* cue_tail;
+    // Set when parsed in place. Parsed blocks are allocated from the arena and
+    // vtt_free releases them all at once, along with any appended heap blocks
+    vtt_arena_t* arena;
+    utf8_char_t* mapped; //< file owned by this vtt_t, see vtt_parse_file
+    size_t mapped_size;
 } vtt_t;
 
 /*! \brief
@@ -76,6 +96,20 @@ void vtt_free(vtt_t* vtt);
 */
 vtt_block_t* vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enum VTT_BLOCK_TYPE type);
 
+/*! \brief Links block to the end of the REGION, STYLE or CUE list of vtt. NOTE blocks are not linked
+    \param vtt Owner of block after the call
+    \param block Block that is not in any list, from vtt_block_new(NULL, ...) or vtt_parser_t
+    \return LIBCAPTION_ERROR if vtt was parsed in place and could not record the block, it is not linked
+*/
+libcaption_stauts_t vtt_block_append(vtt_t* vtt, vtt_block_t* block);
+
+/*! \brief Frees a single heap allocated block
+    \param head Block to free. Must not be a block of a vtt_t from vtt_parse_in_place or
+           vtt_parse_file, those are released by vtt_free
+    \return head->next
+*/
+vtt_block_t* vtt_block_free_head(vtt_block_t* head);
+
 /*! \brief
     \param
 */
@@ -101,6 +135,74 @@ vtt_t* vtt_parse(const utf8_char_t* data, size_t size);
     \param
 */
 vtt_t* _vtt_parse(const utf8_char_t* data, size_t size, int srt_mode);
+/*! \brief Parses without copying block text
+
+    Block headers are allocated from an arena owned by the returned vtt_t. Text, cue
+    ids and settings point into data, which is modified to null terminate them.
+    \param data Writable document, data[size] must be 0. Must outlive the returned vtt_t
+    \param size Size of data in bytes, excluding the null terminator
+    \param srt_mode 0 for WebVTT, 1 for SRT
+    \return NULL on error, free with vtt_free
+*/
+vtt_t* vtt_parse_in_place(utf8_char_t* data, size_t size, int srt_mode);
+/*! \brief Maps a file and parses it in place. The mapping is released by vtt_free
+    \param path WebVTT file
+*/
+vtt_t* vtt_parse_file(const char* path);
+vtt_t* _vtt_parse_file(const char* path, int srt_mode);
+
+////////////////////////////////////////////////////////////////////////////////
+// Push parser. Input may be split anywhere, only the block being received is buffered
+typedef void (*vtt_parser_callback_t)(void* opaque, vtt_block_t* block);
+
+typedef enum {
+    vtt_parser_start = 0,
+    vtt_parser_header = 1,
+    vtt_parser_blocks = 2,
+    vtt_parser_error = 3,
+} vtt_parser_state_t;
+
+#define VTT_PARSER_MIN_CAPACITY 1024
+typedef struct {
+    int srt_mode;
+    vtt_parser_state_t state;
+    utf8_char_t eol; //< line ending, 0 until one has been seen
+    vtt_parser_callback_t callback;
+    void* opaque;
+    utf8_char_t* data; //< start of the current block
+    size_t size, capacity;
+    size_t scan; //< bytes of the current block already known to be in the block
+    vtt_t* in_place; //< see vtt_parse_in_place
+} vtt_parser_t;
+
+/*! \brief Initializes a push parser
+    \param parser Parser to initialize
+    \param srt_mode 0 for WebVTT, 1 for SRT
+    \param callback Called for each complete REGION, STYLE and CUE block. The callback
+           owns the block, it may be linked into a vtt_t with vtt_block_append or
+           released with vtt_block_free_head. NOTE blocks and cues with invalid timings
+           are dropped.
+    \param opaque Passed to callback
+*/
+void vtt_parser_init(vtt_parser_t* parser, int srt_mode, vtt_parser_callback_t callback, void* opaque);
+/*! \brief Parses the next chunk of a document
+    \param parser Parser
+    \param data Chunk, need not be null terminated or end on a line boundary
+    \param size Size of data in bytes
+    \return LIBCAPTION_ERROR if the WebVTT header is invalid or memory could not be allocated
+*/
+libcaption_stauts_t vtt_parser_push(vtt_parser_t* parser, const utf8_char_t* data, size_t size);
+/*! \brief Emits the final block of a document that does not end with a blank line
+
+    The parser is then ready for the next document.
+    \param parser Parser
+    \return LIBCAPTION_ERROR if the document was invalid
+*/
+libcaption_stauts_t vtt_parser_finish(vtt_parser_t* parser);
+/*! \brief Releases the buffer held by parser
+    \param parser Parser
+*/
+void vtt_parser_free(vtt_parser_t* parser);
 
 /*! \brief
     \param
@@ -110,7 +212,20 @@ static inline vtt_block_t* vtt_cue_next(vtt_block_t* block) { return block->next
 /*! \brief
     \param
 */
-static inline utf8_char_t* vtt_block_data(vtt_block_t* block) { return (utf8_char_t*)(block) + sizeof(vtt_block_t); }
+static inline utf8_char_t* vtt_block_data(vtt_block_t* block) { return block->block_text; }
+
+/*! \brief Sets the start and duration of a cue, in seconds and ticks
+    \param cue Cue
+    \param ticks Start time in ticks
+    \param duration_ticks Duration in ticks, negative for no duration
+*/
+static inline void vtt_cue_set_ticks(vtt_block_t* cue, caption_ticks_t ticks, caption_ticks_t duration_ticks)
+{
+    cue->ticks = ticks;
+    cue->duration_ticks = duration_ticks;
+    cue->timestamp = caption_ticks_to_seconds(ticks);
+    cue->duration = 0 > duration_ticks ? -1.0 : caption_ticks_to_seconds(duration_ticks);
+}
 
 /*! \brief
     \param
@@ -134,11 +249,67 @@ int vtt_cue_to_caption_frame(vtt_block_t* cue, caption_frame_t* frame);
     \param
 */
 vtt_block_t* vtt_cue_from_caption_frame(caption_frame_t* frame, vtt_t* vtt);
-/*! \brief
-    \param
+/*! \brief Writes the WEBVTT header followed by every REGION and STYLE block
+    \param writer Destination
+    \param vtt Source
+    \return 1 on success, 0 on error
+*/
+int vtt_write_header(utf8_writer_t* writer, vtt_t* vtt);
+/*! \brief Writes a single block followed by a blank line
+    \param writer Destination
+    \param block REGION, STYLE, NOTE or CUE block
+    \return 1 on success, 0 on error
+*/
+int vtt_write_block(utf8_writer_t* writer, vtt_block_t* block);
+/*! \brief Writes block text, ending with a blank line. Shared with the SRT writer
+*/
+int _vtt_write_text(utf8_writer_t* writer, const utf8_char_t* text);
+/*! \brief Writes a complete WebVTT file
+    \param writer Destination
+    \param vtt Source
+    \return 1 on success, 0 on error
+*/
+int vtt_write(utf8_writer_t* writer, vtt_t* vtt);
+/*! \brief Writes vtt to stdout
+    \param vtt Source
 */
 void vtt_dump(vtt_t* vtt);
 
+////////////////////////////////////////////////////////////////////////////////
+// Streaming output for decoders. A frame becomes a cue once the next frame gives
+// its end time, it is then written and the storage reused, so memory does not grow
+// with the length of the stream
+typedef struct {
+    int srt_mode;
+    utf8_writer_t* writer;
+    unsigned int index; //< cues written so far
+    int pending; //< cue holds a frame waiting for its end time
+    vtt_block_t cue;
+    utf8_char_t text[CAPTION_FRAME_TEXT_BYTES + 2]; //< CRLF per row, plus an extra at the end
+} vtt_sink_t;
+
+/*! \brief Initializes a sink. The WEBVTT header is written immediately in WebVTT mode
+    \param sink Sink to initialize. Must not be moved or copied afterwards
+    \param writer Destination
+    \param srt_mode 0 for WebVTT, 1 for SRT
+    \return 1 on success, 0 on error
+*/
+int vtt_sink_init(vtt_sink_t* sink, utf8_writer_t* writer, int srt_mode);
+/*! \brief Adds a frame returned as LIBCAPTION_READY by the decoder
+
+    The previous frame ends at frame->timestamp and is written as a cue. Produces the
+    same cues as vtt_cue_from_caption_frame followed by vtt_write or srt_write.
+    \param sink Sink
+    \param frame Decoded frame
+    \return 1 on success, 0 on error
+*/
+int vtt_sink_frame(vtt_sink_t* sink, caption_frame_t* frame);
+/*! \brief Writes the last frame, its end time is unknown so it has no duration
+    \param sink Sink, may be reused for another stream once vtt_sink_init is called again
+    \return 1 on success, 0 on error
+*/
+int vtt_sink_finish(vtt_sink_t* sink);
+
 #ifdef __cplusplus
 }
 #endif
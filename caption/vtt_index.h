@@ -0,0 +1,100 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_VTT_INDEX_H
+#define LIBCAPTION_VTT_INDEX_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "vtt.h"
+
+// Cues are stored sorted by start time. The array doubles as an implicit interval
+// tree: entry i is a node whose level is the number of trailing 1 bits in i, and
+// max_end is the largest end time in its subtree
+typedef struct {
+    double start;
+    double end;
+    double max_end;
+    vtt_block_t* cue;
+} vtt_index_entry_t;
+
+typedef struct {
+    size_t size, capacity;
+    vtt_index_entry_t* entry;
+} vtt_index_t;
+
+/*! \brief Builds an index over the cues of vtt
+
+    A cue covers [timestamp, timestamp + duration). Cues with equal start times keep
+    their list order. The index holds pointers to the cues, vtt must outlive it.
+    \param index Index to initialize
+    \param vtt Parsed file
+    \return LIBCAPTION_ERROR if memory could not be allocated
+*/
+libcaption_stauts_t vtt_index_init(vtt_index_t* index, vtt_t* vtt);
+/*! \brief Releases memory held by index. Cues are not freed
+*/
+void vtt_index_free(vtt_index_t* index);
+/*! \brief Finds the cues displayed at timestamp, O(log n + k)
+    \param index Index
+    \param timestamp Time in seconds
+    \param cues Receives matching cues in start time order, may be NULL
+    \param size Number of entries available in cues
+    \return Number of matching cues, may exceed size
+*/
+size_t vtt_index_active(const vtt_index_t* index, double timestamp, vtt_block_t** cues, size_t size);
+/*! \brief Finds the cues that overlap [start, end), O(log n + k)
+    \param index Index
+    \param start Range start in seconds
+    \param end Range end in seconds
+    \param cues Receives matching cues in start time order, may be NULL
+    \param size Number of entries available in cues
+    \return Number of matching cues, may exceed size
+*/
+size_t vtt_index_range(const vtt_index_t* index, double start, double end, vtt_block_t** cues, size_t size);
+/*! \brief Returns the position of the first cue starting at or after timestamp, O(log n)
+
+    Entries from the returned position on are in start time order, so a player can
+    seek with this and then walk index->entry.
+    \param index Index
+    \param timestamp Time in seconds
+    \return Position in index->entry, index->size if every cue starts earlier
+*/
+size_t vtt_index_seek(const vtt_index_t* index, double timestamp);
+/*! \brief Adds a cue to both vtt and the index
+
+    The cue is linked into the cue list of vtt after the last cue that starts at or
+    before it, so the list stays sorted if it was. The position is found in O(log n),
+    the array is shifted and max_end is rebuilt with a single pass.
+    \param index Index built from vtt
+    \param vtt Owner of cue after the call
+    \param cue CUE block that is not in any list, for example from vtt_parser_t
+    \return LIBCAPTION_ERROR if memory could not be allocated, the cue is not added
+*/
+libcaption_stauts_t vtt_index_insert(vtt_index_t* index, vtt_t* vtt, vtt_block_t* cue);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
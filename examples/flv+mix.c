@@ -0,0 +1,149 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "flv.h"
+#include "mixer.h"
+#include "srt.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+vtt_t* load_captions(const char* path)
+{
+    size_t size;
+    vtt_t* vtt = 0;
+    utf8_char_t* data = utf8_load_text_file(path, &size);
+
+    if (data) {
+        size_t len = strlen(path);
+        vtt = (4 <= len && 0 == strcmp(".vtt", path + len - 4)) ? vtt_parse(data, size) : srt_parse(data, size);
+        free(data);
+    }
+
+    return vtt;
+}
+
+int main(int argc, char** argv)
+{
+    flvtag_t tag;
+    flvtag_t* frame;
+    flv_reorder_t reorder;
+    caption_mixer_t mixer;
+    vtt_t* vtt[CAPTION_MIXER_CHANNELS] = { 0 };
+    int cc, has_audio, has_video, arg = 1, mixing = 0;
+    uint32_t num = 0, den = 0;
+
+    if (3 <= argc && 0 == strcmp("-r", argv[1])) {
+        if (!flv_parse_framerate(argv[2], &num, &den)) {
+            fprintf(stderr, "Invalid frame rate %s\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+
+        arg += 2;
+    }
+
+    if (argc < arg + 3) {
+        fprintf(stderr, "Usage: flv+mix [-r rate] input.flv output.flv cc1.srt [cc2.srt [cc3.srt [cc4.srt]]]\n");
+        fprintf(stderr, "Use - to leave a channel empty, files ending in .vtt are read as WebVTT\n");
+        fprintf(stderr, "The rate, for example 25 or 30000/1001, defaults to the onMetaData framerate\n");
+        return EXIT_FAILURE;
+    }
+
+    for (cc = 0; cc < CAPTION_MIXER_CHANNELS && arg + 2 + cc < argc; ++cc) {
+        const char* path = argv[arg + 2 + cc];
+
+        if (0 == strcmp("-", path)) {
+            continue;
+        }
+
+        if (!(vtt[cc] = load_captions(path))) {
+            fprintf(stderr, "Failed to load %s\n", path);
+            return EXIT_FAILURE;
+        }
+
+        fprintf(stderr, "CC%d captions from %s\n", cc + 1, path);
+    }
+
+    FILE* flv = flv_open_read(argv[arg]);
+    FILE* out = flv_open_write(argv[arg + 1]);
+    flvtag_init(&tag);
+    flv_reorder_init(&reorder);
+
+    if (!flv_read_header(flv, &has_audio, &has_video)) {
+        fprintf(stderr, "%s is not an flv file\n", argv[arg]);
+        return EXIT_FAILURE;
+    }
+
+    flv_write_header(out, has_audio, has_video);
+
+    // One pass over the video, every channel is carried in the same SEI. The mixer
+    // paces words across frames, so it is driven in presentation order
+    for (int eof = 0; !eof;) {
+        if (!(eof = !flv_read_tag(flv, &tag))) {
+            if (!num && flvtag_framerate(&tag, &num, &den)) {
+                fprintf(stderr, "Frame rate %u/%u from onMetaData\n", num, den);
+            }
+
+            flv_reorder_push(&reorder, &tag);
+        }
+
+        while ((frame = flv_reorder_frame(&reorder, eof))) {
+            if (!mixing) {
+                if (!num) {
+                    fprintf(stderr, "%s has no framerate in onMetaData, use -r\n", argv[arg]);
+                    return EXIT_FAILURE;
+                }
+
+                caption_mixer_init(&mixer, num, den);
+
+                for (cc = 0; cc < CAPTION_MIXER_CHANNELS; ++cc) {
+                    if (vtt[cc]) {
+                        caption_mixer_add_source(&mixer, cc, vtt[cc]->cue_head, 0);
+                    }
+                }
+
+                mixing = 1;
+            }
+
+            sei_t sei;
+            sei_init(&sei, flvtag_pts(frame));
+            caption_mixer_frame(&mixer, &sei, flvtag_pts_seconds(frame));
+            flvtag_addsei(frame, &sei);
+            sei_free(&sei);
+        }
+
+        flv_reorder_write(&reorder, out);
+    }
+
+    for (cc = 0; cc < CAPTION_MIXER_CHANNELS; ++cc) {
+        if (vtt[cc]) {
+            vtt_free(vtt[cc]);
+        }
+    }
+
+    flv_reorder_free(&reorder);
+    flvtag_free(&tag);
+    flv_close(flv);
+    flv_close(out);
+    return EXIT_SUCCESS;
+}
@@ -31,8 +31,6 @@
 #include <string.h>
 #include <unistd.h>
 
-#define MAX_SRT_SIZE (1 * 1024 * 1024)
-
 // retunes number of bytes read
 // negative number on error
 // retursn 0 on 'not ready' and 'eof'
@@ -68,32 +66,51 @@ size_t fd_read(int fd, uint8_t* data, size_t size, int* eof)
     return retval;
 }
 
-size_t g_srt_size = 0;
-utf8_char_t g_srt_data[MAX_SRT_SIZE];
+// A NUL byte, or the end of the stream, ends each SRT document. Cues are parsed
+// as they arrive so documents of any size can be sent
+#define SRT_READ_SIZE 4096
+size_t g_read_pos = 0, g_read_size = 0;
+utf8_char_t g_read_data[SRT_READ_SIZE];
+vtt_parser_t g_parser;
+srt_t* g_srt = NULL;
+
+void srt_add_cue(void* opaque, srt_cue_t* cue)
+{
+    if (!g_srt) {
+        g_srt = srt_new();
+    }
+
+    vtt_block_append(g_srt, cue);
+}
+
 srt_t* srt_from_fd(int fd)
 {
-    int eof;
-    uint8_t c;
+    int eof = 0;
 
     for (;;) {
-        int ret = fd_read(fd, &c, 1, &eof);
+        if (g_read_pos == g_read_size) {
+            int ret = fd_read(fd, (uint8_t*)g_read_data, SRT_READ_SIZE, &eof);
 
-        if (eof || (1 == ret && 0 == c)) {
-            srt_t* srt = srt_parse(&g_srt_data[0], g_srt_size);
-            g_srt_size = 0;
-            return srt;
+            if (0 >= ret && !eof) {
+                return 0;
+            }
+
+            g_read_pos = 0;
+            g_read_size = 0 < ret ? ret : 0;
         }
 
-        if (1 == ret) {
-            if (g_srt_size >= MAX_SRT_SIZE - 1) {
-                fprintf(stderr, "Warning MAX_SRT_SIZE reached. Clearing buffer\n");
-                g_srt_size = 0;
-            }
+        const utf8_char_t* data = &g_read_data[g_read_pos];
+        const utf8_char_t* nul = memchr(data, 0, g_read_size - g_read_pos);
+        size_t size = nul ? (size_t)(nul - data) : g_read_size - g_read_pos;
+
+        vtt_parser_push(&g_parser, data, size);
+        g_read_pos += nul ? size + 1 : size;
 
-            g_srt_data[g_srt_size] = c;
-            g_srt_size += 1;
-        } else {
-            return 0;
+        if (eof || nul) {
+            vtt_parser_finish(&g_parser);
+            srt_t* srt = g_srt;
+            g_srt = NULL;
+            return srt;
         }
     }
 }
@@ -108,8 +125,11 @@ int main(int argc, char** argv)
     FILE* flv = flv_open_read(argv[1]);
     int fd = open(argv[2], O_RDWR);
     FILE* out = flv_open_write(argv[3]);
+    // Cues are often repeated, and the same cache may be shared by every rendition
+    sei_cache_t* cache = sei_cache_new(SEI_CACHE_DEFAULT_CAPACITY);
 
     flvtag_init(&tag);
+    srt_parser_init(&g_parser, srt_add_cue, NULL);
 
     if (!flv_read_header(flv, &has_audio, &has_video)) {
         fprintf(stderr, "%s is not an flv file\n", argv[1]);
@@ -142,11 +162,11 @@ int main(int argc, char** argv)
             if (next_cue && (offset + next_cue->timestamp) <= timestamp) {
                 fprintf(stderr, "T: %0.02f (%0.02fs):\n%s\n", (offset + next_cue->timestamp), next_cue->duration, srt_cue_data(next_cue));
                 clear_timestamp = (offset + next_cue->timestamp) + next_cue->duration;
-                flvtag_addcaption_text(&tag, srt_cue_data(next_cue));
+                flvtag_addcaption_cache(&tag, cache, srt_cue_data(next_cue));
                 next_cue = next_cue->next;
             } else if (0 <= clear_timestamp && clear_timestamp <= timestamp) {
                 fprintf(stderr, "T: %0.02f: [CAPTIONS CLEARED]\n", timestamp);
-                flvtag_addcaption_text(&tag, NULL);
+                flvtag_addcaption_cache(&tag, cache, NULL);
                 clear_timestamp = -1;
             }
         }
@@ -155,6 +175,12 @@ int main(int argc, char** argv)
     }
 
     srt_free(old_srt);
+    if (g_srt) {
+        srt_free(g_srt);
+    }
+
+    vtt_parser_free(&g_parser);
+    sei_cache_free(cache);
     flvtag_free(&tag);
     flv_close(flv);
     flv_close(out);
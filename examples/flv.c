@@ -22,6 +22,7 @@
 /* THE SOFTWARE.                                                                              */
 /**********************************************************************************************/
 #include "flv.h"
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -402,6 +403,72 @@ int flvtag_addcaption_text(flvtag_t* tag, const utf8_char_t* text)
     return ret;
 }
 
+// Inserts a prerendered SEI ahead of the first slice, captions already in the tag are removed
+static int flvtag_addseinal(flvtag_t* tag, const uint8_t* sei_data, size_t sei_size)
+{
+    if (flvtag_avcpackettype_nalu != flvtag_avcpackettype(tag)) {
+        return 0;
+    }
+
+    flvtag_t new_tag;
+    flvtag_initavc(&new_tag, flvtag_dts(tag), flvtag_cts(tag), flvtag_frametype(tag));
+
+    int written = 0;
+    uint8_t* data = flvtag_payload_data(tag);
+    ssize_t size = flvtag_payload_size(tag);
+
+    while (0 < size) {
+        uint8_t* nalu_data = &data[LENGTH_SIZE];
+        uint8_t nalu_type = nalu_data[0] & 0x1F;
+        uint32_t nalu_size = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+        data += LENGTH_SIZE + nalu_size;
+        size -= LENGTH_SIZE + nalu_size;
+
+        if (6 == nalu_type) {
+            // drop existing captions, keep everything else
+            sei_t old_sei, new_sei;
+            sei_init(&new_sei, 0);
+            sei_parse(&old_sei, nalu_data + 1, nalu_size - 1, 0);
+            sei_cat(&new_sei, &old_sei, 0);
+            flvtag_avcwritesei(&new_tag, &new_sei);
+            sei_free(&old_sei);
+            sei_free(&new_sei);
+            continue;
+        }
+
+        if (!written && 7 != nalu_type && 8 != nalu_type && 9 != nalu_type) {
+            flvtag_avcwritenal(&new_tag, (uint8_t*)sei_data, sei_size);
+            written = 1;
+        }
+
+        flvtag_avcwritenal(&new_tag, nalu_data, nalu_size);
+    }
+
+    // On the off chance we have an empty frame, we still wish to write the sei
+    if (!written) {
+        flvtag_avcwritenal(&new_tag, (uint8_t*)sei_data, sei_size);
+    }
+
+    flvtag_swap(tag, &new_tag);
+    flvtag_free(&new_tag);
+    return 1;
+}
+
+int flvtag_addcaption_cache(flvtag_t* tag, sei_cache_t* cache, const utf8_char_t* text)
+{
+    size_t size;
+    sei_cache_entry_t* entry = sei_cache_text(cache, text);
+
+    if (!entry) {
+        return 0;
+    }
+
+    const uint8_t* data = sei_cache_entry_nalu(entry, &size);
+    int ret = flvtag_addseinal(tag, data, size);
+    sei_cache_entry_release(entry);
+    return ret;
+}
+
 int flvtag_addcaption_scc(flvtag_t* tag, const scc_t* scc)
 {
     sei_t sei;
@@ -411,3 +478,140 @@ int flvtag_addcaption_scc(flvtag_t* tag, const scc_t* scc)
     sei_free(&sei);
     return ret;
 }
+////////////////////////////////////////////////////////////////////////////////
+// 29.97 is stored as 30000 / 1001 so captions are paced without drift
+static void flv_framerate_rational(double fps, uint32_t* num, uint32_t* den)
+{
+    double ntsc = fps * 1001.0;
+
+    if (0.001 > fabs(fps - floor(fps + 0.5))) {
+        (*num) = (uint32_t)floor(fps + 0.5), (*den) = 1;
+    } else if (0.5 > fabs(ntsc - floor(ntsc + 0.5)) && 0 == (uint32_t)floor(ntsc + 0.5) % 1000) {
+        (*num) = (uint32_t)floor(ntsc + 0.5), (*den) = 1001;
+    } else {
+        (*num) = (uint32_t)floor(fps * 1000.0 + 0.5), (*den) = 1000;
+    }
+}
+
+int flvtag_framerate(flvtag_t* tag, uint32_t* num, uint32_t* den)
+{
+    // ECMA array key "framerate" followed by an AMF0 number, a big endian double
+    static const uint8_t key[] = { 0x00, 0x09, 'f', 'r', 'a', 'm', 'e', 'r', 'a', 't', 'e', 0x00 };
+    const uint8_t* data = &tag->data[FLV_TAG_HEADER_SIZE];
+    size_t size = flvtag_size(tag);
+
+    if (flvtag_type_scriptdata != flvtag_type(tag)) {
+        return 0;
+    }
+
+    for (size_t i = 0; i + sizeof(key) + 8 <= size; ++i) {
+        if (0 == memcmp(&data[i], key, sizeof(key))) {
+            uint64_t bits = 0;
+            double fps;
+
+            for (int j = 0; j < 8; ++j) {
+                bits = (bits << 8) | data[i + sizeof(key) + j];
+            }
+
+            memcpy(&fps, &bits, sizeof(fps));
+
+            if (!(0 < fps && 1000 > fps)) {
+                return 0;
+            }
+
+            flv_framerate_rational(fps, num, den);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int flv_parse_framerate(const char* rate, uint32_t* num, uint32_t* den)
+{
+    double fps;
+    unsigned int n, d;
+    char c;
+
+    if (2 == sscanf(rate, "%u/%u%c", &n, &d, &c) && 0 < n && 0 < d) {
+        (*num) = n, (*den) = d;
+        return 1;
+    }
+
+    if (1 != sscanf(rate, "%lf%c", &fps, &c) || !(0 < fps && 1000 > fps)) {
+        return 0;
+    }
+
+    flv_framerate_rational(fps, num, den);
+    return 1;
+}
+////////////////////////////////////////////////////////////////////////////////
+void flv_reorder_init(flv_reorder_t* reorder)
+{
+    memset(reorder, 0, sizeof(flv_reorder_t));
+}
+
+void flv_reorder_free(flv_reorder_t* reorder)
+{
+    for (size_t i = 0; i < FLV_REORDER_MAX_TAGS; ++i) {
+        flvtag_free(&reorder->tag[i]);
+    }
+
+    flv_reorder_init(reorder);
+}
+
+void flv_reorder_push(flv_reorder_t* reorder, flvtag_t* tag)
+{
+    int frame = flvtag_avcpackettype_nalu == flvtag_avcpackettype(tag);
+
+    if (frame && (!reorder->dts_known || reorder->dts < flvtag_dts(tag))) {
+        reorder->dts = flvtag_dts(tag);
+        reorder->dts_known = 1;
+    }
+
+    flvtag_swap(&reorder->tag[reorder->size], tag);
+    reorder->pending[reorder->size] = frame;
+    ++reorder->size;
+}
+
+flvtag_t* flv_reorder_frame(flv_reorder_t* reorder, int eof)
+{
+    size_t i, first = reorder->size;
+
+    for (i = 0; i < reorder->size; ++i) {
+        if (reorder->pending[i] && (first == reorder->size || flvtag_pts(&reorder->tag[i]) < flvtag_pts(&reorder->tag[first]))) {
+            first = i;
+        }
+    }
+
+    if (first == reorder->size) {
+        return NULL;
+    }
+
+    // Frames read later have a dts, and so a pts, at or after the largest dts read.
+    // A full buffer means the input is not reordered the way decoders expect
+    if (!eof && FLV_REORDER_MAX_TAGS > reorder->size && flvtag_pts(&reorder->tag[first]) > reorder->dts) {
+        return NULL;
+    }
+
+    reorder->pending[first] = 0;
+    return &reorder->tag[first];
+}
+
+int flv_reorder_write(flv_reorder_t* reorder, FILE* flv)
+{
+    while (reorder->size && !reorder->pending[0]) {
+        if (!flv_write_tag(flv, &reorder->tag[0])) {
+            return 0;
+        }
+
+        // The written buffer becomes a spare at the end
+        flvtag_t tag = reorder->tag[0];
+        --reorder->size;
+        memmove(&reorder->tag[0], &reorder->tag[1], reorder->size * sizeof(flvtag_t));
+        memmove(&reorder->pending[0], &reorder->pending[1], reorder->size * sizeof(int));
+        reorder->tag[reorder->size] = tag;
+    }
+
+    return 1;
+}
@@ -25,6 +25,7 @@
 #define LIBCAPTION_FLV_H
 
 #include "mpeg.h"
+#include "sei_cache.h"
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
@@ -132,11 +133,41 @@ sei_t* flv_read_sei(FILE* flv, flvtag_t* tag);
 ////////////////////////////////////////////////////////////////////////////////
 int flvtag_initavc(flvtag_t* tag, uint32_t dts, int32_t cts, flvtag_frametype_t type);
 int flvtag_avcwritenal(flvtag_t* tag, uint8_t* data, size_t size);
+int flvtag_addsei(flvtag_t* tag, sei_t* sei);
 int flvtag_addcaption_scc(flvtag_t* tag, const scc_t* scc);
 int flvtag_addcaption_text(flvtag_t* tag, const utf8_char_t* text);
+// Same as flvtag_addcaption_text, but the SEI is rendered once and shared through cache
+int flvtag_addcaption_cache(flvtag_t* tag, sei_cache_t* cache, const utf8_char_t* text);
 ////////////////////////////////////////////////////////////////////////////////
 int flvtag_amfcaption_708(flvtag_t* tag, uint32_t timestamp, sei_message_t* msg);
 ////////////////////////////////////////////////////////////////////////////////
 // This method is expermental, and not currently available on Twitch
 int flvtag_amfcaption_utf8(flvtag_t* tag, uint32_t timestamp, const utf8_char_t* text);
+////////////////////////////////////////////////////////////////////////////////
+// Reads the framerate property of an onMetaData script tag as num / den. Returns 0 if absent
+int flvtag_framerate(flvtag_t* tag, uint32_t* num, uint32_t* den);
+// Parses a frame rate given as 25, 29.97 or 30000/1001. Returns 0 if invalid
+int flv_parse_framerate(const char* rate, uint32_t* num, uint32_t* den);
+////////////////////////////////////////////////////////////////////////////////
+// Video tags are stored in decode order, but captions paced across frames must be
+// added in presentation order. Tags are held until every frame presented before
+// them has been read, then written back in file order
+#define FLV_REORDER_MAX_TAGS 256
+typedef struct {
+    size_t size;
+    int dts_known;
+    uint32_t dts; //< largest video dts read
+    flvtag_t tag[FLV_REORDER_MAX_TAGS]; //< held tags in file order, then spare buffers
+    int pending[FLV_REORDER_MAX_TAGS]; //< video frame not yet returned by flv_reorder_frame
+} flv_reorder_t;
+
+void flv_reorder_init(flv_reorder_t* reorder);
+void flv_reorder_free(flv_reorder_t* reorder);
+// Takes the contents of tag, which receives a spare buffer to read the next tag into
+void flv_reorder_push(flv_reorder_t* reorder, flvtag_t* tag);
+// Returns the next video frame in presentation order, NULL until more tags are read.
+// Pass eof once the input has ended to return the rest
+flvtag_t* flv_reorder_frame(flv_reorder_t* reorder, int eof);
+// Writes held tags from the front until one still waits for flv_reorder_frame
+int flv_reorder_write(flv_reorder_t* reorder, FILE* flv);
 #endif
@@ -56,8 +56,8 @@ int main(int argc, char** argv)
 
             while (0 < size) {
                 size_t nalu_size = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
-                mpeg_bitstream_parse(&mpegbs, &frame, (const uint8_t*)"\0\0\1", 3, STREAM_TYPE_H264, flvtag_dts_seconds(&tag), flvtag_cts_seconds(&tag));
-                mpeg_bitstream_parse(&mpegbs, &frame, &data[LENGTH_SIZE], nalu_size, STREAM_TYPE_H264, flvtag_dts_seconds(&tag), flvtag_cts_seconds(&tag));
+                mpeg_bitstream_parse_ticks(&mpegbs, &frame, (const uint8_t*)"\0\0\1", 3, STREAM_TYPE_H264, caption_ticks_from_ms(flvtag_dts(&tag)), caption_ticks_from_ms(flvtag_cts(&tag)));
+                mpeg_bitstream_parse_ticks(&mpegbs, &frame, &data[LENGTH_SIZE], nalu_size, STREAM_TYPE_H264, caption_ticks_from_ms(flvtag_dts(&tag)), caption_ticks_from_ms(flvtag_cts(&tag)));
                 data += nalu_size + LENGTH_SIZE, size -= nalu_size + LENGTH_SIZE;
                 switch (mpeg_bitstream_status(&mpegbs)) {
                 default:
@@ -76,6 +76,12 @@ int main(int argc, char** argv)
                 } break;
                 } //switch
             }
+
+            // A tag is a complete access unit, its last NALU does not need to wait for the next tag
+            while (LIBCAPTION_READY == mpeg_bitstream_end(&mpegbs, &frame, STREAM_TYPE_H264)) {
+                caption_frame_dump(&frame);
+                srt_cue_from_caption_frame(&frame, srt);
+            }
         }
     }
 
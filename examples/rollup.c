@@ -21,75 +21,132 @@
 /* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
 /* THE SOFTWARE.                                                                              */
 /**********************************************************************************************/
+#include "eia608_encoder.h"
 #include "flv.h"
 #include "mpeg.h"
-#include "srt.h"
 #include "wonderland.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#define SECONDS_PER_LINE 3.0
-void append_caption(const utf8_char_t* data, srt_t* srt)
+// Simulates a live stenographer, sending one word at a time
+#define SECONDS_PER_WORD 0.3
+#define MAX_WORD_SIZE 128
+
+// Copies the next word and a trailing space to word, returns bytes consumed from data
+size_t next_word(const utf8_char_t* data, utf8_char_t* word)
 {
-    int r;
-    ssize_t size = (ssize_t)strlen(data);
-    size_t char_count, line_length = 0, trimmed_length = 0;
-
-    for (r = 0; 0 < size && SCREEN_ROWS > r; ++r) {
-        line_length = utf8_line_length(data);
-        trimmed_length = utf8_trimmed_length(data, line_length);
-        char_count = utf8_char_count(data, trimmed_length);
-
-        // If char_count is greater than one line can display, split it.
-        if (SCREEN_COLS < char_count) {
-            char_count = utf8_wrap_length(data, SCREEN_COLS);
-            line_length = utf8_string_length(data, char_count + 1);
-        }
+    size_t size = 0, skip = 0;
 
-        // fprintf (stderr,"%.*s\n", line_length, data);
-        double timestamp = srt->cue_tail ? srt->cue_tail->timestamp + SECONDS_PER_LINE : 0;
-        srt_cue_t* cue = srt_cue_new(srt, data, line_length);
-        cue->timestamp = timestamp;
-        cue->duration = SECONDS_PER_LINE;
+    while (data[skip] && utf8_char_whitespace(&data[skip])) {
+        ++skip;
+    }
 
-        data += line_length;
-        size -= (ssize_t)line_length;
+    while (data[skip + size] && !utf8_char_whitespace(&data[skip + size]) && MAX_WORD_SIZE - 2 > size) {
+        ++size;
     }
+
+    memcpy(word, &data[skip], size);
+    word[size] = ' ', word[size + 1] = '\0';
+    return skip + size;
 }
 
 int main(int argc, char** argv)
 {
-    int i = 0;
+    int i = 0, arg = 1, pacing = 0;
     flvtag_t tag;
-    srt_t* srt = 0;
+    flvtag_t* frame;
+    flv_reorder_t reorder;
+    double timestamp = 0;
     int has_audio, has_video;
-    FILE* flv = flv_open_read(argv[1]);
-    FILE* out = flv_open_write(argv[2]);
-    flvtag_init(&tag);
+    uint32_t num = 0, den = 0;
+    cea708_pacer_t pacer;
+    eia608_encoder_t encoder;
+    const utf8_char_t* data = wonderland[0];
 
-    srt = srt_new();
+    if (3 <= argc && 0 == strcmp("-r", argv[1])) {
+        if (!flv_parse_framerate(argv[2], &num, &den)) {
+            fprintf(stderr, "Invalid frame rate %s\n", argv[2]);
+            return EXIT_FAILURE;
+        }
 
-    for (i = 0; wonderland[i][0]; ++i) {
-        append_caption(wonderland[i], srt);
+        arg += 2;
     }
 
+    if (argc < arg + 2) {
+        fprintf(stderr, "Usage: rollup [-r rate] input.flv output.flv\n");
+        fprintf(stderr, "The rate, for example 25 or 30000/1001, defaults to the onMetaData framerate\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE* flv = flv_open_read(argv[arg]);
+    FILE* out = flv_open_write(argv[arg + 1]);
+    flvtag_init(&tag);
+    flv_reorder_init(&reorder);
+    eia608_encoder_init(&encoder, eia608_encoder_rollup_3, 0);
+
     if (!flv_read_header(flv, &has_audio, &has_video)) {
-        fprintf(stderr, "%s is not an flv file\n", argv[1]);
+        fprintf(stderr, "%s is not an flv file\n", argv[arg]);
         return EXIT_FAILURE;
     }
 
     flv_write_header(out, has_audio, has_video);
 
-    while (flv_read_tag(flv, &tag)) {
-        if (srt->cue_head && flvtag_avcpackettype_nalu == flvtag_avcpackettype(&tag) && srt->cue_head->timestamp <= flvtag_pts_seconds(&tag)) {
-            fprintf(stderr, "%f %s\n", flvtag_pts_seconds(&tag), srt_cue_data(srt->cue_head));
-            flvtag_addcaption_text(&tag, srt_cue_data(srt->cue_head));
-            srt_cue_free_head(srt);
+    // Words are paced one share of the 608 bandwidth per frame, so frames are
+    // captioned in presentation order
+    for (int eof = 0; !eof;) {
+        if (!(eof = !flv_read_tag(flv, &tag))) {
+            if (!num && flvtag_framerate(&tag, &num, &den)) {
+                fprintf(stderr, "Frame rate %u/%u from onMetaData\n", num, den);
+            }
+
+            flv_reorder_push(&reorder, &tag);
+        }
+
+        while ((frame = flv_reorder_frame(&reorder, eof))) {
+            if (!pacing) {
+                if (!num) {
+                    fprintf(stderr, "%s has no framerate in onMetaData, use -r\n", argv[arg]);
+                    return EXIT_FAILURE;
+                }
+
+                cea708_pacer_init(&pacer, num, den);
+                pacing = 1;
+            }
+
+            if (data && timestamp <= flvtag_pts_seconds(frame)) {
+                utf8_char_t word[MAX_WORD_SIZE];
+                uint16_t cc_data[3 * MAX_WORD_SIZE];
+                data += next_word(data, word);
+
+                // Only the new word is sent, not the whole screen
+                size_t size = eia608_encoder_append_text(&encoder, word, cc_data, 3 * MAX_WORD_SIZE, 0);
+                cea708_pacer_push_cc_data(&pacer, cc_type_ntsc_cc_field_1, cc_data, size);
+                fprintf(stderr, "%f %s(%d words)\n", flvtag_pts_seconds(frame), word, (int)size);
+
+                if (!(*data)) {
+                    data = wonderland[++i][0] ? wonderland[i] : 0;
+                }
+
+                timestamp += SECONDS_PER_WORD;
+            }
+
+            // Every frame carries its share of the 608 bandwidth
+            sei_t sei;
+            cea708_t cea708;
+            sei_init(&sei, flvtag_pts(frame));
+            cea708_pacer_pop(&pacer, &cea708, flvtag_pts_seconds(frame));
+            sei_append_708(&sei, &cea708);
+            flvtag_addsei(frame, &sei);
+            sei_free(&sei);
         }
 
-        flv_write_tag(out, &tag);
+        flv_reorder_write(&reorder, out);
     }
 
+    flv_reorder_free(&reorder);
+    flvtag_free(&tag);
+    flv_close(flv);
+    flv_close(out);
     return EXIT_SUCCESS;
 }
@@ -29,31 +29,33 @@
 
 int main(int argc, char** argv)
 {
-    int i;
-    scc_t* scc = NULL;
-    size_t scc_size = 0;
+    size_t i, j;
+    scc_file_t scc;
     caption_frame_t frame;
     srt_t* srt = 0;
-    utf8_char_t* scc_data_ptr = utf8_load_text_file(argv[1], &scc_size);
-    utf8_char_t* scc_data = scc_data_ptr;
+
+    if (LIBCAPTION_OK != scc_file_load(&scc, argv[1])) {
+        fprintf(stderr, "Failed to load scc '%s'\n", argv[1]);
+        scc_file_free(&scc);
+        return EXIT_FAILURE;
+    }
 
     srt = srt_new();
     caption_frame_init(&frame);
-    scc_data += scc_to_608(&scc, scc_data);
 
-    while (scc->cc_size) {
-        for (i = 0; i < scc->cc_size; ++i) {
-            // eia608_dump (scc->cc_data[i]);
-            if (LIBCAPTION_READY == caption_frame_decode(&frame, scc->cc_data[i], scc->timestamp)) {
+    for (i = 0; i < scc.line_size; ++i) {
+        const uint16_t* cc_data = scc_file_cc_data(&scc, i);
+
+        for (j = 0; j < scc.line[i].size; ++j) {
+            // eia608_dump (cc_data[j]);
+            if (LIBCAPTION_READY == caption_frame_decode(&frame, cc_data[j], scc.line[i].timestamp)) {
                 srt_cue_from_caption_frame(&frame, srt);
             }
         }
-
-        scc_data += scc_to_608(&scc, scc_data);
     }
 
     srt_dump(srt);
     srt_free(srt);
-    free(scc_data_ptr);
+    scc_file_free(&scc);
     return EXIT_SUCCESS;
 }
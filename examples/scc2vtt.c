@@ -34,30 +34,32 @@ int main(int argc, char** argv)
         fprintf(stderr, "Usage: scc2vtt input.scc\n\nOutput: vtt file to stdin\n");
         return 0;
     }
-    int i;
-    scc_t* scc = NULL;
-    size_t scc_size = 0;
+    size_t i, j;
+    scc_file_t scc;
     caption_frame_t frame;
     vtt_t* vtt = 0;
-    utf8_char_t* scc_data_ptr = utf8_load_text_file(argv[1], &scc_size);
-    utf8_char_t* scc_data = scc_data_ptr;
+
+    if (LIBCAPTION_OK != scc_file_load(&scc, argv[1])) {
+        fprintf(stderr, "Failed to load scc '%s'\n", argv[1]);
+        scc_file_free(&scc);
+        return EXIT_FAILURE;
+    }
 
     vtt = vtt_new();
     caption_frame_init(&frame);
-    scc_data += scc_to_608(&scc, scc_data);
 
-    while (scc->cc_size) {
-        for (i = 0; i < scc->cc_size; ++i) {
-            if (LIBCAPTION_READY == caption_frame_decode(&frame, scc->cc_data[i], scc->timestamp)) {
+    for (i = 0; i < scc.line_size; ++i) {
+        const uint16_t* cc_data = scc_file_cc_data(&scc, i);
+
+        for (j = 0; j < scc.line[i].size; ++j) {
+            if (LIBCAPTION_READY == caption_frame_decode(&frame, cc_data[j], scc.line[i].timestamp)) {
                 vtt_cue_from_caption_frame(&frame, vtt);
             }
         }
-
-        scc_data += scc_to_608(&scc, scc_data);
     }
 
     vtt_dump(vtt);
     vtt_free(vtt);
-    free(scc_data_ptr);
+    scc_file_free(&scc);
     return EXIT_SUCCESS;
 }
@@ -21,6 +21,7 @@
 /* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
 /* THE SOFTWARE.                                                                              */
 /**********************************************************************************************/
+#include "coalescer.h"
 #include "srt.h"
 #include "ts.h"
 #include <stdio.h>
@@ -32,8 +33,9 @@ int main(int argc, char** argv)
     const char* path = argv[1];
 
     ts_t ts;
-    srt_t* srt = 0;
-    // srt_cue_t, *cue;
+    vtt_sink_t sink;
+    caption_coalescer_t coalescer;
+    utf8_writer_t writer;
     mpeg_bitstream_t mpegbs;
     caption_frame_t frame;
     uint8_t pkt[TS_PACKET_SIZE];
@@ -41,21 +43,25 @@ int main(int argc, char** argv)
     caption_frame_init(&frame);
     mpeg_bitstream_init(&mpegbs);
 
-    srt = srt_new();
     FILE* file = (0 == strcmp("-", path)) ? freopen(NULL, "rb", stdin) : fopen(path, "rb");
     if(!file) {
         fprintf(stderr,"Failed to open input\n");
         return EXIT_FAILURE;
     }
 
+    // Cues are written as soon as they end
+    fflush(stdout);
+    utf8_writer_init_fd(&writer, 1);
+    srt_sink_init(&sink, &writer);
+    // One cue per screen change rather than per paint-on or roll-up charcter
+    caption_coalescer_init(&coalescer, NULL);
+
     setvbuf(file, 0, _IOFBF, 8192 * TS_PACKET_SIZE);
     // This fread 188 bytes at a time is VERY slow. Need to rewrite that
     while (TS_PACKET_SIZE == fread(&pkt[0], 1, TS_PACKET_SIZE, file)) {
         if (LIBCAPTION_READY == ts_parse_packet(&ts, &pkt[0])) {
-            double dts = ts_dts_seconds(&ts);
-            double cts = ts_cts_seconds(&ts);
             while (ts.size) {
-                size_t bytes_read = mpeg_bitstream_parse(&mpegbs, &frame, ts.data, ts.size, ts.stream_type, dts, cts);
+                size_t bytes_read = mpeg_bitstream_parse_ticks(&mpegbs, &frame, ts.data, ts.size, ts.stream_type, ts.dts, ts.pts - ts.dts);
                 ts.data += bytes_read, ts.size -= bytes_read;
                 switch (mpeg_bitstream_status(&mpegbs)) {
                 default:
@@ -70,7 +76,9 @@ int main(int argc, char** argv)
 
                 case LIBCAPTION_READY: {
                     // caption_frame_dump(&frame);
-                    srt_cue_from_caption_frame(&frame, srt);
+                    if (LIBCAPTION_READY == caption_coalescer_push(&coalescer, &frame)) {
+                        vtt_sink_frame(&sink, caption_coalescer_event(&coalescer));
+                    }
                 } break;
                 } //switch
             } // while
@@ -79,13 +87,17 @@ int main(int argc, char** argv)
 
     // Flush anything left
     while (mpeg_bitstream_flush(&mpegbs, &frame)) {
-        if (mpeg_bitstream_status(&mpegbs)) {
-            srt_cue_from_caption_frame(&frame, srt);
+        if (mpeg_bitstream_status(&mpegbs) && LIBCAPTION_READY == caption_coalescer_push(&coalescer, &frame)) {
+            vtt_sink_frame(&sink, caption_coalescer_event(&coalescer));
         }
     }
 
-    srt_dump(srt);
-    srt_free(srt);
+    if (LIBCAPTION_READY == caption_coalescer_flush(&coalescer)) {
+        vtt_sink_frame(&sink, caption_coalescer_event(&coalescer));
+    }
+
+    vtt_sink_finish(&sink);
+    utf8_writer_free(&writer);
 
     return EXIT_SUCCESS;
 }
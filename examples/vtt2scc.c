@@ -0,0 +1,138 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "scc.h"
+#include "srt.h"
+#include "vtt.h"
+#include "vtt_index.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Pop-on cues are independent, so they are encoded by several threads and
+// written in order once all are done
+typedef struct {
+    vtt_index_t* index;
+    uint16_t** cc_data;
+    size_t* size;
+    size_t first, count;
+} vtt2scc_job_t;
+
+void* vtt2scc_encode(void* arg)
+{
+    vtt2scc_job_t* job = (vtt2scc_job_t*)arg;
+    uint16_t cc_data[SCC_ENCODE_POPON_MAX_WORDS];
+
+    for (size_t i = job->first; i < job->first + job->count; ++i) {
+        size_t size = scc_encode_popon(vtt_block_data(job->index->entry[i].cue), 0, cc_data, SCC_ENCODE_POPON_MAX_WORDS);
+
+        if (NULL != (job->cc_data[i] = (uint16_t*)malloc(size * sizeof(uint16_t)))) {
+            memcpy(job->cc_data[i], cc_data, size * sizeof(uint16_t));
+            job->size[i] = size;
+        }
+    }
+
+    return NULL;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s input.srt|input.vtt [threads]\n\nOutput: scc file to stdout\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    size_t len = strlen(argv[1]);
+    int srt_mode = !(4 <= len && 0 == strcmp(".vtt", argv[1] + len - 4));
+    long threads = 3 <= argc ? atol(argv[2]) : sysconf(_SC_NPROCESSORS_ONLN);
+    vtt_t* vtt = _vtt_parse_file(argv[1], srt_mode);
+    vtt_index_t index;
+
+    if (!vtt || LIBCAPTION_OK != vtt_index_init(&index, vtt)) {
+        fprintf(stderr, "Failed to load '%s'\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    // Every thread gets at least one cue
+    if ((long)index.size < threads) {
+        threads = (long)index.size;
+    }
+
+    if (1 > threads) {
+        threads = 1;
+    }
+
+    uint16_t** cc_data = (uint16_t**)calloc(index.size + 1, sizeof(uint16_t*));
+    size_t* size = (size_t*)calloc(index.size + 1, sizeof(size_t));
+    pthread_t* thread = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    int* created = (int*)calloc(threads, sizeof(int));
+    vtt2scc_job_t* job = (vtt2scc_job_t*)malloc(threads * sizeof(vtt2scc_job_t));
+
+    for (long t = 0; t < threads; ++t) {
+        job[t].index = &index;
+        job[t].cc_data = cc_data;
+        job[t].size = size;
+        job[t].first = index.size * t / threads;
+        job[t].count = index.size * (t + 1) / threads - job[t].first;
+
+        if (0 == pthread_create(&thread[t], NULL, vtt2scc_encode, &job[t])) {
+            created[t] = 1;
+        } else {
+            vtt2scc_encode(&job[t]);
+        }
+    }
+
+    for (long t = 0; t < threads; ++t) {
+        if (created[t]) {
+            pthread_join(thread[t], NULL);
+        }
+    }
+
+    utf8_writer_t writer;
+    scc_writer_t scc;
+    utf8_writer_init_fd(&writer, 1);
+    scc_writer_init(&scc, &writer, 0, 1);
+
+    for (size_t i = 0; i < index.size; ++i) {
+        if (size[i]) {
+            vtt_block_t* cue = index.entry[i].cue;
+            scc_writer_cue(&scc, cue->ticks, cue->ticks + cue->duration_ticks, cc_data[i], size[i]);
+        }
+
+        free(cc_data[i]);
+    }
+
+    scc_writer_finish(&scc);
+    int ok = utf8_writer_free(&writer);
+
+    free(job);
+    free(created);
+    free(thread);
+    free(size);
+    free(cc_data);
+    vtt_index_free(&index);
+    vtt_free(vtt);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
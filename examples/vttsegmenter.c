@@ -22,52 +22,17 @@
 /* THE SOFTWARE.                                                                              */
 /**********************************************************************************************/
 #include "vtt.h"
+#include "vtt_index.h"
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 // #include "sei.h"
 
 #define MAX_VTT_SIZE (10 * 1024 * 1024)
 #define MAX_READ_SIZE 4096
 
-void vtt_write_header(FILE* vttFile)
-{
-    fprintf(vttFile, "WEBVTT\r\n\r\n");
-}
-
-void vtt_write_block(vtt_block_t* block, FILE* vttFile)
-{
-    switch (block->type) {
-    case VTT_REGION:
-        fprintf(vttFile, "REGION\r\n%s\r\n\r\n", vtt_block_data(block));
-        break;
-    case VTT_STYLE:
-        fprintf(vttFile, "STYLE\r\n%s\r\n\r\n", vtt_block_data(block));
-        break;
-    case VTT_NOTE:
-        fprintf(vttFile, "NOTE\r\n%s\r\n\r\n", vtt_block_data(block));
-        break;
-    case VTT_CUE: {
-        if (block->cue_id != NULL) {
-            fprintf(vttFile, "%s\r\n", block->cue_id);
-        }
-
-        int hh1, hh2, mm1, mm2, ss1, ss2, ms1, ms2;
-        vtt_crack_time(block->timestamp, &hh1, &mm1, &ss1, &ms1);
-        vtt_crack_time(block->timestamp + block->duration, &hh2, &mm2, &ss2, &ms2);
-
-        fprintf(vttFile, "%d:%02d:%02d.%03d --> %02d:%02d:%02d.%03d",
-            hh1, mm1, ss1, ms1, hh2, mm2, ss2, ms2);
-
-        if (block->cue_settings != NULL) {
-            printf(" %s", block->cue_settings);
-        }
-
-        fprintf(vttFile, "\r\n%s\r\n\r\n", vtt_block_data(block));
-    } break;
-    }
-}
-
 /**
  * vttsegmenter filename.vtt segment_size duration output_pattern_%05d.vtt
  */
@@ -87,18 +52,20 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    size_t size;
-    utf8_char_t* data = utf8_load_text_file(argv[1], &size);
-    if (data == NULL) {
-        fprintf(stderr, "Failed to load input file\n");
+    vtt_t* vtt = vtt_parse_file(argv[1]);
+    if (vtt == NULL) {
+        fprintf(stderr, "Failed to load vtt\n");
         return 1;
     }
-    vtt_t* vtt = vtt_parse(data, size);
-    if (vtt == NULL) {
-        fprintf(stderr, "Failed to parse vtt\n");
+
+    // Each segment only visits the cues that overlap it
+    vtt_index_t index;
+    if (LIBCAPTION_OK != vtt_index_init(&index, vtt)) {
+        fprintf(stderr, "Failed to index vtt\n");
         return 1;
     }
 
+    vtt_block_t** cues = (vtt_block_t**)malloc((index.size + 1) * sizeof(vtt_block_t*));
     char filename[1024];
 
     for (int i = 0; i * segment_size < duration; i++) {
@@ -107,38 +74,32 @@ int main(int argc, char** argv)
             return 1;
         }
 
-        FILE* outputFile = fopen(filename, "w");
-        if (outputFile == NULL) {
-            fprintf(stderr, "Failed to open output file for reading: '%s'\n", filename);
+        int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            fprintf(stderr, "Failed to open output file for writing: '%s'\n", filename);
             return 1;
         }
 
-        vtt_write_header(outputFile);
-        vtt_block_t* region = vtt->region_head;
-        while (region != NULL) {
-            vtt_write_block(region, outputFile);
-            region = region->next;
-        }
-
-        vtt_block_t* style = vtt->style_head;
-        while (style != NULL) {
-            vtt_write_block(style, outputFile);
-            style = style->next;
-        }
+        utf8_writer_t writer;
+        utf8_writer_init_fd(&writer, fd);
+        vtt_write_header(&writer, vtt);
 
         double segment_start = i * segment_size;
         double segment_end = (i + 1) * segment_size;
 
-        vtt_block_t* cue = vtt->cue_head;
-        while (cue != NULL) {
-            if ((cue->timestamp < segment_end) && ((cue->timestamp + cue->duration) > segment_start)) {
-                vtt_write_block(cue, outputFile);
-            }
-            cue = cue->next;
+        size_t count = vtt_index_range(&index, segment_start, segment_end, cues, index.size);
+        for (size_t j = 0; j < count; j++) {
+            vtt_write_block(&writer, cues[j]);
+        }
+
+        if (!utf8_writer_free(&writer)) {
+            fprintf(stderr, "Failed to write '%s'\n", filename);
         }
 
-        fclose(outputFile);
+        close(fd);
     }
 
+    free(cues);
+    vtt_index_free(&index);
     vtt_free(vtt);
 }
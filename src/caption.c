@@ -28,6 +28,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 ////////////////////////////////////////////////////////////////////////////////
 void caption_frame_buffer_clear(caption_frame_buffer_t* buff)
 {
@@ -36,8 +40,9 @@ void caption_frame_buffer_clear(caption_frame_buffer_t* buff)
 
 void caption_frame_state_clear(caption_frame_t* frame)
 {
-    frame->write = 0;
+    frame->write = caption_frame_write_none;
     frame->timestamp = -1;
+    frame->ticks = -1;
     frame->state = (caption_frame_state_t){ 0, 0, 0, SCREEN_ROWS - 1, 0, 0 }; // clear global state
 }
 
@@ -59,14 +64,26 @@ static caption_frame_cell_t* frame_buffer_cell(caption_frame_buffer_t* buff, int
     return &buff->cell[row][col];
 }
 
-uint16_t _eia608_from_utf8(const char* s); // function is in eia608.c.re2c
+static caption_frame_buffer_t* frame_write_buffer(caption_frame_t* frame)
+{
+    switch (frame->write) {
+    case caption_frame_write_front:
+        return &frame->front;
+    case caption_frame_write_back:
+        return &frame->back;
+    default:
+        return 0;
+    }
+}
+
+uint16_t _eia608_from_utf8(const char* s); // function is in eia608_from_utf8.c
 int caption_frame_write_char(caption_frame_t* frame, int row, int col, eia608_style_t style, int underline, const char* c)
 {
     if (!frame->write || !_eia608_from_utf8(c)) {
         return 0;
     }
 
-    caption_frame_cell_t* cell = frame_buffer_cell(frame->write, row, col);
+    caption_frame_cell_t* cell = frame_buffer_cell(frame_write_buffer(frame), row, col);
 
     if (cell && utf8_char_copy(&cell->data[0], c)) {
         cell->uln = underline;
@@ -120,13 +137,13 @@ libcaption_stauts_t caption_frame_carriage_return(caption_frame_t* frame)
     }
 
     for (; r < SCREEN_ROWS; ++r) {
-        uint8_t* dst = (uint8_t*)frame_buffer_cell(frame->write, r - 1, 0);
-        uint8_t* src = (uint8_t*)frame_buffer_cell(frame->write, r - 0, 0);
+        uint8_t* dst = (uint8_t*)frame_buffer_cell(frame_write_buffer(frame), r - 1, 0);
+        uint8_t* src = (uint8_t*)frame_buffer_cell(frame_write_buffer(frame), r - 0, 0);
         memcpy(dst, src, sizeof(caption_frame_cell_t) * SCREEN_COLS);
     }
 
     frame->state.col = 0;
-    caption_frame_cell_t* cell = frame_buffer_cell(frame->write, SCREEN_ROWS - 1, 0);
+    caption_frame_cell_t* cell = frame_buffer_cell(frame_write_buffer(frame), SCREEN_ROWS - 1, 0);
     memset(cell, 0, sizeof(caption_frame_cell_t) * SCREEN_COLS);
     return LIBCAPTION_OK;
 }
@@ -149,68 +166,62 @@ libcaption_stauts_t caption_frame_end(caption_frame_t* frame)
     return LIBCAPTION_READY;
 }
 
-libcaption_stauts_t caption_frame_decode_preamble(caption_frame_t* frame, uint16_t cc_data)
+libcaption_stauts_t caption_frame_decode_preamble(caption_frame_t* frame, eia608_decoded_t word)
 {
-    eia608_style_t sty;
-    int row, col, chn, uln;
-
-    if (eia608_parse_preamble(cc_data, &row, &col, &sty, &chn, &uln)) {
-        frame->state.row = row;
-        frame->state.col = col;
-        frame->state.sty = sty;
-        frame->state.uln = uln;
+    // Row code 1 is unassigned, ignored like any other unhandled code so the cursor is always on screen
+    if (0 > eia608_decoded_row(word)) {
+        return LIBCAPTION_OK;
     }
 
+    frame->state.row = eia608_decoded_row(word);
+    frame->state.col = eia608_decoded_col(word);
+    frame->state.sty = eia608_decoded_style(word);
+    frame->state.uln = eia608_decoded_underline(word);
     return LIBCAPTION_OK;
 }
 
-libcaption_stauts_t caption_frame_decode_midrowchange(caption_frame_t* frame, uint16_t cc_data)
+libcaption_stauts_t caption_frame_decode_midrowchange(caption_frame_t* frame, eia608_decoded_t word)
 {
-    eia608_style_t sty;
-    int chn, unl;
+    frame->state.sty = eia608_decoded_style(word);
+    frame->state.uln = eia608_decoded_underline(word);
+    return LIBCAPTION_OK;
+}
 
-    if (eia608_parse_midrowchange(cc_data, &chn, &sty, &unl)) {
-        frame->state.sty = sty;
-        frame->state.uln = unl;
-    }
+// caption_frame_write_char rejects the empty string, so erased cells are cleared here
+static void caption_frame_clear_char(caption_frame_t* frame, int row, int col)
+{
+    caption_frame_cell_t* cell = frame_buffer_cell(frame_write_buffer(frame), row, col);
 
-    return LIBCAPTION_OK;
+    if (cell) {
+        memset(cell, 0, sizeof(caption_frame_cell_t));
+    }
 }
 
 libcaption_stauts_t caption_frame_backspace(caption_frame_t* frame)
 {
     // do not reverse wrap (tw 28:20)
     frame->state.col = (0 < frame->state.col) ? (frame->state.col - 1) : 0;
-    caption_frame_write_char(frame, frame->state.row, frame->state.col, eia608_style_white, 0, EIA608_CHAR_NULL);
+    caption_frame_clear_char(frame, frame->state.row, frame->state.col);
     return LIBCAPTION_READY;
 }
 
 libcaption_stauts_t caption_frame_delete_to_end_of_row(caption_frame_t* frame)
 {
     int c;
-    if (frame->write) {
-        for (c = frame->state.col; c < SCREEN_COLS; ++c) {
-            caption_frame_write_char(frame, frame->state.row, c, eia608_style_white, 0, EIA608_CHAR_NULL);
-        }
+    for (c = frame->state.col; c < SCREEN_COLS; ++c) {
+        caption_frame_clear_char(frame, frame->state.row, c);
     }
 
-    // TODO test this and replace loop
-    //  uint8_t* dst = (uint8_t*)frame_buffer_cell(frame->write, frame->state.row, frame->state.col);
-    //  memset(dst,0,sizeof(caption_frame_cell_t) * (SCREEN_COLS - frame->state.col - 1))
-
     return LIBCAPTION_READY;
 }
 
-libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, uint16_t cc_data)
+libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, eia608_control_t cmd)
 {
-    int cc;
-    eia608_control_t cmd = eia608_parse_control(cc_data, &cc);
-
     switch (cmd) {
     // PAINT ON
     case eia608_control_resume_direct_captioning:
         frame->state.rup = 0;
-        frame->write = &frame->front;
+        frame->write = caption_frame_write_front;
         return LIBCAPTION_OK;
 
     case eia608_control_erase_display_memory:
@@ -220,17 +231,17 @@ libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, uint16_
     // ROLL-UP
     case eia608_control_roll_up_2:
         frame->state.rup = 1;
-        frame->write = &frame->front;
+        frame->write = caption_frame_write_front;
         return LIBCAPTION_OK;
 
     case eia608_control_roll_up_3:
         frame->state.rup = 2;
-        frame->write = &frame->front;
+        frame->write = caption_frame_write_front;
         return LIBCAPTION_OK;
 
     case eia608_control_roll_up_4:
         frame->state.rup = 3;
-        frame->write = &frame->front;
+        frame->write = caption_frame_write_front;
         return LIBCAPTION_OK;
 
     case eia608_control_carriage_return:
@@ -245,7 +256,7 @@ libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, uint16_
     // POP ON
     case eia608_control_resume_caption_loading:
         frame->state.rup = 0;
-        frame->write = &frame->back;
+        frame->write = caption_frame_write_back;
         return LIBCAPTION_OK;
 
     case eia608_control_erase_non_displayed_memory:
@@ -273,47 +284,62 @@ libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, uint16_
     }
 }
 
-libcaption_stauts_t caption_frame_decode_text(caption_frame_t* frame, uint16_t cc_data)
+// Charcters from eia608_char_map are always encodable, so unlike
+// caption_frame_write_char there is no need to validate them
+static void caption_frame_decode_char(caption_frame_t* frame, int idx)
 {
-    int chan;
-    char char1[5], char2[5];
-    size_t chars = eia608_to_utf8(cc_data, &chan, &char1[0], &char2[0]);
-
-    if (eia608_is_westeu(cc_data)) {
-        // Extended charcters replace the previous charcter for back compatibility
-        caption_frame_backspace(frame);
-    }
+    caption_frame_cell_t* cell = frame_buffer_cell(frame_write_buffer(frame), frame->state.row, frame->state.col);
 
-    if (0 < chars) {
-        eia608_write_char(frame, char1);
+    if (cell && 0 <= idx && EIA608_CHAR_COUNT > idx) {
+        utf8_char_copy(&cell->data[0], eia608_char_map[idx]);
+        cell->uln = frame->state.uln;
+        cell->sty = frame->state.sty;
+        frame->state.col += 1;
     }
+}
 
-    if (1 < chars) {
-        eia608_write_char(frame, char2);
+libcaption_stauts_t caption_frame_decode_text(caption_frame_t* frame, eia608_decoded_t word)
+{
+    if (eia608_class_westeu == eia608_decoded_class(word)) {
+        // Extended charcters replace the previous charcter for back compatibility
+        caption_frame_backspace(frame);
     }
 
+    caption_frame_decode_char(frame, eia608_decoded_char1(word));
+    caption_frame_decode_char(frame, eia608_decoded_char2(word));
     return LIBCAPTION_OK;
 }
 
 libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_data, double timestamp)
 {
-    if (!eia608_parity_varify(cc_data)) {
+    return caption_frame_decode_ticks(frame, cc_data, caption_ticks_from_seconds(timestamp));
+}
+
+libcaption_stauts_t caption_frame_decode_ticks(caption_frame_t* frame, uint16_t cc_data, caption_ticks_t ticks)
+{
+    eia608_decoded_t word = eia608_decode(cc_data);
+
+    switch (eia608_decoded_class(word)) {
+    case eia608_class_parity_error:
         frame->status = LIBCAPTION_ERROR;
         return frame->status;
-    }
 
-    if (eia608_is_padding(cc_data)) {
+    case eia608_class_padding:
         frame->status = LIBCAPTION_OK;
         return frame->status;
+
+    default:
+        break;
     }
 
-    if (0 > frame->timestamp || frame->timestamp == timestamp || LIBCAPTION_READY == frame->status) {
-        frame->timestamp = timestamp;
+    if (0 > frame->ticks || frame->ticks == ticks || LIBCAPTION_READY == frame->status) {
+        frame->ticks = ticks;
+        frame->timestamp = caption_ticks_to_seconds(ticks);
         frame->status = LIBCAPTION_OK;
     }
 
     // skip duplicate controll commands. We also skip duplicate specialna to match the behaviour of iOS/vlc
-    if ((eia608_is_specialna(cc_data) || eia608_is_control(cc_data)) && cc_data == frame->state.cc_data) {
+    if (eia608_decoded_dedupe(word) && cc_data == frame->state.cc_data) {
         frame->status = LIBCAPTION_OK;
         return frame->status;
     }
@@ -322,39 +348,130 @@ libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_dat
 
     if (frame->xds.state) {
         frame->status = xds_decode(&frame->xds, cc_data);
-    } else if (eia608_is_xds(cc_data)) {
+        return frame->status;
+    }
+
+    switch (eia608_decoded_class(word)) {
+    case eia608_class_xds:
         frame->status = xds_decode(&frame->xds, cc_data);
-    } else if (eia608_is_control(cc_data)) {
-        frame->status = caption_frame_decode_control(frame, cc_data);
-    } else if (eia608_is_basicna(cc_data) || eia608_is_specialna(cc_data) || eia608_is_westeu(cc_data)) {
+        break;
 
+    case eia608_class_control:
+        frame->status = caption_frame_decode_control(frame, eia608_decoded_control(word));
+        break;
+
+    case eia608_class_basicna:
+    case eia608_class_specialna:
+    case eia608_class_westeu:
         // Don't decode text if we dont know what mode we are in.
         if (!frame->write) {
             frame->status = LIBCAPTION_OK;
             return frame->status;
         }
 
-        frame->status = caption_frame_decode_text(frame, cc_data);
+        frame->status = caption_frame_decode_text(frame, word);
 
         // If we are in paint on mode, display immiditally
         if (LIBCAPTION_OK == frame->status && caption_frame_painton(frame)) {
             frame->status = LIBCAPTION_READY;
         }
-    } else if (eia608_is_preamble(cc_data)) {
-        frame->status = caption_frame_decode_preamble(frame, cc_data);
-    } else if (eia608_is_midrowchange(cc_data)) {
-        frame->status = caption_frame_decode_midrowchange(frame, cc_data);
+        break;
+
+    case eia608_class_preamble:
+        frame->status = caption_frame_decode_preamble(frame, word);
+        break;
+
+    case eia608_class_midrowchange:
+        frame->status = caption_frame_decode_midrowchange(frame, word);
+        break;
+
+    default:
+        break;
     }
 
     return frame->status;
 }
 
+
+////////////////////////////////////////////////////////////////////////////////
+// Returns bitmasks of the padding and bad parity words in the next 8 words
+#if defined(__SSE2__) || defined(_M_X64)
+static inline void caption_frame_scan_block(const uint16_t* cc_data, int* padding, int* error)
+{
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i x = _mm_loadu_si128((const __m128i*)cc_data);
+    // fold each byte down to its parity in bit 0, 16 bit shifts leak only into bits we ignore
+    __m128i t = _mm_xor_si128(x, _mm_and_si128(_mm_srli_epi16(x, 4), nibble));
+    t = _mm_xor_si128(t, _mm_srli_epi16(t, 2));
+    t = _mm_xor_si128(t, _mm_srli_epi16(t, 1));
+    t = _mm_and_si128(t, _mm_set1_epi16(0x0101));
+    // every byte must have odd parity
+    int valid = _mm_movemask_epi8(_mm_cmpeq_epi16(t, _mm_set1_epi16(0x0101)));
+    int pad = _mm_movemask_epi8(_mm_cmpeq_epi16(x, _mm_set1_epi16((short)0x8080)));
+    (*padding) = (*error) = 0;
+
+    for (int i = 0; i < 8; ++i) {
+        (*padding) |= ((pad >> (2 * i)) & 1) << i;
+        (*error) |= ((~valid >> (2 * i)) & 1) << i;
+    }
+}
+#else
+static inline void caption_frame_scan_block(const uint16_t* cc_data, int* padding, int* error)
+{
+    (*padding) = (*error) = 0;
+
+    for (int i = 0; i < 8; ++i) {
+        eia608_class_t cls = eia608_decoded_class(eia608_decode(cc_data[i]));
+        (*padding) |= (eia608_class_padding == cls) << i;
+        (*error) |= (eia608_class_parity_error == cls) << i;
+    }
+}
+#endif
+
+libcaption_stauts_t caption_frame_decode_block(caption_frame_t* frame, const uint16_t* cc_data, size_t size, double timestamp)
+{
+    return caption_frame_decode_block_ticks(frame, cc_data, size, caption_ticks_from_seconds(timestamp));
+}
+
+libcaption_stauts_t caption_frame_decode_block_ticks(caption_frame_t* frame, const uint16_t* cc_data, size_t size, caption_ticks_t ticks)
+{
+    size_t i = 0;
+    int padding, error;
+    libcaption_stauts_t status = LIBCAPTION_OK;
+
+    for (; i + 8 <= size; i += 8) {
+        caption_frame_scan_block(&cc_data[i], &padding, &error);
+
+        if (0xFF == padding) {
+            frame->status = LIBCAPTION_OK;
+            continue;
+        }
+
+        for (int j = 0; j < 8; ++j) {
+            if (padding & (1 << j)) {
+                frame->status = LIBCAPTION_OK;
+            } else if (error & (1 << j)) {
+                frame->status = LIBCAPTION_ERROR;
+                status = LIBCAPTION_ERROR;
+            } else {
+                status = libcaption_status_update(status, caption_frame_decode_ticks(frame, cc_data[i + j], ticks));
+            }
+        }
+    }
+
+    for (; i < size; ++i) {
+        status = libcaption_status_update(status, caption_frame_decode_ticks(frame, cc_data[i], ticks));
+    }
+
+    return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int caption_frame_from_text(caption_frame_t* frame, const utf8_char_t* data)
 {
     ssize_t size = (ssize_t)strlen(data);
     caption_frame_init(frame);
-    frame->write = &frame->back;
+    frame->write = caption_frame_write_back;
 
     for (size_t r = 0; (*data) && size && r < SCREEN_ROWS;) {
         // skip whitespace at start of line
@@ -459,3 +576,126 @@ void caption_frame_dump(caption_frame_t* frame)
     caption_frame_dump_buffer(frame, buff);
     fprintf(stderr, "%s\n", buff);
 }
+////////////////////////////////////////////////////////////////////////////////
+// Snapshot layout, all multibyte values are little endian:
+//   magic[4] ticks[8] status[1] write[1]
+//   state: flags[1] row[1] col[1] cc_data[2]
+//   xds: state[4] class_code[1] type[1] size[4] content[32] checksum[1]
+//   front[SCREEN_ROWS * SCREEN_COLS] back[SCREEN_ROWS * SCREEN_COLS]
+// Each cell is stored as flags[1] data[4]
+static const uint8_t _caption_frame_snapshot_magic[4] = { 'l', 'c', 'f', 2 };
+
+static uint8_t* snapshot_put(uint8_t* data, uint64_t value, int bytes)
+{
+    for (int i = 0; i < bytes; ++i, value >>= 8) {
+        data[i] = value & 0xFF;
+    }
+
+    return data + bytes;
+}
+
+static const uint8_t* snapshot_get(const uint8_t* data, uint64_t* value, int bytes)
+{
+    (*value) = 0;
+    for (int i = bytes - 1; 0 <= i; --i) {
+        (*value) = ((*value) << 8) | data[i];
+    }
+
+    return data + bytes;
+}
+
+static uint8_t* snapshot_put_buffer(uint8_t* data, const caption_frame_buffer_t* buff)
+{
+    for (int r = 0; r < SCREEN_ROWS; ++r) {
+        for (int c = 0; c < SCREEN_COLS; ++c) {
+            const caption_frame_cell_t* cell = &buff->cell[r][c];
+            data[0] = cell->uln | (cell->sty << 1);
+            memcpy(&data[1], &cell->data[0], 4);
+            data += CAPTION_FRAME_SNAPSHOT_CELL_SIZE;
+        }
+    }
+
+    return data;
+}
+
+static const uint8_t* snapshot_get_buffer(const uint8_t* data, caption_frame_buffer_t* buff)
+{
+    for (int r = 0; r < SCREEN_ROWS; ++r) {
+        for (int c = 0; c < SCREEN_COLS; ++c) {
+            caption_frame_cell_t* cell = &buff->cell[r][c];
+            memset(cell, 0, sizeof(caption_frame_cell_t));
+            cell->uln = data[0] & 0x01;
+            cell->sty = (data[0] >> 1) & 0x07;
+            memcpy(&cell->data[0], &data[1], 4);
+            data += CAPTION_FRAME_SNAPSHOT_CELL_SIZE;
+        }
+    }
+
+    return data;
+}
+
+size_t caption_frame_snapshot(const caption_frame_t* frame, uint8_t* data, size_t size)
+{
+    uint8_t* pos = data;
+
+    if (CAPTION_FRAME_SNAPSHOT_SIZE > size) {
+        return 0;
+    }
+
+    memcpy(pos, _caption_frame_snapshot_magic, 4), pos += 4;
+    pos = snapshot_put(pos, (uint64_t)frame->ticks, 8);
+    pos = snapshot_put(pos, frame->status, 1);
+    pos = snapshot_put(pos, frame->write, 1);
+    pos = snapshot_put(pos, frame->state.uln | (frame->state.sty << 1) | (frame->state.rup << 4), 1);
+    pos = snapshot_put(pos, (uint8_t)frame->state.row, 1);
+    pos = snapshot_put(pos, (uint8_t)frame->state.col, 1);
+    pos = snapshot_put(pos, frame->state.cc_data, 2);
+    pos = snapshot_put(pos, (uint32_t)frame->xds.state, 4);
+    pos = snapshot_put(pos, frame->xds.class_code, 1);
+    pos = snapshot_put(pos, frame->xds.type, 1);
+    pos = snapshot_put(pos, frame->xds.size, 4);
+    memcpy(pos, &frame->xds.content[0], 32), pos += 32;
+    pos = snapshot_put(pos, frame->xds.checksum, 1);
+    pos = snapshot_put_buffer(pos, &frame->front);
+    pos = snapshot_put_buffer(pos, &frame->back);
+    return pos - data;
+}
+
+libcaption_stauts_t caption_frame_restore(caption_frame_t* frame, const uint8_t* data, size_t size)
+{
+    uint64_t value;
+
+    if (CAPTION_FRAME_SNAPSHOT_SIZE > size || 0 != memcmp(data, _caption_frame_snapshot_magic, 4)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    // validate before touching the frame. xds_decode appends two bytes at a time while size < 32
+    uint32_t xds_size = (uint32_t)data[25] | ((uint32_t)data[26] << 8) | ((uint32_t)data[27] << 16) | ((uint32_t)data[28] << 24);
+    if (LIBCAPTION_READY < data[12] || caption_frame_write_back < data[13]
+        || 0 > (int8_t)data[15] || SCREEN_ROWS <= (int8_t)data[15] || 0 > (int8_t)data[16] || SCREEN_COLS < (int8_t)data[16]
+        || 32 < xds_size || (xds_size & 1)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    data += 4;
+    data = snapshot_get(data, &value, 8), frame->ticks = (caption_ticks_t)value;
+    frame->timestamp = 0 > frame->ticks ? -1 : caption_ticks_to_seconds(frame->ticks);
+    data = snapshot_get(data, &value, 1), frame->status = (libcaption_stauts_t)value;
+    data = snapshot_get(data, &value, 1), frame->write = (caption_frame_write_t)value;
+    data = snapshot_get(data, &value, 1);
+    frame->state.uln = value & 0x01;
+    frame->state.sty = (value >> 1) & 0x07;
+    frame->state.rup = (value >> 4) & 0x03;
+    data = snapshot_get(data, &value, 1), frame->state.row = (int8_t)value;
+    data = snapshot_get(data, &value, 1), frame->state.col = (int8_t)value;
+    data = snapshot_get(data, &value, 2), frame->state.cc_data = (uint16_t)value;
+    data = snapshot_get(data, &value, 4), frame->xds.state = (int)(int32_t)value;
+    data = snapshot_get(data, &value, 1), frame->xds.class_code = (uint8_t)value;
+    data = snapshot_get(data, &value, 1), frame->xds.type = (uint8_t)value;
+    data = snapshot_get(data, &value, 4), frame->xds.size = (uint32_t)value;
+    memcpy(&frame->xds.content[0], data, 32), data += 32;
+    data = snapshot_get(data, &value, 1), frame->xds.checksum = (uint8_t)value;
+    data = snapshot_get_buffer(data, &frame->front);
+    data = snapshot_get_buffer(data, &frame->back);
+    return LIBCAPTION_OK;
+}
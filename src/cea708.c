@@ -52,6 +52,7 @@ int cea708_init(cea708_t* cea708, double timestamp)
     cea708->user_data.em_data = 0xFF;
     cea708->user_data.cc_count = 0;
     cea708->timestamp = timestamp;
+    cea708->ticks = caption_ticks_from_seconds(timestamp);
     return 1;
 }
 
@@ -155,7 +156,7 @@ libcaption_stauts_t cea708_parse_h262(const uint8_t* data, size_t size, cea708_t
 
 int cea708_add_cc_data(cea708_t* cea708, int valid, cea708_cc_type_t type, uint16_t cc_data)
 {
-    if (31 <= cea708->user_data.cc_count) {
+    if (CEA708_MAX_CC_COUNT <= cea708->user_data.cc_count) {
         return 0;
     }
 
@@ -262,22 +263,168 @@ void cea708_dump(cea708_t* cea708)
     }
 }
 
-libcaption_stauts_t cea708_to_caption_frame(caption_frame_t* frame, cea708_t* cea708)
+int cea708_is_padding(cea708_t* cea708)
 {
     int i, count = cea708_cc_count(&cea708->user_data);
-    libcaption_stauts_t status = LIBCAPTION_OK;
 
-    if (GA94 == cea708->user_identifier) {
-        for (i = 0; i < count; ++i) {
-            int valid;
-            cea708_cc_type_t type;
-            uint16_t cc_data = cea708_cc_data(&cea708->user_data, i, &valid, &type);
+    if (GA94 != cea708->user_identifier) {
+        return 1;
+    }
+
+    for (i = 0; i < count; ++i) {
+        cc_data_t* cc = &cea708->user_data.cc_data[i];
+
+        if (cc->cc_valid && cc_type_ntsc_cc_field_1 == cc->cc_type && !eia608_is_padding(cc->cc_data)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
 
-            if (valid && cc_type_ntsc_cc_field_1 == type) {
-                status = libcaption_status_update(status, caption_frame_decode(frame, cc_data, cea708->timestamp));
+libcaption_stauts_t cea708_to_caption_frame(caption_frame_t* frame, cea708_t* cea708)
+{
+    int i, size = 0, count = cea708_cc_count(&cea708->user_data);
+    uint16_t cc_data[32];
+
+    if (GA94 != cea708->user_identifier) {
+        return LIBCAPTION_OK;
+    }
+
+    for (i = 0; i < count; ++i) {
+        int valid;
+        cea708_cc_type_t type;
+        uint16_t cc = cea708_cc_data(&cea708->user_data, i, &valid, &type);
+
+        if (valid && cc_type_ntsc_cc_field_1 == type) {
+            cc_data[size++] = cc;
+        }
+    }
+
+    return caption_frame_decode_block_ticks(frame, &cc_data[0], size, cea708->ticks);
+}
+////////////////////////////////////////////////////////////////////////////////
+// Pacing. Each field carries 30000 / 1001 words per second
+#define CEA708_PACER_WORDS_NUM 30000
+#define CEA708_PACER_WORDS_DEN 1001
+
+void cea708_pacer_init(cea708_pacer_t* pacer, uint32_t num, uint32_t den)
+{
+    memset(pacer, 0, sizeof(cea708_pacer_t));
+    pacer->num = CEA708_PACER_WORDS_NUM, pacer->den = CEA708_PACER_WORDS_DEN;
+    cea708_pacer_set_rate(pacer, num, den);
+}
+
+void cea708_pacer_set_rate(cea708_pacer_t* pacer, uint32_t num, uint32_t den)
+{
+    if (num && den) {
+        // keep the fraction of a word already earned
+        pacer->credit = pacer->credit * num / pacer->num;
+        pacer->num = num, pacer->den = den;
+    }
+}
+
+// Walks cc_data as it would be queued, returning the number of words required.
+// If commit is set the words are queued
+static size_t cea708_pacer_queue_walk(cea708_pacer_queue_t* queue, const uint16_t* cc_data, size_t size, int commit)
+{
+    size_t i, count = 0;
+    int gap = queue->gap;
+    uint16_t last = queue->last;
+
+    for (i = 0; i < size; ++i) {
+        if (eia608_is_padding(cc_data[i])) {
+            gap = 1;
+            continue;
+        }
+
+        // Identical control codes separated by padding are two commands, not one doubled command
+        if (gap && last == cc_data[i] && eia608_decoded_dedupe(eia608_decode(cc_data[i]))) {
+            if (commit) {
+                queue->cc_data[(queue->front + queue->size++) % CEA708_PACER_QUEUE_SIZE] = 0x8080;
             }
+
+            ++count;
+        }
+
+        if (commit) {
+            queue->cc_data[(queue->front + queue->size++) % CEA708_PACER_QUEUE_SIZE] = cc_data[i];
+        }
+
+        last = cc_data[i], gap = 0, ++count;
+    }
+
+    if (commit) {
+        queue->last = last, queue->gap = gap;
+    }
+
+    return count;
+}
+
+libcaption_stauts_t cea708_pacer_push_cc_data(cea708_pacer_t* pacer, cea708_cc_type_t type, const uint16_t* cc_data, size_t size)
+{
+    if (cc_type_ntsc_cc_field_1 != type && cc_type_ntsc_cc_field_2 != type) {
+        return LIBCAPTION_ERROR;
+    }
+
+    cea708_pacer_queue_t* queue = &pacer->field[type];
+
+    if (CEA708_PACER_QUEUE_SIZE - queue->size < cea708_pacer_queue_walk(queue, cc_data, size, 0)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    cea708_pacer_queue_walk(queue, cc_data, size, 1);
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t cea708_pacer_push(cea708_pacer_t* pacer, cea708_t* cea708)
+{
+    int i, count = cea708_cc_count(&cea708->user_data);
+    size_t size[2] = { 0, 0 };
+    uint16_t cc_data[2][32];
+
+    if (GA94 != cea708->user_identifier) {
+        return LIBCAPTION_OK;
+    }
+
+    for (i = 0; i < count; ++i) {
+        cc_data_t* cc = &cea708->user_data.cc_data[i];
+
+        if (cc->cc_valid && (cc_type_ntsc_cc_field_1 == cc->cc_type || cc_type_ntsc_cc_field_2 == cc->cc_type)) {
+            cc_data[cc->cc_type][size[cc->cc_type]++] = cc->cc_data;
         }
     }
 
-    return status;
+    libcaption_stauts_t status = cea708_pacer_push_cc_data(pacer, cc_type_ntsc_cc_field_1, cc_data[0], size[0]);
+    return libcaption_status_update(status, cea708_pacer_push_cc_data(pacer, cc_type_ntsc_cc_field_2, cc_data[1], size[1]));
+}
+
+static uint16_t cea708_pacer_queue_pop(cea708_pacer_queue_t* queue)
+{
+    if (!queue->size) {
+        return 0x8080;
+    }
+
+    uint16_t cc_data = queue->cc_data[queue->front];
+    queue->front = (queue->front + 1) % CEA708_PACER_QUEUE_SIZE, --queue->size;
+    return cc_data;
+}
+
+int cea708_pacer_pop(cea708_pacer_t* pacer, cea708_t* cea708, double timestamp)
+{
+    uint64_t word = (uint64_t)CEA708_PACER_WORDS_DEN * pacer->num;
+    cea708_init(cea708, timestamp);
+    pacer->credit += (uint64_t)CEA708_PACER_WORDS_NUM * pacer->den;
+
+    for (; word <= pacer->credit && 2 <= CEA708_MAX_CC_COUNT - cea708->user_data.cc_count; pacer->credit -= word) {
+        cea708_add_cc_data(cea708, 1, cc_type_ntsc_cc_field_1, cea708_pacer_queue_pop(&pacer->field[0]));
+        cea708_add_cc_data(cea708, 1, cc_type_ntsc_cc_field_2, cea708_pacer_queue_pop(&pacer->field[1]));
+    }
+
+    // Frame rates below 2 fps can not carry the full 608 bandwidth
+    if (word <= pacer->credit) {
+        pacer->credit %= word;
+    }
+
+    return cea708->user_data.cc_count;
 }
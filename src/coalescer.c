@@ -0,0 +1,117 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "coalescer.h"
+#include <string.h>
+
+void caption_coalescer_init(caption_coalescer_t* coalescer, const caption_coalescer_config_t* config)
+{
+    if (config) {
+        coalescer->config = *config;
+    } else {
+        coalescer->config.min_duration = CAPTION_COALESCER_MIN_DURATION;
+        coalescer->config.merge_window = CAPTION_COALESCER_MERGE_WINDOW;
+        coalescer->config.rollup_on_cr = 1;
+    }
+
+    coalescer->pending = 0;
+    caption_frame_init(&coalescer->pending_frame);
+    caption_frame_init(&coalescer->event);
+}
+
+// Bytes after the null terminator of a cell are left over from earlier charcters,
+// and the style of a blank cell is not displayed
+static int caption_coalescer_cell_equal(const caption_frame_cell_t* a, const caption_frame_cell_t* b)
+{
+    if (0 != strcmp(&a->data[0], &b->data[0])) {
+        return 0;
+    }
+
+    return 0 == a->data[0] || (a->sty == b->sty && a->uln == b->uln);
+}
+
+static int caption_coalescer_buffer_equal(const caption_frame_buffer_t* a, const caption_frame_buffer_t* b)
+{
+    for (int r = 0; r < SCREEN_ROWS; ++r) {
+        for (int c = 0; c < SCREEN_COLS; ++c) {
+            if (!caption_coalescer_cell_equal(&a->cell[r][c], &b->cell[r][c])) {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+static libcaption_stauts_t caption_coalescer_emit(caption_coalescer_t* coalescer)
+{
+    coalescer->pending = 0;
+    memcpy(&coalescer->event, &coalescer->pending_frame, sizeof(caption_frame_t));
+    return LIBCAPTION_READY;
+}
+
+libcaption_stauts_t caption_coalescer_push(caption_coalescer_t* coalescer, caption_frame_t* frame)
+{
+    libcaption_stauts_t status = LIBCAPTION_OK;
+    caption_ticks_t start = frame->ticks;
+    caption_ticks_t min_duration = caption_ticks_from_seconds(coalescer->config.min_duration);
+    caption_ticks_t merge_window = caption_ticks_from_seconds(coalescer->config.merge_window);
+    caption_frame_buffer_t front;
+
+    if (coalescer->pending && start >= coalescer->pending_frame.ticks + merge_window) {
+        status = caption_coalescer_emit(coalescer);
+    }
+
+    // Roll-up charcters are written straight to the display. Only the lines above
+    // the cursor have been ended by a carriage return, the base row is left out
+    memcpy(&front, &frame->front, sizeof(caption_frame_buffer_t));
+
+    if (coalescer->config.rollup_on_cr && caption_frame_rollup(frame) && 0 <= frame->state.row && SCREEN_ROWS > frame->state.row) {
+        memset(&front.cell[frame->state.row], 0, sizeof(front.cell[0]));
+    }
+
+    if (caption_coalescer_buffer_equal(&front, coalescer->pending ? &coalescer->pending_frame.front : &coalescer->event.front)) {
+        return status;
+    }
+
+    if (coalescer->pending) {
+        // Merge, the event keeps its start time
+        start = coalescer->pending_frame.ticks;
+    } else if (0 <= coalescer->event.ticks && start < coalescer->event.ticks + min_duration) {
+        start = coalescer->event.ticks + min_duration;
+    }
+
+    memcpy(&coalescer->pending_frame, frame, sizeof(caption_frame_t));
+    memcpy(&coalescer->pending_frame.front, &front, sizeof(caption_frame_buffer_t));
+    coalescer->pending_frame.ticks = start;
+    coalescer->pending_frame.timestamp = caption_ticks_to_seconds(start);
+
+    // Typing followed by a correction can leave the display as it was
+    coalescer->pending = !caption_coalescer_buffer_equal(&front, &coalescer->event.front);
+    return status;
+}
+
+libcaption_stauts_t caption_coalescer_flush(caption_coalescer_t* coalescer)
+{
+    return coalescer->pending ? caption_coalescer_emit(coalescer) : LIBCAPTION_OK;
+}
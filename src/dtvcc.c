@@ -0,0 +1,320 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "dtvcc.h"
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// G2 charcters, sent after EXT1
+static const struct {
+    uint32_t codepoint;
+    uint8_t code;
+} dtvcc_g2[] = {
+    { 0x2026, 0x25 }, // …
+    { 0x0160, 0x2A }, // Š
+    { 0x0152, 0x2C }, // Œ
+    { 0x2588, 0x30 }, // █
+    { 0x2018, 0x31 }, // ‘
+    { 0x2019, 0x32 }, // ’
+    { 0x201C, 0x33 }, // “
+    { 0x201D, 0x34 }, // ”
+    { 0x2022, 0x35 }, // •
+    { 0x2122, 0x39 }, // ™
+    { 0x0161, 0x3A }, // š
+    { 0x0153, 0x3C }, // œ
+    { 0x2120, 0x3D }, // ℠
+    { 0x0178, 0x3F }, // Ÿ
+    { 0x215B, 0x76 }, // ⅛
+    { 0x215C, 0x77 }, // ⅜
+    { 0x215D, 0x78 }, // ⅝
+    { 0x215E, 0x79 }, // ⅞
+    { 0x2502, 0x7A }, // │
+    { 0x2510, 0x7B }, // ┐
+    { 0x2514, 0x7C }, // └
+    { 0x2500, 0x7D }, // ─
+    { 0x2518, 0x7E }, // ┘
+    { 0x250C, 0x7F }, // ┌
+};
+
+static uint32_t dtvcc_codepoint(const utf8_char_t* c)
+{
+    const uint8_t* u = (const uint8_t*)c;
+
+    switch (utf8_char_length(c)) {
+    case 1:
+        return u[0];
+    case 2:
+        return ((u[0] & 0x1F) << 6) | (u[1] & 0x3F);
+    case 3:
+        return ((u[0] & 0x0F) << 12) | ((u[1] & 0x3F) << 6) | (u[2] & 0x3F);
+    case 4:
+        return ((u[0] & 0x07) << 18) | ((u[1] & 0x3F) << 12) | ((u[2] & 0x3F) << 6) | (u[3] & 0x3F);
+    default:
+        return 0;
+    }
+}
+
+size_t dtvcc_from_utf8(const utf8_char_t* c, uint8_t* data)
+{
+    size_t i;
+    uint32_t codepoint = dtvcc_codepoint(c);
+
+    if (0x20 <= codepoint && codepoint < 0x7F) {
+        data[0] = (uint8_t)codepoint;
+        return 1;
+    }
+
+    if (0xA0 <= codepoint && codepoint <= 0xFF) {
+        data[0] = (uint8_t)codepoint; // G1 is latin-1
+        return 1;
+    }
+
+    if (0x266A == codepoint) {
+        data[0] = 0x7F; // ♪
+        return 1;
+    }
+
+    if (0x2014 == codepoint) {
+        data[0] = '-'; // 608 has an em dash, 708 does not
+        return 1;
+    }
+
+    for (i = 0; i < sizeof(dtvcc_g2) / sizeof(dtvcc_g2[0]); ++i) {
+        if (dtvcc_g2[i].codepoint == codepoint) {
+            data[0] = dtvcc_c0_ext1;
+            data[1] = dtvcc_g2[i].code;
+            return 2;
+        }
+    }
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Packs commands into service blocks and packets, writing triples as each packet
+// is completed. A command is never split between service blocks
+typedef struct {
+    dtvcc_encoder_t* enc;
+    cc_data_t* cc_data;
+    size_t size; //< triples written
+    size_t block; //< offset of the open service block header, 0 if none
+    size_t packet_size;
+    uint8_t packet[DTVCC_PACKET_MAX_SIZE];
+} dtvcc_writer_t;
+
+static void dtvcc_writer_flush(dtvcc_writer_t* w)
+{
+    size_t i;
+
+    if (1 >= w->packet_size) {
+        return;
+    }
+
+    // packets are a whole number of pairs, a zero service number marks the padding
+    if (w->packet_size & 1) {
+        w->packet[w->packet_size++] = 0;
+    }
+
+    w->packet[0] = (uint8_t)(((w->enc->sequence & 0x03) << 6) | ((w->packet_size / 2) & 0x3F));
+    w->enc->sequence = (w->enc->sequence + 1) & 0x03;
+
+    for (i = 0; i < w->packet_size; i += 2) {
+        cea708_cc_type_t type = i ? cc_type_dtvcc_packet_data : cc_type_dtvcc_packet_start;
+        w->cc_data[w->size++] = cea708_encode_cc_data(1, type, (uint16_t)(w->packet[i] << 8 | w->packet[i + 1]));
+    }
+
+    w->packet_size = 1;
+    w->block = 0;
+}
+
+static void dtvcc_writer_put(dtvcc_writer_t* w, const uint8_t* data, size_t size)
+{
+    size_t block_size = w->block ? w->packet_size - w->block - 1 : 0;
+
+    if (DTVCC_SERVICE_BLOCK_MAX_SIZE < block_size + size || DTVCC_PACKET_MAX_SIZE < w->packet_size + size) {
+        w->block = 0;
+    }
+
+    if (!w->block) {
+        if (DTVCC_PACKET_MAX_SIZE < w->packet_size + 1 + size) {
+            dtvcc_writer_flush(w);
+        }
+
+        w->block = w->packet_size++;
+        block_size = 0;
+    }
+
+    memcpy(&w->packet[w->packet_size], data, size);
+    w->packet_size += size;
+    w->packet[w->block] = (uint8_t)((w->enc->service << 5) | (block_size + size));
+}
+
+static void dtvcc_writer_command(dtvcc_writer_t* w, dtvcc_command_t command, uint8_t param)
+{
+    uint8_t data[2] = { (uint8_t)command, param };
+    dtvcc_writer_put(w, data, 2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 2 bits per component
+static const uint8_t dtvcc_style_color[] = { 0x2A, 0x08, 0x02, 0x0A, 0x20, 0x28, 0x22, 0x2A };
+
+static void dtvcc_writer_pen(dtvcc_writer_t* w, eia608_style_t sty, int uln)
+{
+    // standard size, normal offset. Solid foreground on solid black
+    uint8_t spa[3] = { dtvcc_c1_spa, 0x05, (uint8_t)((eia608_style_italics == sty ? 0x80 : 0x00) | (uln ? 0x40 : 0x00)) };
+    uint8_t spc[4] = { dtvcc_c1_spc, dtvcc_style_color[sty & 0x07], 0x00, 0x00 };
+    dtvcc_writer_put(w, spa, sizeof(spa));
+    dtvcc_writer_put(w, spc, sizeof(spc));
+}
+
+static int dtvcc_frame_blank(caption_frame_t* frame)
+{
+    int r, c;
+    uint8_t data[2];
+
+    for (r = 0; r < SCREEN_ROWS; ++r) {
+        for (c = 0; c < SCREEN_COLS; ++c) {
+            if (dtvcc_from_utf8(caption_frame_read_char(frame, r, c, 0, 0), data)) {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+// Writes the front buffer of frame to a hidden window, then swaps it with the displayed one
+static void dtvcc_writer_caption(dtvcc_writer_t* w, caption_frame_t* frame)
+{
+    int r, c, uln, pen_uln = -1, pen_col;
+    eia608_style_t sty, pen_sty = eia608_style_white;
+    int window = 0 == w->enc->window ? 1 : 0;
+
+    // not visible, row and column locked, relative anchor at 10% from the top left
+    // SCREEN_ROWS x SCREEN_COLS, window style 2 (transparent), pen style 1
+    uint8_t define[7] = { (uint8_t)(dtvcc_c1_df0 | window), 0x18, 0x80 | 10, 10, SCREEN_ROWS - 1, SCREEN_COLS - 1, (2 << 3) | 1 };
+    dtvcc_writer_put(w, define, sizeof(define));
+
+    for (r = 0; r < SCREEN_ROWS; ++r) {
+        for (c = 0, pen_col = -1; c < SCREEN_COLS; ++c) {
+            uint8_t data[2];
+            const utf8_char_t* chr = caption_frame_read_char(frame, r, c, &sty, &uln);
+            size_t size = dtvcc_from_utf8(chr, data);
+
+            if (!size) {
+                continue;
+            }
+
+            if (pen_col != c) {
+                uint8_t spl[3] = { dtvcc_c1_spl, (uint8_t)r, (uint8_t)c };
+                dtvcc_writer_put(w, spl, sizeof(spl));
+            }
+
+            if (pen_sty != sty || pen_uln != uln) {
+                dtvcc_writer_pen(w, sty, uln);
+                pen_sty = sty, pen_uln = uln;
+            }
+
+            dtvcc_writer_put(w, data, size);
+            pen_col = c + 1;
+        }
+    }
+
+    dtvcc_writer_command(w, dtvcc_c1_dsw, (uint8_t)(1 << window));
+
+    if (0 <= w->enc->window) {
+        dtvcc_writer_command(w, dtvcc_c1_dlw, (uint8_t)(1 << w->enc->window));
+    }
+
+    w->enc->window = window;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void dtvcc_encoder_init(dtvcc_encoder_t* enc, int cc, int service)
+{
+    eia608_encoder_init(&enc->eia608, eia608_encoder_popon, cc);
+    enc->service = service & 0x07;
+    enc->sequence = 0;
+    enc->window = -1;
+}
+
+// Spreads 608 words through the 708 triples already at cc_data[word_count], so
+// every group of CEA708_MAX_CC_COUNT carries both. Works in place, front to back
+static size_t dtvcc_interleave(cc_data_t* cc_data, cea708_cc_type_t type, const uint16_t* words, size_t word_count, size_t triple_count)
+{
+    size_t w = 0, t = 0, out = 0;
+
+    while (w < word_count || t < triple_count) {
+        size_t total = (word_count - w) + (triple_count - t);
+        size_t group = CEA708_MAX_CC_COUNT < total ? CEA708_MAX_CC_COUNT : total;
+        size_t nw = ((word_count - w) * group + total - 1) / total;
+        size_t nt = group - nw;
+
+        for (; 0 < nw; --nw) {
+            cc_data[out++] = cea708_encode_cc_data(1, type, words[w++]);
+        }
+
+        memmove(&cc_data[out], &cc_data[word_count + t], nt * sizeof(cc_data_t));
+        out += nt, t += nt;
+    }
+
+    return out;
+}
+
+size_t dtvcc_encoder_from_caption_frame(dtvcc_encoder_t* enc, caption_frame_t* frame, cc_data_t* cc_data, size_t size)
+{
+    uint16_t words[DTVCC_ENCODER_MAX_608_WORDS];
+    cea708_cc_type_t type = (enc->eia608.cc & 0x02) ? cc_type_ntsc_cc_field_2 : cc_type_ntsc_cc_field_1;
+
+    if (DTVCC_ENCODER_MAX_CC_DATA > size) {
+        return 0;
+    }
+
+    size_t word_count = eia608_encoder_from_caption_frame(&enc->eia608, frame, words, DTVCC_ENCODER_MAX_608_WORDS);
+
+    if (0 == word_count) {
+        return 0;
+    }
+
+    // 708 follows what 608 decoders display once these words are received
+    dtvcc_writer_t w;
+    w.enc = enc;
+    w.cc_data = &cc_data[word_count];
+    w.size = 0;
+    w.block = 0;
+    w.packet_size = 1;
+
+    if (!enc->eia608.loading) {
+        if (dtvcc_frame_blank(&enc->eia608.shadow)) {
+            dtvcc_writer_command(&w, dtvcc_c1_dlw, 0x03);
+            enc->window = -1;
+        } else {
+            dtvcc_writer_caption(&w, &enc->eia608.shadow);
+        }
+
+        dtvcc_writer_flush(&w);
+    }
+
+    return dtvcc_interleave(cc_data, type, words, word_count, w.size);
+}
@@ -43,10 +43,10 @@ const char* eia608_style_map[] = {
 static inline uint16_t eia608_row_pramble(int row, int chan, int x, int underline)
 {
     row = eia608_reverse_row_map[row & 0x0F];
-    return eia608_parity(0x1040 | (chan ? 0x0800 : 0x0000) | ((row << 7) & 0x0700) | ((row << 5) & 0x0020)) | ((x << 1) & 0x001E) | (underline ? 0x0001 : 0x0000);
+    return eia608_parity(0x1040 | (chan ? 0x0800 : 0x0000) | ((row << 7) & 0x0700) | ((row << 5) & 0x0020) | ((x << 1) & 0x001E) | (underline ? 0x0001 : 0x0000));
 }
 
-uint16_t eia608_row_column_pramble(int row, int col, int chan, int underline) { return eia608_row_pramble(row, chan, 0x10 | (col / 4), underline); }
+uint16_t eia608_row_column_pramble(int row, int col, int chan, int underline) { return eia608_row_pramble(row, chan, 0x08 | (col / 4), underline); }
 uint16_t eia608_row_style_pramble(int row, int chan, eia608_style_t style, int underline) { return eia608_row_pramble(row, chan, style, underline); }
 uint16_t eia608_midrow_change(int chan, eia608_style_t style, int underline) { return eia608_parity(0x1120 | ((chan << 11) & 0x0800) | ((style << 1) & 0x000E) | (underline & 0x0001)); }
 
@@ -105,7 +105,7 @@ uint16_t eia608_control_command(eia608_control_t cmd, int cc)
 ////////////////////////////////////////////////////////////////////////////////
 // text
 static const char* utf8_from_index(int idx) { return (0 <= idx && EIA608_CHAR_COUNT > idx) ? eia608_char_map[idx] : ""; }
-static int eia608_to_index(uint16_t cc_data, int* chan, int* c1, int* c2)
+int eia608_to_index(uint16_t cc_data, int* chan, int* c1, int* c2)
 {
     (*c1) = (*c2) = -1;
     (*chan) = 0;
@@ -159,6 +159,7 @@ int eia608_to_utf8(uint16_t c, int* chan, char* str1, char* str2)
     return size;
 }
 
+////////////////////////////////////////////////////////////////////////////////
 uint16_t eia608_from_basicna(uint16_t bna1, uint16_t bna2)
 {
     if (!eia608_is_basicna(bna1) || !eia608_is_basicna(bna2)) {
@@ -168,7 +169,7 @@ uint16_t eia608_from_basicna(uint16_t bna1, uint16_t bna2)
     return eia608_parity((0xFF00 & bna1) | ((0xFF00 & bna2) >> 8));
 }
 
-// prototype for re2c generated function
+// prototype for function in eia608_from_utf8.c
 uint16_t _eia608_from_utf8(const utf8_char_t* s);
 uint16_t eia608_from_utf8_1(const utf8_char_t* c, int chan)
 {
@@ -0,0 +1,4126 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "eia608.h"
+
+// Generated by unit_tests/eia608_decode_table_test.c --generate, do not edit
+static const eia608_decoded_t _eia608_decode_table[0x10000] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0xa07, 0x0, 0x0, 0x120a07, 0x0, 0x140a07, 0x60a07, 0x0, 0x0, 0x180a07, 0xa0a07, 0x0, 0xc0a07, 0x0, 0x0, 0x1e0a07,
+    0x0, 0x100a07, 0x4a07, 0x0, 0x8a07, 0x0, 0x0, 0x10ca07, 0x10a07, 0x0, 0x0, 0x114a07, 0x0, 0x118a07, 0x1ca07, 0x0,
+    0x0, 0x100f07, 0x20f07, 0x0, 0x40f07, 0x0, 0x0, 0x160f07, 0x80f07, 0x0, 0x0, 0x1a0f07, 0x0, 0x1c0f07, 0xe0f07, 0x0,
+    0xf07, 0x0, 0x0, 0x104f07, 0x0, 0x108f07, 0xcf07, 0x0, 0x0, 0x110f07, 0x14f07, 0x0, 0x18f07, 0x0, 0x0, 0x11cf07,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x100a07, 0x20a07, 0x0, 0x40a07, 0x0, 0x0, 0x160a07, 0x80a07, 0x0, 0x0, 0x1a0a07, 0x0, 0x1c0a07, 0xe0a07, 0x0,
+    0xa07, 0x0, 0x0, 0x104a07, 0x0, 0x108a07, 0xca07, 0x0, 0x0, 0x110a07, 0x14a07, 0x0, 0x18a07, 0x0, 0x0, 0x11ca07,
+    0xf07, 0x0, 0x0, 0x120f07, 0x0, 0x140f07, 0x60f07, 0x0, 0x0, 0x180f07, 0xa0f07, 0x0, 0xc0f07, 0x0, 0x0, 0x1e0f07,
+    0x0, 0x100f07, 0x4f07, 0x0, 0x8f07, 0x0, 0x0, 0x10cf07, 0x10f07, 0x0, 0x0, 0x114f07, 0x0, 0x118f07, 0x1cf07, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0xff9006, 0x0, 0x0, 0xff9306, 0x0, 0xff9506, 0xff9606, 0x0, 0x0, 0xff9906, 0xff9a06, 0x0, 0xff9c06, 0x0, 0x0, 0xff9f06,
+    0x0, 0xffa106, 0xffa206, 0x0, 0xffa406, 0x0, 0x0, 0xffa706, 0xffa806, 0x0, 0x0, 0xffab06, 0x0, 0xffad06, 0xffae06, 0x0,
+    0xb07, 0x0, 0x0, 0x120b07, 0x0, 0x140b07, 0x60b07, 0x0, 0x0, 0x180b07, 0xa0b07, 0x0, 0xc0b07, 0x0, 0x0, 0x1e0b07,
+    0x0, 0x100b07, 0x4b07, 0x0, 0x8b07, 0x0, 0x0, 0x10cb07, 0x10b07, 0x0, 0x0, 0x114b07, 0x0, 0x118b07, 0x1cb07, 0x0,
+    0x0, 0x100c07, 0x20c07, 0x0, 0x40c07, 0x0, 0x0, 0x160c07, 0x80c07, 0x0, 0x0, 0x1a0c07, 0x0, 0x1c0c07, 0xe0c07, 0x0,
+    0xc07, 0x0, 0x0, 0x104c07, 0x0, 0x108c07, 0xcc07, 0x0, 0x0, 0x110c07, 0x14c07, 0x0, 0x18c07, 0x0, 0x0, 0x11cc07,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0xff9106, 0xff9206, 0x0, 0xff9406, 0x0, 0x0, 0xff9706, 0xff9806, 0x0, 0x0, 0xff9b06, 0x0, 0xff9d06, 0xff9e06, 0x0,
+    0xffa006, 0x0, 0x0, 0xffa306, 0x0, 0xffa506, 0xffa606, 0x0, 0x0, 0xffa906, 0xffaa06, 0x0, 0xffac06, 0x0, 0x0, 0xffaf06,
+    0x0, 0x100b07, 0x20b07, 0x0, 0x40b07, 0x0, 0x0, 0x160b07, 0x80b07, 0x0, 0x0, 0x1a0b07, 0x0, 0x1c0b07, 0xe0b07, 0x0,
+    0xb07, 0x0, 0x0, 0x104b07, 0x0, 0x108b07, 0xcb07, 0x0, 0x0, 0x110b07, 0x14b07, 0x0, 0x18b07, 0x0, 0x0, 0x11cb07,
+    0xc07, 0x0, 0x0, 0x120c07, 0x0, 0x140c07, 0x60c07, 0x0, 0x0, 0x180c07, 0xa0c07, 0x0, 0xc0c07, 0x0, 0x0, 0x1e0c07,
+    0x0, 0x100c07, 0x4c07, 0x0, 0x8c07, 0x0, 0x0, 0x10cc07, 0x10c07, 0x0, 0x0, 0x114c07, 0x0, 0x118c07, 0x1cc07, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x142023, 0x0, 0x0, 0x142323, 0x0, 0x142523, 0x142623, 0x0, 0x0, 0x142923, 0x142a23, 0x0, 0x142c23, 0x0, 0x0, 0x142f23,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x407, 0x0, 0x0, 0x120407, 0x0, 0x140407, 0x60407, 0x0, 0x0, 0x180407, 0xa0407, 0x0, 0xc0407, 0x0, 0x0, 0x1e0407,
+    0x0, 0x100407, 0x4407, 0x0, 0x8407, 0x0, 0x0, 0x10c407, 0x10407, 0x0, 0x0, 0x114407, 0x0, 0x118407, 0x1c407, 0x0,
+    0x0, 0x100507, 0x20507, 0x0, 0x40507, 0x0, 0x0, 0x160507, 0x80507, 0x0, 0x0, 0x1a0507, 0x0, 0x1c0507, 0xe0507, 0x0,
+    0x507, 0x0, 0x0, 0x104507, 0x0, 0x108507, 0xc507, 0x0, 0x0, 0x110507, 0x14507, 0x0, 0x18507, 0x0, 0x0, 0x11c507,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x142123, 0x142223, 0x0, 0x142423, 0x0, 0x0, 0x142723, 0x142823, 0x0, 0x0, 0x142b23, 0x0, 0x142d23, 0x142e23, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x100407, 0x20407, 0x0, 0x40407, 0x0, 0x0, 0x160407, 0x80407, 0x0, 0x0, 0x1a0407, 0x0, 0x1c0407, 0xe0407, 0x0,
+    0x407, 0x0, 0x0, 0x104407, 0x0, 0x108407, 0xc407, 0x0, 0x0, 0x110407, 0x14407, 0x0, 0x18407, 0x0, 0x0, 0x11c407,
+    0x507, 0x0, 0x0, 0x120507, 0x0, 0x140507, 0x60507, 0x0, 0x0, 0x180507, 0xa0507, 0x0, 0xc0507, 0x0, 0x0, 0x1e0507,
+    0x0, 0x100507, 0x4507, 0x0, 0x8507, 0x0, 0x0, 0x10c507, 0x10507, 0x0, 0x0, 0x114507, 0x0, 0x118507, 0x1c507, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x607, 0x0, 0x0, 0x120607, 0x0, 0x140607, 0x60607, 0x0, 0x0, 0x180607, 0xa0607, 0x0, 0xc0607, 0x0, 0x0, 0x1e0607,
+    0x0, 0x100607, 0x4607, 0x0, 0x8607, 0x0, 0x0, 0x10c607, 0x10607, 0x0, 0x0, 0x114607, 0x0, 0x118607, 0x1c607, 0x0,
+    0x0, 0x100707, 0x20707, 0x0, 0x40707, 0x0, 0x0, 0x160707, 0x80707, 0x0, 0x0, 0x1a0707, 0x0, 0x1c0707, 0xe0707, 0x0,
+    0x707, 0x0, 0x0, 0x104707, 0x0, 0x108707, 0xc707, 0x0, 0x0, 0x110707, 0x14707, 0x0, 0x18707, 0x0, 0x0, 0x11c707,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x100607, 0x20607, 0x0, 0x40607, 0x0, 0x0, 0x160607, 0x80607, 0x0, 0x0, 0x1a0607, 0x0, 0x1c0607, 0xe0607, 0x0,
+    0x607, 0x0, 0x0, 0x104607, 0x0, 0x108607, 0xc607, 0x0, 0x0, 0x110607, 0x14607, 0x0, 0x18607, 0x0, 0x0, 0x11c607,
+    0x707, 0x0, 0x0, 0x120707, 0x0, 0x140707, 0x60707, 0x0, 0x0, 0x180707, 0xa0707, 0x0, 0xc0707, 0x0, 0x0, 0x1e0707,
+    0x0, 0x100707, 0x4707, 0x0, 0x8707, 0x0, 0x0, 0x10c707, 0x10707, 0x0, 0x0, 0x114707, 0x0, 0x118707, 0x1c707, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x18, 0x0, 0x0, 0x120018, 0x0, 0x140018, 0x60018, 0x0, 0x0, 0x180018, 0xa0018, 0x0, 0xc0018, 0x0, 0x0, 0x1e0018,
+    0x0, 0xff6135, 0xff6235, 0x0, 0xff6435, 0x0, 0x0, 0xff6735, 0xff6835, 0x0, 0x0, 0xff6b35, 0x0, 0xff6d35, 0xff6e35, 0x0,
+    0x17, 0x0, 0x0, 0x120017, 0x0, 0x140017, 0x60017, 0x0, 0x0, 0x180017, 0xa0017, 0x0, 0xc0017, 0x0, 0x0, 0x1e0017,
+    0x0, 0x100017, 0x4017, 0x0, 0x8017, 0x0, 0x0, 0x10c017, 0x10017, 0x0, 0x0, 0x114017, 0x0, 0x118017, 0x1c017, 0x0,
+    0x0, 0x100117, 0x20117, 0x0, 0x40117, 0x0, 0x0, 0x160117, 0x80117, 0x0, 0x0, 0x1a0117, 0x0, 0x1c0117, 0xe0117, 0x0,
+    0x117, 0x0, 0x0, 0x104117, 0x0, 0x108117, 0xc117, 0x0, 0x0, 0x110117, 0x14117, 0x0, 0x18117, 0x0, 0x0, 0x11c117,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x100018, 0x20018, 0x0, 0x40018, 0x0, 0x0, 0x160018, 0x80018, 0x0, 0x0, 0x1a0018, 0x0, 0x1c0018, 0xe0018, 0x0,
+    0xff6035, 0x0, 0x0, 0xff6335, 0x0, 0xff6535, 0xff6635, 0x0, 0x0, 0xff6935, 0xff6a35, 0x0, 0xff6c35, 0x0, 0x0, 0xff6f35,
+    0x0, 0x100017, 0x20017, 0x0, 0x40017, 0x0, 0x0, 0x160017, 0x80017, 0x0, 0x0, 0x1a0017, 0x0, 0x1c0017, 0xe0017, 0x0,
+    0x17, 0x0, 0x0, 0x104017, 0x0, 0x108017, 0xc017, 0x0, 0x0, 0x110017, 0x14017, 0x0, 0x18017, 0x0, 0x0, 0x11c017,
+    0x117, 0x0, 0x0, 0x120117, 0x0, 0x140117, 0x60117, 0x0, 0x0, 0x180117, 0xa0117, 0x0, 0xc0117, 0x0, 0x0, 0x1e0117,
+    0x0, 0x100117, 0x4117, 0x0, 0x8117, 0x0, 0x0, 0x10c117, 0x10117, 0x0, 0x0, 0x114117, 0x0, 0x118117, 0x1c117, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0xff7016, 0x0, 0x0, 0xff7316, 0x0, 0xff7516, 0xff7616, 0x0, 0x0, 0xff7916, 0xff7a16, 0x0, 0xff7c16, 0x0, 0x0, 0xff7f16,
+    0x0, 0xff8116, 0xff8216, 0x0, 0xff8416, 0x0, 0x0, 0xff8716, 0xff8816, 0x0, 0x0, 0xff8b16, 0x0, 0xff8d16, 0xff8e16, 0x0,
+    0x217, 0x0, 0x0, 0x120217, 0x0, 0x140217, 0x60217, 0x0, 0x0, 0x180217, 0xa0217, 0x0, 0xc0217, 0x0, 0x0, 0x1e0217,
+    0x0, 0x100217, 0x4217, 0x0, 0x8217, 0x0, 0x0, 0x10c217, 0x10217, 0x0, 0x0, 0x114217, 0x0, 0x118217, 0x1c217, 0x0,
+    0x0, 0x100317, 0x20317, 0x0, 0x40317, 0x0, 0x0, 0x160317, 0x80317, 0x0, 0x0, 0x1a0317, 0x0, 0x1c0317, 0xe0317, 0x0,
+    0x317, 0x0, 0x0, 0x104317, 0x0, 0x108317, 0xc317, 0x0, 0x0, 0x110317, 0x14317, 0x0, 0x18317, 0x0, 0x0, 0x11c317,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0xff7116, 0xff7216, 0x0, 0xff7416, 0x0, 0x0, 0xff7716, 0xff7816, 0x0, 0x0, 0xff7b16, 0x0, 0xff7d16, 0xff7e16, 0x0,
+    0xff8016, 0x0, 0x0, 0xff8316, 0x0, 0xff8516, 0xff8616, 0x0, 0x0, 0xff8916, 0xff8a16, 0x0, 0xff8c16, 0x0, 0x0, 0xff8f16,
+    0x0, 0x100217, 0x20217, 0x0, 0x40217, 0x0, 0x0, 0x160217, 0x80217, 0x0, 0x0, 0x1a0217, 0x0, 0x1c0217, 0xe0217, 0x0,
+    0x217, 0x0, 0x0, 0x104217, 0x0, 0x108217, 0xc217, 0x0, 0x0, 0x110217, 0x14217, 0x0, 0x18217, 0x0, 0x0, 0x11c217,
+    0x317, 0x0, 0x0, 0x120317, 0x0, 0x140317, 0x60317, 0x0, 0x0, 0x180317, 0xa0317, 0x0, 0xc0317, 0x0, 0x0, 0x1e0317,
+    0x0, 0x100317, 0x4317, 0x0, 0x8317, 0x0, 0x0, 0x10c317, 0x10317, 0x0, 0x0, 0x114317, 0x0, 0x118317, 0x1c317, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x142033, 0x0, 0x0, 0x142333, 0x0, 0x142533, 0x142633, 0x0, 0x0, 0x142933, 0x142a33, 0x0, 0x142c33, 0x0, 0x0, 0x142f33,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0xd17, 0x0, 0x0, 0x120d17, 0x0, 0x140d17, 0x60d17, 0x0, 0x0, 0x180d17, 0xa0d17, 0x0, 0xc0d17, 0x0, 0x0, 0x1e0d17,
+    0x0, 0x100d17, 0x4d17, 0x0, 0x8d17, 0x0, 0x0, 0x10cd17, 0x10d17, 0x0, 0x0, 0x114d17, 0x0, 0x118d17, 0x1cd17, 0x0,
+    0x0, 0x100e17, 0x20e17, 0x0, 0x40e17, 0x0, 0x0, 0x160e17, 0x80e17, 0x0, 0x0, 0x1a0e17, 0x0, 0x1c0e17, 0xe0e17, 0x0,
+    0xe17, 0x0, 0x0, 0x104e17, 0x0, 0x108e17, 0xce17, 0x0, 0x0, 0x110e17, 0x14e17, 0x0, 0x18e17, 0x0, 0x0, 0x11ce17,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x142133, 0x142233, 0x0, 0x142433, 0x0, 0x0, 0x142733, 0x142833, 0x0, 0x0, 0x142b33, 0x0, 0x142d33, 0x142e33, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x100d17, 0x20d17, 0x0, 0x40d17, 0x0, 0x0, 0x160d17, 0x80d17, 0x0, 0x0, 0x1a0d17, 0x0, 0x1c0d17, 0xe0d17, 0x0,
+    0xd17, 0x0, 0x0, 0x104d17, 0x0, 0x108d17, 0xcd17, 0x0, 0x0, 0x110d17, 0x14d17, 0x0, 0x18d17, 0x0, 0x0, 0x11cd17,
+    0xe17, 0x0, 0x0, 0x120e17, 0x0, 0x140e17, 0x60e17, 0x0, 0x0, 0x180e17, 0xa0e17, 0x0, 0xc0e17, 0x0, 0x0, 0x1e0e17,
+    0x0, 0x100e17, 0x4e17, 0x0, 0x8e17, 0x0, 0x0, 0x10ce17, 0x10e17, 0x0, 0x0, 0x114e17, 0x0, 0x118e17, 0x1ce17, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x172033, 0x0, 0x0, 0x172333, 0x0, 0x172533, 0x172633, 0x0, 0x0, 0x172933, 0x172a33, 0x0, 0x172c33, 0x0, 0x0, 0x172f33,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x817, 0x0, 0x0, 0x120817, 0x0, 0x140817, 0x60817, 0x0, 0x0, 0x180817, 0xa0817, 0x0, 0xc0817, 0x0, 0x0, 0x1e0817,
+    0x0, 0x100817, 0x4817, 0x0, 0x8817, 0x0, 0x0, 0x10c817, 0x10817, 0x0, 0x0, 0x114817, 0x0, 0x118817, 0x1c817, 0x0,
+    0x0, 0x100917, 0x20917, 0x0, 0x40917, 0x0, 0x0, 0x160917, 0x80917, 0x0, 0x0, 0x1a0917, 0x0, 0x1c0917, 0xe0917, 0x0,
+    0x917, 0x0, 0x0, 0x104917, 0x0, 0x108917, 0xc917, 0x0, 0x0, 0x110917, 0x14917, 0x0, 0x18917, 0x0, 0x0, 0x11c917,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x172133, 0x172233, 0x0, 0x172433, 0x0, 0x0, 0x172733, 0x172833, 0x0, 0x0, 0x172b33, 0x0, 0x172d33, 0x172e33, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x100817, 0x20817, 0x0, 0x40817, 0x0, 0x0, 0x160817, 0x80817, 0x0, 0x0, 0x1a0817, 0x0, 0x1c0817, 0xe0817, 0x0,
+    0x817, 0x0, 0x0, 0x104817, 0x0, 0x108817, 0xc817, 0x0, 0x0, 0x110817, 0x14817, 0x0, 0x18817, 0x0, 0x0, 0x11c817,
+    0x917, 0x0, 0x0, 0x120917, 0x0, 0x140917, 0x60917, 0x0, 0x0, 0x180917, 0xa0917, 0x0, 0xc0917, 0x0, 0x0, 0x1e0917,
+    0x0, 0x100917, 0x4917, 0x0, 0x8917, 0x0, 0x0, 0x10c917, 0x10917, 0x0, 0x0, 0x114917, 0x0, 0x118917, 0x1c917, 0x0,
+    0x0, 0xff0004, 0xff0004, 0x0, 0xff0004, 0x0, 0x0, 0xff0004, 0xff0004, 0x0, 0x0, 0xff0004, 0x0, 0xff0004, 0xff0004, 0x0,
+    0xff0004, 0x0, 0x0, 0xff0004, 0x0, 0xff0004, 0xff0004, 0x0, 0x0, 0xff0004, 0xff0004, 0x0, 0xff0004, 0x0, 0x0, 0xff0004,
+    0x4, 0x0, 0x0, 0x30004, 0x0, 0x50004, 0x60004, 0x0, 0x0, 0x90004, 0xa0004, 0x0, 0xc0004, 0x0, 0x0, 0xf0004,
+    0x0, 0x110004, 0x120004, 0x0, 0x140004, 0x0, 0x0, 0x170004, 0x180004, 0x0, 0x0, 0x1b0004, 0x0, 0x1d0004, 0x1e0004, 0x0,
+    0x200004, 0x0, 0x0, 0x230004, 0x0, 0x250004, 0x260004, 0x0, 0x0, 0x290004, 0x2a0004, 0x0, 0x2c0004, 0x0, 0x0, 0x2f0004,
+    0x0, 0x310004, 0x320004, 0x0, 0x340004, 0x0, 0x0, 0x370004, 0x380004, 0x0, 0x0, 0x3b0004, 0x0, 0x3d0004, 0x3e0004, 0x0,
+    0x0, 0x410004, 0x420004, 0x0, 0x440004, 0x0, 0x0, 0x470004, 0x480004, 0x0, 0x0, 0x4b0004, 0x0, 0x4d0004, 0x4e0004, 0x0,
+    0x500004, 0x0, 0x0, 0x530004, 0x0, 0x550004, 0x560004, 0x0, 0x0, 0x590004, 0x5a0004, 0x0, 0x5c0004, 0x0, 0x0, 0x5f0004,
+    0xff0004, 0x0, 0x0, 0xff0004, 0x0, 0xff0004, 0xff0004, 0x0, 0x0, 0xff0004, 0xff0004, 0x0, 0xff0004, 0x0, 0x0, 0xff0004,
+    0x0, 0xff0004, 0xff0004, 0x0, 0xff0004, 0x0, 0x0, 0xff0004, 0xff0004, 0x0, 0x0, 0xff0004, 0x0, 0xff0004, 0xff0004, 0x0,
+    0x0, 0x10004, 0x20004, 0x0, 0x40004, 0x0, 0x0, 0x70004, 0x80004, 0x0, 0x0, 0xb0004, 0x0, 0xd0004, 0xe0004, 0x0,
+    0x100004, 0x0, 0x0, 0x130004, 0x0, 0x150004, 0x160004, 0x0, 0x0, 0x190004, 0x1a0004, 0x0, 0x1c0004, 0x0, 0x0, 0x1f0004,
+    0x0, 0x210004, 0x220004, 0x0, 0x240004, 0x0, 0x0, 0x270004, 0x280004, 0x0, 0x0, 0x2b0004, 0x0, 0x2d0004, 0x2e0004, 0x0,
+    0x300004, 0x0, 0x0, 0x330004, 0x0, 0x350004, 0x360004, 0x0, 0x0, 0x390004, 0x3a0004, 0x0, 0x3c0004, 0x0, 0x0, 0x3f0004,
+    0x400004, 0x0, 0x0, 0x430004, 0x0, 0x450004, 0x460004, 0x0, 0x0, 0x490004, 0x4a0004, 0x0, 0x4c0004, 0x0, 0x0, 0x4f0004,
+    0x0, 0x510004, 0x520004, 0x0, 0x540004, 0x0, 0x0, 0x570004, 0x580004, 0x0, 0x0, 0x5b0004, 0x0, 0x5d0004, 0x5e0004, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0304, 0xff0304, 0x0, 0xff0304, 0x0, 0x0, 0xff0304, 0xff0304, 0x0, 0x0, 0xff0304, 0x0, 0xff0304, 0xff0304, 0x0,
+    0xff0304, 0x0, 0x0, 0xff0304, 0x0, 0xff0304, 0xff0304, 0x0, 0x0, 0xff0304, 0xff0304, 0x0, 0xff0304, 0x0, 0x0, 0xff0304,
+    0x304, 0x0, 0x0, 0x30304, 0x0, 0x50304, 0x60304, 0x0, 0x0, 0x90304, 0xa0304, 0x0, 0xc0304, 0x0, 0x0, 0xf0304,
+    0x0, 0x110304, 0x120304, 0x0, 0x140304, 0x0, 0x0, 0x170304, 0x180304, 0x0, 0x0, 0x1b0304, 0x0, 0x1d0304, 0x1e0304, 0x0,
+    0x200304, 0x0, 0x0, 0x230304, 0x0, 0x250304, 0x260304, 0x0, 0x0, 0x290304, 0x2a0304, 0x0, 0x2c0304, 0x0, 0x0, 0x2f0304,
+    0x0, 0x310304, 0x320304, 0x0, 0x340304, 0x0, 0x0, 0x370304, 0x380304, 0x0, 0x0, 0x3b0304, 0x0, 0x3d0304, 0x3e0304, 0x0,
+    0x0, 0x410304, 0x420304, 0x0, 0x440304, 0x0, 0x0, 0x470304, 0x480304, 0x0, 0x0, 0x4b0304, 0x0, 0x4d0304, 0x4e0304, 0x0,
+    0x500304, 0x0, 0x0, 0x530304, 0x0, 0x550304, 0x560304, 0x0, 0x0, 0x590304, 0x5a0304, 0x0, 0x5c0304, 0x0, 0x0, 0x5f0304,
+    0xff0304, 0x0, 0x0, 0xff0304, 0x0, 0xff0304, 0xff0304, 0x0, 0x0, 0xff0304, 0xff0304, 0x0, 0xff0304, 0x0, 0x0, 0xff0304,
+    0x0, 0xff0304, 0xff0304, 0x0, 0xff0304, 0x0, 0x0, 0xff0304, 0xff0304, 0x0, 0x0, 0xff0304, 0x0, 0xff0304, 0xff0304, 0x0,
+    0x0, 0x10304, 0x20304, 0x0, 0x40304, 0x0, 0x0, 0x70304, 0x80304, 0x0, 0x0, 0xb0304, 0x0, 0xd0304, 0xe0304, 0x0,
+    0x100304, 0x0, 0x0, 0x130304, 0x0, 0x150304, 0x160304, 0x0, 0x0, 0x190304, 0x1a0304, 0x0, 0x1c0304, 0x0, 0x0, 0x1f0304,
+    0x0, 0x210304, 0x220304, 0x0, 0x240304, 0x0, 0x0, 0x270304, 0x280304, 0x0, 0x0, 0x2b0304, 0x0, 0x2d0304, 0x2e0304, 0x0,
+    0x300304, 0x0, 0x0, 0x330304, 0x0, 0x350304, 0x360304, 0x0, 0x0, 0x390304, 0x3a0304, 0x0, 0x3c0304, 0x0, 0x0, 0x3f0304,
+    0x400304, 0x0, 0x0, 0x430304, 0x0, 0x450304, 0x460304, 0x0, 0x0, 0x490304, 0x4a0304, 0x0, 0x4c0304, 0x0, 0x0, 0x4f0304,
+    0x0, 0x510304, 0x520304, 0x0, 0x540304, 0x0, 0x0, 0x570304, 0x580304, 0x0, 0x0, 0x5b0304, 0x0, 0x5d0304, 0x5e0304, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0504, 0xff0504, 0x0, 0xff0504, 0x0, 0x0, 0xff0504, 0xff0504, 0x0, 0x0, 0xff0504, 0x0, 0xff0504, 0xff0504, 0x0,
+    0xff0504, 0x0, 0x0, 0xff0504, 0x0, 0xff0504, 0xff0504, 0x0, 0x0, 0xff0504, 0xff0504, 0x0, 0xff0504, 0x0, 0x0, 0xff0504,
+    0x504, 0x0, 0x0, 0x30504, 0x0, 0x50504, 0x60504, 0x0, 0x0, 0x90504, 0xa0504, 0x0, 0xc0504, 0x0, 0x0, 0xf0504,
+    0x0, 0x110504, 0x120504, 0x0, 0x140504, 0x0, 0x0, 0x170504, 0x180504, 0x0, 0x0, 0x1b0504, 0x0, 0x1d0504, 0x1e0504, 0x0,
+    0x200504, 0x0, 0x0, 0x230504, 0x0, 0x250504, 0x260504, 0x0, 0x0, 0x290504, 0x2a0504, 0x0, 0x2c0504, 0x0, 0x0, 0x2f0504,
+    0x0, 0x310504, 0x320504, 0x0, 0x340504, 0x0, 0x0, 0x370504, 0x380504, 0x0, 0x0, 0x3b0504, 0x0, 0x3d0504, 0x3e0504, 0x0,
+    0x0, 0x410504, 0x420504, 0x0, 0x440504, 0x0, 0x0, 0x470504, 0x480504, 0x0, 0x0, 0x4b0504, 0x0, 0x4d0504, 0x4e0504, 0x0,
+    0x500504, 0x0, 0x0, 0x530504, 0x0, 0x550504, 0x560504, 0x0, 0x0, 0x590504, 0x5a0504, 0x0, 0x5c0504, 0x0, 0x0, 0x5f0504,
+    0xff0504, 0x0, 0x0, 0xff0504, 0x0, 0xff0504, 0xff0504, 0x0, 0x0, 0xff0504, 0xff0504, 0x0, 0xff0504, 0x0, 0x0, 0xff0504,
+    0x0, 0xff0504, 0xff0504, 0x0, 0xff0504, 0x0, 0x0, 0xff0504, 0xff0504, 0x0, 0x0, 0xff0504, 0x0, 0xff0504, 0xff0504, 0x0,
+    0x0, 0x10504, 0x20504, 0x0, 0x40504, 0x0, 0x0, 0x70504, 0x80504, 0x0, 0x0, 0xb0504, 0x0, 0xd0504, 0xe0504, 0x0,
+    0x100504, 0x0, 0x0, 0x130504, 0x0, 0x150504, 0x160504, 0x0, 0x0, 0x190504, 0x1a0504, 0x0, 0x1c0504, 0x0, 0x0, 0x1f0504,
+    0x0, 0x210504, 0x220504, 0x0, 0x240504, 0x0, 0x0, 0x270504, 0x280504, 0x0, 0x0, 0x2b0504, 0x0, 0x2d0504, 0x2e0504, 0x0,
+    0x300504, 0x0, 0x0, 0x330504, 0x0, 0x350504, 0x360504, 0x0, 0x0, 0x390504, 0x3a0504, 0x0, 0x3c0504, 0x0, 0x0, 0x3f0504,
+    0x400504, 0x0, 0x0, 0x430504, 0x0, 0x450504, 0x460504, 0x0, 0x0, 0x490504, 0x4a0504, 0x0, 0x4c0504, 0x0, 0x0, 0x4f0504,
+    0x0, 0x510504, 0x520504, 0x0, 0x540504, 0x0, 0x0, 0x570504, 0x580504, 0x0, 0x0, 0x5b0504, 0x0, 0x5d0504, 0x5e0504, 0x0,
+    0x0, 0xff0604, 0xff0604, 0x0, 0xff0604, 0x0, 0x0, 0xff0604, 0xff0604, 0x0, 0x0, 0xff0604, 0x0, 0xff0604, 0xff0604, 0x0,
+    0xff0604, 0x0, 0x0, 0xff0604, 0x0, 0xff0604, 0xff0604, 0x0, 0x0, 0xff0604, 0xff0604, 0x0, 0xff0604, 0x0, 0x0, 0xff0604,
+    0x604, 0x0, 0x0, 0x30604, 0x0, 0x50604, 0x60604, 0x0, 0x0, 0x90604, 0xa0604, 0x0, 0xc0604, 0x0, 0x0, 0xf0604,
+    0x0, 0x110604, 0x120604, 0x0, 0x140604, 0x0, 0x0, 0x170604, 0x180604, 0x0, 0x0, 0x1b0604, 0x0, 0x1d0604, 0x1e0604, 0x0,
+    0x200604, 0x0, 0x0, 0x230604, 0x0, 0x250604, 0x260604, 0x0, 0x0, 0x290604, 0x2a0604, 0x0, 0x2c0604, 0x0, 0x0, 0x2f0604,
+    0x0, 0x310604, 0x320604, 0x0, 0x340604, 0x0, 0x0, 0x370604, 0x380604, 0x0, 0x0, 0x3b0604, 0x0, 0x3d0604, 0x3e0604, 0x0,
+    0x0, 0x410604, 0x420604, 0x0, 0x440604, 0x0, 0x0, 0x470604, 0x480604, 0x0, 0x0, 0x4b0604, 0x0, 0x4d0604, 0x4e0604, 0x0,
+    0x500604, 0x0, 0x0, 0x530604, 0x0, 0x550604, 0x560604, 0x0, 0x0, 0x590604, 0x5a0604, 0x0, 0x5c0604, 0x0, 0x0, 0x5f0604,
+    0xff0604, 0x0, 0x0, 0xff0604, 0x0, 0xff0604, 0xff0604, 0x0, 0x0, 0xff0604, 0xff0604, 0x0, 0xff0604, 0x0, 0x0, 0xff0604,
+    0x0, 0xff0604, 0xff0604, 0x0, 0xff0604, 0x0, 0x0, 0xff0604, 0xff0604, 0x0, 0x0, 0xff0604, 0x0, 0xff0604, 0xff0604, 0x0,
+    0x0, 0x10604, 0x20604, 0x0, 0x40604, 0x0, 0x0, 0x70604, 0x80604, 0x0, 0x0, 0xb0604, 0x0, 0xd0604, 0xe0604, 0x0,
+    0x100604, 0x0, 0x0, 0x130604, 0x0, 0x150604, 0x160604, 0x0, 0x0, 0x190604, 0x1a0604, 0x0, 0x1c0604, 0x0, 0x0, 0x1f0604,
+    0x0, 0x210604, 0x220604, 0x0, 0x240604, 0x0, 0x0, 0x270604, 0x280604, 0x0, 0x0, 0x2b0604, 0x0, 0x2d0604, 0x2e0604, 0x0,
+    0x300604, 0x0, 0x0, 0x330604, 0x0, 0x350604, 0x360604, 0x0, 0x0, 0x390604, 0x3a0604, 0x0, 0x3c0604, 0x0, 0x0, 0x3f0604,
+    0x400604, 0x0, 0x0, 0x430604, 0x0, 0x450604, 0x460604, 0x0, 0x0, 0x490604, 0x4a0604, 0x0, 0x4c0604, 0x0, 0x0, 0x4f0604,
+    0x0, 0x510604, 0x520604, 0x0, 0x540604, 0x0, 0x0, 0x570604, 0x580604, 0x0, 0x0, 0x5b0604, 0x0, 0x5d0604, 0x5e0604, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0914, 0xff0914, 0x0, 0xff0914, 0x0, 0x0, 0xff0914, 0xff0914, 0x0, 0x0, 0xff0914, 0x0, 0xff0914, 0xff0914, 0x0,
+    0xff0914, 0x0, 0x0, 0xff0914, 0x0, 0xff0914, 0xff0914, 0x0, 0x0, 0xff0914, 0xff0914, 0x0, 0xff0914, 0x0, 0x0, 0xff0914,
+    0x914, 0x0, 0x0, 0x30914, 0x0, 0x50914, 0x60914, 0x0, 0x0, 0x90914, 0xa0914, 0x0, 0xc0914, 0x0, 0x0, 0xf0914,
+    0x0, 0x110914, 0x120914, 0x0, 0x140914, 0x0, 0x0, 0x170914, 0x180914, 0x0, 0x0, 0x1b0914, 0x0, 0x1d0914, 0x1e0914, 0x0,
+    0x200914, 0x0, 0x0, 0x230914, 0x0, 0x250914, 0x260914, 0x0, 0x0, 0x290914, 0x2a0914, 0x0, 0x2c0914, 0x0, 0x0, 0x2f0914,
+    0x0, 0x310914, 0x320914, 0x0, 0x340914, 0x0, 0x0, 0x370914, 0x380914, 0x0, 0x0, 0x3b0914, 0x0, 0x3d0914, 0x3e0914, 0x0,
+    0x0, 0x410914, 0x420914, 0x0, 0x440914, 0x0, 0x0, 0x470914, 0x480914, 0x0, 0x0, 0x4b0914, 0x0, 0x4d0914, 0x4e0914, 0x0,
+    0x500914, 0x0, 0x0, 0x530914, 0x0, 0x550914, 0x560914, 0x0, 0x0, 0x590914, 0x5a0914, 0x0, 0x5c0914, 0x0, 0x0, 0x5f0914,
+    0xff0914, 0x0, 0x0, 0xff0914, 0x0, 0xff0914, 0xff0914, 0x0, 0x0, 0xff0914, 0xff0914, 0x0, 0xff0914, 0x0, 0x0, 0xff0914,
+    0x0, 0xff0914, 0xff0914, 0x0, 0xff0914, 0x0, 0x0, 0xff0914, 0xff0914, 0x0, 0x0, 0xff0914, 0x0, 0xff0914, 0xff0914, 0x0,
+    0x0, 0x10914, 0x20914, 0x0, 0x40914, 0x0, 0x0, 0x70914, 0x80914, 0x0, 0x0, 0xb0914, 0x0, 0xd0914, 0xe0914, 0x0,
+    0x100914, 0x0, 0x0, 0x130914, 0x0, 0x150914, 0x160914, 0x0, 0x0, 0x190914, 0x1a0914, 0x0, 0x1c0914, 0x0, 0x0, 0x1f0914,
+    0x0, 0x210914, 0x220914, 0x0, 0x240914, 0x0, 0x0, 0x270914, 0x280914, 0x0, 0x0, 0x2b0914, 0x0, 0x2d0914, 0x2e0914, 0x0,
+    0x300914, 0x0, 0x0, 0x330914, 0x0, 0x350914, 0x360914, 0x0, 0x0, 0x390914, 0x3a0914, 0x0, 0x3c0914, 0x0, 0x0, 0x3f0914,
+    0x400914, 0x0, 0x0, 0x430914, 0x0, 0x450914, 0x460914, 0x0, 0x0, 0x490914, 0x4a0914, 0x0, 0x4c0914, 0x0, 0x0, 0x4f0914,
+    0x0, 0x510914, 0x520914, 0x0, 0x540914, 0x0, 0x0, 0x570914, 0x580914, 0x0, 0x0, 0x5b0914, 0x0, 0x5d0914, 0x5e0914, 0x0,
+    0x0, 0xff0a14, 0xff0a14, 0x0, 0xff0a14, 0x0, 0x0, 0xff0a14, 0xff0a14, 0x0, 0x0, 0xff0a14, 0x0, 0xff0a14, 0xff0a14, 0x0,
+    0xff0a14, 0x0, 0x0, 0xff0a14, 0x0, 0xff0a14, 0xff0a14, 0x0, 0x0, 0xff0a14, 0xff0a14, 0x0, 0xff0a14, 0x0, 0x0, 0xff0a14,
+    0xa14, 0x0, 0x0, 0x30a14, 0x0, 0x50a14, 0x60a14, 0x0, 0x0, 0x90a14, 0xa0a14, 0x0, 0xc0a14, 0x0, 0x0, 0xf0a14,
+    0x0, 0x110a14, 0x120a14, 0x0, 0x140a14, 0x0, 0x0, 0x170a14, 0x180a14, 0x0, 0x0, 0x1b0a14, 0x0, 0x1d0a14, 0x1e0a14, 0x0,
+    0x200a14, 0x0, 0x0, 0x230a14, 0x0, 0x250a14, 0x260a14, 0x0, 0x0, 0x290a14, 0x2a0a14, 0x0, 0x2c0a14, 0x0, 0x0, 0x2f0a14,
+    0x0, 0x310a14, 0x320a14, 0x0, 0x340a14, 0x0, 0x0, 0x370a14, 0x380a14, 0x0, 0x0, 0x3b0a14, 0x0, 0x3d0a14, 0x3e0a14, 0x0,
+    0x0, 0x410a14, 0x420a14, 0x0, 0x440a14, 0x0, 0x0, 0x470a14, 0x480a14, 0x0, 0x0, 0x4b0a14, 0x0, 0x4d0a14, 0x4e0a14, 0x0,
+    0x500a14, 0x0, 0x0, 0x530a14, 0x0, 0x550a14, 0x560a14, 0x0, 0x0, 0x590a14, 0x5a0a14, 0x0, 0x5c0a14, 0x0, 0x0, 0x5f0a14,
+    0xff0a14, 0x0, 0x0, 0xff0a14, 0x0, 0xff0a14, 0xff0a14, 0x0, 0x0, 0xff0a14, 0xff0a14, 0x0, 0xff0a14, 0x0, 0x0, 0xff0a14,
+    0x0, 0xff0a14, 0xff0a14, 0x0, 0xff0a14, 0x0, 0x0, 0xff0a14, 0xff0a14, 0x0, 0x0, 0xff0a14, 0x0, 0xff0a14, 0xff0a14, 0x0,
+    0x0, 0x10a14, 0x20a14, 0x0, 0x40a14, 0x0, 0x0, 0x70a14, 0x80a14, 0x0, 0x0, 0xb0a14, 0x0, 0xd0a14, 0xe0a14, 0x0,
+    0x100a14, 0x0, 0x0, 0x130a14, 0x0, 0x150a14, 0x160a14, 0x0, 0x0, 0x190a14, 0x1a0a14, 0x0, 0x1c0a14, 0x0, 0x0, 0x1f0a14,
+    0x0, 0x210a14, 0x220a14, 0x0, 0x240a14, 0x0, 0x0, 0x270a14, 0x280a14, 0x0, 0x0, 0x2b0a14, 0x0, 0x2d0a14, 0x2e0a14, 0x0,
+    0x300a14, 0x0, 0x0, 0x330a14, 0x0, 0x350a14, 0x360a14, 0x0, 0x0, 0x390a14, 0x3a0a14, 0x0, 0x3c0a14, 0x0, 0x0, 0x3f0a14,
+    0x400a14, 0x0, 0x0, 0x430a14, 0x0, 0x450a14, 0x460a14, 0x0, 0x0, 0x490a14, 0x4a0a14, 0x0, 0x4c0a14, 0x0, 0x0, 0x4f0a14,
+    0x0, 0x510a14, 0x520a14, 0x0, 0x540a14, 0x0, 0x0, 0x570a14, 0x580a14, 0x0, 0x0, 0x5b0a14, 0x0, 0x5d0a14, 0x5e0a14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0c14, 0xff0c14, 0x0, 0xff0c14, 0x0, 0x0, 0xff0c14, 0xff0c14, 0x0, 0x0, 0xff0c14, 0x0, 0xff0c14, 0xff0c14, 0x0,
+    0xff0c14, 0x0, 0x0, 0xff0c14, 0x0, 0xff0c14, 0xff0c14, 0x0, 0x0, 0xff0c14, 0xff0c14, 0x0, 0xff0c14, 0x0, 0x0, 0xff0c14,
+    0xc14, 0x0, 0x0, 0x30c14, 0x0, 0x50c14, 0x60c14, 0x0, 0x0, 0x90c14, 0xa0c14, 0x0, 0xc0c14, 0x0, 0x0, 0xf0c14,
+    0x0, 0x110c14, 0x120c14, 0x0, 0x140c14, 0x0, 0x0, 0x170c14, 0x180c14, 0x0, 0x0, 0x1b0c14, 0x0, 0x1d0c14, 0x1e0c14, 0x0,
+    0x200c14, 0x0, 0x0, 0x230c14, 0x0, 0x250c14, 0x260c14, 0x0, 0x0, 0x290c14, 0x2a0c14, 0x0, 0x2c0c14, 0x0, 0x0, 0x2f0c14,
+    0x0, 0x310c14, 0x320c14, 0x0, 0x340c14, 0x0, 0x0, 0x370c14, 0x380c14, 0x0, 0x0, 0x3b0c14, 0x0, 0x3d0c14, 0x3e0c14, 0x0,
+    0x0, 0x410c14, 0x420c14, 0x0, 0x440c14, 0x0, 0x0, 0x470c14, 0x480c14, 0x0, 0x0, 0x4b0c14, 0x0, 0x4d0c14, 0x4e0c14, 0x0,
+    0x500c14, 0x0, 0x0, 0x530c14, 0x0, 0x550c14, 0x560c14, 0x0, 0x0, 0x590c14, 0x5a0c14, 0x0, 0x5c0c14, 0x0, 0x0, 0x5f0c14,
+    0xff0c14, 0x0, 0x0, 0xff0c14, 0x0, 0xff0c14, 0xff0c14, 0x0, 0x0, 0xff0c14, 0xff0c14, 0x0, 0xff0c14, 0x0, 0x0, 0xff0c14,
+    0x0, 0xff0c14, 0xff0c14, 0x0, 0xff0c14, 0x0, 0x0, 0xff0c14, 0xff0c14, 0x0, 0x0, 0xff0c14, 0x0, 0xff0c14, 0xff0c14, 0x0,
+    0x0, 0x10c14, 0x20c14, 0x0, 0x40c14, 0x0, 0x0, 0x70c14, 0x80c14, 0x0, 0x0, 0xb0c14, 0x0, 0xd0c14, 0xe0c14, 0x0,
+    0x100c14, 0x0, 0x0, 0x130c14, 0x0, 0x150c14, 0x160c14, 0x0, 0x0, 0x190c14, 0x1a0c14, 0x0, 0x1c0c14, 0x0, 0x0, 0x1f0c14,
+    0x0, 0x210c14, 0x220c14, 0x0, 0x240c14, 0x0, 0x0, 0x270c14, 0x280c14, 0x0, 0x0, 0x2b0c14, 0x0, 0x2d0c14, 0x2e0c14, 0x0,
+    0x300c14, 0x0, 0x0, 0x330c14, 0x0, 0x350c14, 0x360c14, 0x0, 0x0, 0x390c14, 0x3a0c14, 0x0, 0x3c0c14, 0x0, 0x0, 0x3f0c14,
+    0x400c14, 0x0, 0x0, 0x430c14, 0x0, 0x450c14, 0x460c14, 0x0, 0x0, 0x490c14, 0x4a0c14, 0x0, 0x4c0c14, 0x0, 0x0, 0x4f0c14,
+    0x0, 0x510c14, 0x520c14, 0x0, 0x540c14, 0x0, 0x0, 0x570c14, 0x580c14, 0x0, 0x0, 0x5b0c14, 0x0, 0x5d0c14, 0x5e0c14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0f14, 0xff0f14, 0x0, 0xff0f14, 0x0, 0x0, 0xff0f14, 0xff0f14, 0x0, 0x0, 0xff0f14, 0x0, 0xff0f14, 0xff0f14, 0x0,
+    0xff0f14, 0x0, 0x0, 0xff0f14, 0x0, 0xff0f14, 0xff0f14, 0x0, 0x0, 0xff0f14, 0xff0f14, 0x0, 0xff0f14, 0x0, 0x0, 0xff0f14,
+    0xf14, 0x0, 0x0, 0x30f14, 0x0, 0x50f14, 0x60f14, 0x0, 0x0, 0x90f14, 0xa0f14, 0x0, 0xc0f14, 0x0, 0x0, 0xf0f14,
+    0x0, 0x110f14, 0x120f14, 0x0, 0x140f14, 0x0, 0x0, 0x170f14, 0x180f14, 0x0, 0x0, 0x1b0f14, 0x0, 0x1d0f14, 0x1e0f14, 0x0,
+    0x200f14, 0x0, 0x0, 0x230f14, 0x0, 0x250f14, 0x260f14, 0x0, 0x0, 0x290f14, 0x2a0f14, 0x0, 0x2c0f14, 0x0, 0x0, 0x2f0f14,
+    0x0, 0x310f14, 0x320f14, 0x0, 0x340f14, 0x0, 0x0, 0x370f14, 0x380f14, 0x0, 0x0, 0x3b0f14, 0x0, 0x3d0f14, 0x3e0f14, 0x0,
+    0x0, 0x410f14, 0x420f14, 0x0, 0x440f14, 0x0, 0x0, 0x470f14, 0x480f14, 0x0, 0x0, 0x4b0f14, 0x0, 0x4d0f14, 0x4e0f14, 0x0,
+    0x500f14, 0x0, 0x0, 0x530f14, 0x0, 0x550f14, 0x560f14, 0x0, 0x0, 0x590f14, 0x5a0f14, 0x0, 0x5c0f14, 0x0, 0x0, 0x5f0f14,
+    0xff0f14, 0x0, 0x0, 0xff0f14, 0x0, 0xff0f14, 0xff0f14, 0x0, 0x0, 0xff0f14, 0xff0f14, 0x0, 0xff0f14, 0x0, 0x0, 0xff0f14,
+    0x0, 0xff0f14, 0xff0f14, 0x0, 0xff0f14, 0x0, 0x0, 0xff0f14, 0xff0f14, 0x0, 0x0, 0xff0f14, 0x0, 0xff0f14, 0xff0f14, 0x0,
+    0x0, 0x10f14, 0x20f14, 0x0, 0x40f14, 0x0, 0x0, 0x70f14, 0x80f14, 0x0, 0x0, 0xb0f14, 0x0, 0xd0f14, 0xe0f14, 0x0,
+    0x100f14, 0x0, 0x0, 0x130f14, 0x0, 0x150f14, 0x160f14, 0x0, 0x0, 0x190f14, 0x1a0f14, 0x0, 0x1c0f14, 0x0, 0x0, 0x1f0f14,
+    0x0, 0x210f14, 0x220f14, 0x0, 0x240f14, 0x0, 0x0, 0x270f14, 0x280f14, 0x0, 0x0, 0x2b0f14, 0x0, 0x2d0f14, 0x2e0f14, 0x0,
+    0x300f14, 0x0, 0x0, 0x330f14, 0x0, 0x350f14, 0x360f14, 0x0, 0x0, 0x390f14, 0x3a0f14, 0x0, 0x3c0f14, 0x0, 0x0, 0x3f0f14,
+    0x400f14, 0x0, 0x0, 0x430f14, 0x0, 0x450f14, 0x460f14, 0x0, 0x0, 0x490f14, 0x4a0f14, 0x0, 0x4c0f14, 0x0, 0x0, 0x4f0f14,
+    0x0, 0x510f14, 0x520f14, 0x0, 0x540f14, 0x0, 0x0, 0x570f14, 0x580f14, 0x0, 0x0, 0x5b0f14, 0x0, 0x5d0f14, 0x5e0f14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1104, 0xff1104, 0x0, 0xff1104, 0x0, 0x0, 0xff1104, 0xff1104, 0x0, 0x0, 0xff1104, 0x0, 0xff1104, 0xff1104, 0x0,
+    0xff1104, 0x0, 0x0, 0xff1104, 0x0, 0xff1104, 0xff1104, 0x0, 0x0, 0xff1104, 0xff1104, 0x0, 0xff1104, 0x0, 0x0, 0xff1104,
+    0x1104, 0x0, 0x0, 0x31104, 0x0, 0x51104, 0x61104, 0x0, 0x0, 0x91104, 0xa1104, 0x0, 0xc1104, 0x0, 0x0, 0xf1104,
+    0x0, 0x111104, 0x121104, 0x0, 0x141104, 0x0, 0x0, 0x171104, 0x181104, 0x0, 0x0, 0x1b1104, 0x0, 0x1d1104, 0x1e1104, 0x0,
+    0x201104, 0x0, 0x0, 0x231104, 0x0, 0x251104, 0x261104, 0x0, 0x0, 0x291104, 0x2a1104, 0x0, 0x2c1104, 0x0, 0x0, 0x2f1104,
+    0x0, 0x311104, 0x321104, 0x0, 0x341104, 0x0, 0x0, 0x371104, 0x381104, 0x0, 0x0, 0x3b1104, 0x0, 0x3d1104, 0x3e1104, 0x0,
+    0x0, 0x411104, 0x421104, 0x0, 0x441104, 0x0, 0x0, 0x471104, 0x481104, 0x0, 0x0, 0x4b1104, 0x0, 0x4d1104, 0x4e1104, 0x0,
+    0x501104, 0x0, 0x0, 0x531104, 0x0, 0x551104, 0x561104, 0x0, 0x0, 0x591104, 0x5a1104, 0x0, 0x5c1104, 0x0, 0x0, 0x5f1104,
+    0xff1104, 0x0, 0x0, 0xff1104, 0x0, 0xff1104, 0xff1104, 0x0, 0x0, 0xff1104, 0xff1104, 0x0, 0xff1104, 0x0, 0x0, 0xff1104,
+    0x0, 0xff1104, 0xff1104, 0x0, 0xff1104, 0x0, 0x0, 0xff1104, 0xff1104, 0x0, 0x0, 0xff1104, 0x0, 0xff1104, 0xff1104, 0x0,
+    0x0, 0x11104, 0x21104, 0x0, 0x41104, 0x0, 0x0, 0x71104, 0x81104, 0x0, 0x0, 0xb1104, 0x0, 0xd1104, 0xe1104, 0x0,
+    0x101104, 0x0, 0x0, 0x131104, 0x0, 0x151104, 0x161104, 0x0, 0x0, 0x191104, 0x1a1104, 0x0, 0x1c1104, 0x0, 0x0, 0x1f1104,
+    0x0, 0x211104, 0x221104, 0x0, 0x241104, 0x0, 0x0, 0x271104, 0x281104, 0x0, 0x0, 0x2b1104, 0x0, 0x2d1104, 0x2e1104, 0x0,
+    0x301104, 0x0, 0x0, 0x331104, 0x0, 0x351104, 0x361104, 0x0, 0x0, 0x391104, 0x3a1104, 0x0, 0x3c1104, 0x0, 0x0, 0x3f1104,
+    0x401104, 0x0, 0x0, 0x431104, 0x0, 0x451104, 0x461104, 0x0, 0x0, 0x491104, 0x4a1104, 0x0, 0x4c1104, 0x0, 0x0, 0x4f1104,
+    0x0, 0x511104, 0x521104, 0x0, 0x541104, 0x0, 0x0, 0x571104, 0x581104, 0x0, 0x0, 0x5b1104, 0x0, 0x5d1104, 0x5e1104, 0x0,
+    0x0, 0xff1204, 0xff1204, 0x0, 0xff1204, 0x0, 0x0, 0xff1204, 0xff1204, 0x0, 0x0, 0xff1204, 0x0, 0xff1204, 0xff1204, 0x0,
+    0xff1204, 0x0, 0x0, 0xff1204, 0x0, 0xff1204, 0xff1204, 0x0, 0x0, 0xff1204, 0xff1204, 0x0, 0xff1204, 0x0, 0x0, 0xff1204,
+    0x1204, 0x0, 0x0, 0x31204, 0x0, 0x51204, 0x61204, 0x0, 0x0, 0x91204, 0xa1204, 0x0, 0xc1204, 0x0, 0x0, 0xf1204,
+    0x0, 0x111204, 0x121204, 0x0, 0x141204, 0x0, 0x0, 0x171204, 0x181204, 0x0, 0x0, 0x1b1204, 0x0, 0x1d1204, 0x1e1204, 0x0,
+    0x201204, 0x0, 0x0, 0x231204, 0x0, 0x251204, 0x261204, 0x0, 0x0, 0x291204, 0x2a1204, 0x0, 0x2c1204, 0x0, 0x0, 0x2f1204,
+    0x0, 0x311204, 0x321204, 0x0, 0x341204, 0x0, 0x0, 0x371204, 0x381204, 0x0, 0x0, 0x3b1204, 0x0, 0x3d1204, 0x3e1204, 0x0,
+    0x0, 0x411204, 0x421204, 0x0, 0x441204, 0x0, 0x0, 0x471204, 0x481204, 0x0, 0x0, 0x4b1204, 0x0, 0x4d1204, 0x4e1204, 0x0,
+    0x501204, 0x0, 0x0, 0x531204, 0x0, 0x551204, 0x561204, 0x0, 0x0, 0x591204, 0x5a1204, 0x0, 0x5c1204, 0x0, 0x0, 0x5f1204,
+    0xff1204, 0x0, 0x0, 0xff1204, 0x0, 0xff1204, 0xff1204, 0x0, 0x0, 0xff1204, 0xff1204, 0x0, 0xff1204, 0x0, 0x0, 0xff1204,
+    0x0, 0xff1204, 0xff1204, 0x0, 0xff1204, 0x0, 0x0, 0xff1204, 0xff1204, 0x0, 0x0, 0xff1204, 0x0, 0xff1204, 0xff1204, 0x0,
+    0x0, 0x11204, 0x21204, 0x0, 0x41204, 0x0, 0x0, 0x71204, 0x81204, 0x0, 0x0, 0xb1204, 0x0, 0xd1204, 0xe1204, 0x0,
+    0x101204, 0x0, 0x0, 0x131204, 0x0, 0x151204, 0x161204, 0x0, 0x0, 0x191204, 0x1a1204, 0x0, 0x1c1204, 0x0, 0x0, 0x1f1204,
+    0x0, 0x211204, 0x221204, 0x0, 0x241204, 0x0, 0x0, 0x271204, 0x281204, 0x0, 0x0, 0x2b1204, 0x0, 0x2d1204, 0x2e1204, 0x0,
+    0x301204, 0x0, 0x0, 0x331204, 0x0, 0x351204, 0x361204, 0x0, 0x0, 0x391204, 0x3a1204, 0x0, 0x3c1204, 0x0, 0x0, 0x3f1204,
+    0x401204, 0x0, 0x0, 0x431204, 0x0, 0x451204, 0x461204, 0x0, 0x0, 0x491204, 0x4a1204, 0x0, 0x4c1204, 0x0, 0x0, 0x4f1204,
+    0x0, 0x511204, 0x521204, 0x0, 0x541204, 0x0, 0x0, 0x571204, 0x581204, 0x0, 0x0, 0x5b1204, 0x0, 0x5d1204, 0x5e1204, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1404, 0xff1404, 0x0, 0xff1404, 0x0, 0x0, 0xff1404, 0xff1404, 0x0, 0x0, 0xff1404, 0x0, 0xff1404, 0xff1404, 0x0,
+    0xff1404, 0x0, 0x0, 0xff1404, 0x0, 0xff1404, 0xff1404, 0x0, 0x0, 0xff1404, 0xff1404, 0x0, 0xff1404, 0x0, 0x0, 0xff1404,
+    0x1404, 0x0, 0x0, 0x31404, 0x0, 0x51404, 0x61404, 0x0, 0x0, 0x91404, 0xa1404, 0x0, 0xc1404, 0x0, 0x0, 0xf1404,
+    0x0, 0x111404, 0x121404, 0x0, 0x141404, 0x0, 0x0, 0x171404, 0x181404, 0x0, 0x0, 0x1b1404, 0x0, 0x1d1404, 0x1e1404, 0x0,
+    0x201404, 0x0, 0x0, 0x231404, 0x0, 0x251404, 0x261404, 0x0, 0x0, 0x291404, 0x2a1404, 0x0, 0x2c1404, 0x0, 0x0, 0x2f1404,
+    0x0, 0x311404, 0x321404, 0x0, 0x341404, 0x0, 0x0, 0x371404, 0x381404, 0x0, 0x0, 0x3b1404, 0x0, 0x3d1404, 0x3e1404, 0x0,
+    0x0, 0x411404, 0x421404, 0x0, 0x441404, 0x0, 0x0, 0x471404, 0x481404, 0x0, 0x0, 0x4b1404, 0x0, 0x4d1404, 0x4e1404, 0x0,
+    0x501404, 0x0, 0x0, 0x531404, 0x0, 0x551404, 0x561404, 0x0, 0x0, 0x591404, 0x5a1404, 0x0, 0x5c1404, 0x0, 0x0, 0x5f1404,
+    0xff1404, 0x0, 0x0, 0xff1404, 0x0, 0xff1404, 0xff1404, 0x0, 0x0, 0xff1404, 0xff1404, 0x0, 0xff1404, 0x0, 0x0, 0xff1404,
+    0x0, 0xff1404, 0xff1404, 0x0, 0xff1404, 0x0, 0x0, 0xff1404, 0xff1404, 0x0, 0x0, 0xff1404, 0x0, 0xff1404, 0xff1404, 0x0,
+    0x0, 0x11404, 0x21404, 0x0, 0x41404, 0x0, 0x0, 0x71404, 0x81404, 0x0, 0x0, 0xb1404, 0x0, 0xd1404, 0xe1404, 0x0,
+    0x101404, 0x0, 0x0, 0x131404, 0x0, 0x151404, 0x161404, 0x0, 0x0, 0x191404, 0x1a1404, 0x0, 0x1c1404, 0x0, 0x0, 0x1f1404,
+    0x0, 0x211404, 0x221404, 0x0, 0x241404, 0x0, 0x0, 0x271404, 0x281404, 0x0, 0x0, 0x2b1404, 0x0, 0x2d1404, 0x2e1404, 0x0,
+    0x301404, 0x0, 0x0, 0x331404, 0x0, 0x351404, 0x361404, 0x0, 0x0, 0x391404, 0x3a1404, 0x0, 0x3c1404, 0x0, 0x0, 0x3f1404,
+    0x401404, 0x0, 0x0, 0x431404, 0x0, 0x451404, 0x461404, 0x0, 0x0, 0x491404, 0x4a1404, 0x0, 0x4c1404, 0x0, 0x0, 0x4f1404,
+    0x0, 0x511404, 0x521404, 0x0, 0x541404, 0x0, 0x0, 0x571404, 0x581404, 0x0, 0x0, 0x5b1404, 0x0, 0x5d1404, 0x5e1404, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1704, 0xff1704, 0x0, 0xff1704, 0x0, 0x0, 0xff1704, 0xff1704, 0x0, 0x0, 0xff1704, 0x0, 0xff1704, 0xff1704, 0x0,
+    0xff1704, 0x0, 0x0, 0xff1704, 0x0, 0xff1704, 0xff1704, 0x0, 0x0, 0xff1704, 0xff1704, 0x0, 0xff1704, 0x0, 0x0, 0xff1704,
+    0x1704, 0x0, 0x0, 0x31704, 0x0, 0x51704, 0x61704, 0x0, 0x0, 0x91704, 0xa1704, 0x0, 0xc1704, 0x0, 0x0, 0xf1704,
+    0x0, 0x111704, 0x121704, 0x0, 0x141704, 0x0, 0x0, 0x171704, 0x181704, 0x0, 0x0, 0x1b1704, 0x0, 0x1d1704, 0x1e1704, 0x0,
+    0x201704, 0x0, 0x0, 0x231704, 0x0, 0x251704, 0x261704, 0x0, 0x0, 0x291704, 0x2a1704, 0x0, 0x2c1704, 0x0, 0x0, 0x2f1704,
+    0x0, 0x311704, 0x321704, 0x0, 0x341704, 0x0, 0x0, 0x371704, 0x381704, 0x0, 0x0, 0x3b1704, 0x0, 0x3d1704, 0x3e1704, 0x0,
+    0x0, 0x411704, 0x421704, 0x0, 0x441704, 0x0, 0x0, 0x471704, 0x481704, 0x0, 0x0, 0x4b1704, 0x0, 0x4d1704, 0x4e1704, 0x0,
+    0x501704, 0x0, 0x0, 0x531704, 0x0, 0x551704, 0x561704, 0x0, 0x0, 0x591704, 0x5a1704, 0x0, 0x5c1704, 0x0, 0x0, 0x5f1704,
+    0xff1704, 0x0, 0x0, 0xff1704, 0x0, 0xff1704, 0xff1704, 0x0, 0x0, 0xff1704, 0xff1704, 0x0, 0xff1704, 0x0, 0x0, 0xff1704,
+    0x0, 0xff1704, 0xff1704, 0x0, 0xff1704, 0x0, 0x0, 0xff1704, 0xff1704, 0x0, 0x0, 0xff1704, 0x0, 0xff1704, 0xff1704, 0x0,
+    0x0, 0x11704, 0x21704, 0x0, 0x41704, 0x0, 0x0, 0x71704, 0x81704, 0x0, 0x0, 0xb1704, 0x0, 0xd1704, 0xe1704, 0x0,
+    0x101704, 0x0, 0x0, 0x131704, 0x0, 0x151704, 0x161704, 0x0, 0x0, 0x191704, 0x1a1704, 0x0, 0x1c1704, 0x0, 0x0, 0x1f1704,
+    0x0, 0x211704, 0x221704, 0x0, 0x241704, 0x0, 0x0, 0x271704, 0x281704, 0x0, 0x0, 0x2b1704, 0x0, 0x2d1704, 0x2e1704, 0x0,
+    0x301704, 0x0, 0x0, 0x331704, 0x0, 0x351704, 0x361704, 0x0, 0x0, 0x391704, 0x3a1704, 0x0, 0x3c1704, 0x0, 0x0, 0x3f1704,
+    0x401704, 0x0, 0x0, 0x431704, 0x0, 0x451704, 0x461704, 0x0, 0x0, 0x491704, 0x4a1704, 0x0, 0x4c1704, 0x0, 0x0, 0x4f1704,
+    0x0, 0x511704, 0x521704, 0x0, 0x541704, 0x0, 0x0, 0x571704, 0x581704, 0x0, 0x0, 0x5b1704, 0x0, 0x5d1704, 0x5e1704, 0x0,
+    0x0, 0xff1814, 0xff1814, 0x0, 0xff1814, 0x0, 0x0, 0xff1814, 0xff1814, 0x0, 0x0, 0xff1814, 0x0, 0xff1814, 0xff1814, 0x0,
+    0xff1814, 0x0, 0x0, 0xff1814, 0x0, 0xff1814, 0xff1814, 0x0, 0x0, 0xff1814, 0xff1814, 0x0, 0xff1814, 0x0, 0x0, 0xff1814,
+    0x1814, 0x0, 0x0, 0x31814, 0x0, 0x51814, 0x61814, 0x0, 0x0, 0x91814, 0xa1814, 0x0, 0xc1814, 0x0, 0x0, 0xf1814,
+    0x0, 0x111814, 0x121814, 0x0, 0x141814, 0x0, 0x0, 0x171814, 0x181814, 0x0, 0x0, 0x1b1814, 0x0, 0x1d1814, 0x1e1814, 0x0,
+    0x201814, 0x0, 0x0, 0x231814, 0x0, 0x251814, 0x261814, 0x0, 0x0, 0x291814, 0x2a1814, 0x0, 0x2c1814, 0x0, 0x0, 0x2f1814,
+    0x0, 0x311814, 0x321814, 0x0, 0x341814, 0x0, 0x0, 0x371814, 0x381814, 0x0, 0x0, 0x3b1814, 0x0, 0x3d1814, 0x3e1814, 0x0,
+    0x0, 0x411814, 0x421814, 0x0, 0x441814, 0x0, 0x0, 0x471814, 0x481814, 0x0, 0x0, 0x4b1814, 0x0, 0x4d1814, 0x4e1814, 0x0,
+    0x501814, 0x0, 0x0, 0x531814, 0x0, 0x551814, 0x561814, 0x0, 0x0, 0x591814, 0x5a1814, 0x0, 0x5c1814, 0x0, 0x0, 0x5f1814,
+    0xff1814, 0x0, 0x0, 0xff1814, 0x0, 0xff1814, 0xff1814, 0x0, 0x0, 0xff1814, 0xff1814, 0x0, 0xff1814, 0x0, 0x0, 0xff1814,
+    0x0, 0xff1814, 0xff1814, 0x0, 0xff1814, 0x0, 0x0, 0xff1814, 0xff1814, 0x0, 0x0, 0xff1814, 0x0, 0xff1814, 0xff1814, 0x0,
+    0x0, 0x11814, 0x21814, 0x0, 0x41814, 0x0, 0x0, 0x71814, 0x81814, 0x0, 0x0, 0xb1814, 0x0, 0xd1814, 0xe1814, 0x0,
+    0x101814, 0x0, 0x0, 0x131814, 0x0, 0x151814, 0x161814, 0x0, 0x0, 0x191814, 0x1a1814, 0x0, 0x1c1814, 0x0, 0x0, 0x1f1814,
+    0x0, 0x211814, 0x221814, 0x0, 0x241814, 0x0, 0x0, 0x271814, 0x281814, 0x0, 0x0, 0x2b1814, 0x0, 0x2d1814, 0x2e1814, 0x0,
+    0x301814, 0x0, 0x0, 0x331814, 0x0, 0x351814, 0x361814, 0x0, 0x0, 0x391814, 0x3a1814, 0x0, 0x3c1814, 0x0, 0x0, 0x3f1814,
+    0x401814, 0x0, 0x0, 0x431814, 0x0, 0x451814, 0x461814, 0x0, 0x0, 0x491814, 0x4a1814, 0x0, 0x4c1814, 0x0, 0x0, 0x4f1814,
+    0x0, 0x511814, 0x521814, 0x0, 0x541814, 0x0, 0x0, 0x571814, 0x581814, 0x0, 0x0, 0x5b1814, 0x0, 0x5d1814, 0x5e1814, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1b14, 0xff1b14, 0x0, 0xff1b14, 0x0, 0x0, 0xff1b14, 0xff1b14, 0x0, 0x0, 0xff1b14, 0x0, 0xff1b14, 0xff1b14, 0x0,
+    0xff1b14, 0x0, 0x0, 0xff1b14, 0x0, 0xff1b14, 0xff1b14, 0x0, 0x0, 0xff1b14, 0xff1b14, 0x0, 0xff1b14, 0x0, 0x0, 0xff1b14,
+    0x1b14, 0x0, 0x0, 0x31b14, 0x0, 0x51b14, 0x61b14, 0x0, 0x0, 0x91b14, 0xa1b14, 0x0, 0xc1b14, 0x0, 0x0, 0xf1b14,
+    0x0, 0x111b14, 0x121b14, 0x0, 0x141b14, 0x0, 0x0, 0x171b14, 0x181b14, 0x0, 0x0, 0x1b1b14, 0x0, 0x1d1b14, 0x1e1b14, 0x0,
+    0x201b14, 0x0, 0x0, 0x231b14, 0x0, 0x251b14, 0x261b14, 0x0, 0x0, 0x291b14, 0x2a1b14, 0x0, 0x2c1b14, 0x0, 0x0, 0x2f1b14,
+    0x0, 0x311b14, 0x321b14, 0x0, 0x341b14, 0x0, 0x0, 0x371b14, 0x381b14, 0x0, 0x0, 0x3b1b14, 0x0, 0x3d1b14, 0x3e1b14, 0x0,
+    0x0, 0x411b14, 0x421b14, 0x0, 0x441b14, 0x0, 0x0, 0x471b14, 0x481b14, 0x0, 0x0, 0x4b1b14, 0x0, 0x4d1b14, 0x4e1b14, 0x0,
+    0x501b14, 0x0, 0x0, 0x531b14, 0x0, 0x551b14, 0x561b14, 0x0, 0x0, 0x591b14, 0x5a1b14, 0x0, 0x5c1b14, 0x0, 0x0, 0x5f1b14,
+    0xff1b14, 0x0, 0x0, 0xff1b14, 0x0, 0xff1b14, 0xff1b14, 0x0, 0x0, 0xff1b14, 0xff1b14, 0x0, 0xff1b14, 0x0, 0x0, 0xff1b14,
+    0x0, 0xff1b14, 0xff1b14, 0x0, 0xff1b14, 0x0, 0x0, 0xff1b14, 0xff1b14, 0x0, 0x0, 0xff1b14, 0x0, 0xff1b14, 0xff1b14, 0x0,
+    0x0, 0x11b14, 0x21b14, 0x0, 0x41b14, 0x0, 0x0, 0x71b14, 0x81b14, 0x0, 0x0, 0xb1b14, 0x0, 0xd1b14, 0xe1b14, 0x0,
+    0x101b14, 0x0, 0x0, 0x131b14, 0x0, 0x151b14, 0x161b14, 0x0, 0x0, 0x191b14, 0x1a1b14, 0x0, 0x1c1b14, 0x0, 0x0, 0x1f1b14,
+    0x0, 0x211b14, 0x221b14, 0x0, 0x241b14, 0x0, 0x0, 0x271b14, 0x281b14, 0x0, 0x0, 0x2b1b14, 0x0, 0x2d1b14, 0x2e1b14, 0x0,
+    0x301b14, 0x0, 0x0, 0x331b14, 0x0, 0x351b14, 0x361b14, 0x0, 0x0, 0x391b14, 0x3a1b14, 0x0, 0x3c1b14, 0x0, 0x0, 0x3f1b14,
+    0x401b14, 0x0, 0x0, 0x431b14, 0x0, 0x451b14, 0x461b14, 0x0, 0x0, 0x491b14, 0x4a1b14, 0x0, 0x4c1b14, 0x0, 0x0, 0x4f1b14,
+    0x0, 0x511b14, 0x521b14, 0x0, 0x541b14, 0x0, 0x0, 0x571b14, 0x581b14, 0x0, 0x0, 0x5b1b14, 0x0, 0x5d1b14, 0x5e1b14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1d14, 0xff1d14, 0x0, 0xff1d14, 0x0, 0x0, 0xff1d14, 0xff1d14, 0x0, 0x0, 0xff1d14, 0x0, 0xff1d14, 0xff1d14, 0x0,
+    0xff1d14, 0x0, 0x0, 0xff1d14, 0x0, 0xff1d14, 0xff1d14, 0x0, 0x0, 0xff1d14, 0xff1d14, 0x0, 0xff1d14, 0x0, 0x0, 0xff1d14,
+    0x1d14, 0x0, 0x0, 0x31d14, 0x0, 0x51d14, 0x61d14, 0x0, 0x0, 0x91d14, 0xa1d14, 0x0, 0xc1d14, 0x0, 0x0, 0xf1d14,
+    0x0, 0x111d14, 0x121d14, 0x0, 0x141d14, 0x0, 0x0, 0x171d14, 0x181d14, 0x0, 0x0, 0x1b1d14, 0x0, 0x1d1d14, 0x1e1d14, 0x0,
+    0x201d14, 0x0, 0x0, 0x231d14, 0x0, 0x251d14, 0x261d14, 0x0, 0x0, 0x291d14, 0x2a1d14, 0x0, 0x2c1d14, 0x0, 0x0, 0x2f1d14,
+    0x0, 0x311d14, 0x321d14, 0x0, 0x341d14, 0x0, 0x0, 0x371d14, 0x381d14, 0x0, 0x0, 0x3b1d14, 0x0, 0x3d1d14, 0x3e1d14, 0x0,
+    0x0, 0x411d14, 0x421d14, 0x0, 0x441d14, 0x0, 0x0, 0x471d14, 0x481d14, 0x0, 0x0, 0x4b1d14, 0x0, 0x4d1d14, 0x4e1d14, 0x0,
+    0x501d14, 0x0, 0x0, 0x531d14, 0x0, 0x551d14, 0x561d14, 0x0, 0x0, 0x591d14, 0x5a1d14, 0x0, 0x5c1d14, 0x0, 0x0, 0x5f1d14,
+    0xff1d14, 0x0, 0x0, 0xff1d14, 0x0, 0xff1d14, 0xff1d14, 0x0, 0x0, 0xff1d14, 0xff1d14, 0x0, 0xff1d14, 0x0, 0x0, 0xff1d14,
+    0x0, 0xff1d14, 0xff1d14, 0x0, 0xff1d14, 0x0, 0x0, 0xff1d14, 0xff1d14, 0x0, 0x0, 0xff1d14, 0x0, 0xff1d14, 0xff1d14, 0x0,
+    0x0, 0x11d14, 0x21d14, 0x0, 0x41d14, 0x0, 0x0, 0x71d14, 0x81d14, 0x0, 0x0, 0xb1d14, 0x0, 0xd1d14, 0xe1d14, 0x0,
+    0x101d14, 0x0, 0x0, 0x131d14, 0x0, 0x151d14, 0x161d14, 0x0, 0x0, 0x191d14, 0x1a1d14, 0x0, 0x1c1d14, 0x0, 0x0, 0x1f1d14,
+    0x0, 0x211d14, 0x221d14, 0x0, 0x241d14, 0x0, 0x0, 0x271d14, 0x281d14, 0x0, 0x0, 0x2b1d14, 0x0, 0x2d1d14, 0x2e1d14, 0x0,
+    0x301d14, 0x0, 0x0, 0x331d14, 0x0, 0x351d14, 0x361d14, 0x0, 0x0, 0x391d14, 0x3a1d14, 0x0, 0x3c1d14, 0x0, 0x0, 0x3f1d14,
+    0x401d14, 0x0, 0x0, 0x431d14, 0x0, 0x451d14, 0x461d14, 0x0, 0x0, 0x491d14, 0x4a1d14, 0x0, 0x4c1d14, 0x0, 0x0, 0x4f1d14,
+    0x0, 0x511d14, 0x521d14, 0x0, 0x541d14, 0x0, 0x0, 0x571d14, 0x581d14, 0x0, 0x0, 0x5b1d14, 0x0, 0x5d1d14, 0x5e1d14, 0x0,
+    0x0, 0xff1e14, 0xff1e14, 0x0, 0xff1e14, 0x0, 0x0, 0xff1e14, 0xff1e14, 0x0, 0x0, 0xff1e14, 0x0, 0xff1e14, 0xff1e14, 0x0,
+    0xff1e14, 0x0, 0x0, 0xff1e14, 0x0, 0xff1e14, 0xff1e14, 0x0, 0x0, 0xff1e14, 0xff1e14, 0x0, 0xff1e14, 0x0, 0x0, 0xff1e14,
+    0x1e14, 0x0, 0x0, 0x31e14, 0x0, 0x51e14, 0x61e14, 0x0, 0x0, 0x91e14, 0xa1e14, 0x0, 0xc1e14, 0x0, 0x0, 0xf1e14,
+    0x0, 0x111e14, 0x121e14, 0x0, 0x141e14, 0x0, 0x0, 0x171e14, 0x181e14, 0x0, 0x0, 0x1b1e14, 0x0, 0x1d1e14, 0x1e1e14, 0x0,
+    0x201e14, 0x0, 0x0, 0x231e14, 0x0, 0x251e14, 0x261e14, 0x0, 0x0, 0x291e14, 0x2a1e14, 0x0, 0x2c1e14, 0x0, 0x0, 0x2f1e14,
+    0x0, 0x311e14, 0x321e14, 0x0, 0x341e14, 0x0, 0x0, 0x371e14, 0x381e14, 0x0, 0x0, 0x3b1e14, 0x0, 0x3d1e14, 0x3e1e14, 0x0,
+    0x0, 0x411e14, 0x421e14, 0x0, 0x441e14, 0x0, 0x0, 0x471e14, 0x481e14, 0x0, 0x0, 0x4b1e14, 0x0, 0x4d1e14, 0x4e1e14, 0x0,
+    0x501e14, 0x0, 0x0, 0x531e14, 0x0, 0x551e14, 0x561e14, 0x0, 0x0, 0x591e14, 0x5a1e14, 0x0, 0x5c1e14, 0x0, 0x0, 0x5f1e14,
+    0xff1e14, 0x0, 0x0, 0xff1e14, 0x0, 0xff1e14, 0xff1e14, 0x0, 0x0, 0xff1e14, 0xff1e14, 0x0, 0xff1e14, 0x0, 0x0, 0xff1e14,
+    0x0, 0xff1e14, 0xff1e14, 0x0, 0xff1e14, 0x0, 0x0, 0xff1e14, 0xff1e14, 0x0, 0x0, 0xff1e14, 0x0, 0xff1e14, 0xff1e14, 0x0,
+    0x0, 0x11e14, 0x21e14, 0x0, 0x41e14, 0x0, 0x0, 0x71e14, 0x81e14, 0x0, 0x0, 0xb1e14, 0x0, 0xd1e14, 0xe1e14, 0x0,
+    0x101e14, 0x0, 0x0, 0x131e14, 0x0, 0x151e14, 0x161e14, 0x0, 0x0, 0x191e14, 0x1a1e14, 0x0, 0x1c1e14, 0x0, 0x0, 0x1f1e14,
+    0x0, 0x211e14, 0x221e14, 0x0, 0x241e14, 0x0, 0x0, 0x271e14, 0x281e14, 0x0, 0x0, 0x2b1e14, 0x0, 0x2d1e14, 0x2e1e14, 0x0,
+    0x301e14, 0x0, 0x0, 0x331e14, 0x0, 0x351e14, 0x361e14, 0x0, 0x0, 0x391e14, 0x3a1e14, 0x0, 0x3c1e14, 0x0, 0x0, 0x3f1e14,
+    0x401e14, 0x0, 0x0, 0x431e14, 0x0, 0x451e14, 0x461e14, 0x0, 0x0, 0x491e14, 0x4a1e14, 0x0, 0x4c1e14, 0x0, 0x0, 0x4f1e14,
+    0x0, 0x511e14, 0x521e14, 0x0, 0x541e14, 0x0, 0x0, 0x571e14, 0x581e14, 0x0, 0x0, 0x5b1e14, 0x0, 0x5d1e14, 0x5e1e14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2004, 0xff2004, 0x0, 0xff2004, 0x0, 0x0, 0xff2004, 0xff2004, 0x0, 0x0, 0xff2004, 0x0, 0xff2004, 0xff2004, 0x0,
+    0xff2004, 0x0, 0x0, 0xff2004, 0x0, 0xff2004, 0xff2004, 0x0, 0x0, 0xff2004, 0xff2004, 0x0, 0xff2004, 0x0, 0x0, 0xff2004,
+    0x2004, 0x0, 0x0, 0x32004, 0x0, 0x52004, 0x62004, 0x0, 0x0, 0x92004, 0xa2004, 0x0, 0xc2004, 0x0, 0x0, 0xf2004,
+    0x0, 0x112004, 0x122004, 0x0, 0x142004, 0x0, 0x0, 0x172004, 0x182004, 0x0, 0x0, 0x1b2004, 0x0, 0x1d2004, 0x1e2004, 0x0,
+    0x202004, 0x0, 0x0, 0x232004, 0x0, 0x252004, 0x262004, 0x0, 0x0, 0x292004, 0x2a2004, 0x0, 0x2c2004, 0x0, 0x0, 0x2f2004,
+    0x0, 0x312004, 0x322004, 0x0, 0x342004, 0x0, 0x0, 0x372004, 0x382004, 0x0, 0x0, 0x3b2004, 0x0, 0x3d2004, 0x3e2004, 0x0,
+    0x0, 0x412004, 0x422004, 0x0, 0x442004, 0x0, 0x0, 0x472004, 0x482004, 0x0, 0x0, 0x4b2004, 0x0, 0x4d2004, 0x4e2004, 0x0,
+    0x502004, 0x0, 0x0, 0x532004, 0x0, 0x552004, 0x562004, 0x0, 0x0, 0x592004, 0x5a2004, 0x0, 0x5c2004, 0x0, 0x0, 0x5f2004,
+    0xff2004, 0x0, 0x0, 0xff2004, 0x0, 0xff2004, 0xff2004, 0x0, 0x0, 0xff2004, 0xff2004, 0x0, 0xff2004, 0x0, 0x0, 0xff2004,
+    0x0, 0xff2004, 0xff2004, 0x0, 0xff2004, 0x0, 0x0, 0xff2004, 0xff2004, 0x0, 0x0, 0xff2004, 0x0, 0xff2004, 0xff2004, 0x0,
+    0x0, 0x12004, 0x22004, 0x0, 0x42004, 0x0, 0x0, 0x72004, 0x82004, 0x0, 0x0, 0xb2004, 0x0, 0xd2004, 0xe2004, 0x0,
+    0x102004, 0x0, 0x0, 0x132004, 0x0, 0x152004, 0x162004, 0x0, 0x0, 0x192004, 0x1a2004, 0x0, 0x1c2004, 0x0, 0x0, 0x1f2004,
+    0x0, 0x212004, 0x222004, 0x0, 0x242004, 0x0, 0x0, 0x272004, 0x282004, 0x0, 0x0, 0x2b2004, 0x0, 0x2d2004, 0x2e2004, 0x0,
+    0x302004, 0x0, 0x0, 0x332004, 0x0, 0x352004, 0x362004, 0x0, 0x0, 0x392004, 0x3a2004, 0x0, 0x3c2004, 0x0, 0x0, 0x3f2004,
+    0x402004, 0x0, 0x0, 0x432004, 0x0, 0x452004, 0x462004, 0x0, 0x0, 0x492004, 0x4a2004, 0x0, 0x4c2004, 0x0, 0x0, 0x4f2004,
+    0x0, 0x512004, 0x522004, 0x0, 0x542004, 0x0, 0x0, 0x572004, 0x582004, 0x0, 0x0, 0x5b2004, 0x0, 0x5d2004, 0x5e2004, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2304, 0xff2304, 0x0, 0xff2304, 0x0, 0x0, 0xff2304, 0xff2304, 0x0, 0x0, 0xff2304, 0x0, 0xff2304, 0xff2304, 0x0,
+    0xff2304, 0x0, 0x0, 0xff2304, 0x0, 0xff2304, 0xff2304, 0x0, 0x0, 0xff2304, 0xff2304, 0x0, 0xff2304, 0x0, 0x0, 0xff2304,
+    0x2304, 0x0, 0x0, 0x32304, 0x0, 0x52304, 0x62304, 0x0, 0x0, 0x92304, 0xa2304, 0x0, 0xc2304, 0x0, 0x0, 0xf2304,
+    0x0, 0x112304, 0x122304, 0x0, 0x142304, 0x0, 0x0, 0x172304, 0x182304, 0x0, 0x0, 0x1b2304, 0x0, 0x1d2304, 0x1e2304, 0x0,
+    0x202304, 0x0, 0x0, 0x232304, 0x0, 0x252304, 0x262304, 0x0, 0x0, 0x292304, 0x2a2304, 0x0, 0x2c2304, 0x0, 0x0, 0x2f2304,
+    0x0, 0x312304, 0x322304, 0x0, 0x342304, 0x0, 0x0, 0x372304, 0x382304, 0x0, 0x0, 0x3b2304, 0x0, 0x3d2304, 0x3e2304, 0x0,
+    0x0, 0x412304, 0x422304, 0x0, 0x442304, 0x0, 0x0, 0x472304, 0x482304, 0x0, 0x0, 0x4b2304, 0x0, 0x4d2304, 0x4e2304, 0x0,
+    0x502304, 0x0, 0x0, 0x532304, 0x0, 0x552304, 0x562304, 0x0, 0x0, 0x592304, 0x5a2304, 0x0, 0x5c2304, 0x0, 0x0, 0x5f2304,
+    0xff2304, 0x0, 0x0, 0xff2304, 0x0, 0xff2304, 0xff2304, 0x0, 0x0, 0xff2304, 0xff2304, 0x0, 0xff2304, 0x0, 0x0, 0xff2304,
+    0x0, 0xff2304, 0xff2304, 0x0, 0xff2304, 0x0, 0x0, 0xff2304, 0xff2304, 0x0, 0x0, 0xff2304, 0x0, 0xff2304, 0xff2304, 0x0,
+    0x0, 0x12304, 0x22304, 0x0, 0x42304, 0x0, 0x0, 0x72304, 0x82304, 0x0, 0x0, 0xb2304, 0x0, 0xd2304, 0xe2304, 0x0,
+    0x102304, 0x0, 0x0, 0x132304, 0x0, 0x152304, 0x162304, 0x0, 0x0, 0x192304, 0x1a2304, 0x0, 0x1c2304, 0x0, 0x0, 0x1f2304,
+    0x0, 0x212304, 0x222304, 0x0, 0x242304, 0x0, 0x0, 0x272304, 0x282304, 0x0, 0x0, 0x2b2304, 0x0, 0x2d2304, 0x2e2304, 0x0,
+    0x302304, 0x0, 0x0, 0x332304, 0x0, 0x352304, 0x362304, 0x0, 0x0, 0x392304, 0x3a2304, 0x0, 0x3c2304, 0x0, 0x0, 0x3f2304,
+    0x402304, 0x0, 0x0, 0x432304, 0x0, 0x452304, 0x462304, 0x0, 0x0, 0x492304, 0x4a2304, 0x0, 0x4c2304, 0x0, 0x0, 0x4f2304,
+    0x0, 0x512304, 0x522304, 0x0, 0x542304, 0x0, 0x0, 0x572304, 0x582304, 0x0, 0x0, 0x5b2304, 0x0, 0x5d2304, 0x5e2304, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2504, 0xff2504, 0x0, 0xff2504, 0x0, 0x0, 0xff2504, 0xff2504, 0x0, 0x0, 0xff2504, 0x0, 0xff2504, 0xff2504, 0x0,
+    0xff2504, 0x0, 0x0, 0xff2504, 0x0, 0xff2504, 0xff2504, 0x0, 0x0, 0xff2504, 0xff2504, 0x0, 0xff2504, 0x0, 0x0, 0xff2504,
+    0x2504, 0x0, 0x0, 0x32504, 0x0, 0x52504, 0x62504, 0x0, 0x0, 0x92504, 0xa2504, 0x0, 0xc2504, 0x0, 0x0, 0xf2504,
+    0x0, 0x112504, 0x122504, 0x0, 0x142504, 0x0, 0x0, 0x172504, 0x182504, 0x0, 0x0, 0x1b2504, 0x0, 0x1d2504, 0x1e2504, 0x0,
+    0x202504, 0x0, 0x0, 0x232504, 0x0, 0x252504, 0x262504, 0x0, 0x0, 0x292504, 0x2a2504, 0x0, 0x2c2504, 0x0, 0x0, 0x2f2504,
+    0x0, 0x312504, 0x322504, 0x0, 0x342504, 0x0, 0x0, 0x372504, 0x382504, 0x0, 0x0, 0x3b2504, 0x0, 0x3d2504, 0x3e2504, 0x0,
+    0x0, 0x412504, 0x422504, 0x0, 0x442504, 0x0, 0x0, 0x472504, 0x482504, 0x0, 0x0, 0x4b2504, 0x0, 0x4d2504, 0x4e2504, 0x0,
+    0x502504, 0x0, 0x0, 0x532504, 0x0, 0x552504, 0x562504, 0x0, 0x0, 0x592504, 0x5a2504, 0x0, 0x5c2504, 0x0, 0x0, 0x5f2504,
+    0xff2504, 0x0, 0x0, 0xff2504, 0x0, 0xff2504, 0xff2504, 0x0, 0x0, 0xff2504, 0xff2504, 0x0, 0xff2504, 0x0, 0x0, 0xff2504,
+    0x0, 0xff2504, 0xff2504, 0x0, 0xff2504, 0x0, 0x0, 0xff2504, 0xff2504, 0x0, 0x0, 0xff2504, 0x0, 0xff2504, 0xff2504, 0x0,
+    0x0, 0x12504, 0x22504, 0x0, 0x42504, 0x0, 0x0, 0x72504, 0x82504, 0x0, 0x0, 0xb2504, 0x0, 0xd2504, 0xe2504, 0x0,
+    0x102504, 0x0, 0x0, 0x132504, 0x0, 0x152504, 0x162504, 0x0, 0x0, 0x192504, 0x1a2504, 0x0, 0x1c2504, 0x0, 0x0, 0x1f2504,
+    0x0, 0x212504, 0x222504, 0x0, 0x242504, 0x0, 0x0, 0x272504, 0x282504, 0x0, 0x0, 0x2b2504, 0x0, 0x2d2504, 0x2e2504, 0x0,
+    0x302504, 0x0, 0x0, 0x332504, 0x0, 0x352504, 0x362504, 0x0, 0x0, 0x392504, 0x3a2504, 0x0, 0x3c2504, 0x0, 0x0, 0x3f2504,
+    0x402504, 0x0, 0x0, 0x432504, 0x0, 0x452504, 0x462504, 0x0, 0x0, 0x492504, 0x4a2504, 0x0, 0x4c2504, 0x0, 0x0, 0x4f2504,
+    0x0, 0x512504, 0x522504, 0x0, 0x542504, 0x0, 0x0, 0x572504, 0x582504, 0x0, 0x0, 0x5b2504, 0x0, 0x5d2504, 0x5e2504, 0x0,
+    0x0, 0xff2604, 0xff2604, 0x0, 0xff2604, 0x0, 0x0, 0xff2604, 0xff2604, 0x0, 0x0, 0xff2604, 0x0, 0xff2604, 0xff2604, 0x0,
+    0xff2604, 0x0, 0x0, 0xff2604, 0x0, 0xff2604, 0xff2604, 0x0, 0x0, 0xff2604, 0xff2604, 0x0, 0xff2604, 0x0, 0x0, 0xff2604,
+    0x2604, 0x0, 0x0, 0x32604, 0x0, 0x52604, 0x62604, 0x0, 0x0, 0x92604, 0xa2604, 0x0, 0xc2604, 0x0, 0x0, 0xf2604,
+    0x0, 0x112604, 0x122604, 0x0, 0x142604, 0x0, 0x0, 0x172604, 0x182604, 0x0, 0x0, 0x1b2604, 0x0, 0x1d2604, 0x1e2604, 0x0,
+    0x202604, 0x0, 0x0, 0x232604, 0x0, 0x252604, 0x262604, 0x0, 0x0, 0x292604, 0x2a2604, 0x0, 0x2c2604, 0x0, 0x0, 0x2f2604,
+    0x0, 0x312604, 0x322604, 0x0, 0x342604, 0x0, 0x0, 0x372604, 0x382604, 0x0, 0x0, 0x3b2604, 0x0, 0x3d2604, 0x3e2604, 0x0,
+    0x0, 0x412604, 0x422604, 0x0, 0x442604, 0x0, 0x0, 0x472604, 0x482604, 0x0, 0x0, 0x4b2604, 0x0, 0x4d2604, 0x4e2604, 0x0,
+    0x502604, 0x0, 0x0, 0x532604, 0x0, 0x552604, 0x562604, 0x0, 0x0, 0x592604, 0x5a2604, 0x0, 0x5c2604, 0x0, 0x0, 0x5f2604,
+    0xff2604, 0x0, 0x0, 0xff2604, 0x0, 0xff2604, 0xff2604, 0x0, 0x0, 0xff2604, 0xff2604, 0x0, 0xff2604, 0x0, 0x0, 0xff2604,
+    0x0, 0xff2604, 0xff2604, 0x0, 0xff2604, 0x0, 0x0, 0xff2604, 0xff2604, 0x0, 0x0, 0xff2604, 0x0, 0xff2604, 0xff2604, 0x0,
+    0x0, 0x12604, 0x22604, 0x0, 0x42604, 0x0, 0x0, 0x72604, 0x82604, 0x0, 0x0, 0xb2604, 0x0, 0xd2604, 0xe2604, 0x0,
+    0x102604, 0x0, 0x0, 0x132604, 0x0, 0x152604, 0x162604, 0x0, 0x0, 0x192604, 0x1a2604, 0x0, 0x1c2604, 0x0, 0x0, 0x1f2604,
+    0x0, 0x212604, 0x222604, 0x0, 0x242604, 0x0, 0x0, 0x272604, 0x282604, 0x0, 0x0, 0x2b2604, 0x0, 0x2d2604, 0x2e2604, 0x0,
+    0x302604, 0x0, 0x0, 0x332604, 0x0, 0x352604, 0x362604, 0x0, 0x0, 0x392604, 0x3a2604, 0x0, 0x3c2604, 0x0, 0x0, 0x3f2604,
+    0x402604, 0x0, 0x0, 0x432604, 0x0, 0x452604, 0x462604, 0x0, 0x0, 0x492604, 0x4a2604, 0x0, 0x4c2604, 0x0, 0x0, 0x4f2604,
+    0x0, 0x512604, 0x522604, 0x0, 0x542604, 0x0, 0x0, 0x572604, 0x582604, 0x0, 0x0, 0x5b2604, 0x0, 0x5d2604, 0x5e2604, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2914, 0xff2914, 0x0, 0xff2914, 0x0, 0x0, 0xff2914, 0xff2914, 0x0, 0x0, 0xff2914, 0x0, 0xff2914, 0xff2914, 0x0,
+    0xff2914, 0x0, 0x0, 0xff2914, 0x0, 0xff2914, 0xff2914, 0x0, 0x0, 0xff2914, 0xff2914, 0x0, 0xff2914, 0x0, 0x0, 0xff2914,
+    0x2914, 0x0, 0x0, 0x32914, 0x0, 0x52914, 0x62914, 0x0, 0x0, 0x92914, 0xa2914, 0x0, 0xc2914, 0x0, 0x0, 0xf2914,
+    0x0, 0x112914, 0x122914, 0x0, 0x142914, 0x0, 0x0, 0x172914, 0x182914, 0x0, 0x0, 0x1b2914, 0x0, 0x1d2914, 0x1e2914, 0x0,
+    0x202914, 0x0, 0x0, 0x232914, 0x0, 0x252914, 0x262914, 0x0, 0x0, 0x292914, 0x2a2914, 0x0, 0x2c2914, 0x0, 0x0, 0x2f2914,
+    0x0, 0x312914, 0x322914, 0x0, 0x342914, 0x0, 0x0, 0x372914, 0x382914, 0x0, 0x0, 0x3b2914, 0x0, 0x3d2914, 0x3e2914, 0x0,
+    0x0, 0x412914, 0x422914, 0x0, 0x442914, 0x0, 0x0, 0x472914, 0x482914, 0x0, 0x0, 0x4b2914, 0x0, 0x4d2914, 0x4e2914, 0x0,
+    0x502914, 0x0, 0x0, 0x532914, 0x0, 0x552914, 0x562914, 0x0, 0x0, 0x592914, 0x5a2914, 0x0, 0x5c2914, 0x0, 0x0, 0x5f2914,
+    0xff2914, 0x0, 0x0, 0xff2914, 0x0, 0xff2914, 0xff2914, 0x0, 0x0, 0xff2914, 0xff2914, 0x0, 0xff2914, 0x0, 0x0, 0xff2914,
+    0x0, 0xff2914, 0xff2914, 0x0, 0xff2914, 0x0, 0x0, 0xff2914, 0xff2914, 0x0, 0x0, 0xff2914, 0x0, 0xff2914, 0xff2914, 0x0,
+    0x0, 0x12914, 0x22914, 0x0, 0x42914, 0x0, 0x0, 0x72914, 0x82914, 0x0, 0x0, 0xb2914, 0x0, 0xd2914, 0xe2914, 0x0,
+    0x102914, 0x0, 0x0, 0x132914, 0x0, 0x152914, 0x162914, 0x0, 0x0, 0x192914, 0x1a2914, 0x0, 0x1c2914, 0x0, 0x0, 0x1f2914,
+    0x0, 0x212914, 0x222914, 0x0, 0x242914, 0x0, 0x0, 0x272914, 0x282914, 0x0, 0x0, 0x2b2914, 0x0, 0x2d2914, 0x2e2914, 0x0,
+    0x302914, 0x0, 0x0, 0x332914, 0x0, 0x352914, 0x362914, 0x0, 0x0, 0x392914, 0x3a2914, 0x0, 0x3c2914, 0x0, 0x0, 0x3f2914,
+    0x402914, 0x0, 0x0, 0x432914, 0x0, 0x452914, 0x462914, 0x0, 0x0, 0x492914, 0x4a2914, 0x0, 0x4c2914, 0x0, 0x0, 0x4f2914,
+    0x0, 0x512914, 0x522914, 0x0, 0x542914, 0x0, 0x0, 0x572914, 0x582914, 0x0, 0x0, 0x5b2914, 0x0, 0x5d2914, 0x5e2914, 0x0,
+    0x0, 0xff2a14, 0xff2a14, 0x0, 0xff2a14, 0x0, 0x0, 0xff2a14, 0xff2a14, 0x0, 0x0, 0xff2a14, 0x0, 0xff2a14, 0xff2a14, 0x0,
+    0xff2a14, 0x0, 0x0, 0xff2a14, 0x0, 0xff2a14, 0xff2a14, 0x0, 0x0, 0xff2a14, 0xff2a14, 0x0, 0xff2a14, 0x0, 0x0, 0xff2a14,
+    0x2a14, 0x0, 0x0, 0x32a14, 0x0, 0x52a14, 0x62a14, 0x0, 0x0, 0x92a14, 0xa2a14, 0x0, 0xc2a14, 0x0, 0x0, 0xf2a14,
+    0x0, 0x112a14, 0x122a14, 0x0, 0x142a14, 0x0, 0x0, 0x172a14, 0x182a14, 0x0, 0x0, 0x1b2a14, 0x0, 0x1d2a14, 0x1e2a14, 0x0,
+    0x202a14, 0x0, 0x0, 0x232a14, 0x0, 0x252a14, 0x262a14, 0x0, 0x0, 0x292a14, 0x2a2a14, 0x0, 0x2c2a14, 0x0, 0x0, 0x2f2a14,
+    0x0, 0x312a14, 0x322a14, 0x0, 0x342a14, 0x0, 0x0, 0x372a14, 0x382a14, 0x0, 0x0, 0x3b2a14, 0x0, 0x3d2a14, 0x3e2a14, 0x0,
+    0x0, 0x412a14, 0x422a14, 0x0, 0x442a14, 0x0, 0x0, 0x472a14, 0x482a14, 0x0, 0x0, 0x4b2a14, 0x0, 0x4d2a14, 0x4e2a14, 0x0,
+    0x502a14, 0x0, 0x0, 0x532a14, 0x0, 0x552a14, 0x562a14, 0x0, 0x0, 0x592a14, 0x5a2a14, 0x0, 0x5c2a14, 0x0, 0x0, 0x5f2a14,
+    0xff2a14, 0x0, 0x0, 0xff2a14, 0x0, 0xff2a14, 0xff2a14, 0x0, 0x0, 0xff2a14, 0xff2a14, 0x0, 0xff2a14, 0x0, 0x0, 0xff2a14,
+    0x0, 0xff2a14, 0xff2a14, 0x0, 0xff2a14, 0x0, 0x0, 0xff2a14, 0xff2a14, 0x0, 0x0, 0xff2a14, 0x0, 0xff2a14, 0xff2a14, 0x0,
+    0x0, 0x12a14, 0x22a14, 0x0, 0x42a14, 0x0, 0x0, 0x72a14, 0x82a14, 0x0, 0x0, 0xb2a14, 0x0, 0xd2a14, 0xe2a14, 0x0,
+    0x102a14, 0x0, 0x0, 0x132a14, 0x0, 0x152a14, 0x162a14, 0x0, 0x0, 0x192a14, 0x1a2a14, 0x0, 0x1c2a14, 0x0, 0x0, 0x1f2a14,
+    0x0, 0x212a14, 0x222a14, 0x0, 0x242a14, 0x0, 0x0, 0x272a14, 0x282a14, 0x0, 0x0, 0x2b2a14, 0x0, 0x2d2a14, 0x2e2a14, 0x0,
+    0x302a14, 0x0, 0x0, 0x332a14, 0x0, 0x352a14, 0x362a14, 0x0, 0x0, 0x392a14, 0x3a2a14, 0x0, 0x3c2a14, 0x0, 0x0, 0x3f2a14,
+    0x402a14, 0x0, 0x0, 0x432a14, 0x0, 0x452a14, 0x462a14, 0x0, 0x0, 0x492a14, 0x4a2a14, 0x0, 0x4c2a14, 0x0, 0x0, 0x4f2a14,
+    0x0, 0x512a14, 0x522a14, 0x0, 0x542a14, 0x0, 0x0, 0x572a14, 0x582a14, 0x0, 0x0, 0x5b2a14, 0x0, 0x5d2a14, 0x5e2a14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2c14, 0xff2c14, 0x0, 0xff2c14, 0x0, 0x0, 0xff2c14, 0xff2c14, 0x0, 0x0, 0xff2c14, 0x0, 0xff2c14, 0xff2c14, 0x0,
+    0xff2c14, 0x0, 0x0, 0xff2c14, 0x0, 0xff2c14, 0xff2c14, 0x0, 0x0, 0xff2c14, 0xff2c14, 0x0, 0xff2c14, 0x0, 0x0, 0xff2c14,
+    0x2c14, 0x0, 0x0, 0x32c14, 0x0, 0x52c14, 0x62c14, 0x0, 0x0, 0x92c14, 0xa2c14, 0x0, 0xc2c14, 0x0, 0x0, 0xf2c14,
+    0x0, 0x112c14, 0x122c14, 0x0, 0x142c14, 0x0, 0x0, 0x172c14, 0x182c14, 0x0, 0x0, 0x1b2c14, 0x0, 0x1d2c14, 0x1e2c14, 0x0,
+    0x202c14, 0x0, 0x0, 0x232c14, 0x0, 0x252c14, 0x262c14, 0x0, 0x0, 0x292c14, 0x2a2c14, 0x0, 0x2c2c14, 0x0, 0x0, 0x2f2c14,
+    0x0, 0x312c14, 0x322c14, 0x0, 0x342c14, 0x0, 0x0, 0x372c14, 0x382c14, 0x0, 0x0, 0x3b2c14, 0x0, 0x3d2c14, 0x3e2c14, 0x0,
+    0x0, 0x412c14, 0x422c14, 0x0, 0x442c14, 0x0, 0x0, 0x472c14, 0x482c14, 0x0, 0x0, 0x4b2c14, 0x0, 0x4d2c14, 0x4e2c14, 0x0,
+    0x502c14, 0x0, 0x0, 0x532c14, 0x0, 0x552c14, 0x562c14, 0x0, 0x0, 0x592c14, 0x5a2c14, 0x0, 0x5c2c14, 0x0, 0x0, 0x5f2c14,
+    0xff2c14, 0x0, 0x0, 0xff2c14, 0x0, 0xff2c14, 0xff2c14, 0x0, 0x0, 0xff2c14, 0xff2c14, 0x0, 0xff2c14, 0x0, 0x0, 0xff2c14,
+    0x0, 0xff2c14, 0xff2c14, 0x0, 0xff2c14, 0x0, 0x0, 0xff2c14, 0xff2c14, 0x0, 0x0, 0xff2c14, 0x0, 0xff2c14, 0xff2c14, 0x0,
+    0x0, 0x12c14, 0x22c14, 0x0, 0x42c14, 0x0, 0x0, 0x72c14, 0x82c14, 0x0, 0x0, 0xb2c14, 0x0, 0xd2c14, 0xe2c14, 0x0,
+    0x102c14, 0x0, 0x0, 0x132c14, 0x0, 0x152c14, 0x162c14, 0x0, 0x0, 0x192c14, 0x1a2c14, 0x0, 0x1c2c14, 0x0, 0x0, 0x1f2c14,
+    0x0, 0x212c14, 0x222c14, 0x0, 0x242c14, 0x0, 0x0, 0x272c14, 0x282c14, 0x0, 0x0, 0x2b2c14, 0x0, 0x2d2c14, 0x2e2c14, 0x0,
+    0x302c14, 0x0, 0x0, 0x332c14, 0x0, 0x352c14, 0x362c14, 0x0, 0x0, 0x392c14, 0x3a2c14, 0x0, 0x3c2c14, 0x0, 0x0, 0x3f2c14,
+    0x402c14, 0x0, 0x0, 0x432c14, 0x0, 0x452c14, 0x462c14, 0x0, 0x0, 0x492c14, 0x4a2c14, 0x0, 0x4c2c14, 0x0, 0x0, 0x4f2c14,
+    0x0, 0x512c14, 0x522c14, 0x0, 0x542c14, 0x0, 0x0, 0x572c14, 0x582c14, 0x0, 0x0, 0x5b2c14, 0x0, 0x5d2c14, 0x5e2c14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2f14, 0xff2f14, 0x0, 0xff2f14, 0x0, 0x0, 0xff2f14, 0xff2f14, 0x0, 0x0, 0xff2f14, 0x0, 0xff2f14, 0xff2f14, 0x0,
+    0xff2f14, 0x0, 0x0, 0xff2f14, 0x0, 0xff2f14, 0xff2f14, 0x0, 0x0, 0xff2f14, 0xff2f14, 0x0, 0xff2f14, 0x0, 0x0, 0xff2f14,
+    0x2f14, 0x0, 0x0, 0x32f14, 0x0, 0x52f14, 0x62f14, 0x0, 0x0, 0x92f14, 0xa2f14, 0x0, 0xc2f14, 0x0, 0x0, 0xf2f14,
+    0x0, 0x112f14, 0x122f14, 0x0, 0x142f14, 0x0, 0x0, 0x172f14, 0x182f14, 0x0, 0x0, 0x1b2f14, 0x0, 0x1d2f14, 0x1e2f14, 0x0,
+    0x202f14, 0x0, 0x0, 0x232f14, 0x0, 0x252f14, 0x262f14, 0x0, 0x0, 0x292f14, 0x2a2f14, 0x0, 0x2c2f14, 0x0, 0x0, 0x2f2f14,
+    0x0, 0x312f14, 0x322f14, 0x0, 0x342f14, 0x0, 0x0, 0x372f14, 0x382f14, 0x0, 0x0, 0x3b2f14, 0x0, 0x3d2f14, 0x3e2f14, 0x0,
+    0x0, 0x412f14, 0x422f14, 0x0, 0x442f14, 0x0, 0x0, 0x472f14, 0x482f14, 0x0, 0x0, 0x4b2f14, 0x0, 0x4d2f14, 0x4e2f14, 0x0,
+    0x502f14, 0x0, 0x0, 0x532f14, 0x0, 0x552f14, 0x562f14, 0x0, 0x0, 0x592f14, 0x5a2f14, 0x0, 0x5c2f14, 0x0, 0x0, 0x5f2f14,
+    0xff2f14, 0x0, 0x0, 0xff2f14, 0x0, 0xff2f14, 0xff2f14, 0x0, 0x0, 0xff2f14, 0xff2f14, 0x0, 0xff2f14, 0x0, 0x0, 0xff2f14,
+    0x0, 0xff2f14, 0xff2f14, 0x0, 0xff2f14, 0x0, 0x0, 0xff2f14, 0xff2f14, 0x0, 0x0, 0xff2f14, 0x0, 0xff2f14, 0xff2f14, 0x0,
+    0x0, 0x12f14, 0x22f14, 0x0, 0x42f14, 0x0, 0x0, 0x72f14, 0x82f14, 0x0, 0x0, 0xb2f14, 0x0, 0xd2f14, 0xe2f14, 0x0,
+    0x102f14, 0x0, 0x0, 0x132f14, 0x0, 0x152f14, 0x162f14, 0x0, 0x0, 0x192f14, 0x1a2f14, 0x0, 0x1c2f14, 0x0, 0x0, 0x1f2f14,
+    0x0, 0x212f14, 0x222f14, 0x0, 0x242f14, 0x0, 0x0, 0x272f14, 0x282f14, 0x0, 0x0, 0x2b2f14, 0x0, 0x2d2f14, 0x2e2f14, 0x0,
+    0x302f14, 0x0, 0x0, 0x332f14, 0x0, 0x352f14, 0x362f14, 0x0, 0x0, 0x392f14, 0x3a2f14, 0x0, 0x3c2f14, 0x0, 0x0, 0x3f2f14,
+    0x402f14, 0x0, 0x0, 0x432f14, 0x0, 0x452f14, 0x462f14, 0x0, 0x0, 0x492f14, 0x4a2f14, 0x0, 0x4c2f14, 0x0, 0x0, 0x4f2f14,
+    0x0, 0x512f14, 0x522f14, 0x0, 0x542f14, 0x0, 0x0, 0x572f14, 0x582f14, 0x0, 0x0, 0x5b2f14, 0x0, 0x5d2f14, 0x5e2f14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3104, 0xff3104, 0x0, 0xff3104, 0x0, 0x0, 0xff3104, 0xff3104, 0x0, 0x0, 0xff3104, 0x0, 0xff3104, 0xff3104, 0x0,
+    0xff3104, 0x0, 0x0, 0xff3104, 0x0, 0xff3104, 0xff3104, 0x0, 0x0, 0xff3104, 0xff3104, 0x0, 0xff3104, 0x0, 0x0, 0xff3104,
+    0x3104, 0x0, 0x0, 0x33104, 0x0, 0x53104, 0x63104, 0x0, 0x0, 0x93104, 0xa3104, 0x0, 0xc3104, 0x0, 0x0, 0xf3104,
+    0x0, 0x113104, 0x123104, 0x0, 0x143104, 0x0, 0x0, 0x173104, 0x183104, 0x0, 0x0, 0x1b3104, 0x0, 0x1d3104, 0x1e3104, 0x0,
+    0x203104, 0x0, 0x0, 0x233104, 0x0, 0x253104, 0x263104, 0x0, 0x0, 0x293104, 0x2a3104, 0x0, 0x2c3104, 0x0, 0x0, 0x2f3104,
+    0x0, 0x313104, 0x323104, 0x0, 0x343104, 0x0, 0x0, 0x373104, 0x383104, 0x0, 0x0, 0x3b3104, 0x0, 0x3d3104, 0x3e3104, 0x0,
+    0x0, 0x413104, 0x423104, 0x0, 0x443104, 0x0, 0x0, 0x473104, 0x483104, 0x0, 0x0, 0x4b3104, 0x0, 0x4d3104, 0x4e3104, 0x0,
+    0x503104, 0x0, 0x0, 0x533104, 0x0, 0x553104, 0x563104, 0x0, 0x0, 0x593104, 0x5a3104, 0x0, 0x5c3104, 0x0, 0x0, 0x5f3104,
+    0xff3104, 0x0, 0x0, 0xff3104, 0x0, 0xff3104, 0xff3104, 0x0, 0x0, 0xff3104, 0xff3104, 0x0, 0xff3104, 0x0, 0x0, 0xff3104,
+    0x0, 0xff3104, 0xff3104, 0x0, 0xff3104, 0x0, 0x0, 0xff3104, 0xff3104, 0x0, 0x0, 0xff3104, 0x0, 0xff3104, 0xff3104, 0x0,
+    0x0, 0x13104, 0x23104, 0x0, 0x43104, 0x0, 0x0, 0x73104, 0x83104, 0x0, 0x0, 0xb3104, 0x0, 0xd3104, 0xe3104, 0x0,
+    0x103104, 0x0, 0x0, 0x133104, 0x0, 0x153104, 0x163104, 0x0, 0x0, 0x193104, 0x1a3104, 0x0, 0x1c3104, 0x0, 0x0, 0x1f3104,
+    0x0, 0x213104, 0x223104, 0x0, 0x243104, 0x0, 0x0, 0x273104, 0x283104, 0x0, 0x0, 0x2b3104, 0x0, 0x2d3104, 0x2e3104, 0x0,
+    0x303104, 0x0, 0x0, 0x333104, 0x0, 0x353104, 0x363104, 0x0, 0x0, 0x393104, 0x3a3104, 0x0, 0x3c3104, 0x0, 0x0, 0x3f3104,
+    0x403104, 0x0, 0x0, 0x433104, 0x0, 0x453104, 0x463104, 0x0, 0x0, 0x493104, 0x4a3104, 0x0, 0x4c3104, 0x0, 0x0, 0x4f3104,
+    0x0, 0x513104, 0x523104, 0x0, 0x543104, 0x0, 0x0, 0x573104, 0x583104, 0x0, 0x0, 0x5b3104, 0x0, 0x5d3104, 0x5e3104, 0x0,
+    0x0, 0xff3204, 0xff3204, 0x0, 0xff3204, 0x0, 0x0, 0xff3204, 0xff3204, 0x0, 0x0, 0xff3204, 0x0, 0xff3204, 0xff3204, 0x0,
+    0xff3204, 0x0, 0x0, 0xff3204, 0x0, 0xff3204, 0xff3204, 0x0, 0x0, 0xff3204, 0xff3204, 0x0, 0xff3204, 0x0, 0x0, 0xff3204,
+    0x3204, 0x0, 0x0, 0x33204, 0x0, 0x53204, 0x63204, 0x0, 0x0, 0x93204, 0xa3204, 0x0, 0xc3204, 0x0, 0x0, 0xf3204,
+    0x0, 0x113204, 0x123204, 0x0, 0x143204, 0x0, 0x0, 0x173204, 0x183204, 0x0, 0x0, 0x1b3204, 0x0, 0x1d3204, 0x1e3204, 0x0,
+    0x203204, 0x0, 0x0, 0x233204, 0x0, 0x253204, 0x263204, 0x0, 0x0, 0x293204, 0x2a3204, 0x0, 0x2c3204, 0x0, 0x0, 0x2f3204,
+    0x0, 0x313204, 0x323204, 0x0, 0x343204, 0x0, 0x0, 0x373204, 0x383204, 0x0, 0x0, 0x3b3204, 0x0, 0x3d3204, 0x3e3204, 0x0,
+    0x0, 0x413204, 0x423204, 0x0, 0x443204, 0x0, 0x0, 0x473204, 0x483204, 0x0, 0x0, 0x4b3204, 0x0, 0x4d3204, 0x4e3204, 0x0,
+    0x503204, 0x0, 0x0, 0x533204, 0x0, 0x553204, 0x563204, 0x0, 0x0, 0x593204, 0x5a3204, 0x0, 0x5c3204, 0x0, 0x0, 0x5f3204,
+    0xff3204, 0x0, 0x0, 0xff3204, 0x0, 0xff3204, 0xff3204, 0x0, 0x0, 0xff3204, 0xff3204, 0x0, 0xff3204, 0x0, 0x0, 0xff3204,
+    0x0, 0xff3204, 0xff3204, 0x0, 0xff3204, 0x0, 0x0, 0xff3204, 0xff3204, 0x0, 0x0, 0xff3204, 0x0, 0xff3204, 0xff3204, 0x0,
+    0x0, 0x13204, 0x23204, 0x0, 0x43204, 0x0, 0x0, 0x73204, 0x83204, 0x0, 0x0, 0xb3204, 0x0, 0xd3204, 0xe3204, 0x0,
+    0x103204, 0x0, 0x0, 0x133204, 0x0, 0x153204, 0x163204, 0x0, 0x0, 0x193204, 0x1a3204, 0x0, 0x1c3204, 0x0, 0x0, 0x1f3204,
+    0x0, 0x213204, 0x223204, 0x0, 0x243204, 0x0, 0x0, 0x273204, 0x283204, 0x0, 0x0, 0x2b3204, 0x0, 0x2d3204, 0x2e3204, 0x0,
+    0x303204, 0x0, 0x0, 0x333204, 0x0, 0x353204, 0x363204, 0x0, 0x0, 0x393204, 0x3a3204, 0x0, 0x3c3204, 0x0, 0x0, 0x3f3204,
+    0x403204, 0x0, 0x0, 0x433204, 0x0, 0x453204, 0x463204, 0x0, 0x0, 0x493204, 0x4a3204, 0x0, 0x4c3204, 0x0, 0x0, 0x4f3204,
+    0x0, 0x513204, 0x523204, 0x0, 0x543204, 0x0, 0x0, 0x573204, 0x583204, 0x0, 0x0, 0x5b3204, 0x0, 0x5d3204, 0x5e3204, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3404, 0xff3404, 0x0, 0xff3404, 0x0, 0x0, 0xff3404, 0xff3404, 0x0, 0x0, 0xff3404, 0x0, 0xff3404, 0xff3404, 0x0,
+    0xff3404, 0x0, 0x0, 0xff3404, 0x0, 0xff3404, 0xff3404, 0x0, 0x0, 0xff3404, 0xff3404, 0x0, 0xff3404, 0x0, 0x0, 0xff3404,
+    0x3404, 0x0, 0x0, 0x33404, 0x0, 0x53404, 0x63404, 0x0, 0x0, 0x93404, 0xa3404, 0x0, 0xc3404, 0x0, 0x0, 0xf3404,
+    0x0, 0x113404, 0x123404, 0x0, 0x143404, 0x0, 0x0, 0x173404, 0x183404, 0x0, 0x0, 0x1b3404, 0x0, 0x1d3404, 0x1e3404, 0x0,
+    0x203404, 0x0, 0x0, 0x233404, 0x0, 0x253404, 0x263404, 0x0, 0x0, 0x293404, 0x2a3404, 0x0, 0x2c3404, 0x0, 0x0, 0x2f3404,
+    0x0, 0x313404, 0x323404, 0x0, 0x343404, 0x0, 0x0, 0x373404, 0x383404, 0x0, 0x0, 0x3b3404, 0x0, 0x3d3404, 0x3e3404, 0x0,
+    0x0, 0x413404, 0x423404, 0x0, 0x443404, 0x0, 0x0, 0x473404, 0x483404, 0x0, 0x0, 0x4b3404, 0x0, 0x4d3404, 0x4e3404, 0x0,
+    0x503404, 0x0, 0x0, 0x533404, 0x0, 0x553404, 0x563404, 0x0, 0x0, 0x593404, 0x5a3404, 0x0, 0x5c3404, 0x0, 0x0, 0x5f3404,
+    0xff3404, 0x0, 0x0, 0xff3404, 0x0, 0xff3404, 0xff3404, 0x0, 0x0, 0xff3404, 0xff3404, 0x0, 0xff3404, 0x0, 0x0, 0xff3404,
+    0x0, 0xff3404, 0xff3404, 0x0, 0xff3404, 0x0, 0x0, 0xff3404, 0xff3404, 0x0, 0x0, 0xff3404, 0x0, 0xff3404, 0xff3404, 0x0,
+    0x0, 0x13404, 0x23404, 0x0, 0x43404, 0x0, 0x0, 0x73404, 0x83404, 0x0, 0x0, 0xb3404, 0x0, 0xd3404, 0xe3404, 0x0,
+    0x103404, 0x0, 0x0, 0x133404, 0x0, 0x153404, 0x163404, 0x0, 0x0, 0x193404, 0x1a3404, 0x0, 0x1c3404, 0x0, 0x0, 0x1f3404,
+    0x0, 0x213404, 0x223404, 0x0, 0x243404, 0x0, 0x0, 0x273404, 0x283404, 0x0, 0x0, 0x2b3404, 0x0, 0x2d3404, 0x2e3404, 0x0,
+    0x303404, 0x0, 0x0, 0x333404, 0x0, 0x353404, 0x363404, 0x0, 0x0, 0x393404, 0x3a3404, 0x0, 0x3c3404, 0x0, 0x0, 0x3f3404,
+    0x403404, 0x0, 0x0, 0x433404, 0x0, 0x453404, 0x463404, 0x0, 0x0, 0x493404, 0x4a3404, 0x0, 0x4c3404, 0x0, 0x0, 0x4f3404,
+    0x0, 0x513404, 0x523404, 0x0, 0x543404, 0x0, 0x0, 0x573404, 0x583404, 0x0, 0x0, 0x5b3404, 0x0, 0x5d3404, 0x5e3404, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3704, 0xff3704, 0x0, 0xff3704, 0x0, 0x0, 0xff3704, 0xff3704, 0x0, 0x0, 0xff3704, 0x0, 0xff3704, 0xff3704, 0x0,
+    0xff3704, 0x0, 0x0, 0xff3704, 0x0, 0xff3704, 0xff3704, 0x0, 0x0, 0xff3704, 0xff3704, 0x0, 0xff3704, 0x0, 0x0, 0xff3704,
+    0x3704, 0x0, 0x0, 0x33704, 0x0, 0x53704, 0x63704, 0x0, 0x0, 0x93704, 0xa3704, 0x0, 0xc3704, 0x0, 0x0, 0xf3704,
+    0x0, 0x113704, 0x123704, 0x0, 0x143704, 0x0, 0x0, 0x173704, 0x183704, 0x0, 0x0, 0x1b3704, 0x0, 0x1d3704, 0x1e3704, 0x0,
+    0x203704, 0x0, 0x0, 0x233704, 0x0, 0x253704, 0x263704, 0x0, 0x0, 0x293704, 0x2a3704, 0x0, 0x2c3704, 0x0, 0x0, 0x2f3704,
+    0x0, 0x313704, 0x323704, 0x0, 0x343704, 0x0, 0x0, 0x373704, 0x383704, 0x0, 0x0, 0x3b3704, 0x0, 0x3d3704, 0x3e3704, 0x0,
+    0x0, 0x413704, 0x423704, 0x0, 0x443704, 0x0, 0x0, 0x473704, 0x483704, 0x0, 0x0, 0x4b3704, 0x0, 0x4d3704, 0x4e3704, 0x0,
+    0x503704, 0x0, 0x0, 0x533704, 0x0, 0x553704, 0x563704, 0x0, 0x0, 0x593704, 0x5a3704, 0x0, 0x5c3704, 0x0, 0x0, 0x5f3704,
+    0xff3704, 0x0, 0x0, 0xff3704, 0x0, 0xff3704, 0xff3704, 0x0, 0x0, 0xff3704, 0xff3704, 0x0, 0xff3704, 0x0, 0x0, 0xff3704,
+    0x0, 0xff3704, 0xff3704, 0x0, 0xff3704, 0x0, 0x0, 0xff3704, 0xff3704, 0x0, 0x0, 0xff3704, 0x0, 0xff3704, 0xff3704, 0x0,
+    0x0, 0x13704, 0x23704, 0x0, 0x43704, 0x0, 0x0, 0x73704, 0x83704, 0x0, 0x0, 0xb3704, 0x0, 0xd3704, 0xe3704, 0x0,
+    0x103704, 0x0, 0x0, 0x133704, 0x0, 0x153704, 0x163704, 0x0, 0x0, 0x193704, 0x1a3704, 0x0, 0x1c3704, 0x0, 0x0, 0x1f3704,
+    0x0, 0x213704, 0x223704, 0x0, 0x243704, 0x0, 0x0, 0x273704, 0x283704, 0x0, 0x0, 0x2b3704, 0x0, 0x2d3704, 0x2e3704, 0x0,
+    0x303704, 0x0, 0x0, 0x333704, 0x0, 0x353704, 0x363704, 0x0, 0x0, 0x393704, 0x3a3704, 0x0, 0x3c3704, 0x0, 0x0, 0x3f3704,
+    0x403704, 0x0, 0x0, 0x433704, 0x0, 0x453704, 0x463704, 0x0, 0x0, 0x493704, 0x4a3704, 0x0, 0x4c3704, 0x0, 0x0, 0x4f3704,
+    0x0, 0x513704, 0x523704, 0x0, 0x543704, 0x0, 0x0, 0x573704, 0x583704, 0x0, 0x0, 0x5b3704, 0x0, 0x5d3704, 0x5e3704, 0x0,
+    0x0, 0xff3814, 0xff3814, 0x0, 0xff3814, 0x0, 0x0, 0xff3814, 0xff3814, 0x0, 0x0, 0xff3814, 0x0, 0xff3814, 0xff3814, 0x0,
+    0xff3814, 0x0, 0x0, 0xff3814, 0x0, 0xff3814, 0xff3814, 0x0, 0x0, 0xff3814, 0xff3814, 0x0, 0xff3814, 0x0, 0x0, 0xff3814,
+    0x3814, 0x0, 0x0, 0x33814, 0x0, 0x53814, 0x63814, 0x0, 0x0, 0x93814, 0xa3814, 0x0, 0xc3814, 0x0, 0x0, 0xf3814,
+    0x0, 0x113814, 0x123814, 0x0, 0x143814, 0x0, 0x0, 0x173814, 0x183814, 0x0, 0x0, 0x1b3814, 0x0, 0x1d3814, 0x1e3814, 0x0,
+    0x203814, 0x0, 0x0, 0x233814, 0x0, 0x253814, 0x263814, 0x0, 0x0, 0x293814, 0x2a3814, 0x0, 0x2c3814, 0x0, 0x0, 0x2f3814,
+    0x0, 0x313814, 0x323814, 0x0, 0x343814, 0x0, 0x0, 0x373814, 0x383814, 0x0, 0x0, 0x3b3814, 0x0, 0x3d3814, 0x3e3814, 0x0,
+    0x0, 0x413814, 0x423814, 0x0, 0x443814, 0x0, 0x0, 0x473814, 0x483814, 0x0, 0x0, 0x4b3814, 0x0, 0x4d3814, 0x4e3814, 0x0,
+    0x503814, 0x0, 0x0, 0x533814, 0x0, 0x553814, 0x563814, 0x0, 0x0, 0x593814, 0x5a3814, 0x0, 0x5c3814, 0x0, 0x0, 0x5f3814,
+    0xff3814, 0x0, 0x0, 0xff3814, 0x0, 0xff3814, 0xff3814, 0x0, 0x0, 0xff3814, 0xff3814, 0x0, 0xff3814, 0x0, 0x0, 0xff3814,
+    0x0, 0xff3814, 0xff3814, 0x0, 0xff3814, 0x0, 0x0, 0xff3814, 0xff3814, 0x0, 0x0, 0xff3814, 0x0, 0xff3814, 0xff3814, 0x0,
+    0x0, 0x13814, 0x23814, 0x0, 0x43814, 0x0, 0x0, 0x73814, 0x83814, 0x0, 0x0, 0xb3814, 0x0, 0xd3814, 0xe3814, 0x0,
+    0x103814, 0x0, 0x0, 0x133814, 0x0, 0x153814, 0x163814, 0x0, 0x0, 0x193814, 0x1a3814, 0x0, 0x1c3814, 0x0, 0x0, 0x1f3814,
+    0x0, 0x213814, 0x223814, 0x0, 0x243814, 0x0, 0x0, 0x273814, 0x283814, 0x0, 0x0, 0x2b3814, 0x0, 0x2d3814, 0x2e3814, 0x0,
+    0x303814, 0x0, 0x0, 0x333814, 0x0, 0x353814, 0x363814, 0x0, 0x0, 0x393814, 0x3a3814, 0x0, 0x3c3814, 0x0, 0x0, 0x3f3814,
+    0x403814, 0x0, 0x0, 0x433814, 0x0, 0x453814, 0x463814, 0x0, 0x0, 0x493814, 0x4a3814, 0x0, 0x4c3814, 0x0, 0x0, 0x4f3814,
+    0x0, 0x513814, 0x523814, 0x0, 0x543814, 0x0, 0x0, 0x573814, 0x583814, 0x0, 0x0, 0x5b3814, 0x0, 0x5d3814, 0x5e3814, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3b14, 0xff3b14, 0x0, 0xff3b14, 0x0, 0x0, 0xff3b14, 0xff3b14, 0x0, 0x0, 0xff3b14, 0x0, 0xff3b14, 0xff3b14, 0x0,
+    0xff3b14, 0x0, 0x0, 0xff3b14, 0x0, 0xff3b14, 0xff3b14, 0x0, 0x0, 0xff3b14, 0xff3b14, 0x0, 0xff3b14, 0x0, 0x0, 0xff3b14,
+    0x3b14, 0x0, 0x0, 0x33b14, 0x0, 0x53b14, 0x63b14, 0x0, 0x0, 0x93b14, 0xa3b14, 0x0, 0xc3b14, 0x0, 0x0, 0xf3b14,
+    0x0, 0x113b14, 0x123b14, 0x0, 0x143b14, 0x0, 0x0, 0x173b14, 0x183b14, 0x0, 0x0, 0x1b3b14, 0x0, 0x1d3b14, 0x1e3b14, 0x0,
+    0x203b14, 0x0, 0x0, 0x233b14, 0x0, 0x253b14, 0x263b14, 0x0, 0x0, 0x293b14, 0x2a3b14, 0x0, 0x2c3b14, 0x0, 0x0, 0x2f3b14,
+    0x0, 0x313b14, 0x323b14, 0x0, 0x343b14, 0x0, 0x0, 0x373b14, 0x383b14, 0x0, 0x0, 0x3b3b14, 0x0, 0x3d3b14, 0x3e3b14, 0x0,
+    0x0, 0x413b14, 0x423b14, 0x0, 0x443b14, 0x0, 0x0, 0x473b14, 0x483b14, 0x0, 0x0, 0x4b3b14, 0x0, 0x4d3b14, 0x4e3b14, 0x0,
+    0x503b14, 0x0, 0x0, 0x533b14, 0x0, 0x553b14, 0x563b14, 0x0, 0x0, 0x593b14, 0x5a3b14, 0x0, 0x5c3b14, 0x0, 0x0, 0x5f3b14,
+    0xff3b14, 0x0, 0x0, 0xff3b14, 0x0, 0xff3b14, 0xff3b14, 0x0, 0x0, 0xff3b14, 0xff3b14, 0x0, 0xff3b14, 0x0, 0x0, 0xff3b14,
+    0x0, 0xff3b14, 0xff3b14, 0x0, 0xff3b14, 0x0, 0x0, 0xff3b14, 0xff3b14, 0x0, 0x0, 0xff3b14, 0x0, 0xff3b14, 0xff3b14, 0x0,
+    0x0, 0x13b14, 0x23b14, 0x0, 0x43b14, 0x0, 0x0, 0x73b14, 0x83b14, 0x0, 0x0, 0xb3b14, 0x0, 0xd3b14, 0xe3b14, 0x0,
+    0x103b14, 0x0, 0x0, 0x133b14, 0x0, 0x153b14, 0x163b14, 0x0, 0x0, 0x193b14, 0x1a3b14, 0x0, 0x1c3b14, 0x0, 0x0, 0x1f3b14,
+    0x0, 0x213b14, 0x223b14, 0x0, 0x243b14, 0x0, 0x0, 0x273b14, 0x283b14, 0x0, 0x0, 0x2b3b14, 0x0, 0x2d3b14, 0x2e3b14, 0x0,
+    0x303b14, 0x0, 0x0, 0x333b14, 0x0, 0x353b14, 0x363b14, 0x0, 0x0, 0x393b14, 0x3a3b14, 0x0, 0x3c3b14, 0x0, 0x0, 0x3f3b14,
+    0x403b14, 0x0, 0x0, 0x433b14, 0x0, 0x453b14, 0x463b14, 0x0, 0x0, 0x493b14, 0x4a3b14, 0x0, 0x4c3b14, 0x0, 0x0, 0x4f3b14,
+    0x0, 0x513b14, 0x523b14, 0x0, 0x543b14, 0x0, 0x0, 0x573b14, 0x583b14, 0x0, 0x0, 0x5b3b14, 0x0, 0x5d3b14, 0x5e3b14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3d14, 0xff3d14, 0x0, 0xff3d14, 0x0, 0x0, 0xff3d14, 0xff3d14, 0x0, 0x0, 0xff3d14, 0x0, 0xff3d14, 0xff3d14, 0x0,
+    0xff3d14, 0x0, 0x0, 0xff3d14, 0x0, 0xff3d14, 0xff3d14, 0x0, 0x0, 0xff3d14, 0xff3d14, 0x0, 0xff3d14, 0x0, 0x0, 0xff3d14,
+    0x3d14, 0x0, 0x0, 0x33d14, 0x0, 0x53d14, 0x63d14, 0x0, 0x0, 0x93d14, 0xa3d14, 0x0, 0xc3d14, 0x0, 0x0, 0xf3d14,
+    0x0, 0x113d14, 0x123d14, 0x0, 0x143d14, 0x0, 0x0, 0x173d14, 0x183d14, 0x0, 0x0, 0x1b3d14, 0x0, 0x1d3d14, 0x1e3d14, 0x0,
+    0x203d14, 0x0, 0x0, 0x233d14, 0x0, 0x253d14, 0x263d14, 0x0, 0x0, 0x293d14, 0x2a3d14, 0x0, 0x2c3d14, 0x0, 0x0, 0x2f3d14,
+    0x0, 0x313d14, 0x323d14, 0x0, 0x343d14, 0x0, 0x0, 0x373d14, 0x383d14, 0x0, 0x0, 0x3b3d14, 0x0, 0x3d3d14, 0x3e3d14, 0x0,
+    0x0, 0x413d14, 0x423d14, 0x0, 0x443d14, 0x0, 0x0, 0x473d14, 0x483d14, 0x0, 0x0, 0x4b3d14, 0x0, 0x4d3d14, 0x4e3d14, 0x0,
+    0x503d14, 0x0, 0x0, 0x533d14, 0x0, 0x553d14, 0x563d14, 0x0, 0x0, 0x593d14, 0x5a3d14, 0x0, 0x5c3d14, 0x0, 0x0, 0x5f3d14,
+    0xff3d14, 0x0, 0x0, 0xff3d14, 0x0, 0xff3d14, 0xff3d14, 0x0, 0x0, 0xff3d14, 0xff3d14, 0x0, 0xff3d14, 0x0, 0x0, 0xff3d14,
+    0x0, 0xff3d14, 0xff3d14, 0x0, 0xff3d14, 0x0, 0x0, 0xff3d14, 0xff3d14, 0x0, 0x0, 0xff3d14, 0x0, 0xff3d14, 0xff3d14, 0x0,
+    0x0, 0x13d14, 0x23d14, 0x0, 0x43d14, 0x0, 0x0, 0x73d14, 0x83d14, 0x0, 0x0, 0xb3d14, 0x0, 0xd3d14, 0xe3d14, 0x0,
+    0x103d14, 0x0, 0x0, 0x133d14, 0x0, 0x153d14, 0x163d14, 0x0, 0x0, 0x193d14, 0x1a3d14, 0x0, 0x1c3d14, 0x0, 0x0, 0x1f3d14,
+    0x0, 0x213d14, 0x223d14, 0x0, 0x243d14, 0x0, 0x0, 0x273d14, 0x283d14, 0x0, 0x0, 0x2b3d14, 0x0, 0x2d3d14, 0x2e3d14, 0x0,
+    0x303d14, 0x0, 0x0, 0x333d14, 0x0, 0x353d14, 0x363d14, 0x0, 0x0, 0x393d14, 0x3a3d14, 0x0, 0x3c3d14, 0x0, 0x0, 0x3f3d14,
+    0x403d14, 0x0, 0x0, 0x433d14, 0x0, 0x453d14, 0x463d14, 0x0, 0x0, 0x493d14, 0x4a3d14, 0x0, 0x4c3d14, 0x0, 0x0, 0x4f3d14,
+    0x0, 0x513d14, 0x523d14, 0x0, 0x543d14, 0x0, 0x0, 0x573d14, 0x583d14, 0x0, 0x0, 0x5b3d14, 0x0, 0x5d3d14, 0x5e3d14, 0x0,
+    0x0, 0xff3e14, 0xff3e14, 0x0, 0xff3e14, 0x0, 0x0, 0xff3e14, 0xff3e14, 0x0, 0x0, 0xff3e14, 0x0, 0xff3e14, 0xff3e14, 0x0,
+    0xff3e14, 0x0, 0x0, 0xff3e14, 0x0, 0xff3e14, 0xff3e14, 0x0, 0x0, 0xff3e14, 0xff3e14, 0x0, 0xff3e14, 0x0, 0x0, 0xff3e14,
+    0x3e14, 0x0, 0x0, 0x33e14, 0x0, 0x53e14, 0x63e14, 0x0, 0x0, 0x93e14, 0xa3e14, 0x0, 0xc3e14, 0x0, 0x0, 0xf3e14,
+    0x0, 0x113e14, 0x123e14, 0x0, 0x143e14, 0x0, 0x0, 0x173e14, 0x183e14, 0x0, 0x0, 0x1b3e14, 0x0, 0x1d3e14, 0x1e3e14, 0x0,
+    0x203e14, 0x0, 0x0, 0x233e14, 0x0, 0x253e14, 0x263e14, 0x0, 0x0, 0x293e14, 0x2a3e14, 0x0, 0x2c3e14, 0x0, 0x0, 0x2f3e14,
+    0x0, 0x313e14, 0x323e14, 0x0, 0x343e14, 0x0, 0x0, 0x373e14, 0x383e14, 0x0, 0x0, 0x3b3e14, 0x0, 0x3d3e14, 0x3e3e14, 0x0,
+    0x0, 0x413e14, 0x423e14, 0x0, 0x443e14, 0x0, 0x0, 0x473e14, 0x483e14, 0x0, 0x0, 0x4b3e14, 0x0, 0x4d3e14, 0x4e3e14, 0x0,
+    0x503e14, 0x0, 0x0, 0x533e14, 0x0, 0x553e14, 0x563e14, 0x0, 0x0, 0x593e14, 0x5a3e14, 0x0, 0x5c3e14, 0x0, 0x0, 0x5f3e14,
+    0xff3e14, 0x0, 0x0, 0xff3e14, 0x0, 0xff3e14, 0xff3e14, 0x0, 0x0, 0xff3e14, 0xff3e14, 0x0, 0xff3e14, 0x0, 0x0, 0xff3e14,
+    0x0, 0xff3e14, 0xff3e14, 0x0, 0xff3e14, 0x0, 0x0, 0xff3e14, 0xff3e14, 0x0, 0x0, 0xff3e14, 0x0, 0xff3e14, 0xff3e14, 0x0,
+    0x0, 0x13e14, 0x23e14, 0x0, 0x43e14, 0x0, 0x0, 0x73e14, 0x83e14, 0x0, 0x0, 0xb3e14, 0x0, 0xd3e14, 0xe3e14, 0x0,
+    0x103e14, 0x0, 0x0, 0x133e14, 0x0, 0x153e14, 0x163e14, 0x0, 0x0, 0x193e14, 0x1a3e14, 0x0, 0x1c3e14, 0x0, 0x0, 0x1f3e14,
+    0x0, 0x213e14, 0x223e14, 0x0, 0x243e14, 0x0, 0x0, 0x273e14, 0x283e14, 0x0, 0x0, 0x2b3e14, 0x0, 0x2d3e14, 0x2e3e14, 0x0,
+    0x303e14, 0x0, 0x0, 0x333e14, 0x0, 0x353e14, 0x363e14, 0x0, 0x0, 0x393e14, 0x3a3e14, 0x0, 0x3c3e14, 0x0, 0x0, 0x3f3e14,
+    0x403e14, 0x0, 0x0, 0x433e14, 0x0, 0x453e14, 0x463e14, 0x0, 0x0, 0x493e14, 0x4a3e14, 0x0, 0x4c3e14, 0x0, 0x0, 0x4f3e14,
+    0x0, 0x513e14, 0x523e14, 0x0, 0x543e14, 0x0, 0x0, 0x573e14, 0x583e14, 0x0, 0x0, 0x5b3e14, 0x0, 0x5d3e14, 0x5e3e14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4104, 0xff4104, 0x0, 0xff4104, 0x0, 0x0, 0xff4104, 0xff4104, 0x0, 0x0, 0xff4104, 0x0, 0xff4104, 0xff4104, 0x0,
+    0xff4104, 0x0, 0x0, 0xff4104, 0x0, 0xff4104, 0xff4104, 0x0, 0x0, 0xff4104, 0xff4104, 0x0, 0xff4104, 0x0, 0x0, 0xff4104,
+    0x4104, 0x0, 0x0, 0x34104, 0x0, 0x54104, 0x64104, 0x0, 0x0, 0x94104, 0xa4104, 0x0, 0xc4104, 0x0, 0x0, 0xf4104,
+    0x0, 0x114104, 0x124104, 0x0, 0x144104, 0x0, 0x0, 0x174104, 0x184104, 0x0, 0x0, 0x1b4104, 0x0, 0x1d4104, 0x1e4104, 0x0,
+    0x204104, 0x0, 0x0, 0x234104, 0x0, 0x254104, 0x264104, 0x0, 0x0, 0x294104, 0x2a4104, 0x0, 0x2c4104, 0x0, 0x0, 0x2f4104,
+    0x0, 0x314104, 0x324104, 0x0, 0x344104, 0x0, 0x0, 0x374104, 0x384104, 0x0, 0x0, 0x3b4104, 0x0, 0x3d4104, 0x3e4104, 0x0,
+    0x0, 0x414104, 0x424104, 0x0, 0x444104, 0x0, 0x0, 0x474104, 0x484104, 0x0, 0x0, 0x4b4104, 0x0, 0x4d4104, 0x4e4104, 0x0,
+    0x504104, 0x0, 0x0, 0x534104, 0x0, 0x554104, 0x564104, 0x0, 0x0, 0x594104, 0x5a4104, 0x0, 0x5c4104, 0x0, 0x0, 0x5f4104,
+    0xff4104, 0x0, 0x0, 0xff4104, 0x0, 0xff4104, 0xff4104, 0x0, 0x0, 0xff4104, 0xff4104, 0x0, 0xff4104, 0x0, 0x0, 0xff4104,
+    0x0, 0xff4104, 0xff4104, 0x0, 0xff4104, 0x0, 0x0, 0xff4104, 0xff4104, 0x0, 0x0, 0xff4104, 0x0, 0xff4104, 0xff4104, 0x0,
+    0x0, 0x14104, 0x24104, 0x0, 0x44104, 0x0, 0x0, 0x74104, 0x84104, 0x0, 0x0, 0xb4104, 0x0, 0xd4104, 0xe4104, 0x0,
+    0x104104, 0x0, 0x0, 0x134104, 0x0, 0x154104, 0x164104, 0x0, 0x0, 0x194104, 0x1a4104, 0x0, 0x1c4104, 0x0, 0x0, 0x1f4104,
+    0x0, 0x214104, 0x224104, 0x0, 0x244104, 0x0, 0x0, 0x274104, 0x284104, 0x0, 0x0, 0x2b4104, 0x0, 0x2d4104, 0x2e4104, 0x0,
+    0x304104, 0x0, 0x0, 0x334104, 0x0, 0x354104, 0x364104, 0x0, 0x0, 0x394104, 0x3a4104, 0x0, 0x3c4104, 0x0, 0x0, 0x3f4104,
+    0x404104, 0x0, 0x0, 0x434104, 0x0, 0x454104, 0x464104, 0x0, 0x0, 0x494104, 0x4a4104, 0x0, 0x4c4104, 0x0, 0x0, 0x4f4104,
+    0x0, 0x514104, 0x524104, 0x0, 0x544104, 0x0, 0x0, 0x574104, 0x584104, 0x0, 0x0, 0x5b4104, 0x0, 0x5d4104, 0x5e4104, 0x0,
+    0x0, 0xff4204, 0xff4204, 0x0, 0xff4204, 0x0, 0x0, 0xff4204, 0xff4204, 0x0, 0x0, 0xff4204, 0x0, 0xff4204, 0xff4204, 0x0,
+    0xff4204, 0x0, 0x0, 0xff4204, 0x0, 0xff4204, 0xff4204, 0x0, 0x0, 0xff4204, 0xff4204, 0x0, 0xff4204, 0x0, 0x0, 0xff4204,
+    0x4204, 0x0, 0x0, 0x34204, 0x0, 0x54204, 0x64204, 0x0, 0x0, 0x94204, 0xa4204, 0x0, 0xc4204, 0x0, 0x0, 0xf4204,
+    0x0, 0x114204, 0x124204, 0x0, 0x144204, 0x0, 0x0, 0x174204, 0x184204, 0x0, 0x0, 0x1b4204, 0x0, 0x1d4204, 0x1e4204, 0x0,
+    0x204204, 0x0, 0x0, 0x234204, 0x0, 0x254204, 0x264204, 0x0, 0x0, 0x294204, 0x2a4204, 0x0, 0x2c4204, 0x0, 0x0, 0x2f4204,
+    0x0, 0x314204, 0x324204, 0x0, 0x344204, 0x0, 0x0, 0x374204, 0x384204, 0x0, 0x0, 0x3b4204, 0x0, 0x3d4204, 0x3e4204, 0x0,
+    0x0, 0x414204, 0x424204, 0x0, 0x444204, 0x0, 0x0, 0x474204, 0x484204, 0x0, 0x0, 0x4b4204, 0x0, 0x4d4204, 0x4e4204, 0x0,
+    0x504204, 0x0, 0x0, 0x534204, 0x0, 0x554204, 0x564204, 0x0, 0x0, 0x594204, 0x5a4204, 0x0, 0x5c4204, 0x0, 0x0, 0x5f4204,
+    0xff4204, 0x0, 0x0, 0xff4204, 0x0, 0xff4204, 0xff4204, 0x0, 0x0, 0xff4204, 0xff4204, 0x0, 0xff4204, 0x0, 0x0, 0xff4204,
+    0x0, 0xff4204, 0xff4204, 0x0, 0xff4204, 0x0, 0x0, 0xff4204, 0xff4204, 0x0, 0x0, 0xff4204, 0x0, 0xff4204, 0xff4204, 0x0,
+    0x0, 0x14204, 0x24204, 0x0, 0x44204, 0x0, 0x0, 0x74204, 0x84204, 0x0, 0x0, 0xb4204, 0x0, 0xd4204, 0xe4204, 0x0,
+    0x104204, 0x0, 0x0, 0x134204, 0x0, 0x154204, 0x164204, 0x0, 0x0, 0x194204, 0x1a4204, 0x0, 0x1c4204, 0x0, 0x0, 0x1f4204,
+    0x0, 0x214204, 0x224204, 0x0, 0x244204, 0x0, 0x0, 0x274204, 0x284204, 0x0, 0x0, 0x2b4204, 0x0, 0x2d4204, 0x2e4204, 0x0,
+    0x304204, 0x0, 0x0, 0x334204, 0x0, 0x354204, 0x364204, 0x0, 0x0, 0x394204, 0x3a4204, 0x0, 0x3c4204, 0x0, 0x0, 0x3f4204,
+    0x404204, 0x0, 0x0, 0x434204, 0x0, 0x454204, 0x464204, 0x0, 0x0, 0x494204, 0x4a4204, 0x0, 0x4c4204, 0x0, 0x0, 0x4f4204,
+    0x0, 0x514204, 0x524204, 0x0, 0x544204, 0x0, 0x0, 0x574204, 0x584204, 0x0, 0x0, 0x5b4204, 0x0, 0x5d4204, 0x5e4204, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4404, 0xff4404, 0x0, 0xff4404, 0x0, 0x0, 0xff4404, 0xff4404, 0x0, 0x0, 0xff4404, 0x0, 0xff4404, 0xff4404, 0x0,
+    0xff4404, 0x0, 0x0, 0xff4404, 0x0, 0xff4404, 0xff4404, 0x0, 0x0, 0xff4404, 0xff4404, 0x0, 0xff4404, 0x0, 0x0, 0xff4404,
+    0x4404, 0x0, 0x0, 0x34404, 0x0, 0x54404, 0x64404, 0x0, 0x0, 0x94404, 0xa4404, 0x0, 0xc4404, 0x0, 0x0, 0xf4404,
+    0x0, 0x114404, 0x124404, 0x0, 0x144404, 0x0, 0x0, 0x174404, 0x184404, 0x0, 0x0, 0x1b4404, 0x0, 0x1d4404, 0x1e4404, 0x0,
+    0x204404, 0x0, 0x0, 0x234404, 0x0, 0x254404, 0x264404, 0x0, 0x0, 0x294404, 0x2a4404, 0x0, 0x2c4404, 0x0, 0x0, 0x2f4404,
+    0x0, 0x314404, 0x324404, 0x0, 0x344404, 0x0, 0x0, 0x374404, 0x384404, 0x0, 0x0, 0x3b4404, 0x0, 0x3d4404, 0x3e4404, 0x0,
+    0x0, 0x414404, 0x424404, 0x0, 0x444404, 0x0, 0x0, 0x474404, 0x484404, 0x0, 0x0, 0x4b4404, 0x0, 0x4d4404, 0x4e4404, 0x0,
+    0x504404, 0x0, 0x0, 0x534404, 0x0, 0x554404, 0x564404, 0x0, 0x0, 0x594404, 0x5a4404, 0x0, 0x5c4404, 0x0, 0x0, 0x5f4404,
+    0xff4404, 0x0, 0x0, 0xff4404, 0x0, 0xff4404, 0xff4404, 0x0, 0x0, 0xff4404, 0xff4404, 0x0, 0xff4404, 0x0, 0x0, 0xff4404,
+    0x0, 0xff4404, 0xff4404, 0x0, 0xff4404, 0x0, 0x0, 0xff4404, 0xff4404, 0x0, 0x0, 0xff4404, 0x0, 0xff4404, 0xff4404, 0x0,
+    0x0, 0x14404, 0x24404, 0x0, 0x44404, 0x0, 0x0, 0x74404, 0x84404, 0x0, 0x0, 0xb4404, 0x0, 0xd4404, 0xe4404, 0x0,
+    0x104404, 0x0, 0x0, 0x134404, 0x0, 0x154404, 0x164404, 0x0, 0x0, 0x194404, 0x1a4404, 0x0, 0x1c4404, 0x0, 0x0, 0x1f4404,
+    0x0, 0x214404, 0x224404, 0x0, 0x244404, 0x0, 0x0, 0x274404, 0x284404, 0x0, 0x0, 0x2b4404, 0x0, 0x2d4404, 0x2e4404, 0x0,
+    0x304404, 0x0, 0x0, 0x334404, 0x0, 0x354404, 0x364404, 0x0, 0x0, 0x394404, 0x3a4404, 0x0, 0x3c4404, 0x0, 0x0, 0x3f4404,
+    0x404404, 0x0, 0x0, 0x434404, 0x0, 0x454404, 0x464404, 0x0, 0x0, 0x494404, 0x4a4404, 0x0, 0x4c4404, 0x0, 0x0, 0x4f4404,
+    0x0, 0x514404, 0x524404, 0x0, 0x544404, 0x0, 0x0, 0x574404, 0x584404, 0x0, 0x0, 0x5b4404, 0x0, 0x5d4404, 0x5e4404, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4704, 0xff4704, 0x0, 0xff4704, 0x0, 0x0, 0xff4704, 0xff4704, 0x0, 0x0, 0xff4704, 0x0, 0xff4704, 0xff4704, 0x0,
+    0xff4704, 0x0, 0x0, 0xff4704, 0x0, 0xff4704, 0xff4704, 0x0, 0x0, 0xff4704, 0xff4704, 0x0, 0xff4704, 0x0, 0x0, 0xff4704,
+    0x4704, 0x0, 0x0, 0x34704, 0x0, 0x54704, 0x64704, 0x0, 0x0, 0x94704, 0xa4704, 0x0, 0xc4704, 0x0, 0x0, 0xf4704,
+    0x0, 0x114704, 0x124704, 0x0, 0x144704, 0x0, 0x0, 0x174704, 0x184704, 0x0, 0x0, 0x1b4704, 0x0, 0x1d4704, 0x1e4704, 0x0,
+    0x204704, 0x0, 0x0, 0x234704, 0x0, 0x254704, 0x264704, 0x0, 0x0, 0x294704, 0x2a4704, 0x0, 0x2c4704, 0x0, 0x0, 0x2f4704,
+    0x0, 0x314704, 0x324704, 0x0, 0x344704, 0x0, 0x0, 0x374704, 0x384704, 0x0, 0x0, 0x3b4704, 0x0, 0x3d4704, 0x3e4704, 0x0,
+    0x0, 0x414704, 0x424704, 0x0, 0x444704, 0x0, 0x0, 0x474704, 0x484704, 0x0, 0x0, 0x4b4704, 0x0, 0x4d4704, 0x4e4704, 0x0,
+    0x504704, 0x0, 0x0, 0x534704, 0x0, 0x554704, 0x564704, 0x0, 0x0, 0x594704, 0x5a4704, 0x0, 0x5c4704, 0x0, 0x0, 0x5f4704,
+    0xff4704, 0x0, 0x0, 0xff4704, 0x0, 0xff4704, 0xff4704, 0x0, 0x0, 0xff4704, 0xff4704, 0x0, 0xff4704, 0x0, 0x0, 0xff4704,
+    0x0, 0xff4704, 0xff4704, 0x0, 0xff4704, 0x0, 0x0, 0xff4704, 0xff4704, 0x0, 0x0, 0xff4704, 0x0, 0xff4704, 0xff4704, 0x0,
+    0x0, 0x14704, 0x24704, 0x0, 0x44704, 0x0, 0x0, 0x74704, 0x84704, 0x0, 0x0, 0xb4704, 0x0, 0xd4704, 0xe4704, 0x0,
+    0x104704, 0x0, 0x0, 0x134704, 0x0, 0x154704, 0x164704, 0x0, 0x0, 0x194704, 0x1a4704, 0x0, 0x1c4704, 0x0, 0x0, 0x1f4704,
+    0x0, 0x214704, 0x224704, 0x0, 0x244704, 0x0, 0x0, 0x274704, 0x284704, 0x0, 0x0, 0x2b4704, 0x0, 0x2d4704, 0x2e4704, 0x0,
+    0x304704, 0x0, 0x0, 0x334704, 0x0, 0x354704, 0x364704, 0x0, 0x0, 0x394704, 0x3a4704, 0x0, 0x3c4704, 0x0, 0x0, 0x3f4704,
+    0x404704, 0x0, 0x0, 0x434704, 0x0, 0x454704, 0x464704, 0x0, 0x0, 0x494704, 0x4a4704, 0x0, 0x4c4704, 0x0, 0x0, 0x4f4704,
+    0x0, 0x514704, 0x524704, 0x0, 0x544704, 0x0, 0x0, 0x574704, 0x584704, 0x0, 0x0, 0x5b4704, 0x0, 0x5d4704, 0x5e4704, 0x0,
+    0x0, 0xff4814, 0xff4814, 0x0, 0xff4814, 0x0, 0x0, 0xff4814, 0xff4814, 0x0, 0x0, 0xff4814, 0x0, 0xff4814, 0xff4814, 0x0,
+    0xff4814, 0x0, 0x0, 0xff4814, 0x0, 0xff4814, 0xff4814, 0x0, 0x0, 0xff4814, 0xff4814, 0x0, 0xff4814, 0x0, 0x0, 0xff4814,
+    0x4814, 0x0, 0x0, 0x34814, 0x0, 0x54814, 0x64814, 0x0, 0x0, 0x94814, 0xa4814, 0x0, 0xc4814, 0x0, 0x0, 0xf4814,
+    0x0, 0x114814, 0x124814, 0x0, 0x144814, 0x0, 0x0, 0x174814, 0x184814, 0x0, 0x0, 0x1b4814, 0x0, 0x1d4814, 0x1e4814, 0x0,
+    0x204814, 0x0, 0x0, 0x234814, 0x0, 0x254814, 0x264814, 0x0, 0x0, 0x294814, 0x2a4814, 0x0, 0x2c4814, 0x0, 0x0, 0x2f4814,
+    0x0, 0x314814, 0x324814, 0x0, 0x344814, 0x0, 0x0, 0x374814, 0x384814, 0x0, 0x0, 0x3b4814, 0x0, 0x3d4814, 0x3e4814, 0x0,
+    0x0, 0x414814, 0x424814, 0x0, 0x444814, 0x0, 0x0, 0x474814, 0x484814, 0x0, 0x0, 0x4b4814, 0x0, 0x4d4814, 0x4e4814, 0x0,
+    0x504814, 0x0, 0x0, 0x534814, 0x0, 0x554814, 0x564814, 0x0, 0x0, 0x594814, 0x5a4814, 0x0, 0x5c4814, 0x0, 0x0, 0x5f4814,
+    0xff4814, 0x0, 0x0, 0xff4814, 0x0, 0xff4814, 0xff4814, 0x0, 0x0, 0xff4814, 0xff4814, 0x0, 0xff4814, 0x0, 0x0, 0xff4814,
+    0x0, 0xff4814, 0xff4814, 0x0, 0xff4814, 0x0, 0x0, 0xff4814, 0xff4814, 0x0, 0x0, 0xff4814, 0x0, 0xff4814, 0xff4814, 0x0,
+    0x0, 0x14814, 0x24814, 0x0, 0x44814, 0x0, 0x0, 0x74814, 0x84814, 0x0, 0x0, 0xb4814, 0x0, 0xd4814, 0xe4814, 0x0,
+    0x104814, 0x0, 0x0, 0x134814, 0x0, 0x154814, 0x164814, 0x0, 0x0, 0x194814, 0x1a4814, 0x0, 0x1c4814, 0x0, 0x0, 0x1f4814,
+    0x0, 0x214814, 0x224814, 0x0, 0x244814, 0x0, 0x0, 0x274814, 0x284814, 0x0, 0x0, 0x2b4814, 0x0, 0x2d4814, 0x2e4814, 0x0,
+    0x304814, 0x0, 0x0, 0x334814, 0x0, 0x354814, 0x364814, 0x0, 0x0, 0x394814, 0x3a4814, 0x0, 0x3c4814, 0x0, 0x0, 0x3f4814,
+    0x404814, 0x0, 0x0, 0x434814, 0x0, 0x454814, 0x464814, 0x0, 0x0, 0x494814, 0x4a4814, 0x0, 0x4c4814, 0x0, 0x0, 0x4f4814,
+    0x0, 0x514814, 0x524814, 0x0, 0x544814, 0x0, 0x0, 0x574814, 0x584814, 0x0, 0x0, 0x5b4814, 0x0, 0x5d4814, 0x5e4814, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4b14, 0xff4b14, 0x0, 0xff4b14, 0x0, 0x0, 0xff4b14, 0xff4b14, 0x0, 0x0, 0xff4b14, 0x0, 0xff4b14, 0xff4b14, 0x0,
+    0xff4b14, 0x0, 0x0, 0xff4b14, 0x0, 0xff4b14, 0xff4b14, 0x0, 0x0, 0xff4b14, 0xff4b14, 0x0, 0xff4b14, 0x0, 0x0, 0xff4b14,
+    0x4b14, 0x0, 0x0, 0x34b14, 0x0, 0x54b14, 0x64b14, 0x0, 0x0, 0x94b14, 0xa4b14, 0x0, 0xc4b14, 0x0, 0x0, 0xf4b14,
+    0x0, 0x114b14, 0x124b14, 0x0, 0x144b14, 0x0, 0x0, 0x174b14, 0x184b14, 0x0, 0x0, 0x1b4b14, 0x0, 0x1d4b14, 0x1e4b14, 0x0,
+    0x204b14, 0x0, 0x0, 0x234b14, 0x0, 0x254b14, 0x264b14, 0x0, 0x0, 0x294b14, 0x2a4b14, 0x0, 0x2c4b14, 0x0, 0x0, 0x2f4b14,
+    0x0, 0x314b14, 0x324b14, 0x0, 0x344b14, 0x0, 0x0, 0x374b14, 0x384b14, 0x0, 0x0, 0x3b4b14, 0x0, 0x3d4b14, 0x3e4b14, 0x0,
+    0x0, 0x414b14, 0x424b14, 0x0, 0x444b14, 0x0, 0x0, 0x474b14, 0x484b14, 0x0, 0x0, 0x4b4b14, 0x0, 0x4d4b14, 0x4e4b14, 0x0,
+    0x504b14, 0x0, 0x0, 0x534b14, 0x0, 0x554b14, 0x564b14, 0x0, 0x0, 0x594b14, 0x5a4b14, 0x0, 0x5c4b14, 0x0, 0x0, 0x5f4b14,
+    0xff4b14, 0x0, 0x0, 0xff4b14, 0x0, 0xff4b14, 0xff4b14, 0x0, 0x0, 0xff4b14, 0xff4b14, 0x0, 0xff4b14, 0x0, 0x0, 0xff4b14,
+    0x0, 0xff4b14, 0xff4b14, 0x0, 0xff4b14, 0x0, 0x0, 0xff4b14, 0xff4b14, 0x0, 0x0, 0xff4b14, 0x0, 0xff4b14, 0xff4b14, 0x0,
+    0x0, 0x14b14, 0x24b14, 0x0, 0x44b14, 0x0, 0x0, 0x74b14, 0x84b14, 0x0, 0x0, 0xb4b14, 0x0, 0xd4b14, 0xe4b14, 0x0,
+    0x104b14, 0x0, 0x0, 0x134b14, 0x0, 0x154b14, 0x164b14, 0x0, 0x0, 0x194b14, 0x1a4b14, 0x0, 0x1c4b14, 0x0, 0x0, 0x1f4b14,
+    0x0, 0x214b14, 0x224b14, 0x0, 0x244b14, 0x0, 0x0, 0x274b14, 0x284b14, 0x0, 0x0, 0x2b4b14, 0x0, 0x2d4b14, 0x2e4b14, 0x0,
+    0x304b14, 0x0, 0x0, 0x334b14, 0x0, 0x354b14, 0x364b14, 0x0, 0x0, 0x394b14, 0x3a4b14, 0x0, 0x3c4b14, 0x0, 0x0, 0x3f4b14,
+    0x404b14, 0x0, 0x0, 0x434b14, 0x0, 0x454b14, 0x464b14, 0x0, 0x0, 0x494b14, 0x4a4b14, 0x0, 0x4c4b14, 0x0, 0x0, 0x4f4b14,
+    0x0, 0x514b14, 0x524b14, 0x0, 0x544b14, 0x0, 0x0, 0x574b14, 0x584b14, 0x0, 0x0, 0x5b4b14, 0x0, 0x5d4b14, 0x5e4b14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4d14, 0xff4d14, 0x0, 0xff4d14, 0x0, 0x0, 0xff4d14, 0xff4d14, 0x0, 0x0, 0xff4d14, 0x0, 0xff4d14, 0xff4d14, 0x0,
+    0xff4d14, 0x0, 0x0, 0xff4d14, 0x0, 0xff4d14, 0xff4d14, 0x0, 0x0, 0xff4d14, 0xff4d14, 0x0, 0xff4d14, 0x0, 0x0, 0xff4d14,
+    0x4d14, 0x0, 0x0, 0x34d14, 0x0, 0x54d14, 0x64d14, 0x0, 0x0, 0x94d14, 0xa4d14, 0x0, 0xc4d14, 0x0, 0x0, 0xf4d14,
+    0x0, 0x114d14, 0x124d14, 0x0, 0x144d14, 0x0, 0x0, 0x174d14, 0x184d14, 0x0, 0x0, 0x1b4d14, 0x0, 0x1d4d14, 0x1e4d14, 0x0,
+    0x204d14, 0x0, 0x0, 0x234d14, 0x0, 0x254d14, 0x264d14, 0x0, 0x0, 0x294d14, 0x2a4d14, 0x0, 0x2c4d14, 0x0, 0x0, 0x2f4d14,
+    0x0, 0x314d14, 0x324d14, 0x0, 0x344d14, 0x0, 0x0, 0x374d14, 0x384d14, 0x0, 0x0, 0x3b4d14, 0x0, 0x3d4d14, 0x3e4d14, 0x0,
+    0x0, 0x414d14, 0x424d14, 0x0, 0x444d14, 0x0, 0x0, 0x474d14, 0x484d14, 0x0, 0x0, 0x4b4d14, 0x0, 0x4d4d14, 0x4e4d14, 0x0,
+    0x504d14, 0x0, 0x0, 0x534d14, 0x0, 0x554d14, 0x564d14, 0x0, 0x0, 0x594d14, 0x5a4d14, 0x0, 0x5c4d14, 0x0, 0x0, 0x5f4d14,
+    0xff4d14, 0x0, 0x0, 0xff4d14, 0x0, 0xff4d14, 0xff4d14, 0x0, 0x0, 0xff4d14, 0xff4d14, 0x0, 0xff4d14, 0x0, 0x0, 0xff4d14,
+    0x0, 0xff4d14, 0xff4d14, 0x0, 0xff4d14, 0x0, 0x0, 0xff4d14, 0xff4d14, 0x0, 0x0, 0xff4d14, 0x0, 0xff4d14, 0xff4d14, 0x0,
+    0x0, 0x14d14, 0x24d14, 0x0, 0x44d14, 0x0, 0x0, 0x74d14, 0x84d14, 0x0, 0x0, 0xb4d14, 0x0, 0xd4d14, 0xe4d14, 0x0,
+    0x104d14, 0x0, 0x0, 0x134d14, 0x0, 0x154d14, 0x164d14, 0x0, 0x0, 0x194d14, 0x1a4d14, 0x0, 0x1c4d14, 0x0, 0x0, 0x1f4d14,
+    0x0, 0x214d14, 0x224d14, 0x0, 0x244d14, 0x0, 0x0, 0x274d14, 0x284d14, 0x0, 0x0, 0x2b4d14, 0x0, 0x2d4d14, 0x2e4d14, 0x0,
+    0x304d14, 0x0, 0x0, 0x334d14, 0x0, 0x354d14, 0x364d14, 0x0, 0x0, 0x394d14, 0x3a4d14, 0x0, 0x3c4d14, 0x0, 0x0, 0x3f4d14,
+    0x404d14, 0x0, 0x0, 0x434d14, 0x0, 0x454d14, 0x464d14, 0x0, 0x0, 0x494d14, 0x4a4d14, 0x0, 0x4c4d14, 0x0, 0x0, 0x4f4d14,
+    0x0, 0x514d14, 0x524d14, 0x0, 0x544d14, 0x0, 0x0, 0x574d14, 0x584d14, 0x0, 0x0, 0x5b4d14, 0x0, 0x5d4d14, 0x5e4d14, 0x0,
+    0x0, 0xff4e14, 0xff4e14, 0x0, 0xff4e14, 0x0, 0x0, 0xff4e14, 0xff4e14, 0x0, 0x0, 0xff4e14, 0x0, 0xff4e14, 0xff4e14, 0x0,
+    0xff4e14, 0x0, 0x0, 0xff4e14, 0x0, 0xff4e14, 0xff4e14, 0x0, 0x0, 0xff4e14, 0xff4e14, 0x0, 0xff4e14, 0x0, 0x0, 0xff4e14,
+    0x4e14, 0x0, 0x0, 0x34e14, 0x0, 0x54e14, 0x64e14, 0x0, 0x0, 0x94e14, 0xa4e14, 0x0, 0xc4e14, 0x0, 0x0, 0xf4e14,
+    0x0, 0x114e14, 0x124e14, 0x0, 0x144e14, 0x0, 0x0, 0x174e14, 0x184e14, 0x0, 0x0, 0x1b4e14, 0x0, 0x1d4e14, 0x1e4e14, 0x0,
+    0x204e14, 0x0, 0x0, 0x234e14, 0x0, 0x254e14, 0x264e14, 0x0, 0x0, 0x294e14, 0x2a4e14, 0x0, 0x2c4e14, 0x0, 0x0, 0x2f4e14,
+    0x0, 0x314e14, 0x324e14, 0x0, 0x344e14, 0x0, 0x0, 0x374e14, 0x384e14, 0x0, 0x0, 0x3b4e14, 0x0, 0x3d4e14, 0x3e4e14, 0x0,
+    0x0, 0x414e14, 0x424e14, 0x0, 0x444e14, 0x0, 0x0, 0x474e14, 0x484e14, 0x0, 0x0, 0x4b4e14, 0x0, 0x4d4e14, 0x4e4e14, 0x0,
+    0x504e14, 0x0, 0x0, 0x534e14, 0x0, 0x554e14, 0x564e14, 0x0, 0x0, 0x594e14, 0x5a4e14, 0x0, 0x5c4e14, 0x0, 0x0, 0x5f4e14,
+    0xff4e14, 0x0, 0x0, 0xff4e14, 0x0, 0xff4e14, 0xff4e14, 0x0, 0x0, 0xff4e14, 0xff4e14, 0x0, 0xff4e14, 0x0, 0x0, 0xff4e14,
+    0x0, 0xff4e14, 0xff4e14, 0x0, 0xff4e14, 0x0, 0x0, 0xff4e14, 0xff4e14, 0x0, 0x0, 0xff4e14, 0x0, 0xff4e14, 0xff4e14, 0x0,
+    0x0, 0x14e14, 0x24e14, 0x0, 0x44e14, 0x0, 0x0, 0x74e14, 0x84e14, 0x0, 0x0, 0xb4e14, 0x0, 0xd4e14, 0xe4e14, 0x0,
+    0x104e14, 0x0, 0x0, 0x134e14, 0x0, 0x154e14, 0x164e14, 0x0, 0x0, 0x194e14, 0x1a4e14, 0x0, 0x1c4e14, 0x0, 0x0, 0x1f4e14,
+    0x0, 0x214e14, 0x224e14, 0x0, 0x244e14, 0x0, 0x0, 0x274e14, 0x284e14, 0x0, 0x0, 0x2b4e14, 0x0, 0x2d4e14, 0x2e4e14, 0x0,
+    0x304e14, 0x0, 0x0, 0x334e14, 0x0, 0x354e14, 0x364e14, 0x0, 0x0, 0x394e14, 0x3a4e14, 0x0, 0x3c4e14, 0x0, 0x0, 0x3f4e14,
+    0x404e14, 0x0, 0x0, 0x434e14, 0x0, 0x454e14, 0x464e14, 0x0, 0x0, 0x494e14, 0x4a4e14, 0x0, 0x4c4e14, 0x0, 0x0, 0x4f4e14,
+    0x0, 0x514e14, 0x524e14, 0x0, 0x544e14, 0x0, 0x0, 0x574e14, 0x584e14, 0x0, 0x0, 0x5b4e14, 0x0, 0x5d4e14, 0x5e4e14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5004, 0xff5004, 0x0, 0xff5004, 0x0, 0x0, 0xff5004, 0xff5004, 0x0, 0x0, 0xff5004, 0x0, 0xff5004, 0xff5004, 0x0,
+    0xff5004, 0x0, 0x0, 0xff5004, 0x0, 0xff5004, 0xff5004, 0x0, 0x0, 0xff5004, 0xff5004, 0x0, 0xff5004, 0x0, 0x0, 0xff5004,
+    0x5004, 0x0, 0x0, 0x35004, 0x0, 0x55004, 0x65004, 0x0, 0x0, 0x95004, 0xa5004, 0x0, 0xc5004, 0x0, 0x0, 0xf5004,
+    0x0, 0x115004, 0x125004, 0x0, 0x145004, 0x0, 0x0, 0x175004, 0x185004, 0x0, 0x0, 0x1b5004, 0x0, 0x1d5004, 0x1e5004, 0x0,
+    0x205004, 0x0, 0x0, 0x235004, 0x0, 0x255004, 0x265004, 0x0, 0x0, 0x295004, 0x2a5004, 0x0, 0x2c5004, 0x0, 0x0, 0x2f5004,
+    0x0, 0x315004, 0x325004, 0x0, 0x345004, 0x0, 0x0, 0x375004, 0x385004, 0x0, 0x0, 0x3b5004, 0x0, 0x3d5004, 0x3e5004, 0x0,
+    0x0, 0x415004, 0x425004, 0x0, 0x445004, 0x0, 0x0, 0x475004, 0x485004, 0x0, 0x0, 0x4b5004, 0x0, 0x4d5004, 0x4e5004, 0x0,
+    0x505004, 0x0, 0x0, 0x535004, 0x0, 0x555004, 0x565004, 0x0, 0x0, 0x595004, 0x5a5004, 0x0, 0x5c5004, 0x0, 0x0, 0x5f5004,
+    0xff5004, 0x0, 0x0, 0xff5004, 0x0, 0xff5004, 0xff5004, 0x0, 0x0, 0xff5004, 0xff5004, 0x0, 0xff5004, 0x0, 0x0, 0xff5004,
+    0x0, 0xff5004, 0xff5004, 0x0, 0xff5004, 0x0, 0x0, 0xff5004, 0xff5004, 0x0, 0x0, 0xff5004, 0x0, 0xff5004, 0xff5004, 0x0,
+    0x0, 0x15004, 0x25004, 0x0, 0x45004, 0x0, 0x0, 0x75004, 0x85004, 0x0, 0x0, 0xb5004, 0x0, 0xd5004, 0xe5004, 0x0,
+    0x105004, 0x0, 0x0, 0x135004, 0x0, 0x155004, 0x165004, 0x0, 0x0, 0x195004, 0x1a5004, 0x0, 0x1c5004, 0x0, 0x0, 0x1f5004,
+    0x0, 0x215004, 0x225004, 0x0, 0x245004, 0x0, 0x0, 0x275004, 0x285004, 0x0, 0x0, 0x2b5004, 0x0, 0x2d5004, 0x2e5004, 0x0,
+    0x305004, 0x0, 0x0, 0x335004, 0x0, 0x355004, 0x365004, 0x0, 0x0, 0x395004, 0x3a5004, 0x0, 0x3c5004, 0x0, 0x0, 0x3f5004,
+    0x405004, 0x0, 0x0, 0x435004, 0x0, 0x455004, 0x465004, 0x0, 0x0, 0x495004, 0x4a5004, 0x0, 0x4c5004, 0x0, 0x0, 0x4f5004,
+    0x0, 0x515004, 0x525004, 0x0, 0x545004, 0x0, 0x0, 0x575004, 0x585004, 0x0, 0x0, 0x5b5004, 0x0, 0x5d5004, 0x5e5004, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5304, 0xff5304, 0x0, 0xff5304, 0x0, 0x0, 0xff5304, 0xff5304, 0x0, 0x0, 0xff5304, 0x0, 0xff5304, 0xff5304, 0x0,
+    0xff5304, 0x0, 0x0, 0xff5304, 0x0, 0xff5304, 0xff5304, 0x0, 0x0, 0xff5304, 0xff5304, 0x0, 0xff5304, 0x0, 0x0, 0xff5304,
+    0x5304, 0x0, 0x0, 0x35304, 0x0, 0x55304, 0x65304, 0x0, 0x0, 0x95304, 0xa5304, 0x0, 0xc5304, 0x0, 0x0, 0xf5304,
+    0x0, 0x115304, 0x125304, 0x0, 0x145304, 0x0, 0x0, 0x175304, 0x185304, 0x0, 0x0, 0x1b5304, 0x0, 0x1d5304, 0x1e5304, 0x0,
+    0x205304, 0x0, 0x0, 0x235304, 0x0, 0x255304, 0x265304, 0x0, 0x0, 0x295304, 0x2a5304, 0x0, 0x2c5304, 0x0, 0x0, 0x2f5304,
+    0x0, 0x315304, 0x325304, 0x0, 0x345304, 0x0, 0x0, 0x375304, 0x385304, 0x0, 0x0, 0x3b5304, 0x0, 0x3d5304, 0x3e5304, 0x0,
+    0x0, 0x415304, 0x425304, 0x0, 0x445304, 0x0, 0x0, 0x475304, 0x485304, 0x0, 0x0, 0x4b5304, 0x0, 0x4d5304, 0x4e5304, 0x0,
+    0x505304, 0x0, 0x0, 0x535304, 0x0, 0x555304, 0x565304, 0x0, 0x0, 0x595304, 0x5a5304, 0x0, 0x5c5304, 0x0, 0x0, 0x5f5304,
+    0xff5304, 0x0, 0x0, 0xff5304, 0x0, 0xff5304, 0xff5304, 0x0, 0x0, 0xff5304, 0xff5304, 0x0, 0xff5304, 0x0, 0x0, 0xff5304,
+    0x0, 0xff5304, 0xff5304, 0x0, 0xff5304, 0x0, 0x0, 0xff5304, 0xff5304, 0x0, 0x0, 0xff5304, 0x0, 0xff5304, 0xff5304, 0x0,
+    0x0, 0x15304, 0x25304, 0x0, 0x45304, 0x0, 0x0, 0x75304, 0x85304, 0x0, 0x0, 0xb5304, 0x0, 0xd5304, 0xe5304, 0x0,
+    0x105304, 0x0, 0x0, 0x135304, 0x0, 0x155304, 0x165304, 0x0, 0x0, 0x195304, 0x1a5304, 0x0, 0x1c5304, 0x0, 0x0, 0x1f5304,
+    0x0, 0x215304, 0x225304, 0x0, 0x245304, 0x0, 0x0, 0x275304, 0x285304, 0x0, 0x0, 0x2b5304, 0x0, 0x2d5304, 0x2e5304, 0x0,
+    0x305304, 0x0, 0x0, 0x335304, 0x0, 0x355304, 0x365304, 0x0, 0x0, 0x395304, 0x3a5304, 0x0, 0x3c5304, 0x0, 0x0, 0x3f5304,
+    0x405304, 0x0, 0x0, 0x435304, 0x0, 0x455304, 0x465304, 0x0, 0x0, 0x495304, 0x4a5304, 0x0, 0x4c5304, 0x0, 0x0, 0x4f5304,
+    0x0, 0x515304, 0x525304, 0x0, 0x545304, 0x0, 0x0, 0x575304, 0x585304, 0x0, 0x0, 0x5b5304, 0x0, 0x5d5304, 0x5e5304, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5504, 0xff5504, 0x0, 0xff5504, 0x0, 0x0, 0xff5504, 0xff5504, 0x0, 0x0, 0xff5504, 0x0, 0xff5504, 0xff5504, 0x0,
+    0xff5504, 0x0, 0x0, 0xff5504, 0x0, 0xff5504, 0xff5504, 0x0, 0x0, 0xff5504, 0xff5504, 0x0, 0xff5504, 0x0, 0x0, 0xff5504,
+    0x5504, 0x0, 0x0, 0x35504, 0x0, 0x55504, 0x65504, 0x0, 0x0, 0x95504, 0xa5504, 0x0, 0xc5504, 0x0, 0x0, 0xf5504,
+    0x0, 0x115504, 0x125504, 0x0, 0x145504, 0x0, 0x0, 0x175504, 0x185504, 0x0, 0x0, 0x1b5504, 0x0, 0x1d5504, 0x1e5504, 0x0,
+    0x205504, 0x0, 0x0, 0x235504, 0x0, 0x255504, 0x265504, 0x0, 0x0, 0x295504, 0x2a5504, 0x0, 0x2c5504, 0x0, 0x0, 0x2f5504,
+    0x0, 0x315504, 0x325504, 0x0, 0x345504, 0x0, 0x0, 0x375504, 0x385504, 0x0, 0x0, 0x3b5504, 0x0, 0x3d5504, 0x3e5504, 0x0,
+    0x0, 0x415504, 0x425504, 0x0, 0x445504, 0x0, 0x0, 0x475504, 0x485504, 0x0, 0x0, 0x4b5504, 0x0, 0x4d5504, 0x4e5504, 0x0,
+    0x505504, 0x0, 0x0, 0x535504, 0x0, 0x555504, 0x565504, 0x0, 0x0, 0x595504, 0x5a5504, 0x0, 0x5c5504, 0x0, 0x0, 0x5f5504,
+    0xff5504, 0x0, 0x0, 0xff5504, 0x0, 0xff5504, 0xff5504, 0x0, 0x0, 0xff5504, 0xff5504, 0x0, 0xff5504, 0x0, 0x0, 0xff5504,
+    0x0, 0xff5504, 0xff5504, 0x0, 0xff5504, 0x0, 0x0, 0xff5504, 0xff5504, 0x0, 0x0, 0xff5504, 0x0, 0xff5504, 0xff5504, 0x0,
+    0x0, 0x15504, 0x25504, 0x0, 0x45504, 0x0, 0x0, 0x75504, 0x85504, 0x0, 0x0, 0xb5504, 0x0, 0xd5504, 0xe5504, 0x0,
+    0x105504, 0x0, 0x0, 0x135504, 0x0, 0x155504, 0x165504, 0x0, 0x0, 0x195504, 0x1a5504, 0x0, 0x1c5504, 0x0, 0x0, 0x1f5504,
+    0x0, 0x215504, 0x225504, 0x0, 0x245504, 0x0, 0x0, 0x275504, 0x285504, 0x0, 0x0, 0x2b5504, 0x0, 0x2d5504, 0x2e5504, 0x0,
+    0x305504, 0x0, 0x0, 0x335504, 0x0, 0x355504, 0x365504, 0x0, 0x0, 0x395504, 0x3a5504, 0x0, 0x3c5504, 0x0, 0x0, 0x3f5504,
+    0x405504, 0x0, 0x0, 0x435504, 0x0, 0x455504, 0x465504, 0x0, 0x0, 0x495504, 0x4a5504, 0x0, 0x4c5504, 0x0, 0x0, 0x4f5504,
+    0x0, 0x515504, 0x525504, 0x0, 0x545504, 0x0, 0x0, 0x575504, 0x585504, 0x0, 0x0, 0x5b5504, 0x0, 0x5d5504, 0x5e5504, 0x0,
+    0x0, 0xff5604, 0xff5604, 0x0, 0xff5604, 0x0, 0x0, 0xff5604, 0xff5604, 0x0, 0x0, 0xff5604, 0x0, 0xff5604, 0xff5604, 0x0,
+    0xff5604, 0x0, 0x0, 0xff5604, 0x0, 0xff5604, 0xff5604, 0x0, 0x0, 0xff5604, 0xff5604, 0x0, 0xff5604, 0x0, 0x0, 0xff5604,
+    0x5604, 0x0, 0x0, 0x35604, 0x0, 0x55604, 0x65604, 0x0, 0x0, 0x95604, 0xa5604, 0x0, 0xc5604, 0x0, 0x0, 0xf5604,
+    0x0, 0x115604, 0x125604, 0x0, 0x145604, 0x0, 0x0, 0x175604, 0x185604, 0x0, 0x0, 0x1b5604, 0x0, 0x1d5604, 0x1e5604, 0x0,
+    0x205604, 0x0, 0x0, 0x235604, 0x0, 0x255604, 0x265604, 0x0, 0x0, 0x295604, 0x2a5604, 0x0, 0x2c5604, 0x0, 0x0, 0x2f5604,
+    0x0, 0x315604, 0x325604, 0x0, 0x345604, 0x0, 0x0, 0x375604, 0x385604, 0x0, 0x0, 0x3b5604, 0x0, 0x3d5604, 0x3e5604, 0x0,
+    0x0, 0x415604, 0x425604, 0x0, 0x445604, 0x0, 0x0, 0x475604, 0x485604, 0x0, 0x0, 0x4b5604, 0x0, 0x4d5604, 0x4e5604, 0x0,
+    0x505604, 0x0, 0x0, 0x535604, 0x0, 0x555604, 0x565604, 0x0, 0x0, 0x595604, 0x5a5604, 0x0, 0x5c5604, 0x0, 0x0, 0x5f5604,
+    0xff5604, 0x0, 0x0, 0xff5604, 0x0, 0xff5604, 0xff5604, 0x0, 0x0, 0xff5604, 0xff5604, 0x0, 0xff5604, 0x0, 0x0, 0xff5604,
+    0x0, 0xff5604, 0xff5604, 0x0, 0xff5604, 0x0, 0x0, 0xff5604, 0xff5604, 0x0, 0x0, 0xff5604, 0x0, 0xff5604, 0xff5604, 0x0,
+    0x0, 0x15604, 0x25604, 0x0, 0x45604, 0x0, 0x0, 0x75604, 0x85604, 0x0, 0x0, 0xb5604, 0x0, 0xd5604, 0xe5604, 0x0,
+    0x105604, 0x0, 0x0, 0x135604, 0x0, 0x155604, 0x165604, 0x0, 0x0, 0x195604, 0x1a5604, 0x0, 0x1c5604, 0x0, 0x0, 0x1f5604,
+    0x0, 0x215604, 0x225604, 0x0, 0x245604, 0x0, 0x0, 0x275604, 0x285604, 0x0, 0x0, 0x2b5604, 0x0, 0x2d5604, 0x2e5604, 0x0,
+    0x305604, 0x0, 0x0, 0x335604, 0x0, 0x355604, 0x365604, 0x0, 0x0, 0x395604, 0x3a5604, 0x0, 0x3c5604, 0x0, 0x0, 0x3f5604,
+    0x405604, 0x0, 0x0, 0x435604, 0x0, 0x455604, 0x465604, 0x0, 0x0, 0x495604, 0x4a5604, 0x0, 0x4c5604, 0x0, 0x0, 0x4f5604,
+    0x0, 0x515604, 0x525604, 0x0, 0x545604, 0x0, 0x0, 0x575604, 0x585604, 0x0, 0x0, 0x5b5604, 0x0, 0x5d5604, 0x5e5604, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5914, 0xff5914, 0x0, 0xff5914, 0x0, 0x0, 0xff5914, 0xff5914, 0x0, 0x0, 0xff5914, 0x0, 0xff5914, 0xff5914, 0x0,
+    0xff5914, 0x0, 0x0, 0xff5914, 0x0, 0xff5914, 0xff5914, 0x0, 0x0, 0xff5914, 0xff5914, 0x0, 0xff5914, 0x0, 0x0, 0xff5914,
+    0x5914, 0x0, 0x0, 0x35914, 0x0, 0x55914, 0x65914, 0x0, 0x0, 0x95914, 0xa5914, 0x0, 0xc5914, 0x0, 0x0, 0xf5914,
+    0x0, 0x115914, 0x125914, 0x0, 0x145914, 0x0, 0x0, 0x175914, 0x185914, 0x0, 0x0, 0x1b5914, 0x0, 0x1d5914, 0x1e5914, 0x0,
+    0x205914, 0x0, 0x0, 0x235914, 0x0, 0x255914, 0x265914, 0x0, 0x0, 0x295914, 0x2a5914, 0x0, 0x2c5914, 0x0, 0x0, 0x2f5914,
+    0x0, 0x315914, 0x325914, 0x0, 0x345914, 0x0, 0x0, 0x375914, 0x385914, 0x0, 0x0, 0x3b5914, 0x0, 0x3d5914, 0x3e5914, 0x0,
+    0x0, 0x415914, 0x425914, 0x0, 0x445914, 0x0, 0x0, 0x475914, 0x485914, 0x0, 0x0, 0x4b5914, 0x0, 0x4d5914, 0x4e5914, 0x0,
+    0x505914, 0x0, 0x0, 0x535914, 0x0, 0x555914, 0x565914, 0x0, 0x0, 0x595914, 0x5a5914, 0x0, 0x5c5914, 0x0, 0x0, 0x5f5914,
+    0xff5914, 0x0, 0x0, 0xff5914, 0x0, 0xff5914, 0xff5914, 0x0, 0x0, 0xff5914, 0xff5914, 0x0, 0xff5914, 0x0, 0x0, 0xff5914,
+    0x0, 0xff5914, 0xff5914, 0x0, 0xff5914, 0x0, 0x0, 0xff5914, 0xff5914, 0x0, 0x0, 0xff5914, 0x0, 0xff5914, 0xff5914, 0x0,
+    0x0, 0x15914, 0x25914, 0x0, 0x45914, 0x0, 0x0, 0x75914, 0x85914, 0x0, 0x0, 0xb5914, 0x0, 0xd5914, 0xe5914, 0x0,
+    0x105914, 0x0, 0x0, 0x135914, 0x0, 0x155914, 0x165914, 0x0, 0x0, 0x195914, 0x1a5914, 0x0, 0x1c5914, 0x0, 0x0, 0x1f5914,
+    0x0, 0x215914, 0x225914, 0x0, 0x245914, 0x0, 0x0, 0x275914, 0x285914, 0x0, 0x0, 0x2b5914, 0x0, 0x2d5914, 0x2e5914, 0x0,
+    0x305914, 0x0, 0x0, 0x335914, 0x0, 0x355914, 0x365914, 0x0, 0x0, 0x395914, 0x3a5914, 0x0, 0x3c5914, 0x0, 0x0, 0x3f5914,
+    0x405914, 0x0, 0x0, 0x435914, 0x0, 0x455914, 0x465914, 0x0, 0x0, 0x495914, 0x4a5914, 0x0, 0x4c5914, 0x0, 0x0, 0x4f5914,
+    0x0, 0x515914, 0x525914, 0x0, 0x545914, 0x0, 0x0, 0x575914, 0x585914, 0x0, 0x0, 0x5b5914, 0x0, 0x5d5914, 0x5e5914, 0x0,
+    0x0, 0xff5a14, 0xff5a14, 0x0, 0xff5a14, 0x0, 0x0, 0xff5a14, 0xff5a14, 0x0, 0x0, 0xff5a14, 0x0, 0xff5a14, 0xff5a14, 0x0,
+    0xff5a14, 0x0, 0x0, 0xff5a14, 0x0, 0xff5a14, 0xff5a14, 0x0, 0x0, 0xff5a14, 0xff5a14, 0x0, 0xff5a14, 0x0, 0x0, 0xff5a14,
+    0x5a14, 0x0, 0x0, 0x35a14, 0x0, 0x55a14, 0x65a14, 0x0, 0x0, 0x95a14, 0xa5a14, 0x0, 0xc5a14, 0x0, 0x0, 0xf5a14,
+    0x0, 0x115a14, 0x125a14, 0x0, 0x145a14, 0x0, 0x0, 0x175a14, 0x185a14, 0x0, 0x0, 0x1b5a14, 0x0, 0x1d5a14, 0x1e5a14, 0x0,
+    0x205a14, 0x0, 0x0, 0x235a14, 0x0, 0x255a14, 0x265a14, 0x0, 0x0, 0x295a14, 0x2a5a14, 0x0, 0x2c5a14, 0x0, 0x0, 0x2f5a14,
+    0x0, 0x315a14, 0x325a14, 0x0, 0x345a14, 0x0, 0x0, 0x375a14, 0x385a14, 0x0, 0x0, 0x3b5a14, 0x0, 0x3d5a14, 0x3e5a14, 0x0,
+    0x0, 0x415a14, 0x425a14, 0x0, 0x445a14, 0x0, 0x0, 0x475a14, 0x485a14, 0x0, 0x0, 0x4b5a14, 0x0, 0x4d5a14, 0x4e5a14, 0x0,
+    0x505a14, 0x0, 0x0, 0x535a14, 0x0, 0x555a14, 0x565a14, 0x0, 0x0, 0x595a14, 0x5a5a14, 0x0, 0x5c5a14, 0x0, 0x0, 0x5f5a14,
+    0xff5a14, 0x0, 0x0, 0xff5a14, 0x0, 0xff5a14, 0xff5a14, 0x0, 0x0, 0xff5a14, 0xff5a14, 0x0, 0xff5a14, 0x0, 0x0, 0xff5a14,
+    0x0, 0xff5a14, 0xff5a14, 0x0, 0xff5a14, 0x0, 0x0, 0xff5a14, 0xff5a14, 0x0, 0x0, 0xff5a14, 0x0, 0xff5a14, 0xff5a14, 0x0,
+    0x0, 0x15a14, 0x25a14, 0x0, 0x45a14, 0x0, 0x0, 0x75a14, 0x85a14, 0x0, 0x0, 0xb5a14, 0x0, 0xd5a14, 0xe5a14, 0x0,
+    0x105a14, 0x0, 0x0, 0x135a14, 0x0, 0x155a14, 0x165a14, 0x0, 0x0, 0x195a14, 0x1a5a14, 0x0, 0x1c5a14, 0x0, 0x0, 0x1f5a14,
+    0x0, 0x215a14, 0x225a14, 0x0, 0x245a14, 0x0, 0x0, 0x275a14, 0x285a14, 0x0, 0x0, 0x2b5a14, 0x0, 0x2d5a14, 0x2e5a14, 0x0,
+    0x305a14, 0x0, 0x0, 0x335a14, 0x0, 0x355a14, 0x365a14, 0x0, 0x0, 0x395a14, 0x3a5a14, 0x0, 0x3c5a14, 0x0, 0x0, 0x3f5a14,
+    0x405a14, 0x0, 0x0, 0x435a14, 0x0, 0x455a14, 0x465a14, 0x0, 0x0, 0x495a14, 0x4a5a14, 0x0, 0x4c5a14, 0x0, 0x0, 0x4f5a14,
+    0x0, 0x515a14, 0x525a14, 0x0, 0x545a14, 0x0, 0x0, 0x575a14, 0x585a14, 0x0, 0x0, 0x5b5a14, 0x0, 0x5d5a14, 0x5e5a14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5c14, 0xff5c14, 0x0, 0xff5c14, 0x0, 0x0, 0xff5c14, 0xff5c14, 0x0, 0x0, 0xff5c14, 0x0, 0xff5c14, 0xff5c14, 0x0,
+    0xff5c14, 0x0, 0x0, 0xff5c14, 0x0, 0xff5c14, 0xff5c14, 0x0, 0x0, 0xff5c14, 0xff5c14, 0x0, 0xff5c14, 0x0, 0x0, 0xff5c14,
+    0x5c14, 0x0, 0x0, 0x35c14, 0x0, 0x55c14, 0x65c14, 0x0, 0x0, 0x95c14, 0xa5c14, 0x0, 0xc5c14, 0x0, 0x0, 0xf5c14,
+    0x0, 0x115c14, 0x125c14, 0x0, 0x145c14, 0x0, 0x0, 0x175c14, 0x185c14, 0x0, 0x0, 0x1b5c14, 0x0, 0x1d5c14, 0x1e5c14, 0x0,
+    0x205c14, 0x0, 0x0, 0x235c14, 0x0, 0x255c14, 0x265c14, 0x0, 0x0, 0x295c14, 0x2a5c14, 0x0, 0x2c5c14, 0x0, 0x0, 0x2f5c14,
+    0x0, 0x315c14, 0x325c14, 0x0, 0x345c14, 0x0, 0x0, 0x375c14, 0x385c14, 0x0, 0x0, 0x3b5c14, 0x0, 0x3d5c14, 0x3e5c14, 0x0,
+    0x0, 0x415c14, 0x425c14, 0x0, 0x445c14, 0x0, 0x0, 0x475c14, 0x485c14, 0x0, 0x0, 0x4b5c14, 0x0, 0x4d5c14, 0x4e5c14, 0x0,
+    0x505c14, 0x0, 0x0, 0x535c14, 0x0, 0x555c14, 0x565c14, 0x0, 0x0, 0x595c14, 0x5a5c14, 0x0, 0x5c5c14, 0x0, 0x0, 0x5f5c14,
+    0xff5c14, 0x0, 0x0, 0xff5c14, 0x0, 0xff5c14, 0xff5c14, 0x0, 0x0, 0xff5c14, 0xff5c14, 0x0, 0xff5c14, 0x0, 0x0, 0xff5c14,
+    0x0, 0xff5c14, 0xff5c14, 0x0, 0xff5c14, 0x0, 0x0, 0xff5c14, 0xff5c14, 0x0, 0x0, 0xff5c14, 0x0, 0xff5c14, 0xff5c14, 0x0,
+    0x0, 0x15c14, 0x25c14, 0x0, 0x45c14, 0x0, 0x0, 0x75c14, 0x85c14, 0x0, 0x0, 0xb5c14, 0x0, 0xd5c14, 0xe5c14, 0x0,
+    0x105c14, 0x0, 0x0, 0x135c14, 0x0, 0x155c14, 0x165c14, 0x0, 0x0, 0x195c14, 0x1a5c14, 0x0, 0x1c5c14, 0x0, 0x0, 0x1f5c14,
+    0x0, 0x215c14, 0x225c14, 0x0, 0x245c14, 0x0, 0x0, 0x275c14, 0x285c14, 0x0, 0x0, 0x2b5c14, 0x0, 0x2d5c14, 0x2e5c14, 0x0,
+    0x305c14, 0x0, 0x0, 0x335c14, 0x0, 0x355c14, 0x365c14, 0x0, 0x0, 0x395c14, 0x3a5c14, 0x0, 0x3c5c14, 0x0, 0x0, 0x3f5c14,
+    0x405c14, 0x0, 0x0, 0x435c14, 0x0, 0x455c14, 0x465c14, 0x0, 0x0, 0x495c14, 0x4a5c14, 0x0, 0x4c5c14, 0x0, 0x0, 0x4f5c14,
+    0x0, 0x515c14, 0x525c14, 0x0, 0x545c14, 0x0, 0x0, 0x575c14, 0x585c14, 0x0, 0x0, 0x5b5c14, 0x0, 0x5d5c14, 0x5e5c14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5f14, 0xff5f14, 0x0, 0xff5f14, 0x0, 0x0, 0xff5f14, 0xff5f14, 0x0, 0x0, 0xff5f14, 0x0, 0xff5f14, 0xff5f14, 0x0,
+    0xff5f14, 0x0, 0x0, 0xff5f14, 0x0, 0xff5f14, 0xff5f14, 0x0, 0x0, 0xff5f14, 0xff5f14, 0x0, 0xff5f14, 0x0, 0x0, 0xff5f14,
+    0x5f14, 0x0, 0x0, 0x35f14, 0x0, 0x55f14, 0x65f14, 0x0, 0x0, 0x95f14, 0xa5f14, 0x0, 0xc5f14, 0x0, 0x0, 0xf5f14,
+    0x0, 0x115f14, 0x125f14, 0x0, 0x145f14, 0x0, 0x0, 0x175f14, 0x185f14, 0x0, 0x0, 0x1b5f14, 0x0, 0x1d5f14, 0x1e5f14, 0x0,
+    0x205f14, 0x0, 0x0, 0x235f14, 0x0, 0x255f14, 0x265f14, 0x0, 0x0, 0x295f14, 0x2a5f14, 0x0, 0x2c5f14, 0x0, 0x0, 0x2f5f14,
+    0x0, 0x315f14, 0x325f14, 0x0, 0x345f14, 0x0, 0x0, 0x375f14, 0x385f14, 0x0, 0x0, 0x3b5f14, 0x0, 0x3d5f14, 0x3e5f14, 0x0,
+    0x0, 0x415f14, 0x425f14, 0x0, 0x445f14, 0x0, 0x0, 0x475f14, 0x485f14, 0x0, 0x0, 0x4b5f14, 0x0, 0x4d5f14, 0x4e5f14, 0x0,
+    0x505f14, 0x0, 0x0, 0x535f14, 0x0, 0x555f14, 0x565f14, 0x0, 0x0, 0x595f14, 0x5a5f14, 0x0, 0x5c5f14, 0x0, 0x0, 0x5f5f14,
+    0xff5f14, 0x0, 0x0, 0xff5f14, 0x0, 0xff5f14, 0xff5f14, 0x0, 0x0, 0xff5f14, 0xff5f14, 0x0, 0xff5f14, 0x0, 0x0, 0xff5f14,
+    0x0, 0xff5f14, 0xff5f14, 0x0, 0xff5f14, 0x0, 0x0, 0xff5f14, 0xff5f14, 0x0, 0x0, 0xff5f14, 0x0, 0xff5f14, 0xff5f14, 0x0,
+    0x0, 0x15f14, 0x25f14, 0x0, 0x45f14, 0x0, 0x0, 0x75f14, 0x85f14, 0x0, 0x0, 0xb5f14, 0x0, 0xd5f14, 0xe5f14, 0x0,
+    0x105f14, 0x0, 0x0, 0x135f14, 0x0, 0x155f14, 0x165f14, 0x0, 0x0, 0x195f14, 0x1a5f14, 0x0, 0x1c5f14, 0x0, 0x0, 0x1f5f14,
+    0x0, 0x215f14, 0x225f14, 0x0, 0x245f14, 0x0, 0x0, 0x275f14, 0x285f14, 0x0, 0x0, 0x2b5f14, 0x0, 0x2d5f14, 0x2e5f14, 0x0,
+    0x305f14, 0x0, 0x0, 0x335f14, 0x0, 0x355f14, 0x365f14, 0x0, 0x0, 0x395f14, 0x3a5f14, 0x0, 0x3c5f14, 0x0, 0x0, 0x3f5f14,
+    0x405f14, 0x0, 0x0, 0x435f14, 0x0, 0x455f14, 0x465f14, 0x0, 0x0, 0x495f14, 0x4a5f14, 0x0, 0x4c5f14, 0x0, 0x0, 0x4f5f14,
+    0x0, 0x515f14, 0x525f14, 0x0, 0x545f14, 0x0, 0x0, 0x575f14, 0x585f14, 0x0, 0x0, 0x5b5f14, 0x0, 0x5d5f14, 0x5e5f14, 0x0,
+    0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x1, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x2, 0x0, 0x0, 0x2, 0x0, 0x2, 0x2, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x12, 0x0, 0x0, 0x12, 0x0, 0x12, 0x12, 0x0, 0x0, 0x12, 0x12, 0x0, 0x12, 0x0, 0x0, 0x12,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x8, 0x0, 0x0, 0x120008, 0x0, 0x140008, 0x60008, 0x0, 0x0, 0x180008, 0xa0008, 0x0, 0xc0008, 0x0, 0x0, 0x1e0008,
+    0x0, 0xff6125, 0xff6225, 0x0, 0xff6425, 0x0, 0x0, 0xff6725, 0xff6825, 0x0, 0x0, 0xff6b25, 0x0, 0xff6d25, 0xff6e25, 0x0,
+    0x7, 0x0, 0x0, 0x120007, 0x0, 0x140007, 0x60007, 0x0, 0x0, 0x180007, 0xa0007, 0x0, 0xc0007, 0x0, 0x0, 0x1e0007,
+    0x0, 0x100007, 0x4007, 0x0, 0x8007, 0x0, 0x0, 0x10c007, 0x10007, 0x0, 0x0, 0x114007, 0x0, 0x118007, 0x1c007, 0x0,
+    0x0, 0x100107, 0x20107, 0x0, 0x40107, 0x0, 0x0, 0x160107, 0x80107, 0x0, 0x0, 0x1a0107, 0x0, 0x1c0107, 0xe0107, 0x0,
+    0x107, 0x0, 0x0, 0x104107, 0x0, 0x108107, 0xc107, 0x0, 0x0, 0x110107, 0x14107, 0x0, 0x18107, 0x0, 0x0, 0x11c107,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x100008, 0x20008, 0x0, 0x40008, 0x0, 0x0, 0x160008, 0x80008, 0x0, 0x0, 0x1a0008, 0x0, 0x1c0008, 0xe0008, 0x0,
+    0xff6025, 0x0, 0x0, 0xff6325, 0x0, 0xff6525, 0xff6625, 0x0, 0x0, 0xff6925, 0xff6a25, 0x0, 0xff6c25, 0x0, 0x0, 0xff6f25,
+    0x0, 0x100007, 0x20007, 0x0, 0x40007, 0x0, 0x0, 0x160007, 0x80007, 0x0, 0x0, 0x1a0007, 0x0, 0x1c0007, 0xe0007, 0x0,
+    0x7, 0x0, 0x0, 0x104007, 0x0, 0x108007, 0xc007, 0x0, 0x0, 0x110007, 0x14007, 0x0, 0x18007, 0x0, 0x0, 0x11c007,
+    0x107, 0x0, 0x0, 0x120107, 0x0, 0x140107, 0x60107, 0x0, 0x0, 0x180107, 0xa0107, 0x0, 0xc0107, 0x0, 0x0, 0x1e0107,
+    0x0, 0x100107, 0x4107, 0x0, 0x8107, 0x0, 0x0, 0x10c107, 0x10107, 0x0, 0x0, 0x114107, 0x0, 0x118107, 0x1c107, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0xff7006, 0x0, 0x0, 0xff7306, 0x0, 0xff7506, 0xff7606, 0x0, 0x0, 0xff7906, 0xff7a06, 0x0, 0xff7c06, 0x0, 0x0, 0xff7f06,
+    0x0, 0xff8106, 0xff8206, 0x0, 0xff8406, 0x0, 0x0, 0xff8706, 0xff8806, 0x0, 0x0, 0xff8b06, 0x0, 0xff8d06, 0xff8e06, 0x0,
+    0x207, 0x0, 0x0, 0x120207, 0x0, 0x140207, 0x60207, 0x0, 0x0, 0x180207, 0xa0207, 0x0, 0xc0207, 0x0, 0x0, 0x1e0207,
+    0x0, 0x100207, 0x4207, 0x0, 0x8207, 0x0, 0x0, 0x10c207, 0x10207, 0x0, 0x0, 0x114207, 0x0, 0x118207, 0x1c207, 0x0,
+    0x0, 0x100307, 0x20307, 0x0, 0x40307, 0x0, 0x0, 0x160307, 0x80307, 0x0, 0x0, 0x1a0307, 0x0, 0x1c0307, 0xe0307, 0x0,
+    0x307, 0x0, 0x0, 0x104307, 0x0, 0x108307, 0xc307, 0x0, 0x0, 0x110307, 0x14307, 0x0, 0x18307, 0x0, 0x0, 0x11c307,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0xff7106, 0xff7206, 0x0, 0xff7406, 0x0, 0x0, 0xff7706, 0xff7806, 0x0, 0x0, 0xff7b06, 0x0, 0xff7d06, 0xff7e06, 0x0,
+    0xff8006, 0x0, 0x0, 0xff8306, 0x0, 0xff8506, 0xff8606, 0x0, 0x0, 0xff8906, 0xff8a06, 0x0, 0xff8c06, 0x0, 0x0, 0xff8f06,
+    0x0, 0x100207, 0x20207, 0x0, 0x40207, 0x0, 0x0, 0x160207, 0x80207, 0x0, 0x0, 0x1a0207, 0x0, 0x1c0207, 0xe0207, 0x0,
+    0x207, 0x0, 0x0, 0x104207, 0x0, 0x108207, 0xc207, 0x0, 0x0, 0x110207, 0x14207, 0x0, 0x18207, 0x0, 0x0, 0x11c207,
+    0x307, 0x0, 0x0, 0x120307, 0x0, 0x140307, 0x60307, 0x0, 0x0, 0x180307, 0xa0307, 0x0, 0xc0307, 0x0, 0x0, 0x1e0307,
+    0x0, 0x100307, 0x4307, 0x0, 0x8307, 0x0, 0x0, 0x10c307, 0x10307, 0x0, 0x0, 0x114307, 0x0, 0x118307, 0x1c307, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x142023, 0x0, 0x0, 0x142323, 0x0, 0x142523, 0x142623, 0x0, 0x0, 0x142923, 0x142a23, 0x0, 0x142c23, 0x0, 0x0, 0x142f23,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0xd07, 0x0, 0x0, 0x120d07, 0x0, 0x140d07, 0x60d07, 0x0, 0x0, 0x180d07, 0xa0d07, 0x0, 0xc0d07, 0x0, 0x0, 0x1e0d07,
+    0x0, 0x100d07, 0x4d07, 0x0, 0x8d07, 0x0, 0x0, 0x10cd07, 0x10d07, 0x0, 0x0, 0x114d07, 0x0, 0x118d07, 0x1cd07, 0x0,
+    0x0, 0x100e07, 0x20e07, 0x0, 0x40e07, 0x0, 0x0, 0x160e07, 0x80e07, 0x0, 0x0, 0x1a0e07, 0x0, 0x1c0e07, 0xe0e07, 0x0,
+    0xe07, 0x0, 0x0, 0x104e07, 0x0, 0x108e07, 0xce07, 0x0, 0x0, 0x110e07, 0x14e07, 0x0, 0x18e07, 0x0, 0x0, 0x11ce07,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x142123, 0x142223, 0x0, 0x142423, 0x0, 0x0, 0x142723, 0x142823, 0x0, 0x0, 0x142b23, 0x0, 0x142d23, 0x142e23, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x100d07, 0x20d07, 0x0, 0x40d07, 0x0, 0x0, 0x160d07, 0x80d07, 0x0, 0x0, 0x1a0d07, 0x0, 0x1c0d07, 0xe0d07, 0x0,
+    0xd07, 0x0, 0x0, 0x104d07, 0x0, 0x108d07, 0xcd07, 0x0, 0x0, 0x110d07, 0x14d07, 0x0, 0x18d07, 0x0, 0x0, 0x11cd07,
+    0xe07, 0x0, 0x0, 0x120e07, 0x0, 0x140e07, 0x60e07, 0x0, 0x0, 0x180e07, 0xa0e07, 0x0, 0xc0e07, 0x0, 0x0, 0x1e0e07,
+    0x0, 0x100e07, 0x4e07, 0x0, 0x8e07, 0x0, 0x0, 0x10ce07, 0x10e07, 0x0, 0x0, 0x114e07, 0x0, 0x118e07, 0x1ce07, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x172023, 0x0, 0x0, 0x172323, 0x0, 0x172523, 0x172623, 0x0, 0x0, 0x172923, 0x172a23, 0x0, 0x172c23, 0x0, 0x0, 0x172f23,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x807, 0x0, 0x0, 0x120807, 0x0, 0x140807, 0x60807, 0x0, 0x0, 0x180807, 0xa0807, 0x0, 0xc0807, 0x0, 0x0, 0x1e0807,
+    0x0, 0x100807, 0x4807, 0x0, 0x8807, 0x0, 0x0, 0x10c807, 0x10807, 0x0, 0x0, 0x114807, 0x0, 0x118807, 0x1c807, 0x0,
+    0x0, 0x100907, 0x20907, 0x0, 0x40907, 0x0, 0x0, 0x160907, 0x80907, 0x0, 0x0, 0x1a0907, 0x0, 0x1c0907, 0xe0907, 0x0,
+    0x907, 0x0, 0x0, 0x104907, 0x0, 0x108907, 0xc907, 0x0, 0x0, 0x110907, 0x14907, 0x0, 0x18907, 0x0, 0x0, 0x11c907,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0,
+    0x0, 0x172123, 0x172223, 0x0, 0x172423, 0x0, 0x0, 0x172723, 0x172823, 0x0, 0x0, 0x172b23, 0x0, 0x172d23, 0x172e23, 0x0,
+    0x9, 0x0, 0x0, 0x9, 0x0, 0x9, 0x9, 0x0, 0x0, 0x9, 0x9, 0x0, 0x9, 0x0, 0x0, 0x9,
+    0x0, 0x100807, 0x20807, 0x0, 0x40807, 0x0, 0x0, 0x160807, 0x80807, 0x0, 0x0, 0x1a0807, 0x0, 0x1c0807, 0xe0807, 0x0,
+    0x807, 0x0, 0x0, 0x104807, 0x0, 0x108807, 0xc807, 0x0, 0x0, 0x110807, 0x14807, 0x0, 0x18807, 0x0, 0x0, 0x11c807,
+    0x907, 0x0, 0x0, 0x120907, 0x0, 0x140907, 0x60907, 0x0, 0x0, 0x180907, 0xa0907, 0x0, 0xc0907, 0x0, 0x0, 0x1e0907,
+    0x0, 0x100907, 0x4907, 0x0, 0x8907, 0x0, 0x0, 0x10c907, 0x10907, 0x0, 0x0, 0x114907, 0x0, 0x118907, 0x1c907, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0xa17, 0x0, 0x0, 0x120a17, 0x0, 0x140a17, 0x60a17, 0x0, 0x0, 0x180a17, 0xa0a17, 0x0, 0xc0a17, 0x0, 0x0, 0x1e0a17,
+    0x0, 0x100a17, 0x4a17, 0x0, 0x8a17, 0x0, 0x0, 0x10ca17, 0x10a17, 0x0, 0x0, 0x114a17, 0x0, 0x118a17, 0x1ca17, 0x0,
+    0x0, 0x100f17, 0x20f17, 0x0, 0x40f17, 0x0, 0x0, 0x160f17, 0x80f17, 0x0, 0x0, 0x1a0f17, 0x0, 0x1c0f17, 0xe0f17, 0x0,
+    0xf17, 0x0, 0x0, 0x104f17, 0x0, 0x108f17, 0xcf17, 0x0, 0x0, 0x110f17, 0x14f17, 0x0, 0x18f17, 0x0, 0x0, 0x11cf17,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x100a17, 0x20a17, 0x0, 0x40a17, 0x0, 0x0, 0x160a17, 0x80a17, 0x0, 0x0, 0x1a0a17, 0x0, 0x1c0a17, 0xe0a17, 0x0,
+    0xa17, 0x0, 0x0, 0x104a17, 0x0, 0x108a17, 0xca17, 0x0, 0x0, 0x110a17, 0x14a17, 0x0, 0x18a17, 0x0, 0x0, 0x11ca17,
+    0xf17, 0x0, 0x0, 0x120f17, 0x0, 0x140f17, 0x60f17, 0x0, 0x0, 0x180f17, 0xa0f17, 0x0, 0xc0f17, 0x0, 0x0, 0x1e0f17,
+    0x0, 0x100f17, 0x4f17, 0x0, 0x8f17, 0x0, 0x0, 0x10cf17, 0x10f17, 0x0, 0x0, 0x114f17, 0x0, 0x118f17, 0x1cf17, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0xff9016, 0x0, 0x0, 0xff9316, 0x0, 0xff9516, 0xff9616, 0x0, 0x0, 0xff9916, 0xff9a16, 0x0, 0xff9c16, 0x0, 0x0, 0xff9f16,
+    0x0, 0xffa116, 0xffa216, 0x0, 0xffa416, 0x0, 0x0, 0xffa716, 0xffa816, 0x0, 0x0, 0xffab16, 0x0, 0xffad16, 0xffae16, 0x0,
+    0xb17, 0x0, 0x0, 0x120b17, 0x0, 0x140b17, 0x60b17, 0x0, 0x0, 0x180b17, 0xa0b17, 0x0, 0xc0b17, 0x0, 0x0, 0x1e0b17,
+    0x0, 0x100b17, 0x4b17, 0x0, 0x8b17, 0x0, 0x0, 0x10cb17, 0x10b17, 0x0, 0x0, 0x114b17, 0x0, 0x118b17, 0x1cb17, 0x0,
+    0x0, 0x100c17, 0x20c17, 0x0, 0x40c17, 0x0, 0x0, 0x160c17, 0x80c17, 0x0, 0x0, 0x1a0c17, 0x0, 0x1c0c17, 0xe0c17, 0x0,
+    0xc17, 0x0, 0x0, 0x104c17, 0x0, 0x108c17, 0xcc17, 0x0, 0x0, 0x110c17, 0x14c17, 0x0, 0x18c17, 0x0, 0x0, 0x11cc17,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0xff9116, 0xff9216, 0x0, 0xff9416, 0x0, 0x0, 0xff9716, 0xff9816, 0x0, 0x0, 0xff9b16, 0x0, 0xff9d16, 0xff9e16, 0x0,
+    0xffa016, 0x0, 0x0, 0xffa316, 0x0, 0xffa516, 0xffa616, 0x0, 0x0, 0xffa916, 0xffaa16, 0x0, 0xffac16, 0x0, 0x0, 0xffaf16,
+    0x0, 0x100b17, 0x20b17, 0x0, 0x40b17, 0x0, 0x0, 0x160b17, 0x80b17, 0x0, 0x0, 0x1a0b17, 0x0, 0x1c0b17, 0xe0b17, 0x0,
+    0xb17, 0x0, 0x0, 0x104b17, 0x0, 0x108b17, 0xcb17, 0x0, 0x0, 0x110b17, 0x14b17, 0x0, 0x18b17, 0x0, 0x0, 0x11cb17,
+    0xc17, 0x0, 0x0, 0x120c17, 0x0, 0x140c17, 0x60c17, 0x0, 0x0, 0x180c17, 0xa0c17, 0x0, 0xc0c17, 0x0, 0x0, 0x1e0c17,
+    0x0, 0x100c17, 0x4c17, 0x0, 0x8c17, 0x0, 0x0, 0x10cc17, 0x10c17, 0x0, 0x0, 0x114c17, 0x0, 0x118c17, 0x1cc17, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x142033, 0x0, 0x0, 0x142333, 0x0, 0x142533, 0x142633, 0x0, 0x0, 0x142933, 0x142a33, 0x0, 0x142c33, 0x0, 0x0, 0x142f33,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x417, 0x0, 0x0, 0x120417, 0x0, 0x140417, 0x60417, 0x0, 0x0, 0x180417, 0xa0417, 0x0, 0xc0417, 0x0, 0x0, 0x1e0417,
+    0x0, 0x100417, 0x4417, 0x0, 0x8417, 0x0, 0x0, 0x10c417, 0x10417, 0x0, 0x0, 0x114417, 0x0, 0x118417, 0x1c417, 0x0,
+    0x0, 0x100517, 0x20517, 0x0, 0x40517, 0x0, 0x0, 0x160517, 0x80517, 0x0, 0x0, 0x1a0517, 0x0, 0x1c0517, 0xe0517, 0x0,
+    0x517, 0x0, 0x0, 0x104517, 0x0, 0x108517, 0xc517, 0x0, 0x0, 0x110517, 0x14517, 0x0, 0x18517, 0x0, 0x0, 0x11c517,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x142133, 0x142233, 0x0, 0x142433, 0x0, 0x0, 0x142733, 0x142833, 0x0, 0x0, 0x142b33, 0x0, 0x142d33, 0x142e33, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x100417, 0x20417, 0x0, 0x40417, 0x0, 0x0, 0x160417, 0x80417, 0x0, 0x0, 0x1a0417, 0x0, 0x1c0417, 0xe0417, 0x0,
+    0x417, 0x0, 0x0, 0x104417, 0x0, 0x108417, 0xc417, 0x0, 0x0, 0x110417, 0x14417, 0x0, 0x18417, 0x0, 0x0, 0x11c417,
+    0x517, 0x0, 0x0, 0x120517, 0x0, 0x140517, 0x60517, 0x0, 0x0, 0x180517, 0xa0517, 0x0, 0xc0517, 0x0, 0x0, 0x1e0517,
+    0x0, 0x100517, 0x4517, 0x0, 0x8517, 0x0, 0x0, 0x10c517, 0x10517, 0x0, 0x0, 0x114517, 0x0, 0x118517, 0x1c517, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x617, 0x0, 0x0, 0x120617, 0x0, 0x140617, 0x60617, 0x0, 0x0, 0x180617, 0xa0617, 0x0, 0xc0617, 0x0, 0x0, 0x1e0617,
+    0x0, 0x100617, 0x4617, 0x0, 0x8617, 0x0, 0x0, 0x10c617, 0x10617, 0x0, 0x0, 0x114617, 0x0, 0x118617, 0x1c617, 0x0,
+    0x0, 0x100717, 0x20717, 0x0, 0x40717, 0x0, 0x0, 0x160717, 0x80717, 0x0, 0x0, 0x1a0717, 0x0, 0x1c0717, 0xe0717, 0x0,
+    0x717, 0x0, 0x0, 0x104717, 0x0, 0x108717, 0xc717, 0x0, 0x0, 0x110717, 0x14717, 0x0, 0x18717, 0x0, 0x0, 0x11c717,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0,
+    0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19,
+    0x0, 0x100617, 0x20617, 0x0, 0x40617, 0x0, 0x0, 0x160617, 0x80617, 0x0, 0x0, 0x1a0617, 0x0, 0x1c0617, 0xe0617, 0x0,
+    0x617, 0x0, 0x0, 0x104617, 0x0, 0x108617, 0xc617, 0x0, 0x0, 0x110617, 0x14617, 0x0, 0x18617, 0x0, 0x0, 0x11c617,
+    0x717, 0x0, 0x0, 0x120717, 0x0, 0x140717, 0x60717, 0x0, 0x0, 0x180717, 0xa0717, 0x0, 0xc0717, 0x0, 0x0, 0x1e0717,
+    0x0, 0x100717, 0x4717, 0x0, 0x8717, 0x0, 0x0, 0x10c717, 0x10717, 0x0, 0x0, 0x114717, 0x0, 0x118717, 0x1c717, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0104, 0xff0104, 0x0, 0xff0104, 0x0, 0x0, 0xff0104, 0xff0104, 0x0, 0x0, 0xff0104, 0x0, 0xff0104, 0xff0104, 0x0,
+    0xff0104, 0x0, 0x0, 0xff0104, 0x0, 0xff0104, 0xff0104, 0x0, 0x0, 0xff0104, 0xff0104, 0x0, 0xff0104, 0x0, 0x0, 0xff0104,
+    0x104, 0x0, 0x0, 0x30104, 0x0, 0x50104, 0x60104, 0x0, 0x0, 0x90104, 0xa0104, 0x0, 0xc0104, 0x0, 0x0, 0xf0104,
+    0x0, 0x110104, 0x120104, 0x0, 0x140104, 0x0, 0x0, 0x170104, 0x180104, 0x0, 0x0, 0x1b0104, 0x0, 0x1d0104, 0x1e0104, 0x0,
+    0x200104, 0x0, 0x0, 0x230104, 0x0, 0x250104, 0x260104, 0x0, 0x0, 0x290104, 0x2a0104, 0x0, 0x2c0104, 0x0, 0x0, 0x2f0104,
+    0x0, 0x310104, 0x320104, 0x0, 0x340104, 0x0, 0x0, 0x370104, 0x380104, 0x0, 0x0, 0x3b0104, 0x0, 0x3d0104, 0x3e0104, 0x0,
+    0x0, 0x410104, 0x420104, 0x0, 0x440104, 0x0, 0x0, 0x470104, 0x480104, 0x0, 0x0, 0x4b0104, 0x0, 0x4d0104, 0x4e0104, 0x0,
+    0x500104, 0x0, 0x0, 0x530104, 0x0, 0x550104, 0x560104, 0x0, 0x0, 0x590104, 0x5a0104, 0x0, 0x5c0104, 0x0, 0x0, 0x5f0104,
+    0xff0104, 0x0, 0x0, 0xff0104, 0x0, 0xff0104, 0xff0104, 0x0, 0x0, 0xff0104, 0xff0104, 0x0, 0xff0104, 0x0, 0x0, 0xff0104,
+    0x0, 0xff0104, 0xff0104, 0x0, 0xff0104, 0x0, 0x0, 0xff0104, 0xff0104, 0x0, 0x0, 0xff0104, 0x0, 0xff0104, 0xff0104, 0x0,
+    0x0, 0x10104, 0x20104, 0x0, 0x40104, 0x0, 0x0, 0x70104, 0x80104, 0x0, 0x0, 0xb0104, 0x0, 0xd0104, 0xe0104, 0x0,
+    0x100104, 0x0, 0x0, 0x130104, 0x0, 0x150104, 0x160104, 0x0, 0x0, 0x190104, 0x1a0104, 0x0, 0x1c0104, 0x0, 0x0, 0x1f0104,
+    0x0, 0x210104, 0x220104, 0x0, 0x240104, 0x0, 0x0, 0x270104, 0x280104, 0x0, 0x0, 0x2b0104, 0x0, 0x2d0104, 0x2e0104, 0x0,
+    0x300104, 0x0, 0x0, 0x330104, 0x0, 0x350104, 0x360104, 0x0, 0x0, 0x390104, 0x3a0104, 0x0, 0x3c0104, 0x0, 0x0, 0x3f0104,
+    0x400104, 0x0, 0x0, 0x430104, 0x0, 0x450104, 0x460104, 0x0, 0x0, 0x490104, 0x4a0104, 0x0, 0x4c0104, 0x0, 0x0, 0x4f0104,
+    0x0, 0x510104, 0x520104, 0x0, 0x540104, 0x0, 0x0, 0x570104, 0x580104, 0x0, 0x0, 0x5b0104, 0x0, 0x5d0104, 0x5e0104, 0x0,
+    0x0, 0xff0204, 0xff0204, 0x0, 0xff0204, 0x0, 0x0, 0xff0204, 0xff0204, 0x0, 0x0, 0xff0204, 0x0, 0xff0204, 0xff0204, 0x0,
+    0xff0204, 0x0, 0x0, 0xff0204, 0x0, 0xff0204, 0xff0204, 0x0, 0x0, 0xff0204, 0xff0204, 0x0, 0xff0204, 0x0, 0x0, 0xff0204,
+    0x204, 0x0, 0x0, 0x30204, 0x0, 0x50204, 0x60204, 0x0, 0x0, 0x90204, 0xa0204, 0x0, 0xc0204, 0x0, 0x0, 0xf0204,
+    0x0, 0x110204, 0x120204, 0x0, 0x140204, 0x0, 0x0, 0x170204, 0x180204, 0x0, 0x0, 0x1b0204, 0x0, 0x1d0204, 0x1e0204, 0x0,
+    0x200204, 0x0, 0x0, 0x230204, 0x0, 0x250204, 0x260204, 0x0, 0x0, 0x290204, 0x2a0204, 0x0, 0x2c0204, 0x0, 0x0, 0x2f0204,
+    0x0, 0x310204, 0x320204, 0x0, 0x340204, 0x0, 0x0, 0x370204, 0x380204, 0x0, 0x0, 0x3b0204, 0x0, 0x3d0204, 0x3e0204, 0x0,
+    0x0, 0x410204, 0x420204, 0x0, 0x440204, 0x0, 0x0, 0x470204, 0x480204, 0x0, 0x0, 0x4b0204, 0x0, 0x4d0204, 0x4e0204, 0x0,
+    0x500204, 0x0, 0x0, 0x530204, 0x0, 0x550204, 0x560204, 0x0, 0x0, 0x590204, 0x5a0204, 0x0, 0x5c0204, 0x0, 0x0, 0x5f0204,
+    0xff0204, 0x0, 0x0, 0xff0204, 0x0, 0xff0204, 0xff0204, 0x0, 0x0, 0xff0204, 0xff0204, 0x0, 0xff0204, 0x0, 0x0, 0xff0204,
+    0x0, 0xff0204, 0xff0204, 0x0, 0xff0204, 0x0, 0x0, 0xff0204, 0xff0204, 0x0, 0x0, 0xff0204, 0x0, 0xff0204, 0xff0204, 0x0,
+    0x0, 0x10204, 0x20204, 0x0, 0x40204, 0x0, 0x0, 0x70204, 0x80204, 0x0, 0x0, 0xb0204, 0x0, 0xd0204, 0xe0204, 0x0,
+    0x100204, 0x0, 0x0, 0x130204, 0x0, 0x150204, 0x160204, 0x0, 0x0, 0x190204, 0x1a0204, 0x0, 0x1c0204, 0x0, 0x0, 0x1f0204,
+    0x0, 0x210204, 0x220204, 0x0, 0x240204, 0x0, 0x0, 0x270204, 0x280204, 0x0, 0x0, 0x2b0204, 0x0, 0x2d0204, 0x2e0204, 0x0,
+    0x300204, 0x0, 0x0, 0x330204, 0x0, 0x350204, 0x360204, 0x0, 0x0, 0x390204, 0x3a0204, 0x0, 0x3c0204, 0x0, 0x0, 0x3f0204,
+    0x400204, 0x0, 0x0, 0x430204, 0x0, 0x450204, 0x460204, 0x0, 0x0, 0x490204, 0x4a0204, 0x0, 0x4c0204, 0x0, 0x0, 0x4f0204,
+    0x0, 0x510204, 0x520204, 0x0, 0x540204, 0x0, 0x0, 0x570204, 0x580204, 0x0, 0x0, 0x5b0204, 0x0, 0x5d0204, 0x5e0204, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0404, 0xff0404, 0x0, 0xff0404, 0x0, 0x0, 0xff0404, 0xff0404, 0x0, 0x0, 0xff0404, 0x0, 0xff0404, 0xff0404, 0x0,
+    0xff0404, 0x0, 0x0, 0xff0404, 0x0, 0xff0404, 0xff0404, 0x0, 0x0, 0xff0404, 0xff0404, 0x0, 0xff0404, 0x0, 0x0, 0xff0404,
+    0x404, 0x0, 0x0, 0x30404, 0x0, 0x50404, 0x60404, 0x0, 0x0, 0x90404, 0xa0404, 0x0, 0xc0404, 0x0, 0x0, 0xf0404,
+    0x0, 0x110404, 0x120404, 0x0, 0x140404, 0x0, 0x0, 0x170404, 0x180404, 0x0, 0x0, 0x1b0404, 0x0, 0x1d0404, 0x1e0404, 0x0,
+    0x200404, 0x0, 0x0, 0x230404, 0x0, 0x250404, 0x260404, 0x0, 0x0, 0x290404, 0x2a0404, 0x0, 0x2c0404, 0x0, 0x0, 0x2f0404,
+    0x0, 0x310404, 0x320404, 0x0, 0x340404, 0x0, 0x0, 0x370404, 0x380404, 0x0, 0x0, 0x3b0404, 0x0, 0x3d0404, 0x3e0404, 0x0,
+    0x0, 0x410404, 0x420404, 0x0, 0x440404, 0x0, 0x0, 0x470404, 0x480404, 0x0, 0x0, 0x4b0404, 0x0, 0x4d0404, 0x4e0404, 0x0,
+    0x500404, 0x0, 0x0, 0x530404, 0x0, 0x550404, 0x560404, 0x0, 0x0, 0x590404, 0x5a0404, 0x0, 0x5c0404, 0x0, 0x0, 0x5f0404,
+    0xff0404, 0x0, 0x0, 0xff0404, 0x0, 0xff0404, 0xff0404, 0x0, 0x0, 0xff0404, 0xff0404, 0x0, 0xff0404, 0x0, 0x0, 0xff0404,
+    0x0, 0xff0404, 0xff0404, 0x0, 0xff0404, 0x0, 0x0, 0xff0404, 0xff0404, 0x0, 0x0, 0xff0404, 0x0, 0xff0404, 0xff0404, 0x0,
+    0x0, 0x10404, 0x20404, 0x0, 0x40404, 0x0, 0x0, 0x70404, 0x80404, 0x0, 0x0, 0xb0404, 0x0, 0xd0404, 0xe0404, 0x0,
+    0x100404, 0x0, 0x0, 0x130404, 0x0, 0x150404, 0x160404, 0x0, 0x0, 0x190404, 0x1a0404, 0x0, 0x1c0404, 0x0, 0x0, 0x1f0404,
+    0x0, 0x210404, 0x220404, 0x0, 0x240404, 0x0, 0x0, 0x270404, 0x280404, 0x0, 0x0, 0x2b0404, 0x0, 0x2d0404, 0x2e0404, 0x0,
+    0x300404, 0x0, 0x0, 0x330404, 0x0, 0x350404, 0x360404, 0x0, 0x0, 0x390404, 0x3a0404, 0x0, 0x3c0404, 0x0, 0x0, 0x3f0404,
+    0x400404, 0x0, 0x0, 0x430404, 0x0, 0x450404, 0x460404, 0x0, 0x0, 0x490404, 0x4a0404, 0x0, 0x4c0404, 0x0, 0x0, 0x4f0404,
+    0x0, 0x510404, 0x520404, 0x0, 0x540404, 0x0, 0x0, 0x570404, 0x580404, 0x0, 0x0, 0x5b0404, 0x0, 0x5d0404, 0x5e0404, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0704, 0xff0704, 0x0, 0xff0704, 0x0, 0x0, 0xff0704, 0xff0704, 0x0, 0x0, 0xff0704, 0x0, 0xff0704, 0xff0704, 0x0,
+    0xff0704, 0x0, 0x0, 0xff0704, 0x0, 0xff0704, 0xff0704, 0x0, 0x0, 0xff0704, 0xff0704, 0x0, 0xff0704, 0x0, 0x0, 0xff0704,
+    0x704, 0x0, 0x0, 0x30704, 0x0, 0x50704, 0x60704, 0x0, 0x0, 0x90704, 0xa0704, 0x0, 0xc0704, 0x0, 0x0, 0xf0704,
+    0x0, 0x110704, 0x120704, 0x0, 0x140704, 0x0, 0x0, 0x170704, 0x180704, 0x0, 0x0, 0x1b0704, 0x0, 0x1d0704, 0x1e0704, 0x0,
+    0x200704, 0x0, 0x0, 0x230704, 0x0, 0x250704, 0x260704, 0x0, 0x0, 0x290704, 0x2a0704, 0x0, 0x2c0704, 0x0, 0x0, 0x2f0704,
+    0x0, 0x310704, 0x320704, 0x0, 0x340704, 0x0, 0x0, 0x370704, 0x380704, 0x0, 0x0, 0x3b0704, 0x0, 0x3d0704, 0x3e0704, 0x0,
+    0x0, 0x410704, 0x420704, 0x0, 0x440704, 0x0, 0x0, 0x470704, 0x480704, 0x0, 0x0, 0x4b0704, 0x0, 0x4d0704, 0x4e0704, 0x0,
+    0x500704, 0x0, 0x0, 0x530704, 0x0, 0x550704, 0x560704, 0x0, 0x0, 0x590704, 0x5a0704, 0x0, 0x5c0704, 0x0, 0x0, 0x5f0704,
+    0xff0704, 0x0, 0x0, 0xff0704, 0x0, 0xff0704, 0xff0704, 0x0, 0x0, 0xff0704, 0xff0704, 0x0, 0xff0704, 0x0, 0x0, 0xff0704,
+    0x0, 0xff0704, 0xff0704, 0x0, 0xff0704, 0x0, 0x0, 0xff0704, 0xff0704, 0x0, 0x0, 0xff0704, 0x0, 0xff0704, 0xff0704, 0x0,
+    0x0, 0x10704, 0x20704, 0x0, 0x40704, 0x0, 0x0, 0x70704, 0x80704, 0x0, 0x0, 0xb0704, 0x0, 0xd0704, 0xe0704, 0x0,
+    0x100704, 0x0, 0x0, 0x130704, 0x0, 0x150704, 0x160704, 0x0, 0x0, 0x190704, 0x1a0704, 0x0, 0x1c0704, 0x0, 0x0, 0x1f0704,
+    0x0, 0x210704, 0x220704, 0x0, 0x240704, 0x0, 0x0, 0x270704, 0x280704, 0x0, 0x0, 0x2b0704, 0x0, 0x2d0704, 0x2e0704, 0x0,
+    0x300704, 0x0, 0x0, 0x330704, 0x0, 0x350704, 0x360704, 0x0, 0x0, 0x390704, 0x3a0704, 0x0, 0x3c0704, 0x0, 0x0, 0x3f0704,
+    0x400704, 0x0, 0x0, 0x430704, 0x0, 0x450704, 0x460704, 0x0, 0x0, 0x490704, 0x4a0704, 0x0, 0x4c0704, 0x0, 0x0, 0x4f0704,
+    0x0, 0x510704, 0x520704, 0x0, 0x540704, 0x0, 0x0, 0x570704, 0x580704, 0x0, 0x0, 0x5b0704, 0x0, 0x5d0704, 0x5e0704, 0x0,
+    0x0, 0xff0814, 0xff0814, 0x0, 0xff0814, 0x0, 0x0, 0xff0814, 0xff0814, 0x0, 0x0, 0xff0814, 0x0, 0xff0814, 0xff0814, 0x0,
+    0xff0814, 0x0, 0x0, 0xff0814, 0x0, 0xff0814, 0xff0814, 0x0, 0x0, 0xff0814, 0xff0814, 0x0, 0xff0814, 0x0, 0x0, 0xff0814,
+    0x814, 0x0, 0x0, 0x30814, 0x0, 0x50814, 0x60814, 0x0, 0x0, 0x90814, 0xa0814, 0x0, 0xc0814, 0x0, 0x0, 0xf0814,
+    0x0, 0x110814, 0x120814, 0x0, 0x140814, 0x0, 0x0, 0x170814, 0x180814, 0x0, 0x0, 0x1b0814, 0x0, 0x1d0814, 0x1e0814, 0x0,
+    0x200814, 0x0, 0x0, 0x230814, 0x0, 0x250814, 0x260814, 0x0, 0x0, 0x290814, 0x2a0814, 0x0, 0x2c0814, 0x0, 0x0, 0x2f0814,
+    0x0, 0x310814, 0x320814, 0x0, 0x340814, 0x0, 0x0, 0x370814, 0x380814, 0x0, 0x0, 0x3b0814, 0x0, 0x3d0814, 0x3e0814, 0x0,
+    0x0, 0x410814, 0x420814, 0x0, 0x440814, 0x0, 0x0, 0x470814, 0x480814, 0x0, 0x0, 0x4b0814, 0x0, 0x4d0814, 0x4e0814, 0x0,
+    0x500814, 0x0, 0x0, 0x530814, 0x0, 0x550814, 0x560814, 0x0, 0x0, 0x590814, 0x5a0814, 0x0, 0x5c0814, 0x0, 0x0, 0x5f0814,
+    0xff0814, 0x0, 0x0, 0xff0814, 0x0, 0xff0814, 0xff0814, 0x0, 0x0, 0xff0814, 0xff0814, 0x0, 0xff0814, 0x0, 0x0, 0xff0814,
+    0x0, 0xff0814, 0xff0814, 0x0, 0xff0814, 0x0, 0x0, 0xff0814, 0xff0814, 0x0, 0x0, 0xff0814, 0x0, 0xff0814, 0xff0814, 0x0,
+    0x0, 0x10814, 0x20814, 0x0, 0x40814, 0x0, 0x0, 0x70814, 0x80814, 0x0, 0x0, 0xb0814, 0x0, 0xd0814, 0xe0814, 0x0,
+    0x100814, 0x0, 0x0, 0x130814, 0x0, 0x150814, 0x160814, 0x0, 0x0, 0x190814, 0x1a0814, 0x0, 0x1c0814, 0x0, 0x0, 0x1f0814,
+    0x0, 0x210814, 0x220814, 0x0, 0x240814, 0x0, 0x0, 0x270814, 0x280814, 0x0, 0x0, 0x2b0814, 0x0, 0x2d0814, 0x2e0814, 0x0,
+    0x300814, 0x0, 0x0, 0x330814, 0x0, 0x350814, 0x360814, 0x0, 0x0, 0x390814, 0x3a0814, 0x0, 0x3c0814, 0x0, 0x0, 0x3f0814,
+    0x400814, 0x0, 0x0, 0x430814, 0x0, 0x450814, 0x460814, 0x0, 0x0, 0x490814, 0x4a0814, 0x0, 0x4c0814, 0x0, 0x0, 0x4f0814,
+    0x0, 0x510814, 0x520814, 0x0, 0x540814, 0x0, 0x0, 0x570814, 0x580814, 0x0, 0x0, 0x5b0814, 0x0, 0x5d0814, 0x5e0814, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0b14, 0xff0b14, 0x0, 0xff0b14, 0x0, 0x0, 0xff0b14, 0xff0b14, 0x0, 0x0, 0xff0b14, 0x0, 0xff0b14, 0xff0b14, 0x0,
+    0xff0b14, 0x0, 0x0, 0xff0b14, 0x0, 0xff0b14, 0xff0b14, 0x0, 0x0, 0xff0b14, 0xff0b14, 0x0, 0xff0b14, 0x0, 0x0, 0xff0b14,
+    0xb14, 0x0, 0x0, 0x30b14, 0x0, 0x50b14, 0x60b14, 0x0, 0x0, 0x90b14, 0xa0b14, 0x0, 0xc0b14, 0x0, 0x0, 0xf0b14,
+    0x0, 0x110b14, 0x120b14, 0x0, 0x140b14, 0x0, 0x0, 0x170b14, 0x180b14, 0x0, 0x0, 0x1b0b14, 0x0, 0x1d0b14, 0x1e0b14, 0x0,
+    0x200b14, 0x0, 0x0, 0x230b14, 0x0, 0x250b14, 0x260b14, 0x0, 0x0, 0x290b14, 0x2a0b14, 0x0, 0x2c0b14, 0x0, 0x0, 0x2f0b14,
+    0x0, 0x310b14, 0x320b14, 0x0, 0x340b14, 0x0, 0x0, 0x370b14, 0x380b14, 0x0, 0x0, 0x3b0b14, 0x0, 0x3d0b14, 0x3e0b14, 0x0,
+    0x0, 0x410b14, 0x420b14, 0x0, 0x440b14, 0x0, 0x0, 0x470b14, 0x480b14, 0x0, 0x0, 0x4b0b14, 0x0, 0x4d0b14, 0x4e0b14, 0x0,
+    0x500b14, 0x0, 0x0, 0x530b14, 0x0, 0x550b14, 0x560b14, 0x0, 0x0, 0x590b14, 0x5a0b14, 0x0, 0x5c0b14, 0x0, 0x0, 0x5f0b14,
+    0xff0b14, 0x0, 0x0, 0xff0b14, 0x0, 0xff0b14, 0xff0b14, 0x0, 0x0, 0xff0b14, 0xff0b14, 0x0, 0xff0b14, 0x0, 0x0, 0xff0b14,
+    0x0, 0xff0b14, 0xff0b14, 0x0, 0xff0b14, 0x0, 0x0, 0xff0b14, 0xff0b14, 0x0, 0x0, 0xff0b14, 0x0, 0xff0b14, 0xff0b14, 0x0,
+    0x0, 0x10b14, 0x20b14, 0x0, 0x40b14, 0x0, 0x0, 0x70b14, 0x80b14, 0x0, 0x0, 0xb0b14, 0x0, 0xd0b14, 0xe0b14, 0x0,
+    0x100b14, 0x0, 0x0, 0x130b14, 0x0, 0x150b14, 0x160b14, 0x0, 0x0, 0x190b14, 0x1a0b14, 0x0, 0x1c0b14, 0x0, 0x0, 0x1f0b14,
+    0x0, 0x210b14, 0x220b14, 0x0, 0x240b14, 0x0, 0x0, 0x270b14, 0x280b14, 0x0, 0x0, 0x2b0b14, 0x0, 0x2d0b14, 0x2e0b14, 0x0,
+    0x300b14, 0x0, 0x0, 0x330b14, 0x0, 0x350b14, 0x360b14, 0x0, 0x0, 0x390b14, 0x3a0b14, 0x0, 0x3c0b14, 0x0, 0x0, 0x3f0b14,
+    0x400b14, 0x0, 0x0, 0x430b14, 0x0, 0x450b14, 0x460b14, 0x0, 0x0, 0x490b14, 0x4a0b14, 0x0, 0x4c0b14, 0x0, 0x0, 0x4f0b14,
+    0x0, 0x510b14, 0x520b14, 0x0, 0x540b14, 0x0, 0x0, 0x570b14, 0x580b14, 0x0, 0x0, 0x5b0b14, 0x0, 0x5d0b14, 0x5e0b14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff0d14, 0xff0d14, 0x0, 0xff0d14, 0x0, 0x0, 0xff0d14, 0xff0d14, 0x0, 0x0, 0xff0d14, 0x0, 0xff0d14, 0xff0d14, 0x0,
+    0xff0d14, 0x0, 0x0, 0xff0d14, 0x0, 0xff0d14, 0xff0d14, 0x0, 0x0, 0xff0d14, 0xff0d14, 0x0, 0xff0d14, 0x0, 0x0, 0xff0d14,
+    0xd14, 0x0, 0x0, 0x30d14, 0x0, 0x50d14, 0x60d14, 0x0, 0x0, 0x90d14, 0xa0d14, 0x0, 0xc0d14, 0x0, 0x0, 0xf0d14,
+    0x0, 0x110d14, 0x120d14, 0x0, 0x140d14, 0x0, 0x0, 0x170d14, 0x180d14, 0x0, 0x0, 0x1b0d14, 0x0, 0x1d0d14, 0x1e0d14, 0x0,
+    0x200d14, 0x0, 0x0, 0x230d14, 0x0, 0x250d14, 0x260d14, 0x0, 0x0, 0x290d14, 0x2a0d14, 0x0, 0x2c0d14, 0x0, 0x0, 0x2f0d14,
+    0x0, 0x310d14, 0x320d14, 0x0, 0x340d14, 0x0, 0x0, 0x370d14, 0x380d14, 0x0, 0x0, 0x3b0d14, 0x0, 0x3d0d14, 0x3e0d14, 0x0,
+    0x0, 0x410d14, 0x420d14, 0x0, 0x440d14, 0x0, 0x0, 0x470d14, 0x480d14, 0x0, 0x0, 0x4b0d14, 0x0, 0x4d0d14, 0x4e0d14, 0x0,
+    0x500d14, 0x0, 0x0, 0x530d14, 0x0, 0x550d14, 0x560d14, 0x0, 0x0, 0x590d14, 0x5a0d14, 0x0, 0x5c0d14, 0x0, 0x0, 0x5f0d14,
+    0xff0d14, 0x0, 0x0, 0xff0d14, 0x0, 0xff0d14, 0xff0d14, 0x0, 0x0, 0xff0d14, 0xff0d14, 0x0, 0xff0d14, 0x0, 0x0, 0xff0d14,
+    0x0, 0xff0d14, 0xff0d14, 0x0, 0xff0d14, 0x0, 0x0, 0xff0d14, 0xff0d14, 0x0, 0x0, 0xff0d14, 0x0, 0xff0d14, 0xff0d14, 0x0,
+    0x0, 0x10d14, 0x20d14, 0x0, 0x40d14, 0x0, 0x0, 0x70d14, 0x80d14, 0x0, 0x0, 0xb0d14, 0x0, 0xd0d14, 0xe0d14, 0x0,
+    0x100d14, 0x0, 0x0, 0x130d14, 0x0, 0x150d14, 0x160d14, 0x0, 0x0, 0x190d14, 0x1a0d14, 0x0, 0x1c0d14, 0x0, 0x0, 0x1f0d14,
+    0x0, 0x210d14, 0x220d14, 0x0, 0x240d14, 0x0, 0x0, 0x270d14, 0x280d14, 0x0, 0x0, 0x2b0d14, 0x0, 0x2d0d14, 0x2e0d14, 0x0,
+    0x300d14, 0x0, 0x0, 0x330d14, 0x0, 0x350d14, 0x360d14, 0x0, 0x0, 0x390d14, 0x3a0d14, 0x0, 0x3c0d14, 0x0, 0x0, 0x3f0d14,
+    0x400d14, 0x0, 0x0, 0x430d14, 0x0, 0x450d14, 0x460d14, 0x0, 0x0, 0x490d14, 0x4a0d14, 0x0, 0x4c0d14, 0x0, 0x0, 0x4f0d14,
+    0x0, 0x510d14, 0x520d14, 0x0, 0x540d14, 0x0, 0x0, 0x570d14, 0x580d14, 0x0, 0x0, 0x5b0d14, 0x0, 0x5d0d14, 0x5e0d14, 0x0,
+    0x0, 0xff0e14, 0xff0e14, 0x0, 0xff0e14, 0x0, 0x0, 0xff0e14, 0xff0e14, 0x0, 0x0, 0xff0e14, 0x0, 0xff0e14, 0xff0e14, 0x0,
+    0xff0e14, 0x0, 0x0, 0xff0e14, 0x0, 0xff0e14, 0xff0e14, 0x0, 0x0, 0xff0e14, 0xff0e14, 0x0, 0xff0e14, 0x0, 0x0, 0xff0e14,
+    0xe14, 0x0, 0x0, 0x30e14, 0x0, 0x50e14, 0x60e14, 0x0, 0x0, 0x90e14, 0xa0e14, 0x0, 0xc0e14, 0x0, 0x0, 0xf0e14,
+    0x0, 0x110e14, 0x120e14, 0x0, 0x140e14, 0x0, 0x0, 0x170e14, 0x180e14, 0x0, 0x0, 0x1b0e14, 0x0, 0x1d0e14, 0x1e0e14, 0x0,
+    0x200e14, 0x0, 0x0, 0x230e14, 0x0, 0x250e14, 0x260e14, 0x0, 0x0, 0x290e14, 0x2a0e14, 0x0, 0x2c0e14, 0x0, 0x0, 0x2f0e14,
+    0x0, 0x310e14, 0x320e14, 0x0, 0x340e14, 0x0, 0x0, 0x370e14, 0x380e14, 0x0, 0x0, 0x3b0e14, 0x0, 0x3d0e14, 0x3e0e14, 0x0,
+    0x0, 0x410e14, 0x420e14, 0x0, 0x440e14, 0x0, 0x0, 0x470e14, 0x480e14, 0x0, 0x0, 0x4b0e14, 0x0, 0x4d0e14, 0x4e0e14, 0x0,
+    0x500e14, 0x0, 0x0, 0x530e14, 0x0, 0x550e14, 0x560e14, 0x0, 0x0, 0x590e14, 0x5a0e14, 0x0, 0x5c0e14, 0x0, 0x0, 0x5f0e14,
+    0xff0e14, 0x0, 0x0, 0xff0e14, 0x0, 0xff0e14, 0xff0e14, 0x0, 0x0, 0xff0e14, 0xff0e14, 0x0, 0xff0e14, 0x0, 0x0, 0xff0e14,
+    0x0, 0xff0e14, 0xff0e14, 0x0, 0xff0e14, 0x0, 0x0, 0xff0e14, 0xff0e14, 0x0, 0x0, 0xff0e14, 0x0, 0xff0e14, 0xff0e14, 0x0,
+    0x0, 0x10e14, 0x20e14, 0x0, 0x40e14, 0x0, 0x0, 0x70e14, 0x80e14, 0x0, 0x0, 0xb0e14, 0x0, 0xd0e14, 0xe0e14, 0x0,
+    0x100e14, 0x0, 0x0, 0x130e14, 0x0, 0x150e14, 0x160e14, 0x0, 0x0, 0x190e14, 0x1a0e14, 0x0, 0x1c0e14, 0x0, 0x0, 0x1f0e14,
+    0x0, 0x210e14, 0x220e14, 0x0, 0x240e14, 0x0, 0x0, 0x270e14, 0x280e14, 0x0, 0x0, 0x2b0e14, 0x0, 0x2d0e14, 0x2e0e14, 0x0,
+    0x300e14, 0x0, 0x0, 0x330e14, 0x0, 0x350e14, 0x360e14, 0x0, 0x0, 0x390e14, 0x3a0e14, 0x0, 0x3c0e14, 0x0, 0x0, 0x3f0e14,
+    0x400e14, 0x0, 0x0, 0x430e14, 0x0, 0x450e14, 0x460e14, 0x0, 0x0, 0x490e14, 0x4a0e14, 0x0, 0x4c0e14, 0x0, 0x0, 0x4f0e14,
+    0x0, 0x510e14, 0x520e14, 0x0, 0x540e14, 0x0, 0x0, 0x570e14, 0x580e14, 0x0, 0x0, 0x5b0e14, 0x0, 0x5d0e14, 0x5e0e14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1004, 0xff1004, 0x0, 0xff1004, 0x0, 0x0, 0xff1004, 0xff1004, 0x0, 0x0, 0xff1004, 0x0, 0xff1004, 0xff1004, 0x0,
+    0xff1004, 0x0, 0x0, 0xff1004, 0x0, 0xff1004, 0xff1004, 0x0, 0x0, 0xff1004, 0xff1004, 0x0, 0xff1004, 0x0, 0x0, 0xff1004,
+    0x1004, 0x0, 0x0, 0x31004, 0x0, 0x51004, 0x61004, 0x0, 0x0, 0x91004, 0xa1004, 0x0, 0xc1004, 0x0, 0x0, 0xf1004,
+    0x0, 0x111004, 0x121004, 0x0, 0x141004, 0x0, 0x0, 0x171004, 0x181004, 0x0, 0x0, 0x1b1004, 0x0, 0x1d1004, 0x1e1004, 0x0,
+    0x201004, 0x0, 0x0, 0x231004, 0x0, 0x251004, 0x261004, 0x0, 0x0, 0x291004, 0x2a1004, 0x0, 0x2c1004, 0x0, 0x0, 0x2f1004,
+    0x0, 0x311004, 0x321004, 0x0, 0x341004, 0x0, 0x0, 0x371004, 0x381004, 0x0, 0x0, 0x3b1004, 0x0, 0x3d1004, 0x3e1004, 0x0,
+    0x0, 0x411004, 0x421004, 0x0, 0x441004, 0x0, 0x0, 0x471004, 0x481004, 0x0, 0x0, 0x4b1004, 0x0, 0x4d1004, 0x4e1004, 0x0,
+    0x501004, 0x0, 0x0, 0x531004, 0x0, 0x551004, 0x561004, 0x0, 0x0, 0x591004, 0x5a1004, 0x0, 0x5c1004, 0x0, 0x0, 0x5f1004,
+    0xff1004, 0x0, 0x0, 0xff1004, 0x0, 0xff1004, 0xff1004, 0x0, 0x0, 0xff1004, 0xff1004, 0x0, 0xff1004, 0x0, 0x0, 0xff1004,
+    0x0, 0xff1004, 0xff1004, 0x0, 0xff1004, 0x0, 0x0, 0xff1004, 0xff1004, 0x0, 0x0, 0xff1004, 0x0, 0xff1004, 0xff1004, 0x0,
+    0x0, 0x11004, 0x21004, 0x0, 0x41004, 0x0, 0x0, 0x71004, 0x81004, 0x0, 0x0, 0xb1004, 0x0, 0xd1004, 0xe1004, 0x0,
+    0x101004, 0x0, 0x0, 0x131004, 0x0, 0x151004, 0x161004, 0x0, 0x0, 0x191004, 0x1a1004, 0x0, 0x1c1004, 0x0, 0x0, 0x1f1004,
+    0x0, 0x211004, 0x221004, 0x0, 0x241004, 0x0, 0x0, 0x271004, 0x281004, 0x0, 0x0, 0x2b1004, 0x0, 0x2d1004, 0x2e1004, 0x0,
+    0x301004, 0x0, 0x0, 0x331004, 0x0, 0x351004, 0x361004, 0x0, 0x0, 0x391004, 0x3a1004, 0x0, 0x3c1004, 0x0, 0x0, 0x3f1004,
+    0x401004, 0x0, 0x0, 0x431004, 0x0, 0x451004, 0x461004, 0x0, 0x0, 0x491004, 0x4a1004, 0x0, 0x4c1004, 0x0, 0x0, 0x4f1004,
+    0x0, 0x511004, 0x521004, 0x0, 0x541004, 0x0, 0x0, 0x571004, 0x581004, 0x0, 0x0, 0x5b1004, 0x0, 0x5d1004, 0x5e1004, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1304, 0xff1304, 0x0, 0xff1304, 0x0, 0x0, 0xff1304, 0xff1304, 0x0, 0x0, 0xff1304, 0x0, 0xff1304, 0xff1304, 0x0,
+    0xff1304, 0x0, 0x0, 0xff1304, 0x0, 0xff1304, 0xff1304, 0x0, 0x0, 0xff1304, 0xff1304, 0x0, 0xff1304, 0x0, 0x0, 0xff1304,
+    0x1304, 0x0, 0x0, 0x31304, 0x0, 0x51304, 0x61304, 0x0, 0x0, 0x91304, 0xa1304, 0x0, 0xc1304, 0x0, 0x0, 0xf1304,
+    0x0, 0x111304, 0x121304, 0x0, 0x141304, 0x0, 0x0, 0x171304, 0x181304, 0x0, 0x0, 0x1b1304, 0x0, 0x1d1304, 0x1e1304, 0x0,
+    0x201304, 0x0, 0x0, 0x231304, 0x0, 0x251304, 0x261304, 0x0, 0x0, 0x291304, 0x2a1304, 0x0, 0x2c1304, 0x0, 0x0, 0x2f1304,
+    0x0, 0x311304, 0x321304, 0x0, 0x341304, 0x0, 0x0, 0x371304, 0x381304, 0x0, 0x0, 0x3b1304, 0x0, 0x3d1304, 0x3e1304, 0x0,
+    0x0, 0x411304, 0x421304, 0x0, 0x441304, 0x0, 0x0, 0x471304, 0x481304, 0x0, 0x0, 0x4b1304, 0x0, 0x4d1304, 0x4e1304, 0x0,
+    0x501304, 0x0, 0x0, 0x531304, 0x0, 0x551304, 0x561304, 0x0, 0x0, 0x591304, 0x5a1304, 0x0, 0x5c1304, 0x0, 0x0, 0x5f1304,
+    0xff1304, 0x0, 0x0, 0xff1304, 0x0, 0xff1304, 0xff1304, 0x0, 0x0, 0xff1304, 0xff1304, 0x0, 0xff1304, 0x0, 0x0, 0xff1304,
+    0x0, 0xff1304, 0xff1304, 0x0, 0xff1304, 0x0, 0x0, 0xff1304, 0xff1304, 0x0, 0x0, 0xff1304, 0x0, 0xff1304, 0xff1304, 0x0,
+    0x0, 0x11304, 0x21304, 0x0, 0x41304, 0x0, 0x0, 0x71304, 0x81304, 0x0, 0x0, 0xb1304, 0x0, 0xd1304, 0xe1304, 0x0,
+    0x101304, 0x0, 0x0, 0x131304, 0x0, 0x151304, 0x161304, 0x0, 0x0, 0x191304, 0x1a1304, 0x0, 0x1c1304, 0x0, 0x0, 0x1f1304,
+    0x0, 0x211304, 0x221304, 0x0, 0x241304, 0x0, 0x0, 0x271304, 0x281304, 0x0, 0x0, 0x2b1304, 0x0, 0x2d1304, 0x2e1304, 0x0,
+    0x301304, 0x0, 0x0, 0x331304, 0x0, 0x351304, 0x361304, 0x0, 0x0, 0x391304, 0x3a1304, 0x0, 0x3c1304, 0x0, 0x0, 0x3f1304,
+    0x401304, 0x0, 0x0, 0x431304, 0x0, 0x451304, 0x461304, 0x0, 0x0, 0x491304, 0x4a1304, 0x0, 0x4c1304, 0x0, 0x0, 0x4f1304,
+    0x0, 0x511304, 0x521304, 0x0, 0x541304, 0x0, 0x0, 0x571304, 0x581304, 0x0, 0x0, 0x5b1304, 0x0, 0x5d1304, 0x5e1304, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1504, 0xff1504, 0x0, 0xff1504, 0x0, 0x0, 0xff1504, 0xff1504, 0x0, 0x0, 0xff1504, 0x0, 0xff1504, 0xff1504, 0x0,
+    0xff1504, 0x0, 0x0, 0xff1504, 0x0, 0xff1504, 0xff1504, 0x0, 0x0, 0xff1504, 0xff1504, 0x0, 0xff1504, 0x0, 0x0, 0xff1504,
+    0x1504, 0x0, 0x0, 0x31504, 0x0, 0x51504, 0x61504, 0x0, 0x0, 0x91504, 0xa1504, 0x0, 0xc1504, 0x0, 0x0, 0xf1504,
+    0x0, 0x111504, 0x121504, 0x0, 0x141504, 0x0, 0x0, 0x171504, 0x181504, 0x0, 0x0, 0x1b1504, 0x0, 0x1d1504, 0x1e1504, 0x0,
+    0x201504, 0x0, 0x0, 0x231504, 0x0, 0x251504, 0x261504, 0x0, 0x0, 0x291504, 0x2a1504, 0x0, 0x2c1504, 0x0, 0x0, 0x2f1504,
+    0x0, 0x311504, 0x321504, 0x0, 0x341504, 0x0, 0x0, 0x371504, 0x381504, 0x0, 0x0, 0x3b1504, 0x0, 0x3d1504, 0x3e1504, 0x0,
+    0x0, 0x411504, 0x421504, 0x0, 0x441504, 0x0, 0x0, 0x471504, 0x481504, 0x0, 0x0, 0x4b1504, 0x0, 0x4d1504, 0x4e1504, 0x0,
+    0x501504, 0x0, 0x0, 0x531504, 0x0, 0x551504, 0x561504, 0x0, 0x0, 0x591504, 0x5a1504, 0x0, 0x5c1504, 0x0, 0x0, 0x5f1504,
+    0xff1504, 0x0, 0x0, 0xff1504, 0x0, 0xff1504, 0xff1504, 0x0, 0x0, 0xff1504, 0xff1504, 0x0, 0xff1504, 0x0, 0x0, 0xff1504,
+    0x0, 0xff1504, 0xff1504, 0x0, 0xff1504, 0x0, 0x0, 0xff1504, 0xff1504, 0x0, 0x0, 0xff1504, 0x0, 0xff1504, 0xff1504, 0x0,
+    0x0, 0x11504, 0x21504, 0x0, 0x41504, 0x0, 0x0, 0x71504, 0x81504, 0x0, 0x0, 0xb1504, 0x0, 0xd1504, 0xe1504, 0x0,
+    0x101504, 0x0, 0x0, 0x131504, 0x0, 0x151504, 0x161504, 0x0, 0x0, 0x191504, 0x1a1504, 0x0, 0x1c1504, 0x0, 0x0, 0x1f1504,
+    0x0, 0x211504, 0x221504, 0x0, 0x241504, 0x0, 0x0, 0x271504, 0x281504, 0x0, 0x0, 0x2b1504, 0x0, 0x2d1504, 0x2e1504, 0x0,
+    0x301504, 0x0, 0x0, 0x331504, 0x0, 0x351504, 0x361504, 0x0, 0x0, 0x391504, 0x3a1504, 0x0, 0x3c1504, 0x0, 0x0, 0x3f1504,
+    0x401504, 0x0, 0x0, 0x431504, 0x0, 0x451504, 0x461504, 0x0, 0x0, 0x491504, 0x4a1504, 0x0, 0x4c1504, 0x0, 0x0, 0x4f1504,
+    0x0, 0x511504, 0x521504, 0x0, 0x541504, 0x0, 0x0, 0x571504, 0x581504, 0x0, 0x0, 0x5b1504, 0x0, 0x5d1504, 0x5e1504, 0x0,
+    0x0, 0xff1604, 0xff1604, 0x0, 0xff1604, 0x0, 0x0, 0xff1604, 0xff1604, 0x0, 0x0, 0xff1604, 0x0, 0xff1604, 0xff1604, 0x0,
+    0xff1604, 0x0, 0x0, 0xff1604, 0x0, 0xff1604, 0xff1604, 0x0, 0x0, 0xff1604, 0xff1604, 0x0, 0xff1604, 0x0, 0x0, 0xff1604,
+    0x1604, 0x0, 0x0, 0x31604, 0x0, 0x51604, 0x61604, 0x0, 0x0, 0x91604, 0xa1604, 0x0, 0xc1604, 0x0, 0x0, 0xf1604,
+    0x0, 0x111604, 0x121604, 0x0, 0x141604, 0x0, 0x0, 0x171604, 0x181604, 0x0, 0x0, 0x1b1604, 0x0, 0x1d1604, 0x1e1604, 0x0,
+    0x201604, 0x0, 0x0, 0x231604, 0x0, 0x251604, 0x261604, 0x0, 0x0, 0x291604, 0x2a1604, 0x0, 0x2c1604, 0x0, 0x0, 0x2f1604,
+    0x0, 0x311604, 0x321604, 0x0, 0x341604, 0x0, 0x0, 0x371604, 0x381604, 0x0, 0x0, 0x3b1604, 0x0, 0x3d1604, 0x3e1604, 0x0,
+    0x0, 0x411604, 0x421604, 0x0, 0x441604, 0x0, 0x0, 0x471604, 0x481604, 0x0, 0x0, 0x4b1604, 0x0, 0x4d1604, 0x4e1604, 0x0,
+    0x501604, 0x0, 0x0, 0x531604, 0x0, 0x551604, 0x561604, 0x0, 0x0, 0x591604, 0x5a1604, 0x0, 0x5c1604, 0x0, 0x0, 0x5f1604,
+    0xff1604, 0x0, 0x0, 0xff1604, 0x0, 0xff1604, 0xff1604, 0x0, 0x0, 0xff1604, 0xff1604, 0x0, 0xff1604, 0x0, 0x0, 0xff1604,
+    0x0, 0xff1604, 0xff1604, 0x0, 0xff1604, 0x0, 0x0, 0xff1604, 0xff1604, 0x0, 0x0, 0xff1604, 0x0, 0xff1604, 0xff1604, 0x0,
+    0x0, 0x11604, 0x21604, 0x0, 0x41604, 0x0, 0x0, 0x71604, 0x81604, 0x0, 0x0, 0xb1604, 0x0, 0xd1604, 0xe1604, 0x0,
+    0x101604, 0x0, 0x0, 0x131604, 0x0, 0x151604, 0x161604, 0x0, 0x0, 0x191604, 0x1a1604, 0x0, 0x1c1604, 0x0, 0x0, 0x1f1604,
+    0x0, 0x211604, 0x221604, 0x0, 0x241604, 0x0, 0x0, 0x271604, 0x281604, 0x0, 0x0, 0x2b1604, 0x0, 0x2d1604, 0x2e1604, 0x0,
+    0x301604, 0x0, 0x0, 0x331604, 0x0, 0x351604, 0x361604, 0x0, 0x0, 0x391604, 0x3a1604, 0x0, 0x3c1604, 0x0, 0x0, 0x3f1604,
+    0x401604, 0x0, 0x0, 0x431604, 0x0, 0x451604, 0x461604, 0x0, 0x0, 0x491604, 0x4a1604, 0x0, 0x4c1604, 0x0, 0x0, 0x4f1604,
+    0x0, 0x511604, 0x521604, 0x0, 0x541604, 0x0, 0x0, 0x571604, 0x581604, 0x0, 0x0, 0x5b1604, 0x0, 0x5d1604, 0x5e1604, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1914, 0xff1914, 0x0, 0xff1914, 0x0, 0x0, 0xff1914, 0xff1914, 0x0, 0x0, 0xff1914, 0x0, 0xff1914, 0xff1914, 0x0,
+    0xff1914, 0x0, 0x0, 0xff1914, 0x0, 0xff1914, 0xff1914, 0x0, 0x0, 0xff1914, 0xff1914, 0x0, 0xff1914, 0x0, 0x0, 0xff1914,
+    0x1914, 0x0, 0x0, 0x31914, 0x0, 0x51914, 0x61914, 0x0, 0x0, 0x91914, 0xa1914, 0x0, 0xc1914, 0x0, 0x0, 0xf1914,
+    0x0, 0x111914, 0x121914, 0x0, 0x141914, 0x0, 0x0, 0x171914, 0x181914, 0x0, 0x0, 0x1b1914, 0x0, 0x1d1914, 0x1e1914, 0x0,
+    0x201914, 0x0, 0x0, 0x231914, 0x0, 0x251914, 0x261914, 0x0, 0x0, 0x291914, 0x2a1914, 0x0, 0x2c1914, 0x0, 0x0, 0x2f1914,
+    0x0, 0x311914, 0x321914, 0x0, 0x341914, 0x0, 0x0, 0x371914, 0x381914, 0x0, 0x0, 0x3b1914, 0x0, 0x3d1914, 0x3e1914, 0x0,
+    0x0, 0x411914, 0x421914, 0x0, 0x441914, 0x0, 0x0, 0x471914, 0x481914, 0x0, 0x0, 0x4b1914, 0x0, 0x4d1914, 0x4e1914, 0x0,
+    0x501914, 0x0, 0x0, 0x531914, 0x0, 0x551914, 0x561914, 0x0, 0x0, 0x591914, 0x5a1914, 0x0, 0x5c1914, 0x0, 0x0, 0x5f1914,
+    0xff1914, 0x0, 0x0, 0xff1914, 0x0, 0xff1914, 0xff1914, 0x0, 0x0, 0xff1914, 0xff1914, 0x0, 0xff1914, 0x0, 0x0, 0xff1914,
+    0x0, 0xff1914, 0xff1914, 0x0, 0xff1914, 0x0, 0x0, 0xff1914, 0xff1914, 0x0, 0x0, 0xff1914, 0x0, 0xff1914, 0xff1914, 0x0,
+    0x0, 0x11914, 0x21914, 0x0, 0x41914, 0x0, 0x0, 0x71914, 0x81914, 0x0, 0x0, 0xb1914, 0x0, 0xd1914, 0xe1914, 0x0,
+    0x101914, 0x0, 0x0, 0x131914, 0x0, 0x151914, 0x161914, 0x0, 0x0, 0x191914, 0x1a1914, 0x0, 0x1c1914, 0x0, 0x0, 0x1f1914,
+    0x0, 0x211914, 0x221914, 0x0, 0x241914, 0x0, 0x0, 0x271914, 0x281914, 0x0, 0x0, 0x2b1914, 0x0, 0x2d1914, 0x2e1914, 0x0,
+    0x301914, 0x0, 0x0, 0x331914, 0x0, 0x351914, 0x361914, 0x0, 0x0, 0x391914, 0x3a1914, 0x0, 0x3c1914, 0x0, 0x0, 0x3f1914,
+    0x401914, 0x0, 0x0, 0x431914, 0x0, 0x451914, 0x461914, 0x0, 0x0, 0x491914, 0x4a1914, 0x0, 0x4c1914, 0x0, 0x0, 0x4f1914,
+    0x0, 0x511914, 0x521914, 0x0, 0x541914, 0x0, 0x0, 0x571914, 0x581914, 0x0, 0x0, 0x5b1914, 0x0, 0x5d1914, 0x5e1914, 0x0,
+    0x0, 0xff1a14, 0xff1a14, 0x0, 0xff1a14, 0x0, 0x0, 0xff1a14, 0xff1a14, 0x0, 0x0, 0xff1a14, 0x0, 0xff1a14, 0xff1a14, 0x0,
+    0xff1a14, 0x0, 0x0, 0xff1a14, 0x0, 0xff1a14, 0xff1a14, 0x0, 0x0, 0xff1a14, 0xff1a14, 0x0, 0xff1a14, 0x0, 0x0, 0xff1a14,
+    0x1a14, 0x0, 0x0, 0x31a14, 0x0, 0x51a14, 0x61a14, 0x0, 0x0, 0x91a14, 0xa1a14, 0x0, 0xc1a14, 0x0, 0x0, 0xf1a14,
+    0x0, 0x111a14, 0x121a14, 0x0, 0x141a14, 0x0, 0x0, 0x171a14, 0x181a14, 0x0, 0x0, 0x1b1a14, 0x0, 0x1d1a14, 0x1e1a14, 0x0,
+    0x201a14, 0x0, 0x0, 0x231a14, 0x0, 0x251a14, 0x261a14, 0x0, 0x0, 0x291a14, 0x2a1a14, 0x0, 0x2c1a14, 0x0, 0x0, 0x2f1a14,
+    0x0, 0x311a14, 0x321a14, 0x0, 0x341a14, 0x0, 0x0, 0x371a14, 0x381a14, 0x0, 0x0, 0x3b1a14, 0x0, 0x3d1a14, 0x3e1a14, 0x0,
+    0x0, 0x411a14, 0x421a14, 0x0, 0x441a14, 0x0, 0x0, 0x471a14, 0x481a14, 0x0, 0x0, 0x4b1a14, 0x0, 0x4d1a14, 0x4e1a14, 0x0,
+    0x501a14, 0x0, 0x0, 0x531a14, 0x0, 0x551a14, 0x561a14, 0x0, 0x0, 0x591a14, 0x5a1a14, 0x0, 0x5c1a14, 0x0, 0x0, 0x5f1a14,
+    0xff1a14, 0x0, 0x0, 0xff1a14, 0x0, 0xff1a14, 0xff1a14, 0x0, 0x0, 0xff1a14, 0xff1a14, 0x0, 0xff1a14, 0x0, 0x0, 0xff1a14,
+    0x0, 0xff1a14, 0xff1a14, 0x0, 0xff1a14, 0x0, 0x0, 0xff1a14, 0xff1a14, 0x0, 0x0, 0xff1a14, 0x0, 0xff1a14, 0xff1a14, 0x0,
+    0x0, 0x11a14, 0x21a14, 0x0, 0x41a14, 0x0, 0x0, 0x71a14, 0x81a14, 0x0, 0x0, 0xb1a14, 0x0, 0xd1a14, 0xe1a14, 0x0,
+    0x101a14, 0x0, 0x0, 0x131a14, 0x0, 0x151a14, 0x161a14, 0x0, 0x0, 0x191a14, 0x1a1a14, 0x0, 0x1c1a14, 0x0, 0x0, 0x1f1a14,
+    0x0, 0x211a14, 0x221a14, 0x0, 0x241a14, 0x0, 0x0, 0x271a14, 0x281a14, 0x0, 0x0, 0x2b1a14, 0x0, 0x2d1a14, 0x2e1a14, 0x0,
+    0x301a14, 0x0, 0x0, 0x331a14, 0x0, 0x351a14, 0x361a14, 0x0, 0x0, 0x391a14, 0x3a1a14, 0x0, 0x3c1a14, 0x0, 0x0, 0x3f1a14,
+    0x401a14, 0x0, 0x0, 0x431a14, 0x0, 0x451a14, 0x461a14, 0x0, 0x0, 0x491a14, 0x4a1a14, 0x0, 0x4c1a14, 0x0, 0x0, 0x4f1a14,
+    0x0, 0x511a14, 0x521a14, 0x0, 0x541a14, 0x0, 0x0, 0x571a14, 0x581a14, 0x0, 0x0, 0x5b1a14, 0x0, 0x5d1a14, 0x5e1a14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1c14, 0xff1c14, 0x0, 0xff1c14, 0x0, 0x0, 0xff1c14, 0xff1c14, 0x0, 0x0, 0xff1c14, 0x0, 0xff1c14, 0xff1c14, 0x0,
+    0xff1c14, 0x0, 0x0, 0xff1c14, 0x0, 0xff1c14, 0xff1c14, 0x0, 0x0, 0xff1c14, 0xff1c14, 0x0, 0xff1c14, 0x0, 0x0, 0xff1c14,
+    0x1c14, 0x0, 0x0, 0x31c14, 0x0, 0x51c14, 0x61c14, 0x0, 0x0, 0x91c14, 0xa1c14, 0x0, 0xc1c14, 0x0, 0x0, 0xf1c14,
+    0x0, 0x111c14, 0x121c14, 0x0, 0x141c14, 0x0, 0x0, 0x171c14, 0x181c14, 0x0, 0x0, 0x1b1c14, 0x0, 0x1d1c14, 0x1e1c14, 0x0,
+    0x201c14, 0x0, 0x0, 0x231c14, 0x0, 0x251c14, 0x261c14, 0x0, 0x0, 0x291c14, 0x2a1c14, 0x0, 0x2c1c14, 0x0, 0x0, 0x2f1c14,
+    0x0, 0x311c14, 0x321c14, 0x0, 0x341c14, 0x0, 0x0, 0x371c14, 0x381c14, 0x0, 0x0, 0x3b1c14, 0x0, 0x3d1c14, 0x3e1c14, 0x0,
+    0x0, 0x411c14, 0x421c14, 0x0, 0x441c14, 0x0, 0x0, 0x471c14, 0x481c14, 0x0, 0x0, 0x4b1c14, 0x0, 0x4d1c14, 0x4e1c14, 0x0,
+    0x501c14, 0x0, 0x0, 0x531c14, 0x0, 0x551c14, 0x561c14, 0x0, 0x0, 0x591c14, 0x5a1c14, 0x0, 0x5c1c14, 0x0, 0x0, 0x5f1c14,
+    0xff1c14, 0x0, 0x0, 0xff1c14, 0x0, 0xff1c14, 0xff1c14, 0x0, 0x0, 0xff1c14, 0xff1c14, 0x0, 0xff1c14, 0x0, 0x0, 0xff1c14,
+    0x0, 0xff1c14, 0xff1c14, 0x0, 0xff1c14, 0x0, 0x0, 0xff1c14, 0xff1c14, 0x0, 0x0, 0xff1c14, 0x0, 0xff1c14, 0xff1c14, 0x0,
+    0x0, 0x11c14, 0x21c14, 0x0, 0x41c14, 0x0, 0x0, 0x71c14, 0x81c14, 0x0, 0x0, 0xb1c14, 0x0, 0xd1c14, 0xe1c14, 0x0,
+    0x101c14, 0x0, 0x0, 0x131c14, 0x0, 0x151c14, 0x161c14, 0x0, 0x0, 0x191c14, 0x1a1c14, 0x0, 0x1c1c14, 0x0, 0x0, 0x1f1c14,
+    0x0, 0x211c14, 0x221c14, 0x0, 0x241c14, 0x0, 0x0, 0x271c14, 0x281c14, 0x0, 0x0, 0x2b1c14, 0x0, 0x2d1c14, 0x2e1c14, 0x0,
+    0x301c14, 0x0, 0x0, 0x331c14, 0x0, 0x351c14, 0x361c14, 0x0, 0x0, 0x391c14, 0x3a1c14, 0x0, 0x3c1c14, 0x0, 0x0, 0x3f1c14,
+    0x401c14, 0x0, 0x0, 0x431c14, 0x0, 0x451c14, 0x461c14, 0x0, 0x0, 0x491c14, 0x4a1c14, 0x0, 0x4c1c14, 0x0, 0x0, 0x4f1c14,
+    0x0, 0x511c14, 0x521c14, 0x0, 0x541c14, 0x0, 0x0, 0x571c14, 0x581c14, 0x0, 0x0, 0x5b1c14, 0x0, 0x5d1c14, 0x5e1c14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff1f14, 0xff1f14, 0x0, 0xff1f14, 0x0, 0x0, 0xff1f14, 0xff1f14, 0x0, 0x0, 0xff1f14, 0x0, 0xff1f14, 0xff1f14, 0x0,
+    0xff1f14, 0x0, 0x0, 0xff1f14, 0x0, 0xff1f14, 0xff1f14, 0x0, 0x0, 0xff1f14, 0xff1f14, 0x0, 0xff1f14, 0x0, 0x0, 0xff1f14,
+    0x1f14, 0x0, 0x0, 0x31f14, 0x0, 0x51f14, 0x61f14, 0x0, 0x0, 0x91f14, 0xa1f14, 0x0, 0xc1f14, 0x0, 0x0, 0xf1f14,
+    0x0, 0x111f14, 0x121f14, 0x0, 0x141f14, 0x0, 0x0, 0x171f14, 0x181f14, 0x0, 0x0, 0x1b1f14, 0x0, 0x1d1f14, 0x1e1f14, 0x0,
+    0x201f14, 0x0, 0x0, 0x231f14, 0x0, 0x251f14, 0x261f14, 0x0, 0x0, 0x291f14, 0x2a1f14, 0x0, 0x2c1f14, 0x0, 0x0, 0x2f1f14,
+    0x0, 0x311f14, 0x321f14, 0x0, 0x341f14, 0x0, 0x0, 0x371f14, 0x381f14, 0x0, 0x0, 0x3b1f14, 0x0, 0x3d1f14, 0x3e1f14, 0x0,
+    0x0, 0x411f14, 0x421f14, 0x0, 0x441f14, 0x0, 0x0, 0x471f14, 0x481f14, 0x0, 0x0, 0x4b1f14, 0x0, 0x4d1f14, 0x4e1f14, 0x0,
+    0x501f14, 0x0, 0x0, 0x531f14, 0x0, 0x551f14, 0x561f14, 0x0, 0x0, 0x591f14, 0x5a1f14, 0x0, 0x5c1f14, 0x0, 0x0, 0x5f1f14,
+    0xff1f14, 0x0, 0x0, 0xff1f14, 0x0, 0xff1f14, 0xff1f14, 0x0, 0x0, 0xff1f14, 0xff1f14, 0x0, 0xff1f14, 0x0, 0x0, 0xff1f14,
+    0x0, 0xff1f14, 0xff1f14, 0x0, 0xff1f14, 0x0, 0x0, 0xff1f14, 0xff1f14, 0x0, 0x0, 0xff1f14, 0x0, 0xff1f14, 0xff1f14, 0x0,
+    0x0, 0x11f14, 0x21f14, 0x0, 0x41f14, 0x0, 0x0, 0x71f14, 0x81f14, 0x0, 0x0, 0xb1f14, 0x0, 0xd1f14, 0xe1f14, 0x0,
+    0x101f14, 0x0, 0x0, 0x131f14, 0x0, 0x151f14, 0x161f14, 0x0, 0x0, 0x191f14, 0x1a1f14, 0x0, 0x1c1f14, 0x0, 0x0, 0x1f1f14,
+    0x0, 0x211f14, 0x221f14, 0x0, 0x241f14, 0x0, 0x0, 0x271f14, 0x281f14, 0x0, 0x0, 0x2b1f14, 0x0, 0x2d1f14, 0x2e1f14, 0x0,
+    0x301f14, 0x0, 0x0, 0x331f14, 0x0, 0x351f14, 0x361f14, 0x0, 0x0, 0x391f14, 0x3a1f14, 0x0, 0x3c1f14, 0x0, 0x0, 0x3f1f14,
+    0x401f14, 0x0, 0x0, 0x431f14, 0x0, 0x451f14, 0x461f14, 0x0, 0x0, 0x491f14, 0x4a1f14, 0x0, 0x4c1f14, 0x0, 0x0, 0x4f1f14,
+    0x0, 0x511f14, 0x521f14, 0x0, 0x541f14, 0x0, 0x0, 0x571f14, 0x581f14, 0x0, 0x0, 0x5b1f14, 0x0, 0x5d1f14, 0x5e1f14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2104, 0xff2104, 0x0, 0xff2104, 0x0, 0x0, 0xff2104, 0xff2104, 0x0, 0x0, 0xff2104, 0x0, 0xff2104, 0xff2104, 0x0,
+    0xff2104, 0x0, 0x0, 0xff2104, 0x0, 0xff2104, 0xff2104, 0x0, 0x0, 0xff2104, 0xff2104, 0x0, 0xff2104, 0x0, 0x0, 0xff2104,
+    0x2104, 0x0, 0x0, 0x32104, 0x0, 0x52104, 0x62104, 0x0, 0x0, 0x92104, 0xa2104, 0x0, 0xc2104, 0x0, 0x0, 0xf2104,
+    0x0, 0x112104, 0x122104, 0x0, 0x142104, 0x0, 0x0, 0x172104, 0x182104, 0x0, 0x0, 0x1b2104, 0x0, 0x1d2104, 0x1e2104, 0x0,
+    0x202104, 0x0, 0x0, 0x232104, 0x0, 0x252104, 0x262104, 0x0, 0x0, 0x292104, 0x2a2104, 0x0, 0x2c2104, 0x0, 0x0, 0x2f2104,
+    0x0, 0x312104, 0x322104, 0x0, 0x342104, 0x0, 0x0, 0x372104, 0x382104, 0x0, 0x0, 0x3b2104, 0x0, 0x3d2104, 0x3e2104, 0x0,
+    0x0, 0x412104, 0x422104, 0x0, 0x442104, 0x0, 0x0, 0x472104, 0x482104, 0x0, 0x0, 0x4b2104, 0x0, 0x4d2104, 0x4e2104, 0x0,
+    0x502104, 0x0, 0x0, 0x532104, 0x0, 0x552104, 0x562104, 0x0, 0x0, 0x592104, 0x5a2104, 0x0, 0x5c2104, 0x0, 0x0, 0x5f2104,
+    0xff2104, 0x0, 0x0, 0xff2104, 0x0, 0xff2104, 0xff2104, 0x0, 0x0, 0xff2104, 0xff2104, 0x0, 0xff2104, 0x0, 0x0, 0xff2104,
+    0x0, 0xff2104, 0xff2104, 0x0, 0xff2104, 0x0, 0x0, 0xff2104, 0xff2104, 0x0, 0x0, 0xff2104, 0x0, 0xff2104, 0xff2104, 0x0,
+    0x0, 0x12104, 0x22104, 0x0, 0x42104, 0x0, 0x0, 0x72104, 0x82104, 0x0, 0x0, 0xb2104, 0x0, 0xd2104, 0xe2104, 0x0,
+    0x102104, 0x0, 0x0, 0x132104, 0x0, 0x152104, 0x162104, 0x0, 0x0, 0x192104, 0x1a2104, 0x0, 0x1c2104, 0x0, 0x0, 0x1f2104,
+    0x0, 0x212104, 0x222104, 0x0, 0x242104, 0x0, 0x0, 0x272104, 0x282104, 0x0, 0x0, 0x2b2104, 0x0, 0x2d2104, 0x2e2104, 0x0,
+    0x302104, 0x0, 0x0, 0x332104, 0x0, 0x352104, 0x362104, 0x0, 0x0, 0x392104, 0x3a2104, 0x0, 0x3c2104, 0x0, 0x0, 0x3f2104,
+    0x402104, 0x0, 0x0, 0x432104, 0x0, 0x452104, 0x462104, 0x0, 0x0, 0x492104, 0x4a2104, 0x0, 0x4c2104, 0x0, 0x0, 0x4f2104,
+    0x0, 0x512104, 0x522104, 0x0, 0x542104, 0x0, 0x0, 0x572104, 0x582104, 0x0, 0x0, 0x5b2104, 0x0, 0x5d2104, 0x5e2104, 0x0,
+    0x0, 0xff2204, 0xff2204, 0x0, 0xff2204, 0x0, 0x0, 0xff2204, 0xff2204, 0x0, 0x0, 0xff2204, 0x0, 0xff2204, 0xff2204, 0x0,
+    0xff2204, 0x0, 0x0, 0xff2204, 0x0, 0xff2204, 0xff2204, 0x0, 0x0, 0xff2204, 0xff2204, 0x0, 0xff2204, 0x0, 0x0, 0xff2204,
+    0x2204, 0x0, 0x0, 0x32204, 0x0, 0x52204, 0x62204, 0x0, 0x0, 0x92204, 0xa2204, 0x0, 0xc2204, 0x0, 0x0, 0xf2204,
+    0x0, 0x112204, 0x122204, 0x0, 0x142204, 0x0, 0x0, 0x172204, 0x182204, 0x0, 0x0, 0x1b2204, 0x0, 0x1d2204, 0x1e2204, 0x0,
+    0x202204, 0x0, 0x0, 0x232204, 0x0, 0x252204, 0x262204, 0x0, 0x0, 0x292204, 0x2a2204, 0x0, 0x2c2204, 0x0, 0x0, 0x2f2204,
+    0x0, 0x312204, 0x322204, 0x0, 0x342204, 0x0, 0x0, 0x372204, 0x382204, 0x0, 0x0, 0x3b2204, 0x0, 0x3d2204, 0x3e2204, 0x0,
+    0x0, 0x412204, 0x422204, 0x0, 0x442204, 0x0, 0x0, 0x472204, 0x482204, 0x0, 0x0, 0x4b2204, 0x0, 0x4d2204, 0x4e2204, 0x0,
+    0x502204, 0x0, 0x0, 0x532204, 0x0, 0x552204, 0x562204, 0x0, 0x0, 0x592204, 0x5a2204, 0x0, 0x5c2204, 0x0, 0x0, 0x5f2204,
+    0xff2204, 0x0, 0x0, 0xff2204, 0x0, 0xff2204, 0xff2204, 0x0, 0x0, 0xff2204, 0xff2204, 0x0, 0xff2204, 0x0, 0x0, 0xff2204,
+    0x0, 0xff2204, 0xff2204, 0x0, 0xff2204, 0x0, 0x0, 0xff2204, 0xff2204, 0x0, 0x0, 0xff2204, 0x0, 0xff2204, 0xff2204, 0x0,
+    0x0, 0x12204, 0x22204, 0x0, 0x42204, 0x0, 0x0, 0x72204, 0x82204, 0x0, 0x0, 0xb2204, 0x0, 0xd2204, 0xe2204, 0x0,
+    0x102204, 0x0, 0x0, 0x132204, 0x0, 0x152204, 0x162204, 0x0, 0x0, 0x192204, 0x1a2204, 0x0, 0x1c2204, 0x0, 0x0, 0x1f2204,
+    0x0, 0x212204, 0x222204, 0x0, 0x242204, 0x0, 0x0, 0x272204, 0x282204, 0x0, 0x0, 0x2b2204, 0x0, 0x2d2204, 0x2e2204, 0x0,
+    0x302204, 0x0, 0x0, 0x332204, 0x0, 0x352204, 0x362204, 0x0, 0x0, 0x392204, 0x3a2204, 0x0, 0x3c2204, 0x0, 0x0, 0x3f2204,
+    0x402204, 0x0, 0x0, 0x432204, 0x0, 0x452204, 0x462204, 0x0, 0x0, 0x492204, 0x4a2204, 0x0, 0x4c2204, 0x0, 0x0, 0x4f2204,
+    0x0, 0x512204, 0x522204, 0x0, 0x542204, 0x0, 0x0, 0x572204, 0x582204, 0x0, 0x0, 0x5b2204, 0x0, 0x5d2204, 0x5e2204, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2404, 0xff2404, 0x0, 0xff2404, 0x0, 0x0, 0xff2404, 0xff2404, 0x0, 0x0, 0xff2404, 0x0, 0xff2404, 0xff2404, 0x0,
+    0xff2404, 0x0, 0x0, 0xff2404, 0x0, 0xff2404, 0xff2404, 0x0, 0x0, 0xff2404, 0xff2404, 0x0, 0xff2404, 0x0, 0x0, 0xff2404,
+    0x2404, 0x0, 0x0, 0x32404, 0x0, 0x52404, 0x62404, 0x0, 0x0, 0x92404, 0xa2404, 0x0, 0xc2404, 0x0, 0x0, 0xf2404,
+    0x0, 0x112404, 0x122404, 0x0, 0x142404, 0x0, 0x0, 0x172404, 0x182404, 0x0, 0x0, 0x1b2404, 0x0, 0x1d2404, 0x1e2404, 0x0,
+    0x202404, 0x0, 0x0, 0x232404, 0x0, 0x252404, 0x262404, 0x0, 0x0, 0x292404, 0x2a2404, 0x0, 0x2c2404, 0x0, 0x0, 0x2f2404,
+    0x0, 0x312404, 0x322404, 0x0, 0x342404, 0x0, 0x0, 0x372404, 0x382404, 0x0, 0x0, 0x3b2404, 0x0, 0x3d2404, 0x3e2404, 0x0,
+    0x0, 0x412404, 0x422404, 0x0, 0x442404, 0x0, 0x0, 0x472404, 0x482404, 0x0, 0x0, 0x4b2404, 0x0, 0x4d2404, 0x4e2404, 0x0,
+    0x502404, 0x0, 0x0, 0x532404, 0x0, 0x552404, 0x562404, 0x0, 0x0, 0x592404, 0x5a2404, 0x0, 0x5c2404, 0x0, 0x0, 0x5f2404,
+    0xff2404, 0x0, 0x0, 0xff2404, 0x0, 0xff2404, 0xff2404, 0x0, 0x0, 0xff2404, 0xff2404, 0x0, 0xff2404, 0x0, 0x0, 0xff2404,
+    0x0, 0xff2404, 0xff2404, 0x0, 0xff2404, 0x0, 0x0, 0xff2404, 0xff2404, 0x0, 0x0, 0xff2404, 0x0, 0xff2404, 0xff2404, 0x0,
+    0x0, 0x12404, 0x22404, 0x0, 0x42404, 0x0, 0x0, 0x72404, 0x82404, 0x0, 0x0, 0xb2404, 0x0, 0xd2404, 0xe2404, 0x0,
+    0x102404, 0x0, 0x0, 0x132404, 0x0, 0x152404, 0x162404, 0x0, 0x0, 0x192404, 0x1a2404, 0x0, 0x1c2404, 0x0, 0x0, 0x1f2404,
+    0x0, 0x212404, 0x222404, 0x0, 0x242404, 0x0, 0x0, 0x272404, 0x282404, 0x0, 0x0, 0x2b2404, 0x0, 0x2d2404, 0x2e2404, 0x0,
+    0x302404, 0x0, 0x0, 0x332404, 0x0, 0x352404, 0x362404, 0x0, 0x0, 0x392404, 0x3a2404, 0x0, 0x3c2404, 0x0, 0x0, 0x3f2404,
+    0x402404, 0x0, 0x0, 0x432404, 0x0, 0x452404, 0x462404, 0x0, 0x0, 0x492404, 0x4a2404, 0x0, 0x4c2404, 0x0, 0x0, 0x4f2404,
+    0x0, 0x512404, 0x522404, 0x0, 0x542404, 0x0, 0x0, 0x572404, 0x582404, 0x0, 0x0, 0x5b2404, 0x0, 0x5d2404, 0x5e2404, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2704, 0xff2704, 0x0, 0xff2704, 0x0, 0x0, 0xff2704, 0xff2704, 0x0, 0x0, 0xff2704, 0x0, 0xff2704, 0xff2704, 0x0,
+    0xff2704, 0x0, 0x0, 0xff2704, 0x0, 0xff2704, 0xff2704, 0x0, 0x0, 0xff2704, 0xff2704, 0x0, 0xff2704, 0x0, 0x0, 0xff2704,
+    0x2704, 0x0, 0x0, 0x32704, 0x0, 0x52704, 0x62704, 0x0, 0x0, 0x92704, 0xa2704, 0x0, 0xc2704, 0x0, 0x0, 0xf2704,
+    0x0, 0x112704, 0x122704, 0x0, 0x142704, 0x0, 0x0, 0x172704, 0x182704, 0x0, 0x0, 0x1b2704, 0x0, 0x1d2704, 0x1e2704, 0x0,
+    0x202704, 0x0, 0x0, 0x232704, 0x0, 0x252704, 0x262704, 0x0, 0x0, 0x292704, 0x2a2704, 0x0, 0x2c2704, 0x0, 0x0, 0x2f2704,
+    0x0, 0x312704, 0x322704, 0x0, 0x342704, 0x0, 0x0, 0x372704, 0x382704, 0x0, 0x0, 0x3b2704, 0x0, 0x3d2704, 0x3e2704, 0x0,
+    0x0, 0x412704, 0x422704, 0x0, 0x442704, 0x0, 0x0, 0x472704, 0x482704, 0x0, 0x0, 0x4b2704, 0x0, 0x4d2704, 0x4e2704, 0x0,
+    0x502704, 0x0, 0x0, 0x532704, 0x0, 0x552704, 0x562704, 0x0, 0x0, 0x592704, 0x5a2704, 0x0, 0x5c2704, 0x0, 0x0, 0x5f2704,
+    0xff2704, 0x0, 0x0, 0xff2704, 0x0, 0xff2704, 0xff2704, 0x0, 0x0, 0xff2704, 0xff2704, 0x0, 0xff2704, 0x0, 0x0, 0xff2704,
+    0x0, 0xff2704, 0xff2704, 0x0, 0xff2704, 0x0, 0x0, 0xff2704, 0xff2704, 0x0, 0x0, 0xff2704, 0x0, 0xff2704, 0xff2704, 0x0,
+    0x0, 0x12704, 0x22704, 0x0, 0x42704, 0x0, 0x0, 0x72704, 0x82704, 0x0, 0x0, 0xb2704, 0x0, 0xd2704, 0xe2704, 0x0,
+    0x102704, 0x0, 0x0, 0x132704, 0x0, 0x152704, 0x162704, 0x0, 0x0, 0x192704, 0x1a2704, 0x0, 0x1c2704, 0x0, 0x0, 0x1f2704,
+    0x0, 0x212704, 0x222704, 0x0, 0x242704, 0x0, 0x0, 0x272704, 0x282704, 0x0, 0x0, 0x2b2704, 0x0, 0x2d2704, 0x2e2704, 0x0,
+    0x302704, 0x0, 0x0, 0x332704, 0x0, 0x352704, 0x362704, 0x0, 0x0, 0x392704, 0x3a2704, 0x0, 0x3c2704, 0x0, 0x0, 0x3f2704,
+    0x402704, 0x0, 0x0, 0x432704, 0x0, 0x452704, 0x462704, 0x0, 0x0, 0x492704, 0x4a2704, 0x0, 0x4c2704, 0x0, 0x0, 0x4f2704,
+    0x0, 0x512704, 0x522704, 0x0, 0x542704, 0x0, 0x0, 0x572704, 0x582704, 0x0, 0x0, 0x5b2704, 0x0, 0x5d2704, 0x5e2704, 0x0,
+    0x0, 0xff2814, 0xff2814, 0x0, 0xff2814, 0x0, 0x0, 0xff2814, 0xff2814, 0x0, 0x0, 0xff2814, 0x0, 0xff2814, 0xff2814, 0x0,
+    0xff2814, 0x0, 0x0, 0xff2814, 0x0, 0xff2814, 0xff2814, 0x0, 0x0, 0xff2814, 0xff2814, 0x0, 0xff2814, 0x0, 0x0, 0xff2814,
+    0x2814, 0x0, 0x0, 0x32814, 0x0, 0x52814, 0x62814, 0x0, 0x0, 0x92814, 0xa2814, 0x0, 0xc2814, 0x0, 0x0, 0xf2814,
+    0x0, 0x112814, 0x122814, 0x0, 0x142814, 0x0, 0x0, 0x172814, 0x182814, 0x0, 0x0, 0x1b2814, 0x0, 0x1d2814, 0x1e2814, 0x0,
+    0x202814, 0x0, 0x0, 0x232814, 0x0, 0x252814, 0x262814, 0x0, 0x0, 0x292814, 0x2a2814, 0x0, 0x2c2814, 0x0, 0x0, 0x2f2814,
+    0x0, 0x312814, 0x322814, 0x0, 0x342814, 0x0, 0x0, 0x372814, 0x382814, 0x0, 0x0, 0x3b2814, 0x0, 0x3d2814, 0x3e2814, 0x0,
+    0x0, 0x412814, 0x422814, 0x0, 0x442814, 0x0, 0x0, 0x472814, 0x482814, 0x0, 0x0, 0x4b2814, 0x0, 0x4d2814, 0x4e2814, 0x0,
+    0x502814, 0x0, 0x0, 0x532814, 0x0, 0x552814, 0x562814, 0x0, 0x0, 0x592814, 0x5a2814, 0x0, 0x5c2814, 0x0, 0x0, 0x5f2814,
+    0xff2814, 0x0, 0x0, 0xff2814, 0x0, 0xff2814, 0xff2814, 0x0, 0x0, 0xff2814, 0xff2814, 0x0, 0xff2814, 0x0, 0x0, 0xff2814,
+    0x0, 0xff2814, 0xff2814, 0x0, 0xff2814, 0x0, 0x0, 0xff2814, 0xff2814, 0x0, 0x0, 0xff2814, 0x0, 0xff2814, 0xff2814, 0x0,
+    0x0, 0x12814, 0x22814, 0x0, 0x42814, 0x0, 0x0, 0x72814, 0x82814, 0x0, 0x0, 0xb2814, 0x0, 0xd2814, 0xe2814, 0x0,
+    0x102814, 0x0, 0x0, 0x132814, 0x0, 0x152814, 0x162814, 0x0, 0x0, 0x192814, 0x1a2814, 0x0, 0x1c2814, 0x0, 0x0, 0x1f2814,
+    0x0, 0x212814, 0x222814, 0x0, 0x242814, 0x0, 0x0, 0x272814, 0x282814, 0x0, 0x0, 0x2b2814, 0x0, 0x2d2814, 0x2e2814, 0x0,
+    0x302814, 0x0, 0x0, 0x332814, 0x0, 0x352814, 0x362814, 0x0, 0x0, 0x392814, 0x3a2814, 0x0, 0x3c2814, 0x0, 0x0, 0x3f2814,
+    0x402814, 0x0, 0x0, 0x432814, 0x0, 0x452814, 0x462814, 0x0, 0x0, 0x492814, 0x4a2814, 0x0, 0x4c2814, 0x0, 0x0, 0x4f2814,
+    0x0, 0x512814, 0x522814, 0x0, 0x542814, 0x0, 0x0, 0x572814, 0x582814, 0x0, 0x0, 0x5b2814, 0x0, 0x5d2814, 0x5e2814, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2b14, 0xff2b14, 0x0, 0xff2b14, 0x0, 0x0, 0xff2b14, 0xff2b14, 0x0, 0x0, 0xff2b14, 0x0, 0xff2b14, 0xff2b14, 0x0,
+    0xff2b14, 0x0, 0x0, 0xff2b14, 0x0, 0xff2b14, 0xff2b14, 0x0, 0x0, 0xff2b14, 0xff2b14, 0x0, 0xff2b14, 0x0, 0x0, 0xff2b14,
+    0x2b14, 0x0, 0x0, 0x32b14, 0x0, 0x52b14, 0x62b14, 0x0, 0x0, 0x92b14, 0xa2b14, 0x0, 0xc2b14, 0x0, 0x0, 0xf2b14,
+    0x0, 0x112b14, 0x122b14, 0x0, 0x142b14, 0x0, 0x0, 0x172b14, 0x182b14, 0x0, 0x0, 0x1b2b14, 0x0, 0x1d2b14, 0x1e2b14, 0x0,
+    0x202b14, 0x0, 0x0, 0x232b14, 0x0, 0x252b14, 0x262b14, 0x0, 0x0, 0x292b14, 0x2a2b14, 0x0, 0x2c2b14, 0x0, 0x0, 0x2f2b14,
+    0x0, 0x312b14, 0x322b14, 0x0, 0x342b14, 0x0, 0x0, 0x372b14, 0x382b14, 0x0, 0x0, 0x3b2b14, 0x0, 0x3d2b14, 0x3e2b14, 0x0,
+    0x0, 0x412b14, 0x422b14, 0x0, 0x442b14, 0x0, 0x0, 0x472b14, 0x482b14, 0x0, 0x0, 0x4b2b14, 0x0, 0x4d2b14, 0x4e2b14, 0x0,
+    0x502b14, 0x0, 0x0, 0x532b14, 0x0, 0x552b14, 0x562b14, 0x0, 0x0, 0x592b14, 0x5a2b14, 0x0, 0x5c2b14, 0x0, 0x0, 0x5f2b14,
+    0xff2b14, 0x0, 0x0, 0xff2b14, 0x0, 0xff2b14, 0xff2b14, 0x0, 0x0, 0xff2b14, 0xff2b14, 0x0, 0xff2b14, 0x0, 0x0, 0xff2b14,
+    0x0, 0xff2b14, 0xff2b14, 0x0, 0xff2b14, 0x0, 0x0, 0xff2b14, 0xff2b14, 0x0, 0x0, 0xff2b14, 0x0, 0xff2b14, 0xff2b14, 0x0,
+    0x0, 0x12b14, 0x22b14, 0x0, 0x42b14, 0x0, 0x0, 0x72b14, 0x82b14, 0x0, 0x0, 0xb2b14, 0x0, 0xd2b14, 0xe2b14, 0x0,
+    0x102b14, 0x0, 0x0, 0x132b14, 0x0, 0x152b14, 0x162b14, 0x0, 0x0, 0x192b14, 0x1a2b14, 0x0, 0x1c2b14, 0x0, 0x0, 0x1f2b14,
+    0x0, 0x212b14, 0x222b14, 0x0, 0x242b14, 0x0, 0x0, 0x272b14, 0x282b14, 0x0, 0x0, 0x2b2b14, 0x0, 0x2d2b14, 0x2e2b14, 0x0,
+    0x302b14, 0x0, 0x0, 0x332b14, 0x0, 0x352b14, 0x362b14, 0x0, 0x0, 0x392b14, 0x3a2b14, 0x0, 0x3c2b14, 0x0, 0x0, 0x3f2b14,
+    0x402b14, 0x0, 0x0, 0x432b14, 0x0, 0x452b14, 0x462b14, 0x0, 0x0, 0x492b14, 0x4a2b14, 0x0, 0x4c2b14, 0x0, 0x0, 0x4f2b14,
+    0x0, 0x512b14, 0x522b14, 0x0, 0x542b14, 0x0, 0x0, 0x572b14, 0x582b14, 0x0, 0x0, 0x5b2b14, 0x0, 0x5d2b14, 0x5e2b14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff2d14, 0xff2d14, 0x0, 0xff2d14, 0x0, 0x0, 0xff2d14, 0xff2d14, 0x0, 0x0, 0xff2d14, 0x0, 0xff2d14, 0xff2d14, 0x0,
+    0xff2d14, 0x0, 0x0, 0xff2d14, 0x0, 0xff2d14, 0xff2d14, 0x0, 0x0, 0xff2d14, 0xff2d14, 0x0, 0xff2d14, 0x0, 0x0, 0xff2d14,
+    0x2d14, 0x0, 0x0, 0x32d14, 0x0, 0x52d14, 0x62d14, 0x0, 0x0, 0x92d14, 0xa2d14, 0x0, 0xc2d14, 0x0, 0x0, 0xf2d14,
+    0x0, 0x112d14, 0x122d14, 0x0, 0x142d14, 0x0, 0x0, 0x172d14, 0x182d14, 0x0, 0x0, 0x1b2d14, 0x0, 0x1d2d14, 0x1e2d14, 0x0,
+    0x202d14, 0x0, 0x0, 0x232d14, 0x0, 0x252d14, 0x262d14, 0x0, 0x0, 0x292d14, 0x2a2d14, 0x0, 0x2c2d14, 0x0, 0x0, 0x2f2d14,
+    0x0, 0x312d14, 0x322d14, 0x0, 0x342d14, 0x0, 0x0, 0x372d14, 0x382d14, 0x0, 0x0, 0x3b2d14, 0x0, 0x3d2d14, 0x3e2d14, 0x0,
+    0x0, 0x412d14, 0x422d14, 0x0, 0x442d14, 0x0, 0x0, 0x472d14, 0x482d14, 0x0, 0x0, 0x4b2d14, 0x0, 0x4d2d14, 0x4e2d14, 0x0,
+    0x502d14, 0x0, 0x0, 0x532d14, 0x0, 0x552d14, 0x562d14, 0x0, 0x0, 0x592d14, 0x5a2d14, 0x0, 0x5c2d14, 0x0, 0x0, 0x5f2d14,
+    0xff2d14, 0x0, 0x0, 0xff2d14, 0x0, 0xff2d14, 0xff2d14, 0x0, 0x0, 0xff2d14, 0xff2d14, 0x0, 0xff2d14, 0x0, 0x0, 0xff2d14,
+    0x0, 0xff2d14, 0xff2d14, 0x0, 0xff2d14, 0x0, 0x0, 0xff2d14, 0xff2d14, 0x0, 0x0, 0xff2d14, 0x0, 0xff2d14, 0xff2d14, 0x0,
+    0x0, 0x12d14, 0x22d14, 0x0, 0x42d14, 0x0, 0x0, 0x72d14, 0x82d14, 0x0, 0x0, 0xb2d14, 0x0, 0xd2d14, 0xe2d14, 0x0,
+    0x102d14, 0x0, 0x0, 0x132d14, 0x0, 0x152d14, 0x162d14, 0x0, 0x0, 0x192d14, 0x1a2d14, 0x0, 0x1c2d14, 0x0, 0x0, 0x1f2d14,
+    0x0, 0x212d14, 0x222d14, 0x0, 0x242d14, 0x0, 0x0, 0x272d14, 0x282d14, 0x0, 0x0, 0x2b2d14, 0x0, 0x2d2d14, 0x2e2d14, 0x0,
+    0x302d14, 0x0, 0x0, 0x332d14, 0x0, 0x352d14, 0x362d14, 0x0, 0x0, 0x392d14, 0x3a2d14, 0x0, 0x3c2d14, 0x0, 0x0, 0x3f2d14,
+    0x402d14, 0x0, 0x0, 0x432d14, 0x0, 0x452d14, 0x462d14, 0x0, 0x0, 0x492d14, 0x4a2d14, 0x0, 0x4c2d14, 0x0, 0x0, 0x4f2d14,
+    0x0, 0x512d14, 0x522d14, 0x0, 0x542d14, 0x0, 0x0, 0x572d14, 0x582d14, 0x0, 0x0, 0x5b2d14, 0x0, 0x5d2d14, 0x5e2d14, 0x0,
+    0x0, 0xff2e14, 0xff2e14, 0x0, 0xff2e14, 0x0, 0x0, 0xff2e14, 0xff2e14, 0x0, 0x0, 0xff2e14, 0x0, 0xff2e14, 0xff2e14, 0x0,
+    0xff2e14, 0x0, 0x0, 0xff2e14, 0x0, 0xff2e14, 0xff2e14, 0x0, 0x0, 0xff2e14, 0xff2e14, 0x0, 0xff2e14, 0x0, 0x0, 0xff2e14,
+    0x2e14, 0x0, 0x0, 0x32e14, 0x0, 0x52e14, 0x62e14, 0x0, 0x0, 0x92e14, 0xa2e14, 0x0, 0xc2e14, 0x0, 0x0, 0xf2e14,
+    0x0, 0x112e14, 0x122e14, 0x0, 0x142e14, 0x0, 0x0, 0x172e14, 0x182e14, 0x0, 0x0, 0x1b2e14, 0x0, 0x1d2e14, 0x1e2e14, 0x0,
+    0x202e14, 0x0, 0x0, 0x232e14, 0x0, 0x252e14, 0x262e14, 0x0, 0x0, 0x292e14, 0x2a2e14, 0x0, 0x2c2e14, 0x0, 0x0, 0x2f2e14,
+    0x0, 0x312e14, 0x322e14, 0x0, 0x342e14, 0x0, 0x0, 0x372e14, 0x382e14, 0x0, 0x0, 0x3b2e14, 0x0, 0x3d2e14, 0x3e2e14, 0x0,
+    0x0, 0x412e14, 0x422e14, 0x0, 0x442e14, 0x0, 0x0, 0x472e14, 0x482e14, 0x0, 0x0, 0x4b2e14, 0x0, 0x4d2e14, 0x4e2e14, 0x0,
+    0x502e14, 0x0, 0x0, 0x532e14, 0x0, 0x552e14, 0x562e14, 0x0, 0x0, 0x592e14, 0x5a2e14, 0x0, 0x5c2e14, 0x0, 0x0, 0x5f2e14,
+    0xff2e14, 0x0, 0x0, 0xff2e14, 0x0, 0xff2e14, 0xff2e14, 0x0, 0x0, 0xff2e14, 0xff2e14, 0x0, 0xff2e14, 0x0, 0x0, 0xff2e14,
+    0x0, 0xff2e14, 0xff2e14, 0x0, 0xff2e14, 0x0, 0x0, 0xff2e14, 0xff2e14, 0x0, 0x0, 0xff2e14, 0x0, 0xff2e14, 0xff2e14, 0x0,
+    0x0, 0x12e14, 0x22e14, 0x0, 0x42e14, 0x0, 0x0, 0x72e14, 0x82e14, 0x0, 0x0, 0xb2e14, 0x0, 0xd2e14, 0xe2e14, 0x0,
+    0x102e14, 0x0, 0x0, 0x132e14, 0x0, 0x152e14, 0x162e14, 0x0, 0x0, 0x192e14, 0x1a2e14, 0x0, 0x1c2e14, 0x0, 0x0, 0x1f2e14,
+    0x0, 0x212e14, 0x222e14, 0x0, 0x242e14, 0x0, 0x0, 0x272e14, 0x282e14, 0x0, 0x0, 0x2b2e14, 0x0, 0x2d2e14, 0x2e2e14, 0x0,
+    0x302e14, 0x0, 0x0, 0x332e14, 0x0, 0x352e14, 0x362e14, 0x0, 0x0, 0x392e14, 0x3a2e14, 0x0, 0x3c2e14, 0x0, 0x0, 0x3f2e14,
+    0x402e14, 0x0, 0x0, 0x432e14, 0x0, 0x452e14, 0x462e14, 0x0, 0x0, 0x492e14, 0x4a2e14, 0x0, 0x4c2e14, 0x0, 0x0, 0x4f2e14,
+    0x0, 0x512e14, 0x522e14, 0x0, 0x542e14, 0x0, 0x0, 0x572e14, 0x582e14, 0x0, 0x0, 0x5b2e14, 0x0, 0x5d2e14, 0x5e2e14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3004, 0xff3004, 0x0, 0xff3004, 0x0, 0x0, 0xff3004, 0xff3004, 0x0, 0x0, 0xff3004, 0x0, 0xff3004, 0xff3004, 0x0,
+    0xff3004, 0x0, 0x0, 0xff3004, 0x0, 0xff3004, 0xff3004, 0x0, 0x0, 0xff3004, 0xff3004, 0x0, 0xff3004, 0x0, 0x0, 0xff3004,
+    0x3004, 0x0, 0x0, 0x33004, 0x0, 0x53004, 0x63004, 0x0, 0x0, 0x93004, 0xa3004, 0x0, 0xc3004, 0x0, 0x0, 0xf3004,
+    0x0, 0x113004, 0x123004, 0x0, 0x143004, 0x0, 0x0, 0x173004, 0x183004, 0x0, 0x0, 0x1b3004, 0x0, 0x1d3004, 0x1e3004, 0x0,
+    0x203004, 0x0, 0x0, 0x233004, 0x0, 0x253004, 0x263004, 0x0, 0x0, 0x293004, 0x2a3004, 0x0, 0x2c3004, 0x0, 0x0, 0x2f3004,
+    0x0, 0x313004, 0x323004, 0x0, 0x343004, 0x0, 0x0, 0x373004, 0x383004, 0x0, 0x0, 0x3b3004, 0x0, 0x3d3004, 0x3e3004, 0x0,
+    0x0, 0x413004, 0x423004, 0x0, 0x443004, 0x0, 0x0, 0x473004, 0x483004, 0x0, 0x0, 0x4b3004, 0x0, 0x4d3004, 0x4e3004, 0x0,
+    0x503004, 0x0, 0x0, 0x533004, 0x0, 0x553004, 0x563004, 0x0, 0x0, 0x593004, 0x5a3004, 0x0, 0x5c3004, 0x0, 0x0, 0x5f3004,
+    0xff3004, 0x0, 0x0, 0xff3004, 0x0, 0xff3004, 0xff3004, 0x0, 0x0, 0xff3004, 0xff3004, 0x0, 0xff3004, 0x0, 0x0, 0xff3004,
+    0x0, 0xff3004, 0xff3004, 0x0, 0xff3004, 0x0, 0x0, 0xff3004, 0xff3004, 0x0, 0x0, 0xff3004, 0x0, 0xff3004, 0xff3004, 0x0,
+    0x0, 0x13004, 0x23004, 0x0, 0x43004, 0x0, 0x0, 0x73004, 0x83004, 0x0, 0x0, 0xb3004, 0x0, 0xd3004, 0xe3004, 0x0,
+    0x103004, 0x0, 0x0, 0x133004, 0x0, 0x153004, 0x163004, 0x0, 0x0, 0x193004, 0x1a3004, 0x0, 0x1c3004, 0x0, 0x0, 0x1f3004,
+    0x0, 0x213004, 0x223004, 0x0, 0x243004, 0x0, 0x0, 0x273004, 0x283004, 0x0, 0x0, 0x2b3004, 0x0, 0x2d3004, 0x2e3004, 0x0,
+    0x303004, 0x0, 0x0, 0x333004, 0x0, 0x353004, 0x363004, 0x0, 0x0, 0x393004, 0x3a3004, 0x0, 0x3c3004, 0x0, 0x0, 0x3f3004,
+    0x403004, 0x0, 0x0, 0x433004, 0x0, 0x453004, 0x463004, 0x0, 0x0, 0x493004, 0x4a3004, 0x0, 0x4c3004, 0x0, 0x0, 0x4f3004,
+    0x0, 0x513004, 0x523004, 0x0, 0x543004, 0x0, 0x0, 0x573004, 0x583004, 0x0, 0x0, 0x5b3004, 0x0, 0x5d3004, 0x5e3004, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3304, 0xff3304, 0x0, 0xff3304, 0x0, 0x0, 0xff3304, 0xff3304, 0x0, 0x0, 0xff3304, 0x0, 0xff3304, 0xff3304, 0x0,
+    0xff3304, 0x0, 0x0, 0xff3304, 0x0, 0xff3304, 0xff3304, 0x0, 0x0, 0xff3304, 0xff3304, 0x0, 0xff3304, 0x0, 0x0, 0xff3304,
+    0x3304, 0x0, 0x0, 0x33304, 0x0, 0x53304, 0x63304, 0x0, 0x0, 0x93304, 0xa3304, 0x0, 0xc3304, 0x0, 0x0, 0xf3304,
+    0x0, 0x113304, 0x123304, 0x0, 0x143304, 0x0, 0x0, 0x173304, 0x183304, 0x0, 0x0, 0x1b3304, 0x0, 0x1d3304, 0x1e3304, 0x0,
+    0x203304, 0x0, 0x0, 0x233304, 0x0, 0x253304, 0x263304, 0x0, 0x0, 0x293304, 0x2a3304, 0x0, 0x2c3304, 0x0, 0x0, 0x2f3304,
+    0x0, 0x313304, 0x323304, 0x0, 0x343304, 0x0, 0x0, 0x373304, 0x383304, 0x0, 0x0, 0x3b3304, 0x0, 0x3d3304, 0x3e3304, 0x0,
+    0x0, 0x413304, 0x423304, 0x0, 0x443304, 0x0, 0x0, 0x473304, 0x483304, 0x0, 0x0, 0x4b3304, 0x0, 0x4d3304, 0x4e3304, 0x0,
+    0x503304, 0x0, 0x0, 0x533304, 0x0, 0x553304, 0x563304, 0x0, 0x0, 0x593304, 0x5a3304, 0x0, 0x5c3304, 0x0, 0x0, 0x5f3304,
+    0xff3304, 0x0, 0x0, 0xff3304, 0x0, 0xff3304, 0xff3304, 0x0, 0x0, 0xff3304, 0xff3304, 0x0, 0xff3304, 0x0, 0x0, 0xff3304,
+    0x0, 0xff3304, 0xff3304, 0x0, 0xff3304, 0x0, 0x0, 0xff3304, 0xff3304, 0x0, 0x0, 0xff3304, 0x0, 0xff3304, 0xff3304, 0x0,
+    0x0, 0x13304, 0x23304, 0x0, 0x43304, 0x0, 0x0, 0x73304, 0x83304, 0x0, 0x0, 0xb3304, 0x0, 0xd3304, 0xe3304, 0x0,
+    0x103304, 0x0, 0x0, 0x133304, 0x0, 0x153304, 0x163304, 0x0, 0x0, 0x193304, 0x1a3304, 0x0, 0x1c3304, 0x0, 0x0, 0x1f3304,
+    0x0, 0x213304, 0x223304, 0x0, 0x243304, 0x0, 0x0, 0x273304, 0x283304, 0x0, 0x0, 0x2b3304, 0x0, 0x2d3304, 0x2e3304, 0x0,
+    0x303304, 0x0, 0x0, 0x333304, 0x0, 0x353304, 0x363304, 0x0, 0x0, 0x393304, 0x3a3304, 0x0, 0x3c3304, 0x0, 0x0, 0x3f3304,
+    0x403304, 0x0, 0x0, 0x433304, 0x0, 0x453304, 0x463304, 0x0, 0x0, 0x493304, 0x4a3304, 0x0, 0x4c3304, 0x0, 0x0, 0x4f3304,
+    0x0, 0x513304, 0x523304, 0x0, 0x543304, 0x0, 0x0, 0x573304, 0x583304, 0x0, 0x0, 0x5b3304, 0x0, 0x5d3304, 0x5e3304, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3504, 0xff3504, 0x0, 0xff3504, 0x0, 0x0, 0xff3504, 0xff3504, 0x0, 0x0, 0xff3504, 0x0, 0xff3504, 0xff3504, 0x0,
+    0xff3504, 0x0, 0x0, 0xff3504, 0x0, 0xff3504, 0xff3504, 0x0, 0x0, 0xff3504, 0xff3504, 0x0, 0xff3504, 0x0, 0x0, 0xff3504,
+    0x3504, 0x0, 0x0, 0x33504, 0x0, 0x53504, 0x63504, 0x0, 0x0, 0x93504, 0xa3504, 0x0, 0xc3504, 0x0, 0x0, 0xf3504,
+    0x0, 0x113504, 0x123504, 0x0, 0x143504, 0x0, 0x0, 0x173504, 0x183504, 0x0, 0x0, 0x1b3504, 0x0, 0x1d3504, 0x1e3504, 0x0,
+    0x203504, 0x0, 0x0, 0x233504, 0x0, 0x253504, 0x263504, 0x0, 0x0, 0x293504, 0x2a3504, 0x0, 0x2c3504, 0x0, 0x0, 0x2f3504,
+    0x0, 0x313504, 0x323504, 0x0, 0x343504, 0x0, 0x0, 0x373504, 0x383504, 0x0, 0x0, 0x3b3504, 0x0, 0x3d3504, 0x3e3504, 0x0,
+    0x0, 0x413504, 0x423504, 0x0, 0x443504, 0x0, 0x0, 0x473504, 0x483504, 0x0, 0x0, 0x4b3504, 0x0, 0x4d3504, 0x4e3504, 0x0,
+    0x503504, 0x0, 0x0, 0x533504, 0x0, 0x553504, 0x563504, 0x0, 0x0, 0x593504, 0x5a3504, 0x0, 0x5c3504, 0x0, 0x0, 0x5f3504,
+    0xff3504, 0x0, 0x0, 0xff3504, 0x0, 0xff3504, 0xff3504, 0x0, 0x0, 0xff3504, 0xff3504, 0x0, 0xff3504, 0x0, 0x0, 0xff3504,
+    0x0, 0xff3504, 0xff3504, 0x0, 0xff3504, 0x0, 0x0, 0xff3504, 0xff3504, 0x0, 0x0, 0xff3504, 0x0, 0xff3504, 0xff3504, 0x0,
+    0x0, 0x13504, 0x23504, 0x0, 0x43504, 0x0, 0x0, 0x73504, 0x83504, 0x0, 0x0, 0xb3504, 0x0, 0xd3504, 0xe3504, 0x0,
+    0x103504, 0x0, 0x0, 0x133504, 0x0, 0x153504, 0x163504, 0x0, 0x0, 0x193504, 0x1a3504, 0x0, 0x1c3504, 0x0, 0x0, 0x1f3504,
+    0x0, 0x213504, 0x223504, 0x0, 0x243504, 0x0, 0x0, 0x273504, 0x283504, 0x0, 0x0, 0x2b3504, 0x0, 0x2d3504, 0x2e3504, 0x0,
+    0x303504, 0x0, 0x0, 0x333504, 0x0, 0x353504, 0x363504, 0x0, 0x0, 0x393504, 0x3a3504, 0x0, 0x3c3504, 0x0, 0x0, 0x3f3504,
+    0x403504, 0x0, 0x0, 0x433504, 0x0, 0x453504, 0x463504, 0x0, 0x0, 0x493504, 0x4a3504, 0x0, 0x4c3504, 0x0, 0x0, 0x4f3504,
+    0x0, 0x513504, 0x523504, 0x0, 0x543504, 0x0, 0x0, 0x573504, 0x583504, 0x0, 0x0, 0x5b3504, 0x0, 0x5d3504, 0x5e3504, 0x0,
+    0x0, 0xff3604, 0xff3604, 0x0, 0xff3604, 0x0, 0x0, 0xff3604, 0xff3604, 0x0, 0x0, 0xff3604, 0x0, 0xff3604, 0xff3604, 0x0,
+    0xff3604, 0x0, 0x0, 0xff3604, 0x0, 0xff3604, 0xff3604, 0x0, 0x0, 0xff3604, 0xff3604, 0x0, 0xff3604, 0x0, 0x0, 0xff3604,
+    0x3604, 0x0, 0x0, 0x33604, 0x0, 0x53604, 0x63604, 0x0, 0x0, 0x93604, 0xa3604, 0x0, 0xc3604, 0x0, 0x0, 0xf3604,
+    0x0, 0x113604, 0x123604, 0x0, 0x143604, 0x0, 0x0, 0x173604, 0x183604, 0x0, 0x0, 0x1b3604, 0x0, 0x1d3604, 0x1e3604, 0x0,
+    0x203604, 0x0, 0x0, 0x233604, 0x0, 0x253604, 0x263604, 0x0, 0x0, 0x293604, 0x2a3604, 0x0, 0x2c3604, 0x0, 0x0, 0x2f3604,
+    0x0, 0x313604, 0x323604, 0x0, 0x343604, 0x0, 0x0, 0x373604, 0x383604, 0x0, 0x0, 0x3b3604, 0x0, 0x3d3604, 0x3e3604, 0x0,
+    0x0, 0x413604, 0x423604, 0x0, 0x443604, 0x0, 0x0, 0x473604, 0x483604, 0x0, 0x0, 0x4b3604, 0x0, 0x4d3604, 0x4e3604, 0x0,
+    0x503604, 0x0, 0x0, 0x533604, 0x0, 0x553604, 0x563604, 0x0, 0x0, 0x593604, 0x5a3604, 0x0, 0x5c3604, 0x0, 0x0, 0x5f3604,
+    0xff3604, 0x0, 0x0, 0xff3604, 0x0, 0xff3604, 0xff3604, 0x0, 0x0, 0xff3604, 0xff3604, 0x0, 0xff3604, 0x0, 0x0, 0xff3604,
+    0x0, 0xff3604, 0xff3604, 0x0, 0xff3604, 0x0, 0x0, 0xff3604, 0xff3604, 0x0, 0x0, 0xff3604, 0x0, 0xff3604, 0xff3604, 0x0,
+    0x0, 0x13604, 0x23604, 0x0, 0x43604, 0x0, 0x0, 0x73604, 0x83604, 0x0, 0x0, 0xb3604, 0x0, 0xd3604, 0xe3604, 0x0,
+    0x103604, 0x0, 0x0, 0x133604, 0x0, 0x153604, 0x163604, 0x0, 0x0, 0x193604, 0x1a3604, 0x0, 0x1c3604, 0x0, 0x0, 0x1f3604,
+    0x0, 0x213604, 0x223604, 0x0, 0x243604, 0x0, 0x0, 0x273604, 0x283604, 0x0, 0x0, 0x2b3604, 0x0, 0x2d3604, 0x2e3604, 0x0,
+    0x303604, 0x0, 0x0, 0x333604, 0x0, 0x353604, 0x363604, 0x0, 0x0, 0x393604, 0x3a3604, 0x0, 0x3c3604, 0x0, 0x0, 0x3f3604,
+    0x403604, 0x0, 0x0, 0x433604, 0x0, 0x453604, 0x463604, 0x0, 0x0, 0x493604, 0x4a3604, 0x0, 0x4c3604, 0x0, 0x0, 0x4f3604,
+    0x0, 0x513604, 0x523604, 0x0, 0x543604, 0x0, 0x0, 0x573604, 0x583604, 0x0, 0x0, 0x5b3604, 0x0, 0x5d3604, 0x5e3604, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3914, 0xff3914, 0x0, 0xff3914, 0x0, 0x0, 0xff3914, 0xff3914, 0x0, 0x0, 0xff3914, 0x0, 0xff3914, 0xff3914, 0x0,
+    0xff3914, 0x0, 0x0, 0xff3914, 0x0, 0xff3914, 0xff3914, 0x0, 0x0, 0xff3914, 0xff3914, 0x0, 0xff3914, 0x0, 0x0, 0xff3914,
+    0x3914, 0x0, 0x0, 0x33914, 0x0, 0x53914, 0x63914, 0x0, 0x0, 0x93914, 0xa3914, 0x0, 0xc3914, 0x0, 0x0, 0xf3914,
+    0x0, 0x113914, 0x123914, 0x0, 0x143914, 0x0, 0x0, 0x173914, 0x183914, 0x0, 0x0, 0x1b3914, 0x0, 0x1d3914, 0x1e3914, 0x0,
+    0x203914, 0x0, 0x0, 0x233914, 0x0, 0x253914, 0x263914, 0x0, 0x0, 0x293914, 0x2a3914, 0x0, 0x2c3914, 0x0, 0x0, 0x2f3914,
+    0x0, 0x313914, 0x323914, 0x0, 0x343914, 0x0, 0x0, 0x373914, 0x383914, 0x0, 0x0, 0x3b3914, 0x0, 0x3d3914, 0x3e3914, 0x0,
+    0x0, 0x413914, 0x423914, 0x0, 0x443914, 0x0, 0x0, 0x473914, 0x483914, 0x0, 0x0, 0x4b3914, 0x0, 0x4d3914, 0x4e3914, 0x0,
+    0x503914, 0x0, 0x0, 0x533914, 0x0, 0x553914, 0x563914, 0x0, 0x0, 0x593914, 0x5a3914, 0x0, 0x5c3914, 0x0, 0x0, 0x5f3914,
+    0xff3914, 0x0, 0x0, 0xff3914, 0x0, 0xff3914, 0xff3914, 0x0, 0x0, 0xff3914, 0xff3914, 0x0, 0xff3914, 0x0, 0x0, 0xff3914,
+    0x0, 0xff3914, 0xff3914, 0x0, 0xff3914, 0x0, 0x0, 0xff3914, 0xff3914, 0x0, 0x0, 0xff3914, 0x0, 0xff3914, 0xff3914, 0x0,
+    0x0, 0x13914, 0x23914, 0x0, 0x43914, 0x0, 0x0, 0x73914, 0x83914, 0x0, 0x0, 0xb3914, 0x0, 0xd3914, 0xe3914, 0x0,
+    0x103914, 0x0, 0x0, 0x133914, 0x0, 0x153914, 0x163914, 0x0, 0x0, 0x193914, 0x1a3914, 0x0, 0x1c3914, 0x0, 0x0, 0x1f3914,
+    0x0, 0x213914, 0x223914, 0x0, 0x243914, 0x0, 0x0, 0x273914, 0x283914, 0x0, 0x0, 0x2b3914, 0x0, 0x2d3914, 0x2e3914, 0x0,
+    0x303914, 0x0, 0x0, 0x333914, 0x0, 0x353914, 0x363914, 0x0, 0x0, 0x393914, 0x3a3914, 0x0, 0x3c3914, 0x0, 0x0, 0x3f3914,
+    0x403914, 0x0, 0x0, 0x433914, 0x0, 0x453914, 0x463914, 0x0, 0x0, 0x493914, 0x4a3914, 0x0, 0x4c3914, 0x0, 0x0, 0x4f3914,
+    0x0, 0x513914, 0x523914, 0x0, 0x543914, 0x0, 0x0, 0x573914, 0x583914, 0x0, 0x0, 0x5b3914, 0x0, 0x5d3914, 0x5e3914, 0x0,
+    0x0, 0xff3a14, 0xff3a14, 0x0, 0xff3a14, 0x0, 0x0, 0xff3a14, 0xff3a14, 0x0, 0x0, 0xff3a14, 0x0, 0xff3a14, 0xff3a14, 0x0,
+    0xff3a14, 0x0, 0x0, 0xff3a14, 0x0, 0xff3a14, 0xff3a14, 0x0, 0x0, 0xff3a14, 0xff3a14, 0x0, 0xff3a14, 0x0, 0x0, 0xff3a14,
+    0x3a14, 0x0, 0x0, 0x33a14, 0x0, 0x53a14, 0x63a14, 0x0, 0x0, 0x93a14, 0xa3a14, 0x0, 0xc3a14, 0x0, 0x0, 0xf3a14,
+    0x0, 0x113a14, 0x123a14, 0x0, 0x143a14, 0x0, 0x0, 0x173a14, 0x183a14, 0x0, 0x0, 0x1b3a14, 0x0, 0x1d3a14, 0x1e3a14, 0x0,
+    0x203a14, 0x0, 0x0, 0x233a14, 0x0, 0x253a14, 0x263a14, 0x0, 0x0, 0x293a14, 0x2a3a14, 0x0, 0x2c3a14, 0x0, 0x0, 0x2f3a14,
+    0x0, 0x313a14, 0x323a14, 0x0, 0x343a14, 0x0, 0x0, 0x373a14, 0x383a14, 0x0, 0x0, 0x3b3a14, 0x0, 0x3d3a14, 0x3e3a14, 0x0,
+    0x0, 0x413a14, 0x423a14, 0x0, 0x443a14, 0x0, 0x0, 0x473a14, 0x483a14, 0x0, 0x0, 0x4b3a14, 0x0, 0x4d3a14, 0x4e3a14, 0x0,
+    0x503a14, 0x0, 0x0, 0x533a14, 0x0, 0x553a14, 0x563a14, 0x0, 0x0, 0x593a14, 0x5a3a14, 0x0, 0x5c3a14, 0x0, 0x0, 0x5f3a14,
+    0xff3a14, 0x0, 0x0, 0xff3a14, 0x0, 0xff3a14, 0xff3a14, 0x0, 0x0, 0xff3a14, 0xff3a14, 0x0, 0xff3a14, 0x0, 0x0, 0xff3a14,
+    0x0, 0xff3a14, 0xff3a14, 0x0, 0xff3a14, 0x0, 0x0, 0xff3a14, 0xff3a14, 0x0, 0x0, 0xff3a14, 0x0, 0xff3a14, 0xff3a14, 0x0,
+    0x0, 0x13a14, 0x23a14, 0x0, 0x43a14, 0x0, 0x0, 0x73a14, 0x83a14, 0x0, 0x0, 0xb3a14, 0x0, 0xd3a14, 0xe3a14, 0x0,
+    0x103a14, 0x0, 0x0, 0x133a14, 0x0, 0x153a14, 0x163a14, 0x0, 0x0, 0x193a14, 0x1a3a14, 0x0, 0x1c3a14, 0x0, 0x0, 0x1f3a14,
+    0x0, 0x213a14, 0x223a14, 0x0, 0x243a14, 0x0, 0x0, 0x273a14, 0x283a14, 0x0, 0x0, 0x2b3a14, 0x0, 0x2d3a14, 0x2e3a14, 0x0,
+    0x303a14, 0x0, 0x0, 0x333a14, 0x0, 0x353a14, 0x363a14, 0x0, 0x0, 0x393a14, 0x3a3a14, 0x0, 0x3c3a14, 0x0, 0x0, 0x3f3a14,
+    0x403a14, 0x0, 0x0, 0x433a14, 0x0, 0x453a14, 0x463a14, 0x0, 0x0, 0x493a14, 0x4a3a14, 0x0, 0x4c3a14, 0x0, 0x0, 0x4f3a14,
+    0x0, 0x513a14, 0x523a14, 0x0, 0x543a14, 0x0, 0x0, 0x573a14, 0x583a14, 0x0, 0x0, 0x5b3a14, 0x0, 0x5d3a14, 0x5e3a14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3c14, 0xff3c14, 0x0, 0xff3c14, 0x0, 0x0, 0xff3c14, 0xff3c14, 0x0, 0x0, 0xff3c14, 0x0, 0xff3c14, 0xff3c14, 0x0,
+    0xff3c14, 0x0, 0x0, 0xff3c14, 0x0, 0xff3c14, 0xff3c14, 0x0, 0x0, 0xff3c14, 0xff3c14, 0x0, 0xff3c14, 0x0, 0x0, 0xff3c14,
+    0x3c14, 0x0, 0x0, 0x33c14, 0x0, 0x53c14, 0x63c14, 0x0, 0x0, 0x93c14, 0xa3c14, 0x0, 0xc3c14, 0x0, 0x0, 0xf3c14,
+    0x0, 0x113c14, 0x123c14, 0x0, 0x143c14, 0x0, 0x0, 0x173c14, 0x183c14, 0x0, 0x0, 0x1b3c14, 0x0, 0x1d3c14, 0x1e3c14, 0x0,
+    0x203c14, 0x0, 0x0, 0x233c14, 0x0, 0x253c14, 0x263c14, 0x0, 0x0, 0x293c14, 0x2a3c14, 0x0, 0x2c3c14, 0x0, 0x0, 0x2f3c14,
+    0x0, 0x313c14, 0x323c14, 0x0, 0x343c14, 0x0, 0x0, 0x373c14, 0x383c14, 0x0, 0x0, 0x3b3c14, 0x0, 0x3d3c14, 0x3e3c14, 0x0,
+    0x0, 0x413c14, 0x423c14, 0x0, 0x443c14, 0x0, 0x0, 0x473c14, 0x483c14, 0x0, 0x0, 0x4b3c14, 0x0, 0x4d3c14, 0x4e3c14, 0x0,
+    0x503c14, 0x0, 0x0, 0x533c14, 0x0, 0x553c14, 0x563c14, 0x0, 0x0, 0x593c14, 0x5a3c14, 0x0, 0x5c3c14, 0x0, 0x0, 0x5f3c14,
+    0xff3c14, 0x0, 0x0, 0xff3c14, 0x0, 0xff3c14, 0xff3c14, 0x0, 0x0, 0xff3c14, 0xff3c14, 0x0, 0xff3c14, 0x0, 0x0, 0xff3c14,
+    0x0, 0xff3c14, 0xff3c14, 0x0, 0xff3c14, 0x0, 0x0, 0xff3c14, 0xff3c14, 0x0, 0x0, 0xff3c14, 0x0, 0xff3c14, 0xff3c14, 0x0,
+    0x0, 0x13c14, 0x23c14, 0x0, 0x43c14, 0x0, 0x0, 0x73c14, 0x83c14, 0x0, 0x0, 0xb3c14, 0x0, 0xd3c14, 0xe3c14, 0x0,
+    0x103c14, 0x0, 0x0, 0x133c14, 0x0, 0x153c14, 0x163c14, 0x0, 0x0, 0x193c14, 0x1a3c14, 0x0, 0x1c3c14, 0x0, 0x0, 0x1f3c14,
+    0x0, 0x213c14, 0x223c14, 0x0, 0x243c14, 0x0, 0x0, 0x273c14, 0x283c14, 0x0, 0x0, 0x2b3c14, 0x0, 0x2d3c14, 0x2e3c14, 0x0,
+    0x303c14, 0x0, 0x0, 0x333c14, 0x0, 0x353c14, 0x363c14, 0x0, 0x0, 0x393c14, 0x3a3c14, 0x0, 0x3c3c14, 0x0, 0x0, 0x3f3c14,
+    0x403c14, 0x0, 0x0, 0x433c14, 0x0, 0x453c14, 0x463c14, 0x0, 0x0, 0x493c14, 0x4a3c14, 0x0, 0x4c3c14, 0x0, 0x0, 0x4f3c14,
+    0x0, 0x513c14, 0x523c14, 0x0, 0x543c14, 0x0, 0x0, 0x573c14, 0x583c14, 0x0, 0x0, 0x5b3c14, 0x0, 0x5d3c14, 0x5e3c14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff3f14, 0xff3f14, 0x0, 0xff3f14, 0x0, 0x0, 0xff3f14, 0xff3f14, 0x0, 0x0, 0xff3f14, 0x0, 0xff3f14, 0xff3f14, 0x0,
+    0xff3f14, 0x0, 0x0, 0xff3f14, 0x0, 0xff3f14, 0xff3f14, 0x0, 0x0, 0xff3f14, 0xff3f14, 0x0, 0xff3f14, 0x0, 0x0, 0xff3f14,
+    0x3f14, 0x0, 0x0, 0x33f14, 0x0, 0x53f14, 0x63f14, 0x0, 0x0, 0x93f14, 0xa3f14, 0x0, 0xc3f14, 0x0, 0x0, 0xf3f14,
+    0x0, 0x113f14, 0x123f14, 0x0, 0x143f14, 0x0, 0x0, 0x173f14, 0x183f14, 0x0, 0x0, 0x1b3f14, 0x0, 0x1d3f14, 0x1e3f14, 0x0,
+    0x203f14, 0x0, 0x0, 0x233f14, 0x0, 0x253f14, 0x263f14, 0x0, 0x0, 0x293f14, 0x2a3f14, 0x0, 0x2c3f14, 0x0, 0x0, 0x2f3f14,
+    0x0, 0x313f14, 0x323f14, 0x0, 0x343f14, 0x0, 0x0, 0x373f14, 0x383f14, 0x0, 0x0, 0x3b3f14, 0x0, 0x3d3f14, 0x3e3f14, 0x0,
+    0x0, 0x413f14, 0x423f14, 0x0, 0x443f14, 0x0, 0x0, 0x473f14, 0x483f14, 0x0, 0x0, 0x4b3f14, 0x0, 0x4d3f14, 0x4e3f14, 0x0,
+    0x503f14, 0x0, 0x0, 0x533f14, 0x0, 0x553f14, 0x563f14, 0x0, 0x0, 0x593f14, 0x5a3f14, 0x0, 0x5c3f14, 0x0, 0x0, 0x5f3f14,
+    0xff3f14, 0x0, 0x0, 0xff3f14, 0x0, 0xff3f14, 0xff3f14, 0x0, 0x0, 0xff3f14, 0xff3f14, 0x0, 0xff3f14, 0x0, 0x0, 0xff3f14,
+    0x0, 0xff3f14, 0xff3f14, 0x0, 0xff3f14, 0x0, 0x0, 0xff3f14, 0xff3f14, 0x0, 0x0, 0xff3f14, 0x0, 0xff3f14, 0xff3f14, 0x0,
+    0x0, 0x13f14, 0x23f14, 0x0, 0x43f14, 0x0, 0x0, 0x73f14, 0x83f14, 0x0, 0x0, 0xb3f14, 0x0, 0xd3f14, 0xe3f14, 0x0,
+    0x103f14, 0x0, 0x0, 0x133f14, 0x0, 0x153f14, 0x163f14, 0x0, 0x0, 0x193f14, 0x1a3f14, 0x0, 0x1c3f14, 0x0, 0x0, 0x1f3f14,
+    0x0, 0x213f14, 0x223f14, 0x0, 0x243f14, 0x0, 0x0, 0x273f14, 0x283f14, 0x0, 0x0, 0x2b3f14, 0x0, 0x2d3f14, 0x2e3f14, 0x0,
+    0x303f14, 0x0, 0x0, 0x333f14, 0x0, 0x353f14, 0x363f14, 0x0, 0x0, 0x393f14, 0x3a3f14, 0x0, 0x3c3f14, 0x0, 0x0, 0x3f3f14,
+    0x403f14, 0x0, 0x0, 0x433f14, 0x0, 0x453f14, 0x463f14, 0x0, 0x0, 0x493f14, 0x4a3f14, 0x0, 0x4c3f14, 0x0, 0x0, 0x4f3f14,
+    0x0, 0x513f14, 0x523f14, 0x0, 0x543f14, 0x0, 0x0, 0x573f14, 0x583f14, 0x0, 0x0, 0x5b3f14, 0x0, 0x5d3f14, 0x5e3f14, 0x0,
+    0x0, 0xff4004, 0xff4004, 0x0, 0xff4004, 0x0, 0x0, 0xff4004, 0xff4004, 0x0, 0x0, 0xff4004, 0x0, 0xff4004, 0xff4004, 0x0,
+    0xff4004, 0x0, 0x0, 0xff4004, 0x0, 0xff4004, 0xff4004, 0x0, 0x0, 0xff4004, 0xff4004, 0x0, 0xff4004, 0x0, 0x0, 0xff4004,
+    0x4004, 0x0, 0x0, 0x34004, 0x0, 0x54004, 0x64004, 0x0, 0x0, 0x94004, 0xa4004, 0x0, 0xc4004, 0x0, 0x0, 0xf4004,
+    0x0, 0x114004, 0x124004, 0x0, 0x144004, 0x0, 0x0, 0x174004, 0x184004, 0x0, 0x0, 0x1b4004, 0x0, 0x1d4004, 0x1e4004, 0x0,
+    0x204004, 0x0, 0x0, 0x234004, 0x0, 0x254004, 0x264004, 0x0, 0x0, 0x294004, 0x2a4004, 0x0, 0x2c4004, 0x0, 0x0, 0x2f4004,
+    0x0, 0x314004, 0x324004, 0x0, 0x344004, 0x0, 0x0, 0x374004, 0x384004, 0x0, 0x0, 0x3b4004, 0x0, 0x3d4004, 0x3e4004, 0x0,
+    0x0, 0x414004, 0x424004, 0x0, 0x444004, 0x0, 0x0, 0x474004, 0x484004, 0x0, 0x0, 0x4b4004, 0x0, 0x4d4004, 0x4e4004, 0x0,
+    0x504004, 0x0, 0x0, 0x534004, 0x0, 0x554004, 0x564004, 0x0, 0x0, 0x594004, 0x5a4004, 0x0, 0x5c4004, 0x0, 0x0, 0x5f4004,
+    0xff4004, 0x0, 0x0, 0xff4004, 0x0, 0xff4004, 0xff4004, 0x0, 0x0, 0xff4004, 0xff4004, 0x0, 0xff4004, 0x0, 0x0, 0xff4004,
+    0x0, 0xff4004, 0xff4004, 0x0, 0xff4004, 0x0, 0x0, 0xff4004, 0xff4004, 0x0, 0x0, 0xff4004, 0x0, 0xff4004, 0xff4004, 0x0,
+    0x0, 0x14004, 0x24004, 0x0, 0x44004, 0x0, 0x0, 0x74004, 0x84004, 0x0, 0x0, 0xb4004, 0x0, 0xd4004, 0xe4004, 0x0,
+    0x104004, 0x0, 0x0, 0x134004, 0x0, 0x154004, 0x164004, 0x0, 0x0, 0x194004, 0x1a4004, 0x0, 0x1c4004, 0x0, 0x0, 0x1f4004,
+    0x0, 0x214004, 0x224004, 0x0, 0x244004, 0x0, 0x0, 0x274004, 0x284004, 0x0, 0x0, 0x2b4004, 0x0, 0x2d4004, 0x2e4004, 0x0,
+    0x304004, 0x0, 0x0, 0x334004, 0x0, 0x354004, 0x364004, 0x0, 0x0, 0x394004, 0x3a4004, 0x0, 0x3c4004, 0x0, 0x0, 0x3f4004,
+    0x404004, 0x0, 0x0, 0x434004, 0x0, 0x454004, 0x464004, 0x0, 0x0, 0x494004, 0x4a4004, 0x0, 0x4c4004, 0x0, 0x0, 0x4f4004,
+    0x0, 0x514004, 0x524004, 0x0, 0x544004, 0x0, 0x0, 0x574004, 0x584004, 0x0, 0x0, 0x5b4004, 0x0, 0x5d4004, 0x5e4004, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4304, 0xff4304, 0x0, 0xff4304, 0x0, 0x0, 0xff4304, 0xff4304, 0x0, 0x0, 0xff4304, 0x0, 0xff4304, 0xff4304, 0x0,
+    0xff4304, 0x0, 0x0, 0xff4304, 0x0, 0xff4304, 0xff4304, 0x0, 0x0, 0xff4304, 0xff4304, 0x0, 0xff4304, 0x0, 0x0, 0xff4304,
+    0x4304, 0x0, 0x0, 0x34304, 0x0, 0x54304, 0x64304, 0x0, 0x0, 0x94304, 0xa4304, 0x0, 0xc4304, 0x0, 0x0, 0xf4304,
+    0x0, 0x114304, 0x124304, 0x0, 0x144304, 0x0, 0x0, 0x174304, 0x184304, 0x0, 0x0, 0x1b4304, 0x0, 0x1d4304, 0x1e4304, 0x0,
+    0x204304, 0x0, 0x0, 0x234304, 0x0, 0x254304, 0x264304, 0x0, 0x0, 0x294304, 0x2a4304, 0x0, 0x2c4304, 0x0, 0x0, 0x2f4304,
+    0x0, 0x314304, 0x324304, 0x0, 0x344304, 0x0, 0x0, 0x374304, 0x384304, 0x0, 0x0, 0x3b4304, 0x0, 0x3d4304, 0x3e4304, 0x0,
+    0x0, 0x414304, 0x424304, 0x0, 0x444304, 0x0, 0x0, 0x474304, 0x484304, 0x0, 0x0, 0x4b4304, 0x0, 0x4d4304, 0x4e4304, 0x0,
+    0x504304, 0x0, 0x0, 0x534304, 0x0, 0x554304, 0x564304, 0x0, 0x0, 0x594304, 0x5a4304, 0x0, 0x5c4304, 0x0, 0x0, 0x5f4304,
+    0xff4304, 0x0, 0x0, 0xff4304, 0x0, 0xff4304, 0xff4304, 0x0, 0x0, 0xff4304, 0xff4304, 0x0, 0xff4304, 0x0, 0x0, 0xff4304,
+    0x0, 0xff4304, 0xff4304, 0x0, 0xff4304, 0x0, 0x0, 0xff4304, 0xff4304, 0x0, 0x0, 0xff4304, 0x0, 0xff4304, 0xff4304, 0x0,
+    0x0, 0x14304, 0x24304, 0x0, 0x44304, 0x0, 0x0, 0x74304, 0x84304, 0x0, 0x0, 0xb4304, 0x0, 0xd4304, 0xe4304, 0x0,
+    0x104304, 0x0, 0x0, 0x134304, 0x0, 0x154304, 0x164304, 0x0, 0x0, 0x194304, 0x1a4304, 0x0, 0x1c4304, 0x0, 0x0, 0x1f4304,
+    0x0, 0x214304, 0x224304, 0x0, 0x244304, 0x0, 0x0, 0x274304, 0x284304, 0x0, 0x0, 0x2b4304, 0x0, 0x2d4304, 0x2e4304, 0x0,
+    0x304304, 0x0, 0x0, 0x334304, 0x0, 0x354304, 0x364304, 0x0, 0x0, 0x394304, 0x3a4304, 0x0, 0x3c4304, 0x0, 0x0, 0x3f4304,
+    0x404304, 0x0, 0x0, 0x434304, 0x0, 0x454304, 0x464304, 0x0, 0x0, 0x494304, 0x4a4304, 0x0, 0x4c4304, 0x0, 0x0, 0x4f4304,
+    0x0, 0x514304, 0x524304, 0x0, 0x544304, 0x0, 0x0, 0x574304, 0x584304, 0x0, 0x0, 0x5b4304, 0x0, 0x5d4304, 0x5e4304, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4504, 0xff4504, 0x0, 0xff4504, 0x0, 0x0, 0xff4504, 0xff4504, 0x0, 0x0, 0xff4504, 0x0, 0xff4504, 0xff4504, 0x0,
+    0xff4504, 0x0, 0x0, 0xff4504, 0x0, 0xff4504, 0xff4504, 0x0, 0x0, 0xff4504, 0xff4504, 0x0, 0xff4504, 0x0, 0x0, 0xff4504,
+    0x4504, 0x0, 0x0, 0x34504, 0x0, 0x54504, 0x64504, 0x0, 0x0, 0x94504, 0xa4504, 0x0, 0xc4504, 0x0, 0x0, 0xf4504,
+    0x0, 0x114504, 0x124504, 0x0, 0x144504, 0x0, 0x0, 0x174504, 0x184504, 0x0, 0x0, 0x1b4504, 0x0, 0x1d4504, 0x1e4504, 0x0,
+    0x204504, 0x0, 0x0, 0x234504, 0x0, 0x254504, 0x264504, 0x0, 0x0, 0x294504, 0x2a4504, 0x0, 0x2c4504, 0x0, 0x0, 0x2f4504,
+    0x0, 0x314504, 0x324504, 0x0, 0x344504, 0x0, 0x0, 0x374504, 0x384504, 0x0, 0x0, 0x3b4504, 0x0, 0x3d4504, 0x3e4504, 0x0,
+    0x0, 0x414504, 0x424504, 0x0, 0x444504, 0x0, 0x0, 0x474504, 0x484504, 0x0, 0x0, 0x4b4504, 0x0, 0x4d4504, 0x4e4504, 0x0,
+    0x504504, 0x0, 0x0, 0x534504, 0x0, 0x554504, 0x564504, 0x0, 0x0, 0x594504, 0x5a4504, 0x0, 0x5c4504, 0x0, 0x0, 0x5f4504,
+    0xff4504, 0x0, 0x0, 0xff4504, 0x0, 0xff4504, 0xff4504, 0x0, 0x0, 0xff4504, 0xff4504, 0x0, 0xff4504, 0x0, 0x0, 0xff4504,
+    0x0, 0xff4504, 0xff4504, 0x0, 0xff4504, 0x0, 0x0, 0xff4504, 0xff4504, 0x0, 0x0, 0xff4504, 0x0, 0xff4504, 0xff4504, 0x0,
+    0x0, 0x14504, 0x24504, 0x0, 0x44504, 0x0, 0x0, 0x74504, 0x84504, 0x0, 0x0, 0xb4504, 0x0, 0xd4504, 0xe4504, 0x0,
+    0x104504, 0x0, 0x0, 0x134504, 0x0, 0x154504, 0x164504, 0x0, 0x0, 0x194504, 0x1a4504, 0x0, 0x1c4504, 0x0, 0x0, 0x1f4504,
+    0x0, 0x214504, 0x224504, 0x0, 0x244504, 0x0, 0x0, 0x274504, 0x284504, 0x0, 0x0, 0x2b4504, 0x0, 0x2d4504, 0x2e4504, 0x0,
+    0x304504, 0x0, 0x0, 0x334504, 0x0, 0x354504, 0x364504, 0x0, 0x0, 0x394504, 0x3a4504, 0x0, 0x3c4504, 0x0, 0x0, 0x3f4504,
+    0x404504, 0x0, 0x0, 0x434504, 0x0, 0x454504, 0x464504, 0x0, 0x0, 0x494504, 0x4a4504, 0x0, 0x4c4504, 0x0, 0x0, 0x4f4504,
+    0x0, 0x514504, 0x524504, 0x0, 0x544504, 0x0, 0x0, 0x574504, 0x584504, 0x0, 0x0, 0x5b4504, 0x0, 0x5d4504, 0x5e4504, 0x0,
+    0x0, 0xff4604, 0xff4604, 0x0, 0xff4604, 0x0, 0x0, 0xff4604, 0xff4604, 0x0, 0x0, 0xff4604, 0x0, 0xff4604, 0xff4604, 0x0,
+    0xff4604, 0x0, 0x0, 0xff4604, 0x0, 0xff4604, 0xff4604, 0x0, 0x0, 0xff4604, 0xff4604, 0x0, 0xff4604, 0x0, 0x0, 0xff4604,
+    0x4604, 0x0, 0x0, 0x34604, 0x0, 0x54604, 0x64604, 0x0, 0x0, 0x94604, 0xa4604, 0x0, 0xc4604, 0x0, 0x0, 0xf4604,
+    0x0, 0x114604, 0x124604, 0x0, 0x144604, 0x0, 0x0, 0x174604, 0x184604, 0x0, 0x0, 0x1b4604, 0x0, 0x1d4604, 0x1e4604, 0x0,
+    0x204604, 0x0, 0x0, 0x234604, 0x0, 0x254604, 0x264604, 0x0, 0x0, 0x294604, 0x2a4604, 0x0, 0x2c4604, 0x0, 0x0, 0x2f4604,
+    0x0, 0x314604, 0x324604, 0x0, 0x344604, 0x0, 0x0, 0x374604, 0x384604, 0x0, 0x0, 0x3b4604, 0x0, 0x3d4604, 0x3e4604, 0x0,
+    0x0, 0x414604, 0x424604, 0x0, 0x444604, 0x0, 0x0, 0x474604, 0x484604, 0x0, 0x0, 0x4b4604, 0x0, 0x4d4604, 0x4e4604, 0x0,
+    0x504604, 0x0, 0x0, 0x534604, 0x0, 0x554604, 0x564604, 0x0, 0x0, 0x594604, 0x5a4604, 0x0, 0x5c4604, 0x0, 0x0, 0x5f4604,
+    0xff4604, 0x0, 0x0, 0xff4604, 0x0, 0xff4604, 0xff4604, 0x0, 0x0, 0xff4604, 0xff4604, 0x0, 0xff4604, 0x0, 0x0, 0xff4604,
+    0x0, 0xff4604, 0xff4604, 0x0, 0xff4604, 0x0, 0x0, 0xff4604, 0xff4604, 0x0, 0x0, 0xff4604, 0x0, 0xff4604, 0xff4604, 0x0,
+    0x0, 0x14604, 0x24604, 0x0, 0x44604, 0x0, 0x0, 0x74604, 0x84604, 0x0, 0x0, 0xb4604, 0x0, 0xd4604, 0xe4604, 0x0,
+    0x104604, 0x0, 0x0, 0x134604, 0x0, 0x154604, 0x164604, 0x0, 0x0, 0x194604, 0x1a4604, 0x0, 0x1c4604, 0x0, 0x0, 0x1f4604,
+    0x0, 0x214604, 0x224604, 0x0, 0x244604, 0x0, 0x0, 0x274604, 0x284604, 0x0, 0x0, 0x2b4604, 0x0, 0x2d4604, 0x2e4604, 0x0,
+    0x304604, 0x0, 0x0, 0x334604, 0x0, 0x354604, 0x364604, 0x0, 0x0, 0x394604, 0x3a4604, 0x0, 0x3c4604, 0x0, 0x0, 0x3f4604,
+    0x404604, 0x0, 0x0, 0x434604, 0x0, 0x454604, 0x464604, 0x0, 0x0, 0x494604, 0x4a4604, 0x0, 0x4c4604, 0x0, 0x0, 0x4f4604,
+    0x0, 0x514604, 0x524604, 0x0, 0x544604, 0x0, 0x0, 0x574604, 0x584604, 0x0, 0x0, 0x5b4604, 0x0, 0x5d4604, 0x5e4604, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4914, 0xff4914, 0x0, 0xff4914, 0x0, 0x0, 0xff4914, 0xff4914, 0x0, 0x0, 0xff4914, 0x0, 0xff4914, 0xff4914, 0x0,
+    0xff4914, 0x0, 0x0, 0xff4914, 0x0, 0xff4914, 0xff4914, 0x0, 0x0, 0xff4914, 0xff4914, 0x0, 0xff4914, 0x0, 0x0, 0xff4914,
+    0x4914, 0x0, 0x0, 0x34914, 0x0, 0x54914, 0x64914, 0x0, 0x0, 0x94914, 0xa4914, 0x0, 0xc4914, 0x0, 0x0, 0xf4914,
+    0x0, 0x114914, 0x124914, 0x0, 0x144914, 0x0, 0x0, 0x174914, 0x184914, 0x0, 0x0, 0x1b4914, 0x0, 0x1d4914, 0x1e4914, 0x0,
+    0x204914, 0x0, 0x0, 0x234914, 0x0, 0x254914, 0x264914, 0x0, 0x0, 0x294914, 0x2a4914, 0x0, 0x2c4914, 0x0, 0x0, 0x2f4914,
+    0x0, 0x314914, 0x324914, 0x0, 0x344914, 0x0, 0x0, 0x374914, 0x384914, 0x0, 0x0, 0x3b4914, 0x0, 0x3d4914, 0x3e4914, 0x0,
+    0x0, 0x414914, 0x424914, 0x0, 0x444914, 0x0, 0x0, 0x474914, 0x484914, 0x0, 0x0, 0x4b4914, 0x0, 0x4d4914, 0x4e4914, 0x0,
+    0x504914, 0x0, 0x0, 0x534914, 0x0, 0x554914, 0x564914, 0x0, 0x0, 0x594914, 0x5a4914, 0x0, 0x5c4914, 0x0, 0x0, 0x5f4914,
+    0xff4914, 0x0, 0x0, 0xff4914, 0x0, 0xff4914, 0xff4914, 0x0, 0x0, 0xff4914, 0xff4914, 0x0, 0xff4914, 0x0, 0x0, 0xff4914,
+    0x0, 0xff4914, 0xff4914, 0x0, 0xff4914, 0x0, 0x0, 0xff4914, 0xff4914, 0x0, 0x0, 0xff4914, 0x0, 0xff4914, 0xff4914, 0x0,
+    0x0, 0x14914, 0x24914, 0x0, 0x44914, 0x0, 0x0, 0x74914, 0x84914, 0x0, 0x0, 0xb4914, 0x0, 0xd4914, 0xe4914, 0x0,
+    0x104914, 0x0, 0x0, 0x134914, 0x0, 0x154914, 0x164914, 0x0, 0x0, 0x194914, 0x1a4914, 0x0, 0x1c4914, 0x0, 0x0, 0x1f4914,
+    0x0, 0x214914, 0x224914, 0x0, 0x244914, 0x0, 0x0, 0x274914, 0x284914, 0x0, 0x0, 0x2b4914, 0x0, 0x2d4914, 0x2e4914, 0x0,
+    0x304914, 0x0, 0x0, 0x334914, 0x0, 0x354914, 0x364914, 0x0, 0x0, 0x394914, 0x3a4914, 0x0, 0x3c4914, 0x0, 0x0, 0x3f4914,
+    0x404914, 0x0, 0x0, 0x434914, 0x0, 0x454914, 0x464914, 0x0, 0x0, 0x494914, 0x4a4914, 0x0, 0x4c4914, 0x0, 0x0, 0x4f4914,
+    0x0, 0x514914, 0x524914, 0x0, 0x544914, 0x0, 0x0, 0x574914, 0x584914, 0x0, 0x0, 0x5b4914, 0x0, 0x5d4914, 0x5e4914, 0x0,
+    0x0, 0xff4a14, 0xff4a14, 0x0, 0xff4a14, 0x0, 0x0, 0xff4a14, 0xff4a14, 0x0, 0x0, 0xff4a14, 0x0, 0xff4a14, 0xff4a14, 0x0,
+    0xff4a14, 0x0, 0x0, 0xff4a14, 0x0, 0xff4a14, 0xff4a14, 0x0, 0x0, 0xff4a14, 0xff4a14, 0x0, 0xff4a14, 0x0, 0x0, 0xff4a14,
+    0x4a14, 0x0, 0x0, 0x34a14, 0x0, 0x54a14, 0x64a14, 0x0, 0x0, 0x94a14, 0xa4a14, 0x0, 0xc4a14, 0x0, 0x0, 0xf4a14,
+    0x0, 0x114a14, 0x124a14, 0x0, 0x144a14, 0x0, 0x0, 0x174a14, 0x184a14, 0x0, 0x0, 0x1b4a14, 0x0, 0x1d4a14, 0x1e4a14, 0x0,
+    0x204a14, 0x0, 0x0, 0x234a14, 0x0, 0x254a14, 0x264a14, 0x0, 0x0, 0x294a14, 0x2a4a14, 0x0, 0x2c4a14, 0x0, 0x0, 0x2f4a14,
+    0x0, 0x314a14, 0x324a14, 0x0, 0x344a14, 0x0, 0x0, 0x374a14, 0x384a14, 0x0, 0x0, 0x3b4a14, 0x0, 0x3d4a14, 0x3e4a14, 0x0,
+    0x0, 0x414a14, 0x424a14, 0x0, 0x444a14, 0x0, 0x0, 0x474a14, 0x484a14, 0x0, 0x0, 0x4b4a14, 0x0, 0x4d4a14, 0x4e4a14, 0x0,
+    0x504a14, 0x0, 0x0, 0x534a14, 0x0, 0x554a14, 0x564a14, 0x0, 0x0, 0x594a14, 0x5a4a14, 0x0, 0x5c4a14, 0x0, 0x0, 0x5f4a14,
+    0xff4a14, 0x0, 0x0, 0xff4a14, 0x0, 0xff4a14, 0xff4a14, 0x0, 0x0, 0xff4a14, 0xff4a14, 0x0, 0xff4a14, 0x0, 0x0, 0xff4a14,
+    0x0, 0xff4a14, 0xff4a14, 0x0, 0xff4a14, 0x0, 0x0, 0xff4a14, 0xff4a14, 0x0, 0x0, 0xff4a14, 0x0, 0xff4a14, 0xff4a14, 0x0,
+    0x0, 0x14a14, 0x24a14, 0x0, 0x44a14, 0x0, 0x0, 0x74a14, 0x84a14, 0x0, 0x0, 0xb4a14, 0x0, 0xd4a14, 0xe4a14, 0x0,
+    0x104a14, 0x0, 0x0, 0x134a14, 0x0, 0x154a14, 0x164a14, 0x0, 0x0, 0x194a14, 0x1a4a14, 0x0, 0x1c4a14, 0x0, 0x0, 0x1f4a14,
+    0x0, 0x214a14, 0x224a14, 0x0, 0x244a14, 0x0, 0x0, 0x274a14, 0x284a14, 0x0, 0x0, 0x2b4a14, 0x0, 0x2d4a14, 0x2e4a14, 0x0,
+    0x304a14, 0x0, 0x0, 0x334a14, 0x0, 0x354a14, 0x364a14, 0x0, 0x0, 0x394a14, 0x3a4a14, 0x0, 0x3c4a14, 0x0, 0x0, 0x3f4a14,
+    0x404a14, 0x0, 0x0, 0x434a14, 0x0, 0x454a14, 0x464a14, 0x0, 0x0, 0x494a14, 0x4a4a14, 0x0, 0x4c4a14, 0x0, 0x0, 0x4f4a14,
+    0x0, 0x514a14, 0x524a14, 0x0, 0x544a14, 0x0, 0x0, 0x574a14, 0x584a14, 0x0, 0x0, 0x5b4a14, 0x0, 0x5d4a14, 0x5e4a14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4c14, 0xff4c14, 0x0, 0xff4c14, 0x0, 0x0, 0xff4c14, 0xff4c14, 0x0, 0x0, 0xff4c14, 0x0, 0xff4c14, 0xff4c14, 0x0,
+    0xff4c14, 0x0, 0x0, 0xff4c14, 0x0, 0xff4c14, 0xff4c14, 0x0, 0x0, 0xff4c14, 0xff4c14, 0x0, 0xff4c14, 0x0, 0x0, 0xff4c14,
+    0x4c14, 0x0, 0x0, 0x34c14, 0x0, 0x54c14, 0x64c14, 0x0, 0x0, 0x94c14, 0xa4c14, 0x0, 0xc4c14, 0x0, 0x0, 0xf4c14,
+    0x0, 0x114c14, 0x124c14, 0x0, 0x144c14, 0x0, 0x0, 0x174c14, 0x184c14, 0x0, 0x0, 0x1b4c14, 0x0, 0x1d4c14, 0x1e4c14, 0x0,
+    0x204c14, 0x0, 0x0, 0x234c14, 0x0, 0x254c14, 0x264c14, 0x0, 0x0, 0x294c14, 0x2a4c14, 0x0, 0x2c4c14, 0x0, 0x0, 0x2f4c14,
+    0x0, 0x314c14, 0x324c14, 0x0, 0x344c14, 0x0, 0x0, 0x374c14, 0x384c14, 0x0, 0x0, 0x3b4c14, 0x0, 0x3d4c14, 0x3e4c14, 0x0,
+    0x0, 0x414c14, 0x424c14, 0x0, 0x444c14, 0x0, 0x0, 0x474c14, 0x484c14, 0x0, 0x0, 0x4b4c14, 0x0, 0x4d4c14, 0x4e4c14, 0x0,
+    0x504c14, 0x0, 0x0, 0x534c14, 0x0, 0x554c14, 0x564c14, 0x0, 0x0, 0x594c14, 0x5a4c14, 0x0, 0x5c4c14, 0x0, 0x0, 0x5f4c14,
+    0xff4c14, 0x0, 0x0, 0xff4c14, 0x0, 0xff4c14, 0xff4c14, 0x0, 0x0, 0xff4c14, 0xff4c14, 0x0, 0xff4c14, 0x0, 0x0, 0xff4c14,
+    0x0, 0xff4c14, 0xff4c14, 0x0, 0xff4c14, 0x0, 0x0, 0xff4c14, 0xff4c14, 0x0, 0x0, 0xff4c14, 0x0, 0xff4c14, 0xff4c14, 0x0,
+    0x0, 0x14c14, 0x24c14, 0x0, 0x44c14, 0x0, 0x0, 0x74c14, 0x84c14, 0x0, 0x0, 0xb4c14, 0x0, 0xd4c14, 0xe4c14, 0x0,
+    0x104c14, 0x0, 0x0, 0x134c14, 0x0, 0x154c14, 0x164c14, 0x0, 0x0, 0x194c14, 0x1a4c14, 0x0, 0x1c4c14, 0x0, 0x0, 0x1f4c14,
+    0x0, 0x214c14, 0x224c14, 0x0, 0x244c14, 0x0, 0x0, 0x274c14, 0x284c14, 0x0, 0x0, 0x2b4c14, 0x0, 0x2d4c14, 0x2e4c14, 0x0,
+    0x304c14, 0x0, 0x0, 0x334c14, 0x0, 0x354c14, 0x364c14, 0x0, 0x0, 0x394c14, 0x3a4c14, 0x0, 0x3c4c14, 0x0, 0x0, 0x3f4c14,
+    0x404c14, 0x0, 0x0, 0x434c14, 0x0, 0x454c14, 0x464c14, 0x0, 0x0, 0x494c14, 0x4a4c14, 0x0, 0x4c4c14, 0x0, 0x0, 0x4f4c14,
+    0x0, 0x514c14, 0x524c14, 0x0, 0x544c14, 0x0, 0x0, 0x574c14, 0x584c14, 0x0, 0x0, 0x5b4c14, 0x0, 0x5d4c14, 0x5e4c14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff4f14, 0xff4f14, 0x0, 0xff4f14, 0x0, 0x0, 0xff4f14, 0xff4f14, 0x0, 0x0, 0xff4f14, 0x0, 0xff4f14, 0xff4f14, 0x0,
+    0xff4f14, 0x0, 0x0, 0xff4f14, 0x0, 0xff4f14, 0xff4f14, 0x0, 0x0, 0xff4f14, 0xff4f14, 0x0, 0xff4f14, 0x0, 0x0, 0xff4f14,
+    0x4f14, 0x0, 0x0, 0x34f14, 0x0, 0x54f14, 0x64f14, 0x0, 0x0, 0x94f14, 0xa4f14, 0x0, 0xc4f14, 0x0, 0x0, 0xf4f14,
+    0x0, 0x114f14, 0x124f14, 0x0, 0x144f14, 0x0, 0x0, 0x174f14, 0x184f14, 0x0, 0x0, 0x1b4f14, 0x0, 0x1d4f14, 0x1e4f14, 0x0,
+    0x204f14, 0x0, 0x0, 0x234f14, 0x0, 0x254f14, 0x264f14, 0x0, 0x0, 0x294f14, 0x2a4f14, 0x0, 0x2c4f14, 0x0, 0x0, 0x2f4f14,
+    0x0, 0x314f14, 0x324f14, 0x0, 0x344f14, 0x0, 0x0, 0x374f14, 0x384f14, 0x0, 0x0, 0x3b4f14, 0x0, 0x3d4f14, 0x3e4f14, 0x0,
+    0x0, 0x414f14, 0x424f14, 0x0, 0x444f14, 0x0, 0x0, 0x474f14, 0x484f14, 0x0, 0x0, 0x4b4f14, 0x0, 0x4d4f14, 0x4e4f14, 0x0,
+    0x504f14, 0x0, 0x0, 0x534f14, 0x0, 0x554f14, 0x564f14, 0x0, 0x0, 0x594f14, 0x5a4f14, 0x0, 0x5c4f14, 0x0, 0x0, 0x5f4f14,
+    0xff4f14, 0x0, 0x0, 0xff4f14, 0x0, 0xff4f14, 0xff4f14, 0x0, 0x0, 0xff4f14, 0xff4f14, 0x0, 0xff4f14, 0x0, 0x0, 0xff4f14,
+    0x0, 0xff4f14, 0xff4f14, 0x0, 0xff4f14, 0x0, 0x0, 0xff4f14, 0xff4f14, 0x0, 0x0, 0xff4f14, 0x0, 0xff4f14, 0xff4f14, 0x0,
+    0x0, 0x14f14, 0x24f14, 0x0, 0x44f14, 0x0, 0x0, 0x74f14, 0x84f14, 0x0, 0x0, 0xb4f14, 0x0, 0xd4f14, 0xe4f14, 0x0,
+    0x104f14, 0x0, 0x0, 0x134f14, 0x0, 0x154f14, 0x164f14, 0x0, 0x0, 0x194f14, 0x1a4f14, 0x0, 0x1c4f14, 0x0, 0x0, 0x1f4f14,
+    0x0, 0x214f14, 0x224f14, 0x0, 0x244f14, 0x0, 0x0, 0x274f14, 0x284f14, 0x0, 0x0, 0x2b4f14, 0x0, 0x2d4f14, 0x2e4f14, 0x0,
+    0x304f14, 0x0, 0x0, 0x334f14, 0x0, 0x354f14, 0x364f14, 0x0, 0x0, 0x394f14, 0x3a4f14, 0x0, 0x3c4f14, 0x0, 0x0, 0x3f4f14,
+    0x404f14, 0x0, 0x0, 0x434f14, 0x0, 0x454f14, 0x464f14, 0x0, 0x0, 0x494f14, 0x4a4f14, 0x0, 0x4c4f14, 0x0, 0x0, 0x4f4f14,
+    0x0, 0x514f14, 0x524f14, 0x0, 0x544f14, 0x0, 0x0, 0x574f14, 0x584f14, 0x0, 0x0, 0x5b4f14, 0x0, 0x5d4f14, 0x5e4f14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5104, 0xff5104, 0x0, 0xff5104, 0x0, 0x0, 0xff5104, 0xff5104, 0x0, 0x0, 0xff5104, 0x0, 0xff5104, 0xff5104, 0x0,
+    0xff5104, 0x0, 0x0, 0xff5104, 0x0, 0xff5104, 0xff5104, 0x0, 0x0, 0xff5104, 0xff5104, 0x0, 0xff5104, 0x0, 0x0, 0xff5104,
+    0x5104, 0x0, 0x0, 0x35104, 0x0, 0x55104, 0x65104, 0x0, 0x0, 0x95104, 0xa5104, 0x0, 0xc5104, 0x0, 0x0, 0xf5104,
+    0x0, 0x115104, 0x125104, 0x0, 0x145104, 0x0, 0x0, 0x175104, 0x185104, 0x0, 0x0, 0x1b5104, 0x0, 0x1d5104, 0x1e5104, 0x0,
+    0x205104, 0x0, 0x0, 0x235104, 0x0, 0x255104, 0x265104, 0x0, 0x0, 0x295104, 0x2a5104, 0x0, 0x2c5104, 0x0, 0x0, 0x2f5104,
+    0x0, 0x315104, 0x325104, 0x0, 0x345104, 0x0, 0x0, 0x375104, 0x385104, 0x0, 0x0, 0x3b5104, 0x0, 0x3d5104, 0x3e5104, 0x0,
+    0x0, 0x415104, 0x425104, 0x0, 0x445104, 0x0, 0x0, 0x475104, 0x485104, 0x0, 0x0, 0x4b5104, 0x0, 0x4d5104, 0x4e5104, 0x0,
+    0x505104, 0x0, 0x0, 0x535104, 0x0, 0x555104, 0x565104, 0x0, 0x0, 0x595104, 0x5a5104, 0x0, 0x5c5104, 0x0, 0x0, 0x5f5104,
+    0xff5104, 0x0, 0x0, 0xff5104, 0x0, 0xff5104, 0xff5104, 0x0, 0x0, 0xff5104, 0xff5104, 0x0, 0xff5104, 0x0, 0x0, 0xff5104,
+    0x0, 0xff5104, 0xff5104, 0x0, 0xff5104, 0x0, 0x0, 0xff5104, 0xff5104, 0x0, 0x0, 0xff5104, 0x0, 0xff5104, 0xff5104, 0x0,
+    0x0, 0x15104, 0x25104, 0x0, 0x45104, 0x0, 0x0, 0x75104, 0x85104, 0x0, 0x0, 0xb5104, 0x0, 0xd5104, 0xe5104, 0x0,
+    0x105104, 0x0, 0x0, 0x135104, 0x0, 0x155104, 0x165104, 0x0, 0x0, 0x195104, 0x1a5104, 0x0, 0x1c5104, 0x0, 0x0, 0x1f5104,
+    0x0, 0x215104, 0x225104, 0x0, 0x245104, 0x0, 0x0, 0x275104, 0x285104, 0x0, 0x0, 0x2b5104, 0x0, 0x2d5104, 0x2e5104, 0x0,
+    0x305104, 0x0, 0x0, 0x335104, 0x0, 0x355104, 0x365104, 0x0, 0x0, 0x395104, 0x3a5104, 0x0, 0x3c5104, 0x0, 0x0, 0x3f5104,
+    0x405104, 0x0, 0x0, 0x435104, 0x0, 0x455104, 0x465104, 0x0, 0x0, 0x495104, 0x4a5104, 0x0, 0x4c5104, 0x0, 0x0, 0x4f5104,
+    0x0, 0x515104, 0x525104, 0x0, 0x545104, 0x0, 0x0, 0x575104, 0x585104, 0x0, 0x0, 0x5b5104, 0x0, 0x5d5104, 0x5e5104, 0x0,
+    0x0, 0xff5204, 0xff5204, 0x0, 0xff5204, 0x0, 0x0, 0xff5204, 0xff5204, 0x0, 0x0, 0xff5204, 0x0, 0xff5204, 0xff5204, 0x0,
+    0xff5204, 0x0, 0x0, 0xff5204, 0x0, 0xff5204, 0xff5204, 0x0, 0x0, 0xff5204, 0xff5204, 0x0, 0xff5204, 0x0, 0x0, 0xff5204,
+    0x5204, 0x0, 0x0, 0x35204, 0x0, 0x55204, 0x65204, 0x0, 0x0, 0x95204, 0xa5204, 0x0, 0xc5204, 0x0, 0x0, 0xf5204,
+    0x0, 0x115204, 0x125204, 0x0, 0x145204, 0x0, 0x0, 0x175204, 0x185204, 0x0, 0x0, 0x1b5204, 0x0, 0x1d5204, 0x1e5204, 0x0,
+    0x205204, 0x0, 0x0, 0x235204, 0x0, 0x255204, 0x265204, 0x0, 0x0, 0x295204, 0x2a5204, 0x0, 0x2c5204, 0x0, 0x0, 0x2f5204,
+    0x0, 0x315204, 0x325204, 0x0, 0x345204, 0x0, 0x0, 0x375204, 0x385204, 0x0, 0x0, 0x3b5204, 0x0, 0x3d5204, 0x3e5204, 0x0,
+    0x0, 0x415204, 0x425204, 0x0, 0x445204, 0x0, 0x0, 0x475204, 0x485204, 0x0, 0x0, 0x4b5204, 0x0, 0x4d5204, 0x4e5204, 0x0,
+    0x505204, 0x0, 0x0, 0x535204, 0x0, 0x555204, 0x565204, 0x0, 0x0, 0x595204, 0x5a5204, 0x0, 0x5c5204, 0x0, 0x0, 0x5f5204,
+    0xff5204, 0x0, 0x0, 0xff5204, 0x0, 0xff5204, 0xff5204, 0x0, 0x0, 0xff5204, 0xff5204, 0x0, 0xff5204, 0x0, 0x0, 0xff5204,
+    0x0, 0xff5204, 0xff5204, 0x0, 0xff5204, 0x0, 0x0, 0xff5204, 0xff5204, 0x0, 0x0, 0xff5204, 0x0, 0xff5204, 0xff5204, 0x0,
+    0x0, 0x15204, 0x25204, 0x0, 0x45204, 0x0, 0x0, 0x75204, 0x85204, 0x0, 0x0, 0xb5204, 0x0, 0xd5204, 0xe5204, 0x0,
+    0x105204, 0x0, 0x0, 0x135204, 0x0, 0x155204, 0x165204, 0x0, 0x0, 0x195204, 0x1a5204, 0x0, 0x1c5204, 0x0, 0x0, 0x1f5204,
+    0x0, 0x215204, 0x225204, 0x0, 0x245204, 0x0, 0x0, 0x275204, 0x285204, 0x0, 0x0, 0x2b5204, 0x0, 0x2d5204, 0x2e5204, 0x0,
+    0x305204, 0x0, 0x0, 0x335204, 0x0, 0x355204, 0x365204, 0x0, 0x0, 0x395204, 0x3a5204, 0x0, 0x3c5204, 0x0, 0x0, 0x3f5204,
+    0x405204, 0x0, 0x0, 0x435204, 0x0, 0x455204, 0x465204, 0x0, 0x0, 0x495204, 0x4a5204, 0x0, 0x4c5204, 0x0, 0x0, 0x4f5204,
+    0x0, 0x515204, 0x525204, 0x0, 0x545204, 0x0, 0x0, 0x575204, 0x585204, 0x0, 0x0, 0x5b5204, 0x0, 0x5d5204, 0x5e5204, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5404, 0xff5404, 0x0, 0xff5404, 0x0, 0x0, 0xff5404, 0xff5404, 0x0, 0x0, 0xff5404, 0x0, 0xff5404, 0xff5404, 0x0,
+    0xff5404, 0x0, 0x0, 0xff5404, 0x0, 0xff5404, 0xff5404, 0x0, 0x0, 0xff5404, 0xff5404, 0x0, 0xff5404, 0x0, 0x0, 0xff5404,
+    0x5404, 0x0, 0x0, 0x35404, 0x0, 0x55404, 0x65404, 0x0, 0x0, 0x95404, 0xa5404, 0x0, 0xc5404, 0x0, 0x0, 0xf5404,
+    0x0, 0x115404, 0x125404, 0x0, 0x145404, 0x0, 0x0, 0x175404, 0x185404, 0x0, 0x0, 0x1b5404, 0x0, 0x1d5404, 0x1e5404, 0x0,
+    0x205404, 0x0, 0x0, 0x235404, 0x0, 0x255404, 0x265404, 0x0, 0x0, 0x295404, 0x2a5404, 0x0, 0x2c5404, 0x0, 0x0, 0x2f5404,
+    0x0, 0x315404, 0x325404, 0x0, 0x345404, 0x0, 0x0, 0x375404, 0x385404, 0x0, 0x0, 0x3b5404, 0x0, 0x3d5404, 0x3e5404, 0x0,
+    0x0, 0x415404, 0x425404, 0x0, 0x445404, 0x0, 0x0, 0x475404, 0x485404, 0x0, 0x0, 0x4b5404, 0x0, 0x4d5404, 0x4e5404, 0x0,
+    0x505404, 0x0, 0x0, 0x535404, 0x0, 0x555404, 0x565404, 0x0, 0x0, 0x595404, 0x5a5404, 0x0, 0x5c5404, 0x0, 0x0, 0x5f5404,
+    0xff5404, 0x0, 0x0, 0xff5404, 0x0, 0xff5404, 0xff5404, 0x0, 0x0, 0xff5404, 0xff5404, 0x0, 0xff5404, 0x0, 0x0, 0xff5404,
+    0x0, 0xff5404, 0xff5404, 0x0, 0xff5404, 0x0, 0x0, 0xff5404, 0xff5404, 0x0, 0x0, 0xff5404, 0x0, 0xff5404, 0xff5404, 0x0,
+    0x0, 0x15404, 0x25404, 0x0, 0x45404, 0x0, 0x0, 0x75404, 0x85404, 0x0, 0x0, 0xb5404, 0x0, 0xd5404, 0xe5404, 0x0,
+    0x105404, 0x0, 0x0, 0x135404, 0x0, 0x155404, 0x165404, 0x0, 0x0, 0x195404, 0x1a5404, 0x0, 0x1c5404, 0x0, 0x0, 0x1f5404,
+    0x0, 0x215404, 0x225404, 0x0, 0x245404, 0x0, 0x0, 0x275404, 0x285404, 0x0, 0x0, 0x2b5404, 0x0, 0x2d5404, 0x2e5404, 0x0,
+    0x305404, 0x0, 0x0, 0x335404, 0x0, 0x355404, 0x365404, 0x0, 0x0, 0x395404, 0x3a5404, 0x0, 0x3c5404, 0x0, 0x0, 0x3f5404,
+    0x405404, 0x0, 0x0, 0x435404, 0x0, 0x455404, 0x465404, 0x0, 0x0, 0x495404, 0x4a5404, 0x0, 0x4c5404, 0x0, 0x0, 0x4f5404,
+    0x0, 0x515404, 0x525404, 0x0, 0x545404, 0x0, 0x0, 0x575404, 0x585404, 0x0, 0x0, 0x5b5404, 0x0, 0x5d5404, 0x5e5404, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5704, 0xff5704, 0x0, 0xff5704, 0x0, 0x0, 0xff5704, 0xff5704, 0x0, 0x0, 0xff5704, 0x0, 0xff5704, 0xff5704, 0x0,
+    0xff5704, 0x0, 0x0, 0xff5704, 0x0, 0xff5704, 0xff5704, 0x0, 0x0, 0xff5704, 0xff5704, 0x0, 0xff5704, 0x0, 0x0, 0xff5704,
+    0x5704, 0x0, 0x0, 0x35704, 0x0, 0x55704, 0x65704, 0x0, 0x0, 0x95704, 0xa5704, 0x0, 0xc5704, 0x0, 0x0, 0xf5704,
+    0x0, 0x115704, 0x125704, 0x0, 0x145704, 0x0, 0x0, 0x175704, 0x185704, 0x0, 0x0, 0x1b5704, 0x0, 0x1d5704, 0x1e5704, 0x0,
+    0x205704, 0x0, 0x0, 0x235704, 0x0, 0x255704, 0x265704, 0x0, 0x0, 0x295704, 0x2a5704, 0x0, 0x2c5704, 0x0, 0x0, 0x2f5704,
+    0x0, 0x315704, 0x325704, 0x0, 0x345704, 0x0, 0x0, 0x375704, 0x385704, 0x0, 0x0, 0x3b5704, 0x0, 0x3d5704, 0x3e5704, 0x0,
+    0x0, 0x415704, 0x425704, 0x0, 0x445704, 0x0, 0x0, 0x475704, 0x485704, 0x0, 0x0, 0x4b5704, 0x0, 0x4d5704, 0x4e5704, 0x0,
+    0x505704, 0x0, 0x0, 0x535704, 0x0, 0x555704, 0x565704, 0x0, 0x0, 0x595704, 0x5a5704, 0x0, 0x5c5704, 0x0, 0x0, 0x5f5704,
+    0xff5704, 0x0, 0x0, 0xff5704, 0x0, 0xff5704, 0xff5704, 0x0, 0x0, 0xff5704, 0xff5704, 0x0, 0xff5704, 0x0, 0x0, 0xff5704,
+    0x0, 0xff5704, 0xff5704, 0x0, 0xff5704, 0x0, 0x0, 0xff5704, 0xff5704, 0x0, 0x0, 0xff5704, 0x0, 0xff5704, 0xff5704, 0x0,
+    0x0, 0x15704, 0x25704, 0x0, 0x45704, 0x0, 0x0, 0x75704, 0x85704, 0x0, 0x0, 0xb5704, 0x0, 0xd5704, 0xe5704, 0x0,
+    0x105704, 0x0, 0x0, 0x135704, 0x0, 0x155704, 0x165704, 0x0, 0x0, 0x195704, 0x1a5704, 0x0, 0x1c5704, 0x0, 0x0, 0x1f5704,
+    0x0, 0x215704, 0x225704, 0x0, 0x245704, 0x0, 0x0, 0x275704, 0x285704, 0x0, 0x0, 0x2b5704, 0x0, 0x2d5704, 0x2e5704, 0x0,
+    0x305704, 0x0, 0x0, 0x335704, 0x0, 0x355704, 0x365704, 0x0, 0x0, 0x395704, 0x3a5704, 0x0, 0x3c5704, 0x0, 0x0, 0x3f5704,
+    0x405704, 0x0, 0x0, 0x435704, 0x0, 0x455704, 0x465704, 0x0, 0x0, 0x495704, 0x4a5704, 0x0, 0x4c5704, 0x0, 0x0, 0x4f5704,
+    0x0, 0x515704, 0x525704, 0x0, 0x545704, 0x0, 0x0, 0x575704, 0x585704, 0x0, 0x0, 0x5b5704, 0x0, 0x5d5704, 0x5e5704, 0x0,
+    0x0, 0xff5814, 0xff5814, 0x0, 0xff5814, 0x0, 0x0, 0xff5814, 0xff5814, 0x0, 0x0, 0xff5814, 0x0, 0xff5814, 0xff5814, 0x0,
+    0xff5814, 0x0, 0x0, 0xff5814, 0x0, 0xff5814, 0xff5814, 0x0, 0x0, 0xff5814, 0xff5814, 0x0, 0xff5814, 0x0, 0x0, 0xff5814,
+    0x5814, 0x0, 0x0, 0x35814, 0x0, 0x55814, 0x65814, 0x0, 0x0, 0x95814, 0xa5814, 0x0, 0xc5814, 0x0, 0x0, 0xf5814,
+    0x0, 0x115814, 0x125814, 0x0, 0x145814, 0x0, 0x0, 0x175814, 0x185814, 0x0, 0x0, 0x1b5814, 0x0, 0x1d5814, 0x1e5814, 0x0,
+    0x205814, 0x0, 0x0, 0x235814, 0x0, 0x255814, 0x265814, 0x0, 0x0, 0x295814, 0x2a5814, 0x0, 0x2c5814, 0x0, 0x0, 0x2f5814,
+    0x0, 0x315814, 0x325814, 0x0, 0x345814, 0x0, 0x0, 0x375814, 0x385814, 0x0, 0x0, 0x3b5814, 0x0, 0x3d5814, 0x3e5814, 0x0,
+    0x0, 0x415814, 0x425814, 0x0, 0x445814, 0x0, 0x0, 0x475814, 0x485814, 0x0, 0x0, 0x4b5814, 0x0, 0x4d5814, 0x4e5814, 0x0,
+    0x505814, 0x0, 0x0, 0x535814, 0x0, 0x555814, 0x565814, 0x0, 0x0, 0x595814, 0x5a5814, 0x0, 0x5c5814, 0x0, 0x0, 0x5f5814,
+    0xff5814, 0x0, 0x0, 0xff5814, 0x0, 0xff5814, 0xff5814, 0x0, 0x0, 0xff5814, 0xff5814, 0x0, 0xff5814, 0x0, 0x0, 0xff5814,
+    0x0, 0xff5814, 0xff5814, 0x0, 0xff5814, 0x0, 0x0, 0xff5814, 0xff5814, 0x0, 0x0, 0xff5814, 0x0, 0xff5814, 0xff5814, 0x0,
+    0x0, 0x15814, 0x25814, 0x0, 0x45814, 0x0, 0x0, 0x75814, 0x85814, 0x0, 0x0, 0xb5814, 0x0, 0xd5814, 0xe5814, 0x0,
+    0x105814, 0x0, 0x0, 0x135814, 0x0, 0x155814, 0x165814, 0x0, 0x0, 0x195814, 0x1a5814, 0x0, 0x1c5814, 0x0, 0x0, 0x1f5814,
+    0x0, 0x215814, 0x225814, 0x0, 0x245814, 0x0, 0x0, 0x275814, 0x285814, 0x0, 0x0, 0x2b5814, 0x0, 0x2d5814, 0x2e5814, 0x0,
+    0x305814, 0x0, 0x0, 0x335814, 0x0, 0x355814, 0x365814, 0x0, 0x0, 0x395814, 0x3a5814, 0x0, 0x3c5814, 0x0, 0x0, 0x3f5814,
+    0x405814, 0x0, 0x0, 0x435814, 0x0, 0x455814, 0x465814, 0x0, 0x0, 0x495814, 0x4a5814, 0x0, 0x4c5814, 0x0, 0x0, 0x4f5814,
+    0x0, 0x515814, 0x525814, 0x0, 0x545814, 0x0, 0x0, 0x575814, 0x585814, 0x0, 0x0, 0x5b5814, 0x0, 0x5d5814, 0x5e5814, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5b14, 0xff5b14, 0x0, 0xff5b14, 0x0, 0x0, 0xff5b14, 0xff5b14, 0x0, 0x0, 0xff5b14, 0x0, 0xff5b14, 0xff5b14, 0x0,
+    0xff5b14, 0x0, 0x0, 0xff5b14, 0x0, 0xff5b14, 0xff5b14, 0x0, 0x0, 0xff5b14, 0xff5b14, 0x0, 0xff5b14, 0x0, 0x0, 0xff5b14,
+    0x5b14, 0x0, 0x0, 0x35b14, 0x0, 0x55b14, 0x65b14, 0x0, 0x0, 0x95b14, 0xa5b14, 0x0, 0xc5b14, 0x0, 0x0, 0xf5b14,
+    0x0, 0x115b14, 0x125b14, 0x0, 0x145b14, 0x0, 0x0, 0x175b14, 0x185b14, 0x0, 0x0, 0x1b5b14, 0x0, 0x1d5b14, 0x1e5b14, 0x0,
+    0x205b14, 0x0, 0x0, 0x235b14, 0x0, 0x255b14, 0x265b14, 0x0, 0x0, 0x295b14, 0x2a5b14, 0x0, 0x2c5b14, 0x0, 0x0, 0x2f5b14,
+    0x0, 0x315b14, 0x325b14, 0x0, 0x345b14, 0x0, 0x0, 0x375b14, 0x385b14, 0x0, 0x0, 0x3b5b14, 0x0, 0x3d5b14, 0x3e5b14, 0x0,
+    0x0, 0x415b14, 0x425b14, 0x0, 0x445b14, 0x0, 0x0, 0x475b14, 0x485b14, 0x0, 0x0, 0x4b5b14, 0x0, 0x4d5b14, 0x4e5b14, 0x0,
+    0x505b14, 0x0, 0x0, 0x535b14, 0x0, 0x555b14, 0x565b14, 0x0, 0x0, 0x595b14, 0x5a5b14, 0x0, 0x5c5b14, 0x0, 0x0, 0x5f5b14,
+    0xff5b14, 0x0, 0x0, 0xff5b14, 0x0, 0xff5b14, 0xff5b14, 0x0, 0x0, 0xff5b14, 0xff5b14, 0x0, 0xff5b14, 0x0, 0x0, 0xff5b14,
+    0x0, 0xff5b14, 0xff5b14, 0x0, 0xff5b14, 0x0, 0x0, 0xff5b14, 0xff5b14, 0x0, 0x0, 0xff5b14, 0x0, 0xff5b14, 0xff5b14, 0x0,
+    0x0, 0x15b14, 0x25b14, 0x0, 0x45b14, 0x0, 0x0, 0x75b14, 0x85b14, 0x0, 0x0, 0xb5b14, 0x0, 0xd5b14, 0xe5b14, 0x0,
+    0x105b14, 0x0, 0x0, 0x135b14, 0x0, 0x155b14, 0x165b14, 0x0, 0x0, 0x195b14, 0x1a5b14, 0x0, 0x1c5b14, 0x0, 0x0, 0x1f5b14,
+    0x0, 0x215b14, 0x225b14, 0x0, 0x245b14, 0x0, 0x0, 0x275b14, 0x285b14, 0x0, 0x0, 0x2b5b14, 0x0, 0x2d5b14, 0x2e5b14, 0x0,
+    0x305b14, 0x0, 0x0, 0x335b14, 0x0, 0x355b14, 0x365b14, 0x0, 0x0, 0x395b14, 0x3a5b14, 0x0, 0x3c5b14, 0x0, 0x0, 0x3f5b14,
+    0x405b14, 0x0, 0x0, 0x435b14, 0x0, 0x455b14, 0x465b14, 0x0, 0x0, 0x495b14, 0x4a5b14, 0x0, 0x4c5b14, 0x0, 0x0, 0x4f5b14,
+    0x0, 0x515b14, 0x525b14, 0x0, 0x545b14, 0x0, 0x0, 0x575b14, 0x585b14, 0x0, 0x0, 0x5b5b14, 0x0, 0x5d5b14, 0x5e5b14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff5d14, 0xff5d14, 0x0, 0xff5d14, 0x0, 0x0, 0xff5d14, 0xff5d14, 0x0, 0x0, 0xff5d14, 0x0, 0xff5d14, 0xff5d14, 0x0,
+    0xff5d14, 0x0, 0x0, 0xff5d14, 0x0, 0xff5d14, 0xff5d14, 0x0, 0x0, 0xff5d14, 0xff5d14, 0x0, 0xff5d14, 0x0, 0x0, 0xff5d14,
+    0x5d14, 0x0, 0x0, 0x35d14, 0x0, 0x55d14, 0x65d14, 0x0, 0x0, 0x95d14, 0xa5d14, 0x0, 0xc5d14, 0x0, 0x0, 0xf5d14,
+    0x0, 0x115d14, 0x125d14, 0x0, 0x145d14, 0x0, 0x0, 0x175d14, 0x185d14, 0x0, 0x0, 0x1b5d14, 0x0, 0x1d5d14, 0x1e5d14, 0x0,
+    0x205d14, 0x0, 0x0, 0x235d14, 0x0, 0x255d14, 0x265d14, 0x0, 0x0, 0x295d14, 0x2a5d14, 0x0, 0x2c5d14, 0x0, 0x0, 0x2f5d14,
+    0x0, 0x315d14, 0x325d14, 0x0, 0x345d14, 0x0, 0x0, 0x375d14, 0x385d14, 0x0, 0x0, 0x3b5d14, 0x0, 0x3d5d14, 0x3e5d14, 0x0,
+    0x0, 0x415d14, 0x425d14, 0x0, 0x445d14, 0x0, 0x0, 0x475d14, 0x485d14, 0x0, 0x0, 0x4b5d14, 0x0, 0x4d5d14, 0x4e5d14, 0x0,
+    0x505d14, 0x0, 0x0, 0x535d14, 0x0, 0x555d14, 0x565d14, 0x0, 0x0, 0x595d14, 0x5a5d14, 0x0, 0x5c5d14, 0x0, 0x0, 0x5f5d14,
+    0xff5d14, 0x0, 0x0, 0xff5d14, 0x0, 0xff5d14, 0xff5d14, 0x0, 0x0, 0xff5d14, 0xff5d14, 0x0, 0xff5d14, 0x0, 0x0, 0xff5d14,
+    0x0, 0xff5d14, 0xff5d14, 0x0, 0xff5d14, 0x0, 0x0, 0xff5d14, 0xff5d14, 0x0, 0x0, 0xff5d14, 0x0, 0xff5d14, 0xff5d14, 0x0,
+    0x0, 0x15d14, 0x25d14, 0x0, 0x45d14, 0x0, 0x0, 0x75d14, 0x85d14, 0x0, 0x0, 0xb5d14, 0x0, 0xd5d14, 0xe5d14, 0x0,
+    0x105d14, 0x0, 0x0, 0x135d14, 0x0, 0x155d14, 0x165d14, 0x0, 0x0, 0x195d14, 0x1a5d14, 0x0, 0x1c5d14, 0x0, 0x0, 0x1f5d14,
+    0x0, 0x215d14, 0x225d14, 0x0, 0x245d14, 0x0, 0x0, 0x275d14, 0x285d14, 0x0, 0x0, 0x2b5d14, 0x0, 0x2d5d14, 0x2e5d14, 0x0,
+    0x305d14, 0x0, 0x0, 0x335d14, 0x0, 0x355d14, 0x365d14, 0x0, 0x0, 0x395d14, 0x3a5d14, 0x0, 0x3c5d14, 0x0, 0x0, 0x3f5d14,
+    0x405d14, 0x0, 0x0, 0x435d14, 0x0, 0x455d14, 0x465d14, 0x0, 0x0, 0x495d14, 0x4a5d14, 0x0, 0x4c5d14, 0x0, 0x0, 0x4f5d14,
+    0x0, 0x515d14, 0x525d14, 0x0, 0x545d14, 0x0, 0x0, 0x575d14, 0x585d14, 0x0, 0x0, 0x5b5d14, 0x0, 0x5d5d14, 0x5e5d14, 0x0,
+    0x0, 0xff5e14, 0xff5e14, 0x0, 0xff5e14, 0x0, 0x0, 0xff5e14, 0xff5e14, 0x0, 0x0, 0xff5e14, 0x0, 0xff5e14, 0xff5e14, 0x0,
+    0xff5e14, 0x0, 0x0, 0xff5e14, 0x0, 0xff5e14, 0xff5e14, 0x0, 0x0, 0xff5e14, 0xff5e14, 0x0, 0xff5e14, 0x0, 0x0, 0xff5e14,
+    0x5e14, 0x0, 0x0, 0x35e14, 0x0, 0x55e14, 0x65e14, 0x0, 0x0, 0x95e14, 0xa5e14, 0x0, 0xc5e14, 0x0, 0x0, 0xf5e14,
+    0x0, 0x115e14, 0x125e14, 0x0, 0x145e14, 0x0, 0x0, 0x175e14, 0x185e14, 0x0, 0x0, 0x1b5e14, 0x0, 0x1d5e14, 0x1e5e14, 0x0,
+    0x205e14, 0x0, 0x0, 0x235e14, 0x0, 0x255e14, 0x265e14, 0x0, 0x0, 0x295e14, 0x2a5e14, 0x0, 0x2c5e14, 0x0, 0x0, 0x2f5e14,
+    0x0, 0x315e14, 0x325e14, 0x0, 0x345e14, 0x0, 0x0, 0x375e14, 0x385e14, 0x0, 0x0, 0x3b5e14, 0x0, 0x3d5e14, 0x3e5e14, 0x0,
+    0x0, 0x415e14, 0x425e14, 0x0, 0x445e14, 0x0, 0x0, 0x475e14, 0x485e14, 0x0, 0x0, 0x4b5e14, 0x0, 0x4d5e14, 0x4e5e14, 0x0,
+    0x505e14, 0x0, 0x0, 0x535e14, 0x0, 0x555e14, 0x565e14, 0x0, 0x0, 0x595e14, 0x5a5e14, 0x0, 0x5c5e14, 0x0, 0x0, 0x5f5e14,
+    0xff5e14, 0x0, 0x0, 0xff5e14, 0x0, 0xff5e14, 0xff5e14, 0x0, 0x0, 0xff5e14, 0xff5e14, 0x0, 0xff5e14, 0x0, 0x0, 0xff5e14,
+    0x0, 0xff5e14, 0xff5e14, 0x0, 0xff5e14, 0x0, 0x0, 0xff5e14, 0xff5e14, 0x0, 0x0, 0xff5e14, 0x0, 0xff5e14, 0xff5e14, 0x0,
+    0x0, 0x15e14, 0x25e14, 0x0, 0x45e14, 0x0, 0x0, 0x75e14, 0x85e14, 0x0, 0x0, 0xb5e14, 0x0, 0xd5e14, 0xe5e14, 0x0,
+    0x105e14, 0x0, 0x0, 0x135e14, 0x0, 0x155e14, 0x165e14, 0x0, 0x0, 0x195e14, 0x1a5e14, 0x0, 0x1c5e14, 0x0, 0x0, 0x1f5e14,
+    0x0, 0x215e14, 0x225e14, 0x0, 0x245e14, 0x0, 0x0, 0x275e14, 0x285e14, 0x0, 0x0, 0x2b5e14, 0x0, 0x2d5e14, 0x2e5e14, 0x0,
+    0x305e14, 0x0, 0x0, 0x335e14, 0x0, 0x355e14, 0x365e14, 0x0, 0x0, 0x395e14, 0x3a5e14, 0x0, 0x3c5e14, 0x0, 0x0, 0x3f5e14,
+    0x405e14, 0x0, 0x0, 0x435e14, 0x0, 0x455e14, 0x465e14, 0x0, 0x0, 0x495e14, 0x4a5e14, 0x0, 0x4c5e14, 0x0, 0x0, 0x4f5e14,
+    0x0, 0x515e14, 0x525e14, 0x0, 0x545e14, 0x0, 0x0, 0x575e14, 0x585e14, 0x0, 0x0, 0x5b5e14, 0x0, 0x5d5e14, 0x5e5e14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+const eia608_decoded_t* eia608_decode_table() { return &_eia608_decode_table[0]; }
@@ -0,0 +1,686 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "eia608_encoder.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Basic North American charcter displayed by decoders that do not support an
+// extended charcter. Indexed by the low 6 bits of 0x1220-0x123F and 0x1320-0x133F
+static const char eia608_westeu_fallback_map[64] = {
+    'A', 'E', 'O', 'U', 'U', 'u', '\'', '!', // 0x1220
+    ' ', '\'', '-', 'c', ' ', '.', '"', '"', // 0x1228
+    'A', 'A', 'C', 'E', 'E', 'E', 'e', 'I', // 0x1230
+    'I', 'i', 'O', 'U', 'u', 'U', '"', '"', // 0x1238
+    'A', 'a', 'I', 'I', 'i', 'O', 'o', 'O', // 0x1320
+    'o', '[', ']', '/', ' ', '-', ' ', '-', // 0x1328
+    'A', 'a', 'O', 'o', 's', 'Y', ' ', ' ', // 0x1330
+    'A', 'a', 'O', 'o', '+', '+', '+', '+', // 0x1338
+};
+
+static uint16_t eia608_westeu_fallback(uint16_t cc_data)
+{
+    return eia608_parity(eia608_westeu_fallback_map[((cc_data & 0x0100) >> 3) | (cc_data & 0x1F)] << 8);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Packs charcters into cc_data words
+typedef struct {
+    uint16_t* cc_data;
+    size_t size;
+    size_t count;
+    uint16_t pending; // basicna charcter waiting for a second charcter
+    uint16_t breaker; // no-op control code used to separate repeated codes
+    uint16_t last; // last word written, decoders discard repeated control codes
+    caption_frame_t* shadow; // if set, every word written is also decoded here
+} eia608_writer_t;
+
+static void eia608_writer_init(eia608_writer_t* w, uint16_t* cc_data, size_t size, uint16_t breaker)
+{
+    w->cc_data = cc_data;
+    w->size = size;
+    w->count = 0;
+    w->pending = 0;
+    w->breaker = breaker;
+    w->last = 0;
+    w->shadow = 0;
+}
+
+static inline size_t eia608_writer_avail(eia608_writer_t* w) { return w->size - w->count; }
+static inline uint16_t eia608_writer_last(eia608_writer_t* w) { return w->last; }
+
+static void eia608_writer_put(eia608_writer_t* w, uint16_t cc_data)
+{
+    if (w->count < w->size) {
+        w->cc_data[w->count++] = cc_data;
+        w->last = cc_data;
+
+        if (w->shadow) {
+            caption_frame_decode(w->shadow, cc_data, 0);
+        }
+    }
+}
+
+static void eia608_writer_flush(eia608_writer_t* w)
+{
+    if (w->pending) {
+        eia608_writer_put(w, w->pending);
+        w->pending = 0;
+    }
+}
+
+// Writes a charcter returned from eia608_from_utf8_1. At most 3 words are written
+static void eia608_writer_char(eia608_writer_t* w, uint16_t cc_data)
+{
+    if (eia608_is_basicna(cc_data)) {
+        if (w->pending) {
+            eia608_writer_put(w, eia608_from_basicna(w->pending, cc_data));
+            w->pending = 0;
+        } else {
+            w->pending = cc_data;
+        }
+    } else if (eia608_is_westeu(cc_data)) {
+        // extended charcters overwrite the previous charcter, so write a fallback first
+        uint16_t fallback = eia608_westeu_fallback(cc_data);
+        eia608_writer_put(w, w->pending ? eia608_from_basicna(w->pending, fallback) : fallback);
+        eia608_writer_put(w, cc_data);
+        w->pending = 0;
+    } else {
+        eia608_writer_flush(w);
+
+        // Repeated specialna are discarded as duplicates, so break the repetition
+        if (cc_data == eia608_writer_last(w)) {
+            eia608_writer_put(w, w->breaker);
+        }
+
+        eia608_writer_put(w, cc_data);
+    }
+}
+
+// Writes a control code, preamble or mid-row change. At most 3 words are written
+static void eia608_writer_control(eia608_writer_t* w, uint16_t cc_data)
+{
+    eia608_writer_flush(w);
+
+    if (cc_data == eia608_writer_last(w)) {
+        if (cc_data == w->breaker) {
+            return; // already in effect
+        }
+
+        eia608_writer_put(w, w->breaker);
+    }
+
+    eia608_writer_put(w, cc_data);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Encodes 16 bytes as 8 basicna pairs if every byte is ascii that maps directly
+// to basicna. Returns 0, and writes nothing, otherwise.
+#if defined(__SSE2__) || defined(_M_X64)
+static int eia608_encode_ascii16(const utf8_char_t* data, uint16_t* cc_data)
+{
+    __m128i x = _mm_loadu_si128((const __m128i*)data);
+    // 0x20 - 0x7A excluding the charcters that 608 displays differently than ascii
+    __m128i plain = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8(0x1F)), _mm_cmplt_epi8(x, _mm_set1_epi8(0x7B)));
+    __m128i except = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x27)), _mm_cmpeq_epi8(x, _mm_set1_epi8(0x2A))),
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x5C)), _mm_cmpeq_epi8(x, _mm_set1_epi8(0x5E))),
+            _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x5F)), _mm_cmpeq_epi8(x, _mm_set1_epi8(0x60)))));
+
+    if (0xFFFF != _mm_movemask_epi8(_mm_andnot_si128(except, plain))) {
+        return 0;
+    }
+
+    // odd parity: set bit 7 when the low 7 bits have an even number of ones
+    __m128i t = _mm_xor_si128(x, _mm_and_si128(_mm_srli_epi16(x, 4), _mm_set1_epi8(0x0F)));
+    t = _mm_xor_si128(t, _mm_srli_epi16(t, 2));
+    t = _mm_xor_si128(t, _mm_srli_epi16(t, 1));
+    t = _mm_andnot_si128(t, _mm_set1_epi8(0x01));
+    x = _mm_or_si128(x, _mm_slli_epi16(t, 7));
+    // first charcter goes in the high byte
+    x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+    _mm_storeu_si128((__m128i*)cc_data, x);
+    return 1;
+}
+#else
+static int eia608_encode_ascii16(const utf8_char_t* data, uint16_t* cc_data)
+{
+    return 0;
+}
+#endif
+
+size_t eia608_encode_text(const utf8_char_t* text, int cc, uint16_t* cc_data, size_t size)
+{
+    eia608_writer_t w;
+    eia608_writer_init(&w, cc_data, size, eia608_control_command(eia608_control_resume_caption_loading, cc));
+
+    for (int r = 0; (*text) && r < SCREEN_ROWS; ++r) {
+        // skip whitespace at start of line
+        while ((*text) && utf8_char_whitespace(text)) {
+            text += utf8_char_length(text);
+        }
+
+        utf8_size_t char_count = utf8_wrap_length(text, SCREEN_COLS);
+
+        if (0 == (*text) || 0 == char_count || 5 > eia608_writer_avail(&w)) {
+            break;
+        }
+
+        eia608_writer_put(&w, eia608_row_column_pramble(r, 0, cc & 0x01, 0));
+
+        for (utf8_size_t c = 0; c < char_count && (*text);) {
+            if (!w.pending && 16 <= char_count - c && 12 <= eia608_writer_avail(&w) && eia608_encode_ascii16(text, &w.cc_data[w.count])) {
+                w.last = w.cc_data[w.count + 7];
+                w.count += 8, text += 16, c += 16;
+                continue;
+            }
+
+            // room for the charcter plus a pending flush at the end of the row
+            if (4 > eia608_writer_avail(&w)) {
+                break;
+            }
+
+            size_t char_length = utf8_char_length(text);
+            uint16_t word = eia608_from_utf8_1(text, cc & 0x01);
+
+            if (word) {
+                eia608_writer_char(&w, word);
+            }
+
+            text += char_length ? char_length : 1, ++c;
+        }
+
+        eia608_writer_flush(&w);
+    }
+
+    return w.count;
+}
+////////////////////////////////////////////////////////////////////////////////
+// Incremental encoder
+#define EIA608_ENCODER_ROLLUP_BASE (SCREEN_ROWS - 1)
+// EIA608_ENCODER_STEP_WORDS covers a single cell: preamble, tab and mid-row change
+// each with a breaker, plus a pending charcter and an extended charcter with its fallback
+
+static uint16_t eia608_encoder_mode_command(eia608_encoder_mode_t mode, int cc)
+{
+    switch (mode) {
+    default:
+    case eia608_encoder_popon:
+        return eia608_control_command(eia608_control_resume_caption_loading, cc);
+    case eia608_encoder_painton:
+        return eia608_control_command(eia608_control_resume_direct_captioning, cc);
+    case eia608_encoder_rollup_2:
+        return eia608_control_command(eia608_control_roll_up_2, cc);
+    case eia608_encoder_rollup_3:
+        return eia608_control_command(eia608_control_roll_up_3, cc);
+    case eia608_encoder_rollup_4:
+        return eia608_control_command(eia608_control_roll_up_4, cc);
+    }
+}
+
+static inline int eia608_encoder_rollup(eia608_encoder_t* enc) { return eia608_encoder_rollup_2 <= enc->mode ? (int)enc->mode : 0; }
+
+void eia608_encoder_init(eia608_encoder_t* enc, eia608_encoder_mode_t mode, int cc)
+{
+    enc->mode = mode;
+    enc->cc = cc;
+    enc->loading = 0;
+    enc->queued = 0;
+    caption_frame_init(&enc->shadow);
+}
+
+// Returns words queued by an earlier call
+static size_t eia608_encoder_drain(eia608_encoder_t* enc, uint16_t* cc_data, size_t size)
+{
+    size_t count = size < enc->queued ? size : enc->queued;
+    memcpy(cc_data, &enc->queue[0], count * sizeof(uint16_t));
+    memmove(&enc->queue[0], &enc->queue[count], (enc->queued - count) * sizeof(uint16_t));
+    enc->queued -= count;
+    return count;
+}
+
+// Cells that can not be encoded are treated as blank
+static int eia608_encoder_cell_blank(const caption_frame_cell_t* cell)
+{
+    return 0 == cell->data[0] || 0 == eia608_from_utf8_1(&cell->data[0], 0);
+}
+
+static int eia608_encoder_cell_equal(const caption_frame_cell_t* want, const caption_frame_cell_t* have)
+{
+    if (eia608_encoder_cell_blank(want)) {
+        return 0 == have->data[0];
+    }
+
+    return want->sty == have->sty && want->uln == have->uln && 0 == strcmp(&want->data[0], &have->data[0]);
+}
+
+static int eia608_encoder_row_equal(caption_frame_t* frame, int src, const caption_frame_buffer_t* have, int dst)
+{
+    for (int c = 0; c < SCREEN_COLS; ++c) {
+        if (!eia608_encoder_cell_equal(&frame->front.cell[src][c], &have->cell[dst][c])) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static int eia608_encoder_row_blank(const caption_frame_buffer_t* buff, int row)
+{
+    for (int c = 0; c < SCREEN_COLS; ++c) {
+        if (!eia608_encoder_cell_blank(&buff->cell[row][c])) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static int eia608_encoder_rows_blank(const caption_frame_buffer_t* buff, int first, int last)
+{
+    for (int r = first; r <= last; ++r) {
+        if (!eia608_encoder_row_blank(buff, r)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+// Moves the decoder cursor to row and col, then selects the pen
+static void eia608_encoder_seek(eia608_encoder_t* enc, eia608_writer_t* w, int row, int col, eia608_style_t sty, int uln)
+{
+    caption_frame_state_t* state = &enc->shadow.state;
+    int chan = enc->cc & 0x01;
+    int cur = state->col + (w->pending ? 1 : 0);
+
+    if (row == state->row && col == cur) {
+        // already there
+    } else if (row == state->row && cur < col && 4 > col - cur) {
+        eia608_writer_control(w, eia608_tab(col - cur, enc->cc));
+    } else if (0 == col && eia608_style_white != sty) {
+        eia608_writer_control(w, eia608_row_style_pramble(row, chan, sty, uln));
+    } else {
+        eia608_writer_control(w, eia608_row_column_pramble(row, col, chan, uln));
+
+        if (col % 4) {
+            eia608_writer_control(w, eia608_tab(col % 4, enc->cc));
+        }
+    }
+
+    if ((unsigned)sty != state->sty || (unsigned)uln != state->uln) {
+        eia608_writer_control(w, eia608_midrow_change(chan, sty, uln));
+    }
+}
+
+// Rewrites the changed cells of row dst so it matches row src of frame. Returns 0
+// if cc_data filled up first
+static int eia608_encoder_row(eia608_encoder_t* enc, eia608_writer_t* w, caption_frame_t* frame, int src, int dst)
+{
+    caption_frame_buffer_t* have = caption_frame_popon(&enc->shadow) ? &enc->shadow.back : &enc->shadow.front;
+    caption_frame_state_t* state = &enc->shadow.state;
+
+    for (int c = 0; c < SCREEN_COLS; ++c) {
+        const caption_frame_cell_t* want = &frame->front.cell[src][c];
+
+        if (eia608_encoder_cell_equal(want, &have->cell[dst][c])) {
+            continue;
+        }
+
+        if (EIA608_ENCODER_STEP_WORDS > eia608_writer_avail(w)) {
+            return 0;
+        }
+
+        if (!eia608_encoder_cell_blank(want)) {
+            eia608_encoder_seek(enc, w, dst, c, want->sty, want->uln);
+            eia608_writer_char(w, eia608_from_utf8_1(&want->data[0], enc->cc & 0x01));
+        } else if (SCREEN_COLS > c + 1 && !eia608_encoder_cell_blank(want + 1)) {
+            // a single blank cell, backspace over it
+            eia608_encoder_seek(enc, w, dst, c + 1, state->sty, state->uln);
+            eia608_writer_control(w, eia608_control_command(eia608_control_backspace, enc->cc));
+        } else {
+            // clear the rest of the row, anything after the gap is rewritten
+            eia608_encoder_seek(enc, w, dst, c, state->sty, state->uln);
+            eia608_writer_control(w, eia608_control_command(eia608_control_delete_to_end_of_row, enc->cc));
+        }
+    }
+
+    return 1;
+}
+
+static void eia608_encoder_popon_frame(eia608_encoder_t* enc, eia608_writer_t* w, caption_frame_t* frame)
+{
+    if (!enc->loading) {
+        if (eia608_encoder_rows_blank(&frame->front, 0, SCREEN_ROWS - 1)) {
+            if (!eia608_encoder_rows_blank(&enc->shadow.front, 0, SCREEN_ROWS - 1)) {
+                eia608_writer_control(w, eia608_control_command(eia608_control_erase_display_memory, enc->cc));
+            }
+
+            return;
+        }
+
+        int r;
+        for (r = 0; r < SCREEN_ROWS && eia608_encoder_row_equal(frame, r, &enc->shadow.front, r); ++r) {
+        }
+
+        if (SCREEN_ROWS == r) {
+            return;
+        }
+
+        eia608_writer_control(w, eia608_control_command(eia608_control_erase_non_displayed_memory, enc->cc));
+        eia608_writer_control(w, eia608_control_command(eia608_control_resume_caption_loading, enc->cc));
+        enc->loading = 1;
+    }
+
+    for (int r = 0; r < SCREEN_ROWS; ++r) {
+        if (!eia608_encoder_row(enc, w, frame, r, r)) {
+            return;
+        }
+    }
+
+    // The caption is only complete once end of caption is written
+    if (EIA608_ENCODER_STEP_WORDS > eia608_writer_avail(w)) {
+        return;
+    }
+
+    eia608_writer_control(w, eia608_control_command(eia608_control_end_of_caption, enc->cc));
+    enc->loading = 0;
+}
+
+static void eia608_encoder_painton_frame(eia608_encoder_t* enc, eia608_writer_t* w, caption_frame_t* frame)
+{
+    int kept = 0, shown = 0;
+
+    for (int r = 0; r < SCREEN_ROWS; ++r) {
+        for (int c = 0; c < SCREEN_COLS; ++c) {
+            const caption_frame_cell_t* have = &enc->shadow.front.cell[r][c];
+
+            if (have->data[0]) {
+                shown += 1;
+                kept += eia608_encoder_cell_equal(&frame->front.cell[r][c], have);
+            }
+        }
+    }
+
+    // Nothing on screen survives, erasing is cheaper than deleting row by row
+    if (shown && !kept) {
+        eia608_writer_control(w, eia608_control_command(eia608_control_erase_display_memory, enc->cc));
+    }
+
+    for (int r = 0; r < SCREEN_ROWS; ++r) {
+        if (!eia608_encoder_row(enc, w, frame, r, r)) {
+            return;
+        }
+    }
+}
+
+// Returns how many lines frame is ahead of the displayed window, that is the
+// number of carriage returns after which the rows above the base row match
+static int eia608_encoder_rollup_count(eia608_encoder_t* enc, caption_frame_t* frame)
+{
+    int base = EIA608_ENCODER_ROLLUP_BASE;
+    int top = base - eia608_encoder_rollup(enc) + 1;
+    int k;
+
+    for (k = 0; k < base - top + 1; ++k) {
+        int r;
+        for (r = top + k; r < base && eia608_encoder_row_equal(frame, r - k, &enc->shadow.front, r); ++r) {
+        }
+
+        if (base == r) {
+            break;
+        }
+    }
+
+    return k;
+}
+
+static int eia608_encoder_carriage_return(eia608_encoder_t* enc, eia608_writer_t* w)
+{
+    if (EIA608_ENCODER_STEP_WORDS > eia608_writer_avail(w)) {
+        return 0;
+    }
+
+    // carriage return rolls up the window above the cursor
+    if (EIA608_ENCODER_ROLLUP_BASE != enc->shadow.state.row) {
+        eia608_writer_control(w, eia608_row_column_pramble(EIA608_ENCODER_ROLLUP_BASE, 0, enc->cc & 0x01, 0));
+    }
+
+    eia608_writer_control(w, eia608_control_command(eia608_control_carriage_return, enc->cc));
+    return 1;
+}
+
+static void eia608_encoder_rollup_frame(eia608_encoder_t* enc, eia608_writer_t* w, caption_frame_t* frame)
+{
+    int base = EIA608_ENCODER_ROLLUP_BASE;
+    int rows = eia608_encoder_rollup(enc);
+
+    if (eia608_encoder_rows_blank(&frame->front, base - rows + 1, base)) {
+        if (!eia608_encoder_rows_blank(&enc->shadow.front, 0, SCREEN_ROWS - 1)) {
+            eia608_writer_control(w, eia608_control_command(eia608_control_erase_display_memory, enc->cc));
+        }
+
+        return;
+    }
+
+    // Finish the line on the base row, then roll up and write each following line
+    for (int k = eia608_encoder_rollup_count(enc, frame);; --k) {
+        if (!eia608_encoder_row(enc, w, frame, base - k, base)) {
+            return;
+        }
+
+        if (0 == k || !eia608_encoder_carriage_return(enc, w)) {
+            return;
+        }
+    }
+}
+
+static void eia608_encoder_writer_init(eia608_encoder_t* enc, eia608_writer_t* w, uint16_t* cc_data, size_t size)
+{
+    eia608_writer_init(w, cc_data, size, eia608_encoder_mode_command(enc->mode, enc->cc));
+    w->last = enc->shadow.state.cc_data;
+    w->shadow = &enc->shadow;
+
+    // Select the mode if the decoder is not already in it. Pop-on selects it per caption
+    if (eia608_encoder_popon != enc->mode && EIA608_ENCODER_STEP_WORDS <= eia608_writer_avail(w)) {
+        if (!caption_frame_painton(&enc->shadow) || eia608_encoder_rollup(enc) != caption_frame_rollup(&enc->shadow)) {
+            eia608_writer_control(w, w->breaker);
+        }
+    }
+}
+
+static size_t eia608_encoder_frame_words(eia608_encoder_t* enc, caption_frame_t* frame, uint16_t* cc_data, size_t size)
+{
+    eia608_writer_t w;
+    eia608_encoder_writer_init(enc, &w, cc_data, size);
+
+    if (EIA608_ENCODER_STEP_WORDS > eia608_writer_avail(&w)) {
+        return w.count;
+    }
+
+    if (eia608_encoder_popon == enc->mode) {
+        eia608_encoder_popon_frame(enc, &w, frame);
+    } else if (eia608_encoder_rollup(enc)) {
+        eia608_encoder_rollup_frame(enc, &w, frame);
+    } else {
+        eia608_encoder_painton_frame(enc, &w, frame);
+    }
+
+    eia608_writer_flush(&w);
+    return w.count;
+}
+
+size_t eia608_encoder_from_caption_frame(eia608_encoder_t* enc, caption_frame_t* frame, uint16_t* cc_data, size_t size)
+{
+    size_t count = eia608_encoder_drain(enc, cc_data, size);
+
+    if (count == size) {
+        return count;
+    }
+
+    if (EIA608_ENCODER_STEP_WORDS <= size - count) {
+        return count + eia608_encoder_frame_words(enc, frame, &cc_data[count], size - count);
+    }
+
+    // Too small for a step, encode one into the queue and return what fits
+    enc->queued = eia608_encoder_frame_words(enc, frame, &enc->queue[0], EIA608_ENCODER_STEP_WORDS);
+    return count + eia608_encoder_drain(enc, &cc_data[count], size - count);
+}
+////////////////////////////////////////////////////////////////////////////////
+// Live text
+static int eia608_encoder_newline(eia608_encoder_t* enc, eia608_writer_t* w)
+{
+    if (eia608_encoder_rollup(enc)) {
+        return eia608_encoder_carriage_return(enc, w);
+    }
+
+    int row = enc->shadow.state.row + 1;
+
+    if (SCREEN_ROWS <= row) {
+        eia608_writer_control(w, eia608_control_command(eia608_control_erase_display_memory, enc->cc));
+        row = EIA608_ENCODER_PAINTON_TOP;
+    }
+
+    eia608_encoder_seek(enc, w, row, 0, eia608_style_white, 0);
+
+    if (!eia608_encoder_row_blank(&enc->shadow.front, row)) {
+        eia608_writer_control(w, eia608_control_command(eia608_control_delete_to_end_of_row, enc->cc));
+    }
+
+    return 1;
+}
+
+// Number of charcters before the next whitespace
+static utf8_size_t eia608_encoder_word_length(const utf8_char_t* text)
+{
+    utf8_size_t chars = 0;
+
+    while ((*text) && !utf8_char_whitespace(text)) {
+        size_t char_length = utf8_char_length(text);
+        text += char_length ? char_length : 1, ++chars;
+    }
+
+    return chars;
+}
+
+static size_t eia608_encoder_text_words(eia608_encoder_t* enc, const utf8_char_t* text, uint16_t* cc_data, size_t size, size_t* used)
+{
+    eia608_writer_t w;
+    const utf8_char_t* start = text;
+    caption_frame_state_t* state = &enc->shadow.state;
+    eia608_encoder_writer_init(enc, &w, cc_data, size);
+
+    if (eia608_encoder_popon == enc->mode) {
+        text += strlen(text);
+    }
+
+    int row = eia608_encoder_rollup(enc) ? EIA608_ENCODER_ROLLUP_BASE : state->row;
+
+    if (!eia608_encoder_rollup(enc) && 0 == state->col && eia608_encoder_rows_blank(&enc->shadow.front, 0, SCREEN_ROWS - 1)) {
+        row = EIA608_ENCODER_PAINTON_TOP;
+    }
+
+    // A word starts after whitespace or at the beginning of a line
+    const caption_frame_cell_t* prev = (row == state->row && 0 < state->col && SCREEN_COLS >= state->col) ? &enc->shadow.front.cell[row][state->col - 1] : 0;
+    int boundary = !prev || !prev->data[0] || utf8_char_whitespace(&prev->data[0]);
+
+    while ((*text) && EIA608_ENCODER_STEP_WORDS <= eia608_writer_avail(&w)) {
+        size_t char_length = utf8_char_length(text);
+        int col = row == state->row ? state->col + (w.pending ? 1 : 0) : 0;
+
+        if ('\r' == (*text)) {
+            text += 1;
+            continue;
+        }
+
+        if ('\n' == (*text)) {
+            if (!eia608_encoder_newline(enc, &w)) {
+                break;
+            }
+
+            row = state->row, boundary = 1, text += 1;
+            continue;
+        }
+
+        if (utf8_char_whitespace(text)) {
+            // whitespace is dropped at the start and end of a line
+            if (0 < col && SCREEN_COLS > col) {
+                eia608_encoder_seek(enc, &w, row, col, eia608_style_white, 0);
+                eia608_writer_char(&w, eia608_from_utf8_1(EIA608_CHAR_SPACE, enc->cc & 0x01));
+            }
+
+            boundary = 1, text += char_length ? char_length : 1;
+            continue;
+        }
+
+        if (0 < col && (SCREEN_COLS <= col || (boundary && SCREEN_COLS < col + eia608_encoder_word_length(text)))) {
+            if (!eia608_encoder_newline(enc, &w)) {
+                break;
+            }
+
+            row = state->row;
+            continue;
+        }
+
+        uint16_t cc_data = eia608_from_utf8_1(text, enc->cc & 0x01);
+
+        if (cc_data) {
+            eia608_encoder_seek(enc, &w, row, col, eia608_style_white, 0);
+            eia608_writer_char(&w, cc_data);
+        }
+
+        boundary = 0, text += char_length ? char_length : 1;
+    }
+
+    eia608_writer_flush(&w);
+
+    if (used) {
+        (*used) = text - start;
+    }
+
+    return w.count;
+}
+
+size_t eia608_encoder_append_text(eia608_encoder_t* enc, const utf8_char_t* text, uint16_t* cc_data, size_t size, size_t* used)
+{
+    size_t count = eia608_encoder_drain(enc, cc_data, size);
+
+    if (count == size) {
+        if (used) {
+            (*used) = 0;
+        }
+
+        return count;
+    }
+
+    if (EIA608_ENCODER_STEP_WORDS <= size - count) {
+        return count + eia608_encoder_text_words(enc, text, &cc_data[count], size - count, used);
+    }
+
+    // Too small for a step, encode one into the queue and return what fits
+    enc->queued = eia608_encoder_text_words(enc, text, &enc->queue[0], EIA608_ENCODER_STEP_WORDS, used);
+    return count + eia608_encoder_drain(enc, &cc_data[count], size - count);
+}
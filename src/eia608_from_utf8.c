@@ -0,0 +1,128 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "utf8.h"
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Maps a single utf8 charcter to its (parity-less) cc_data. Basic North American
+// charcters are returned in the high byte, everything else is a two byte code.
+// Unmapped charcters return 0x0000.
+
+// Indexed by the ascii value
+static const uint16_t eia608_from_ascii[0x80] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x00
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x08
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x10
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x18
+    0x2000, 0x2100, 0x2200, 0x2300, 0x2400, 0x2500, 0x2600, 0x1229, // 0x20
+    0x2800, 0x2900, 0x1228, 0x2B00, 0x2C00, 0x2D00, 0x2E00, 0x2F00, // 0x28
+    0x3000, 0x3100, 0x3200, 0x3300, 0x3400, 0x3500, 0x3600, 0x3700, // 0x30
+    0x3800, 0x3900, 0x3A00, 0x3B00, 0x3C00, 0x3D00, 0x3E00, 0x3F00, // 0x38
+    0x4000, 0x4100, 0x4200, 0x4300, 0x4400, 0x4500, 0x4600, 0x4700, // 0x40
+    0x4800, 0x4900, 0x4A00, 0x4B00, 0x4C00, 0x4D00, 0x4E00, 0x4F00, // 0x48
+    0x5000, 0x5100, 0x5200, 0x5300, 0x5400, 0x5500, 0x5600, 0x5700, // 0x50
+    0x5800, 0x5900, 0x5A00, 0x5B00, 0x132B, 0x5D00, 0x132C, 0x132D, // 0x58
+    0x1226, 0x6100, 0x6200, 0x6300, 0x6400, 0x6500, 0x6600, 0x6700, // 0x60
+    0x6800, 0x6900, 0x6A00, 0x6B00, 0x6C00, 0x6D00, 0x6E00, 0x6F00, // 0x68
+    0x7000, 0x7100, 0x7200, 0x7300, 0x7400, 0x7500, 0x7600, 0x7700, // 0x70
+    0x7800, 0x7900, 0x7A00, 0x1329, 0x132E, 0x132A, 0x132F, 0x0000, // 0x78
+};
+
+// Indexed by code point - 0x80 (U+0080 to U+00FF, two byte sequences starting with 0xC2 or 0xC3)
+static const uint16_t eia608_from_latin1[0x80] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // U+0080
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // U+0088
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // U+0090
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // U+0098
+    0x1139, 0x1227, 0x1135, 0x1136, 0x1336, 0x1335, 0x1337, 0x0000, // U+00A0
+    0x0000, 0x122B, 0x0000, 0x123E, 0x0000, 0x0000, 0x1130, 0x0000, // U+00A8
+    0x1131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // U+00B0
+    0x0000, 0x0000, 0x0000, 0x123F, 0x0000, 0x1132, 0x0000, 0x1133, // U+00B8
+    0x1230, 0x1220, 0x1231, 0x1320, 0x1330, 0x1338, 0x0000, 0x1232, // U+00C0
+    0x1233, 0x1221, 0x1234, 0x1235, 0x1323, 0x1322, 0x1237, 0x1238, // U+00C8
+    0x0000, 0x7D00, 0x1325, 0x1222, 0x123A, 0x1327, 0x1332, 0x0000, // U+00D0
+    0x133A, 0x123B, 0x1223, 0x123D, 0x1224, 0x0000, 0x0000, 0x1334, // U+00D8
+    0x1138, 0x2A00, 0x113B, 0x1321, 0x1331, 0x1339, 0x0000, 0x7B00, // U+00E0
+    0x113A, 0x5C00, 0x113C, 0x1236, 0x1324, 0x5E00, 0x113D, 0x1239, // U+00E8
+    0x0000, 0x7E00, 0x1326, 0x5F00, 0x113E, 0x1328, 0x1333, 0x7C00, // U+00F0
+    0x133B, 0x123C, 0x6000, 0x113F, 0x1225, 0x0000, 0x0000, 0x0000, // U+00F8
+};
+
+// The remaining charcters are all three byte sequences. They are placed by a perfect
+// hash; the stored code point confirms the match.
+#define EIA608_FROM_UTF8_HASH(CP) ((((CP)*115) >> 5) & 0x0F)
+static const struct {
+    uint16_t code_point;
+    uint16_t cc_data;
+} eia608_from_utf8_hash[0x10] = {
+    { 0x2588, 0x7F00 }, // FULL_BLOCK
+    { 0x2510, 0x133D }, // EIA608_CHAR_BOX_DRAWINGS_LIGHT_DOWN_AND_LEFT
+    { 0x2122, 0x1134 }, // TRADE_MARK_SIGN
+    { 0x250C, 0x133C }, // EIA608_CHAR_BOX_DRAWINGS_LIGHT_DOWN_AND_RIGHT
+    { 0x201C, 0x122E }, // LEFT_DOUBLE_QUOTATION_MARK
+    { 0x0000, 0x0000 },
+    { 0x2018, 0x1226 }, // LEFT_SINGLE_QUOTATION_MARK
+    { 0x2014, 0x122A }, // EM_DASH
+    { 0x201D, 0x122F }, // RIGHT_DOUBLE_QUOTATION_MARK
+    { 0x2019, 0x2700 }, // RIGHT_SINGLE_QUOTATION_MARK -> APOSTROPHE
+    { 0x2022, 0x122D }, // BULLET
+    { 0x2120, 0x122C }, // SERVICE_MARK
+    { 0x266A, 0x1137 }, // EIGHTH_NOTE
+    { 0x0000, 0x0000 },
+    { 0x2518, 0x133F }, // EIA608_CHAR_BOX_DRAWINGS_LIGHT_UP_AND_LEFT
+    { 0x2514, 0x133E }, // EIA608_CHAR_BOX_DRAWINGS_LIGHT_UP_AND_RIGHT
+};
+
+uint16_t _eia608_from_utf8(const utf8_char_t* s)
+{
+    const uint8_t* c = (const uint8_t*)s;
+
+    if (0 == c) {
+        return 0x0000;
+    }
+
+    if (0x80 > c[0]) {
+        return eia608_from_ascii[c[0]];
+    }
+
+    if (0xC2 == c[0] || 0xC3 == c[0]) {
+        if (0x80 != (c[1] & 0xC0)) {
+            return 0x0000;
+        }
+
+        return eia608_from_latin1[((c[0] & 0x01) << 6) | (c[1] & 0x3F)];
+    }
+
+    if (0xE2 == c[0]) {
+        if (0x80 != (c[1] & 0xC0) || 0x80 != (c[2] & 0xC0)) {
+            return 0x0000;
+        }
+
+        uint16_t cp = 0x2000 | ((c[1] & 0x3F) << 6) | (c[2] & 0x3F);
+        int h = EIA608_FROM_UTF8_HASH(cp);
+        return cp == eia608_from_utf8_hash[h].code_point ? eia608_from_utf8_hash[h].cc_data : 0x0000;
+    }
+
+    return 0x0000;
+}
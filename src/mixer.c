@@ -0,0 +1,252 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "mixer.h"
+#include "eia608_encoder.h"
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+static int caption_mixer_before(const caption_mixer_event_t* a, const caption_mixer_event_t* b)
+{
+    // ties are broken by channel so output does not depend on insertion order
+    return a->timestamp < b->timestamp || (a->timestamp == b->timestamp && a->cc < b->cc);
+}
+
+static void caption_mixer_heap_push(caption_mixer_t* mixer, caption_mixer_event_t event)
+{
+    size_t i = mixer->heap_size++;
+
+    for (; 0 < i && caption_mixer_before(&event, &mixer->heap[(i - 1) / 2]); i = (i - 1) / 2) {
+        mixer->heap[i] = mixer->heap[(i - 1) / 2];
+    }
+
+    mixer->heap[i] = event;
+}
+
+static caption_mixer_event_t caption_mixer_heap_pop(caption_mixer_t* mixer)
+{
+    caption_mixer_event_t top = mixer->heap[0];
+    caption_mixer_event_t last = mixer->heap[--mixer->heap_size];
+    size_t i = 0, child;
+
+    for (; (child = 2 * i + 1) < mixer->heap_size; i = child) {
+        if (child + 1 < mixer->heap_size && caption_mixer_before(&mixer->heap[child + 1], &mixer->heap[child])) {
+            ++child;
+        }
+
+        if (!caption_mixer_before(&mixer->heap[child], &last)) {
+            break;
+        }
+
+        mixer->heap[i] = mixer->heap[child];
+    }
+
+    mixer->heap[i] = last;
+    return top;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Each field carries 30000 / 1001 words per second
+#define CAPTION_MIXER_WORD_DURATION (1001.0 / 30000.0)
+
+static cea708_cc_type_t caption_mixer_field(int cc) { return (cc & 0x02) ? cc_type_ntsc_cc_field_2 : cc_type_ntsc_cc_field_1; }
+static double caption_mixer_show_time(caption_mixer_source_t* source) { return source->offset + source->cue->timestamp; }
+// The displayed cue ends before the next one begins
+static int caption_mixer_clear_due(caption_mixer_source_t* source)
+{
+    return 0 <= source->clear && (!source->cue || source->clear < caption_mixer_show_time(source));
+}
+
+static void caption_mixer_schedule(caption_mixer_t* mixer, int cc)
+{
+    caption_mixer_source_t* source = &mixer->source[cc];
+    caption_mixer_event_t event = { 0, cc };
+
+    if (caption_mixer_clear_due(source)) {
+        event.timestamp = source->clear;
+    } else if (source->cue) {
+        event.timestamp = caption_mixer_show_time(source);
+    } else {
+        return;
+    }
+
+    caption_mixer_heap_push(mixer, event);
+}
+
+// Encodes the next cue once, it is kept until there is room to queue it
+static size_t caption_mixer_encode(caption_mixer_t* mixer, int cc)
+{
+    caption_mixer_source_t* source = &mixer->source[cc];
+
+    if (!source->size) {
+        source->cc_data[0] = eia608_control_command(eia608_control_resume_caption_loading, cc);
+        source->cc_data[1] = eia608_control_command(eia608_control_erase_non_displayed_memory, cc);
+        source->size = 2 + eia608_encode_text(vtt_block_data(source->cue), cc, &source->cc_data[2], EIA608_ENCODE_TEXT_MAX_WORDS);
+    }
+
+    return source->size;
+}
+
+// Writes the next cue to non-displayed memory
+static int caption_mixer_load(caption_mixer_t* mixer, int cc)
+{
+    caption_mixer_source_t* source = &mixer->source[cc];
+
+    if (source->loaded || !source->cue) {
+        return source->loaded;
+    }
+
+    caption_mixer_encode(mixer, cc);
+
+    if (LIBCAPTION_OK == cea708_pacer_push_cc_data(&mixer->pacer, caption_mixer_field(cc), source->cc_data, source->size)) {
+        source->loaded = 1;
+        source->size = 0;
+    }
+
+    return source->loaded;
+}
+
+// Loading ahead of time is only allowed into an idle field, and only if it will
+// not hold up an earlier action of the other channel sharing the field
+static void caption_mixer_preload(caption_mixer_t* mixer, int cc, double timestamp)
+{
+    size_t i;
+    caption_mixer_source_t* source = &mixer->source[cc];
+    cea708_cc_type_t field = caption_mixer_field(cc);
+
+    if (source->loaded || !source->cue || 0 < cea708_pacer_queued(&mixer->pacer, field)) {
+        return;
+    }
+
+    double due = caption_mixer_show_time(source);
+    double done = timestamp + caption_mixer_encode(mixer, cc) * CAPTION_MIXER_WORD_DURATION;
+
+    for (i = 0; i < mixer->heap_size; ++i) {
+        const caption_mixer_event_t* event = &mixer->heap[i];
+
+        if (event->cc != cc && caption_mixer_field(event->cc) == field && event->timestamp < due && event->timestamp < done) {
+            return;
+        }
+    }
+
+    caption_mixer_load(mixer, cc);
+}
+
+// Performs the timed action at the top of a source. Returns 0 if the field is out of space
+static int caption_mixer_action(caption_mixer_t* mixer, int cc)
+{
+    caption_mixer_source_t* source = &mixer->source[cc];
+
+    if (caption_mixer_clear_due(source)) {
+        uint16_t cc_data = eia608_control_command(eia608_control_erase_display_memory, cc);
+
+        if (LIBCAPTION_OK != cea708_pacer_push_cc_data(&mixer->pacer, caption_mixer_field(cc), &cc_data, 1)) {
+            return 0;
+        }
+
+        source->clear = -1;
+        return 1;
+    }
+
+    uint16_t cc_data = eia608_control_command(eia608_control_end_of_caption, cc);
+
+    if (!caption_mixer_load(mixer, cc) || LIBCAPTION_OK != cea708_pacer_push_cc_data(&mixer->pacer, caption_mixer_field(cc), &cc_data, 1)) {
+        return 0;
+    }
+
+    source->clear = 0 <= source->cue->duration ? caption_mixer_show_time(source) + source->cue->duration : -1;
+    source->cue = source->cue->next;
+    source->loaded = 0;
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void caption_mixer_init(caption_mixer_t* mixer, uint32_t num, uint32_t den)
+{
+    memset(mixer, 0, sizeof(caption_mixer_t));
+    cea708_pacer_init(&mixer->pacer, num, den);
+
+    for (int cc = 0; cc < CAPTION_MIXER_CHANNELS; ++cc) {
+        mixer->source[cc].clear = -1;
+    }
+}
+
+libcaption_stauts_t caption_mixer_add_source(caption_mixer_t* mixer, int cc, vtt_block_t* cue, double offset)
+{
+    if (0 > cc || CAPTION_MIXER_CHANNELS <= cc) {
+        return LIBCAPTION_ERROR;
+    }
+
+    // drop any pending action of the source being replaced
+    size_t i, size = mixer->heap_size;
+    caption_mixer_event_t heap[CAPTION_MIXER_CHANNELS];
+    memcpy(heap, mixer->heap, sizeof(heap));
+
+    for (mixer->heap_size = 0, i = 0; i < size; ++i) {
+        if (heap[i].cc != cc) {
+            caption_mixer_heap_push(mixer, heap[i]);
+        }
+    }
+
+    mixer->source[cc].cue = cue;
+    mixer->source[cc].offset = offset;
+    mixer->source[cc].clear = -1;
+    mixer->source[cc].loaded = 0;
+    caption_mixer_schedule(mixer, cc);
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t caption_mixer_frame(caption_mixer_t* mixer, sei_t* sei, double timestamp)
+{
+    size_t i, retries = 0;
+    caption_mixer_event_t retry[CAPTION_MIXER_CHANNELS];
+
+    // Time critical control codes go first
+    while (mixer->heap_size && mixer->heap[0].timestamp <= timestamp) {
+        caption_mixer_event_t event = caption_mixer_heap_pop(mixer);
+
+        if (caption_mixer_action(mixer, event.cc)) {
+            caption_mixer_schedule(mixer, event.cc);
+        } else {
+            retry[retries++] = event;
+        }
+    }
+
+    for (i = 0; i < retries; ++i) {
+        caption_mixer_heap_push(mixer, retry[i]);
+    }
+
+    for (int cc = 0; cc < CAPTION_MIXER_CHANNELS; ++cc) {
+        caption_mixer_preload(mixer, cc, timestamp);
+    }
+
+    cea708_t cea708;
+    cea708_pacer_pop(&mixer->pacer, &cea708, timestamp);
+    sei_append_708(sei, &cea708);
+    return LIBCAPTION_OK;
+}
+
+int caption_mixer_done(caption_mixer_t* mixer)
+{
+    return 0 == mixer->heap_size;
+}
@@ -168,6 +168,7 @@ void sei_init(sei_t* sei, double timestamp)
     sei->head = 0;
     sei->tail = 0;
     sei->timestamp = timestamp;
+    sei->ticks = caption_ticks_from_seconds(timestamp);
 }
 
 void sei_message_append(sei_t* sei, sei_message_t* msg)
@@ -324,7 +325,13 @@ uint8_t* sei_render_alloc(sei_t* sei, size_t* size)
 ////////////////////////////////////////////////////////////////////////////////
 libcaption_stauts_t sei_parse(sei_t* sei, const uint8_t* data, size_t size, double timestamp)
 {
-    sei_init(sei, timestamp);
+    return sei_parse_ticks(sei, data, size, caption_ticks_from_seconds(timestamp));
+}
+
+libcaption_stauts_t sei_parse_ticks(sei_t* sei, const uint8_t* data, size_t size, caption_ticks_t ticks)
+{
+    sei_init(sei, caption_ticks_to_seconds(ticks));
+    sei->ticks = ticks;
     int ret = 0;
 
     // SEI may contain more than one payload
@@ -383,6 +390,7 @@ libcaption_stauts_t sei_to_caption_frame(sei_t* sei, caption_frame_t* frame)
     libcaption_stauts_t status = LIBCAPTION_OK;
 
     cea708_init(&cea708, frame->timestamp);
+    cea708.ticks = frame->ticks;
 
     for (msg = sei_message_head(sei); msg; msg = sei_message_next(msg)) {
         if (sei_type_user_data_registered_itu_t_t35 == sei_message_type(msg)) {
@@ -393,11 +401,13 @@ libcaption_stauts_t sei_to_caption_frame(sei_t* sei, caption_frame_t* frame)
 
     if (LIBCAPTION_READY == status) {
         frame->timestamp = sei->timestamp;
+        frame->ticks = sei->ticks;
     }
 
     return status;
 }
 ////////////////////////////////////////////////////////////////////////////////
+// Other channels and fields are supported by eia608_encoder_t and caption_mixer_t
 #define DEFAULT_CHANNEL 0
 
 void sei_append_708(sei_t* sei, cea708_t* cea708)
@@ -409,13 +419,12 @@ void sei_append_708(sei_t* sei, cea708_t* cea708)
 }
 
 // This should be moved to 708.c
-// This works for popon, but bad for paint on and roll up
+// This works for popon, but bad for paint on and roll up. See eia608_encoder_t
 // Please understand this function before you try to use it, setting null values have different effects than you may assume
 void sei_encode_eia608(sei_t* sei, cea708_t* cea708, uint16_t cc_data)
 {
     // This one is full, flush and init a new one
-    // shoudl this be 32? I cant remember
-    if (31 == cea708->user_data.cc_count) {
+    if (CEA708_MAX_CC_COUNT == cea708->user_data.cc_count) {
         sei_append_708(sei, cea708);
     }
 
@@ -525,22 +534,23 @@ libcaption_stauts_t sei_from_caption_frame(sei_t* sei, caption_frame_t* frame)
 
     sei_encode_eia608(sei, &cea708, 0); // flush
     sei->timestamp = frame->timestamp; // assumes in order frames
+    sei->ticks = caption_ticks_from_seconds(frame->timestamp);
     // sei_dump (sei);
     return LIBCAPTION_OK;
 }
 
-libcaption_stauts_t sei_from_scc(sei_t* sei, const scc_t* scc)
+libcaption_stauts_t sei_from_cc_data(sei_t* sei, const uint16_t* cc_data, size_t size)
 {
-    unsigned int i;
+    size_t i;
     cea708_t cea708;
-    cea708_init(&cea708, sei->timestamp); // set up a new popon frame
+    cea708_init(&cea708, sei->timestamp);
 
-    for (i = 0; i < scc->cc_size; ++i) {
-        if (31 == cea708.user_data.cc_count) {
+    for (i = 0; i < size; ++i) {
+        if (CEA708_MAX_CC_COUNT == cea708.user_data.cc_count) {
             sei_append_708(sei, &cea708);
         }
 
-        cea708_add_cc_data(&cea708, 1, cc_type_ntsc_cc_field_1, scc->cc_data[i]);
+        cea708_add_cc_data(&cea708, 1, cc_type_ntsc_cc_field_1, cc_data[i]);
     }
 
     if (0 != cea708.user_data.cc_count) {
@@ -550,6 +560,32 @@ libcaption_stauts_t sei_from_scc(sei_t* sei, const scc_t* scc)
     return LIBCAPTION_OK;
 }
 
+libcaption_stauts_t sei_from_cc_triples(sei_t* sei, const cc_data_t* cc_data, size_t size)
+{
+    size_t i;
+    cea708_t cea708;
+    cea708_init(&cea708, sei->timestamp);
+
+    for (i = 0; i < size; ++i) {
+        if (CEA708_MAX_CC_COUNT == cea708.user_data.cc_count) {
+            sei_append_708(sei, &cea708);
+        }
+
+        cea708.user_data.cc_data[cea708.user_data.cc_count++] = cc_data[i];
+    }
+
+    if (0 != cea708.user_data.cc_count) {
+        sei_append_708(sei, &cea708);
+    }
+
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t sei_from_scc(sei_t* sei, const scc_t* scc)
+{
+    return sei_from_cc_data(sei, scc->cc_data, scc->cc_size);
+}
+
 libcaption_stauts_t sei_from_caption_clear(sei_t* sei)
 {
     cea708_t cea708;
@@ -564,6 +600,367 @@ libcaption_stauts_t sei_from_caption_clear(sei_t* sei)
     return LIBCAPTION_OK;
 }
 ////////////////////////////////////////////////////////////////////////////////
+// Sequence parameters. Only what is needed to find the reorder depth is read
+#define MPEG_SPS_MAX_SIZE 1024
+
+typedef struct {
+    uint8_t data[MPEG_SPS_MAX_SIZE];
+    size_t size, bit;
+    int error; //< read past the end
+} mpeg_bits_t;
+
+// Emulation prevention bytes are removed, an SPS longer than the buffer is truncated
+static void mpeg_bits_init(mpeg_bits_t* bits, const uint8_t* data, size_t size)
+{
+    size_t i, zeros = 0;
+    bits->size = bits->bit = 0;
+    bits->error = 0;
+
+    for (i = 0; i < size && bits->size < MPEG_SPS_MAX_SIZE; ++i) {
+        if (2 <= zeros && 3 == data[i]) {
+            zeros = 0;
+            continue;
+        }
+
+        zeros = 0 == data[i] ? zeros + 1 : 0;
+        bits->data[bits->size++] = data[i];
+    }
+}
+
+static uint32_t mpeg_bits_read(mpeg_bits_t* bits, int count)
+{
+    uint32_t value = 0;
+
+    for (; 0 < count; --count, ++bits->bit) {
+        if (bits->bit >= 8 * bits->size) {
+            bits->error = 1;
+            return 0;
+        }
+
+        value = (value << 1) | ((bits->data[bits->bit / 8] >> (7 - bits->bit % 8)) & 1);
+    }
+
+    return value;
+}
+
+static void mpeg_bits_skip(mpeg_bits_t* bits, size_t count) { bits->bit += count; }
+
+// Exp-Golomb ue(v)
+static uint32_t mpeg_bits_ue(mpeg_bits_t* bits)
+{
+    int zeros = 0;
+
+    while (!bits->error && 0 == mpeg_bits_read(bits, 1)) {
+        if (31 < ++zeros) {
+            bits->error = 1;
+            return 0;
+        }
+    }
+
+    return (uint32_t)((1ULL << zeros) - 1 + mpeg_bits_read(bits, zeros));
+}
+
+static void mpeg_bits_skip_ue(mpeg_bits_t* bits, int count)
+{
+    for (; 0 < count; --count) {
+        mpeg_bits_ue(bits);
+    }
+}
+
+static void h264_skip_scaling_list(mpeg_bits_t* bits, int size)
+{
+    int j, last = 8, next = 8;
+
+    for (j = 0; j < size && 0 != next; ++j) {
+        // se(v) delta_scale
+        uint32_t ue = mpeg_bits_ue(bits);
+        int32_t delta = (ue & 1) ? (int32_t)((ue + 1) / 2) : -(int32_t)(ue / 2);
+        next = (last + delta + 256) % 256;
+        last = 0 == next ? last : next;
+    }
+}
+
+static void h264_skip_hrd_parameters(mpeg_bits_t* bits)
+{
+    uint32_t i, count = mpeg_bits_ue(bits) + 1;
+    mpeg_bits_skip(bits, 8); // bit_rate_scale, cpb_size_scale
+
+    for (i = 0; i < count && !bits->error; ++i) {
+        mpeg_bits_skip_ue(bits, 2);
+        mpeg_bits_skip(bits, 1);
+    }
+
+    mpeg_bits_skip(bits, 20);
+}
+
+// MaxDpbMbs from table A-1
+static int h264_max_dpb_frames(int level_idc, uint32_t frame_mbs)
+{
+    uint32_t max_dpb_mbs;
+
+    switch (level_idc) {
+    case 9:
+    case 10:
+        max_dpb_mbs = 396;
+        break;
+    case 11:
+        max_dpb_mbs = 900;
+        break;
+    case 12:
+    case 13:
+    case 20:
+        max_dpb_mbs = 2376;
+        break;
+    case 21:
+        max_dpb_mbs = 4752;
+        break;
+    case 22:
+    case 30:
+        max_dpb_mbs = 8100;
+        break;
+    case 31:
+        max_dpb_mbs = 18000;
+        break;
+    case 32:
+        max_dpb_mbs = 20480;
+        break;
+    case 40:
+    case 41:
+        max_dpb_mbs = 32768;
+        break;
+    case 42:
+        max_dpb_mbs = 34816;
+        break;
+    case 50:
+        max_dpb_mbs = 110400;
+        break;
+    case 51:
+    case 52:
+        max_dpb_mbs = 184320;
+        break;
+    default:
+        return MPEG_BITSTREAM_MAX_REORDER;
+    }
+
+    return frame_mbs ? (int)(max_dpb_mbs / frame_mbs < MPEG_BITSTREAM_MAX_REORDER ? max_dpb_mbs / frame_mbs : MPEG_BITSTREAM_MAX_REORDER) : MPEG_BITSTREAM_MAX_REORDER;
+}
+
+// 7.3.2.1.1 and E.1.1. Returns -1 if the SPS can not be read
+static int h264_sps_reorder(const uint8_t* data, size_t size)
+{
+    int i, lists, profile_idc, constraint_flags, level_idc, poc_type, frame_mbs_only;
+    uint32_t width_mbs, height_units, count;
+    mpeg_bits_t bits;
+    mpeg_bits_init(&bits, data, size);
+
+    profile_idc = mpeg_bits_read(&bits, 8);
+    constraint_flags = mpeg_bits_read(&bits, 8);
+    level_idc = mpeg_bits_read(&bits, 8);
+    mpeg_bits_ue(&bits); // seq_parameter_set_id
+
+    switch (profile_idc) {
+    case 100:
+    case 110:
+    case 122:
+    case 244:
+    case 44:
+    case 83:
+    case 86:
+    case 118:
+    case 128:
+    case 138:
+    case 139:
+    case 134:
+    case 135:
+        lists = 8;
+
+        if (3 == mpeg_bits_ue(&bits)) { // chroma_format_idc
+            mpeg_bits_skip(&bits, 1); // separate_colour_plane_flag
+            lists = 12;
+        }
+
+        mpeg_bits_skip_ue(&bits, 2); // bit_depth_luma_minus8, bit_depth_chroma_minus8
+        mpeg_bits_skip(&bits, 1); // qpprime_y_zero_transform_bypass_flag
+
+        if (mpeg_bits_read(&bits, 1)) { // seq_scaling_matrix_present_flag
+            for (i = 0; i < lists; ++i) {
+                if (mpeg_bits_read(&bits, 1)) {
+                    h264_skip_scaling_list(&bits, 6 > i ? 16 : 64);
+                }
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+    mpeg_bits_ue(&bits); // log2_max_frame_num_minus4
+    poc_type = mpeg_bits_ue(&bits);
+
+    if (0 == poc_type) {
+        mpeg_bits_ue(&bits); // log2_max_pic_order_cnt_lsb_minus4
+    } else if (1 == poc_type) {
+        mpeg_bits_skip(&bits, 1); // delta_pic_order_always_zero_flag
+        mpeg_bits_skip_ue(&bits, 2); // offset_for_non_ref_pic, offset_for_top_to_bottom_field
+        count = mpeg_bits_ue(&bits);
+
+        for (; 0 < count && !bits.error; --count) {
+            mpeg_bits_ue(&bits); // offset_for_ref_frame
+        }
+    }
+
+    mpeg_bits_ue(&bits); // max_num_ref_frames
+    mpeg_bits_skip(&bits, 1); // gaps_in_frame_num_value_allowed_flag
+    width_mbs = mpeg_bits_ue(&bits) + 1;
+    height_units = mpeg_bits_ue(&bits) + 1;
+    frame_mbs_only = mpeg_bits_read(&bits, 1);
+
+    if (!frame_mbs_only) {
+        mpeg_bits_skip(&bits, 1); // mb_adaptive_frame_field_flag
+    }
+
+    mpeg_bits_skip(&bits, 1); // direct_8x8_inference_flag
+
+    if (mpeg_bits_read(&bits, 1)) { // frame_cropping_flag
+        mpeg_bits_skip_ue(&bits, 4);
+    }
+
+    if (bits.error) {
+        return -1;
+    }
+
+    if (mpeg_bits_read(&bits, 1)) { // vui_parameters_present_flag
+        int hrd = 0;
+
+        if (mpeg_bits_read(&bits, 1) && 255 == mpeg_bits_read(&bits, 8)) { // aspect_ratio_idc, Extended_SAR
+            mpeg_bits_skip(&bits, 32);
+        }
+
+        if (mpeg_bits_read(&bits, 1)) { // overscan_info_present_flag
+            mpeg_bits_skip(&bits, 1);
+        }
+
+        if (mpeg_bits_read(&bits, 1)) { // video_signal_type_present_flag
+            mpeg_bits_skip(&bits, 4);
+
+            if (mpeg_bits_read(&bits, 1)) { // colour_description_present_flag
+                mpeg_bits_skip(&bits, 24);
+            }
+        }
+
+        if (mpeg_bits_read(&bits, 1)) { // chroma_loc_info_present_flag
+            mpeg_bits_skip_ue(&bits, 2);
+        }
+
+        if (mpeg_bits_read(&bits, 1)) { // timing_info_present_flag
+            mpeg_bits_skip(&bits, 65);
+        }
+
+        for (i = 0; i < 2; ++i) { // nal then vcl hrd_parameters
+            if (mpeg_bits_read(&bits, 1)) {
+                h264_skip_hrd_parameters(&bits);
+                hrd = 1;
+            }
+        }
+
+        if (hrd) {
+            mpeg_bits_skip(&bits, 1); // low_delay_hrd_flag
+        }
+
+        mpeg_bits_skip(&bits, 1); // pic_struct_present_flag
+
+        if (mpeg_bits_read(&bits, 1)) { // bitstream_restriction_flag
+            mpeg_bits_skip(&bits, 1); // motion_vectors_over_pic_boundaries_flag
+            mpeg_bits_skip_ue(&bits, 4);
+            count = mpeg_bits_ue(&bits); // max_num_reorder_frames
+            return bits.error ? -1 : (int)(MPEG_BITSTREAM_MAX_REORDER < count ? MPEG_BITSTREAM_MAX_REORDER : count);
+        }
+
+        if (bits.error) {
+            return -1;
+        }
+    }
+
+    // Output order is decode order
+    if (2 == poc_type) {
+        return 0;
+    }
+
+    // Intra only profiles, constraint_set3_flag
+    if ((44 == profile_idc || 100 == profile_idc || 110 == profile_idc || 122 == profile_idc || 244 == profile_idc) && (constraint_flags & 0x10)) {
+        return 0;
+    }
+
+    // Otherwise max_num_reorder_frames is inferred to be MaxDpbFrames
+    return h264_max_dpb_frames(level_idc, width_mbs * (2 - frame_mbs_only) * height_units);
+}
+
+// 7.3.2.2.1 of H.265. Returns -1 if the SPS can not be read
+static int h265_sps_reorder(const uint8_t* data, size_t size)
+{
+    int i, max_sub_layers, profile_present[8], level_present[8];
+    uint32_t reorder = 0;
+    mpeg_bits_t bits;
+    mpeg_bits_init(&bits, data, size);
+
+    mpeg_bits_skip(&bits, 4); // sps_video_parameter_set_id
+    max_sub_layers = mpeg_bits_read(&bits, 3) + 1;
+    mpeg_bits_skip(&bits, 1); // sps_temporal_id_nesting_flag
+
+    // profile_tier_level
+    mpeg_bits_skip(&bits, 96);
+
+    for (i = 0; i < max_sub_layers - 1; ++i) {
+        profile_present[i] = mpeg_bits_read(&bits, 1);
+        level_present[i] = mpeg_bits_read(&bits, 1);
+    }
+
+    if (1 < max_sub_layers) {
+        mpeg_bits_skip(&bits, 2 * (9 - max_sub_layers));
+    }
+
+    for (i = 0; i < max_sub_layers - 1; ++i) {
+        mpeg_bits_skip(&bits, (profile_present[i] ? 88 : 0) + (level_present[i] ? 8 : 0));
+    }
+
+    mpeg_bits_ue(&bits); // sps_seq_parameter_set_id
+
+    if (3 == mpeg_bits_ue(&bits)) { // chroma_format_idc
+        mpeg_bits_skip(&bits, 1); // separate_colour_plane_flag
+    }
+
+    mpeg_bits_skip_ue(&bits, 2); // pic_width_in_luma_samples, pic_height_in_luma_samples
+
+    if (mpeg_bits_read(&bits, 1)) { // conformance_window_flag
+        mpeg_bits_skip_ue(&bits, 4);
+    }
+
+    mpeg_bits_skip_ue(&bits, 3); // bit_depth_luma_minus8, bit_depth_chroma_minus8, log2_max_pic_order_cnt_lsb_minus4
+
+    // Only the highest sub-layer matters, it is the one that is decoded
+    i = mpeg_bits_read(&bits, 1) ? 0 : max_sub_layers - 1; // sps_sub_layer_ordering_info_present_flag
+
+    for (; i < max_sub_layers; ++i) {
+        mpeg_bits_ue(&bits); // sps_max_dec_pic_buffering_minus1
+        reorder = mpeg_bits_ue(&bits);
+        mpeg_bits_ue(&bits); // sps_max_latency_increase_plus1
+    }
+
+    return bits.error ? -1 : (int)(MPEG_BITSTREAM_MAX_REORDER < reorder ? MPEG_BITSTREAM_MAX_REORDER : reorder);
+}
+
+// 6.2.2.3 of H.262. A low delay sequence has no B pictures, otherwise one anchor
+// picture is held back. Returns -1 for other extensions
+static int h262_sequence_extension_reorder(const uint8_t* data, size_t size)
+{
+    // extension_start_code_identifier is 1, low_delay follows 40 bits later
+    if (6 > size || 1 != (data[0] >> 4)) {
+        return -1;
+    }
+
+    return (data[5] & 0x80) ? 0 : 1;
+}
+////////////////////////////////////////////////////////////////////////////////
 // bitstream
 void mpeg_bitstream_init(mpeg_bitstream_t* packet)
 {
@@ -573,6 +970,10 @@ void mpeg_bitstream_init(mpeg_bitstream_t* packet)
     packet->front = 0;
     packet->latent = 0;
     packet->status = LIBCAPTION_OK;
+    packet->reorder = -1;
+    packet->frame_known = 0;
+    packet->waiting = 0;
+    packet->presented_known = 0;
 }
 
 uint8_t mpeg_bitstream_packet_type(mpeg_bitstream_t* packet, unsigned stream_type)
@@ -623,14 +1024,36 @@ static size_t find_start_code(const uint8_t* data, size_t size)
 cea708_t* _mpeg_bitstream_cea708_at(mpeg_bitstream_t* packet, size_t pos) { return &packet->cea708[(packet->front + pos) % MAX_REFRENCE_FRAMES]; }
 cea708_t* _mpeg_bitstream_cea708_front(mpeg_bitstream_t* packet) { return _mpeg_bitstream_cea708_at(packet, 0); }
 cea708_t* _mpeg_bitstream_cea708_back(mpeg_bitstream_t* packet) { return _mpeg_bitstream_cea708_at(packet, packet->latent - 1); }
-cea708_t* _mpeg_bitstream_cea708_emplace_back(mpeg_bitstream_t* packet, double timestamp)
+cea708_t* _mpeg_bitstream_cea708_emplace_back(mpeg_bitstream_t* packet, caption_frame_t* frame, caption_ticks_t ticks)
 {
+    // Should not happen once the reorder depth is known. Rather than overwrite the
+    // front of the ring, decode the oldest payload now, or drop it if a frame is
+    // already waiting for the caller
+    if (MAX_REFRENCE_FRAMES == packet->latent) {
+        if (LIBCAPTION_OK == packet->status) {
+            mpeg_bitstream_flush(packet, frame);
+        } else {
+            packet->front = (packet->front + 1) % MAX_REFRENCE_FRAMES;
+            --packet->latent;
+        }
+    }
+
     ++packet->latent;
     cea708_t* cea708 = _mpeg_bitstream_cea708_back(packet);
-    cea708_init(cea708, timestamp);
+    cea708_init(cea708, caption_ticks_to_seconds(ticks));
+    cea708->ticks = ticks;
     return cea708;
 }
 
+// Payloads that carry no caption data are never queued, so silent channels
+// skip the sort and decode entirely. Ordering is still driven by dts.
+void _mpeg_bitstream_cea708_drop_padding(mpeg_bitstream_t* packet)
+{
+    if (packet->latent && cea708_is_padding(_mpeg_bitstream_cea708_back(packet))) {
+        --packet->latent;
+    }
+}
+
 void _mpeg_bitstream_cea708_sort(mpeg_bitstream_t* packet)
 {
     // TODO better sort? (for small nearly sorted lists bubble is difficult to beat)
@@ -640,7 +1063,7 @@ again:
         cea708_t c;
         cea708_t* a = _mpeg_bitstream_cea708_at(packet, i - 1);
         cea708_t* b = _mpeg_bitstream_cea708_at(packet, i);
-        if (a->timestamp > b->timestamp) {
+        if (a->ticks > b->ticks) {
             memcpy(&c, a, sizeof(cea708_t));
             memcpy(a, b, sizeof(cea708_t));
             memcpy(b, &c, sizeof(cea708_t));
@@ -662,16 +1085,142 @@ size_t mpeg_bitstream_flush(mpeg_bitstream_t* packet, caption_frame_t* frame)
     return packet->latent;
 }
 
-void _mpeg_bitstream_cea708_sort_flush(mpeg_bitstream_t* packet, caption_frame_t* frame, double dts)
+// A payload can be decoded once its frame is presented. Frames presented before
+// dts are always known, the reorder depth lets frames be presented sooner
+static int _mpeg_bitstream_cea708_presented(mpeg_bitstream_t* packet, caption_ticks_t ticks, caption_ticks_t dts)
+{
+    return ticks < dts || (0 <= packet->reorder && packet->presented_known && ticks <= packet->presented);
+}
+
+void _mpeg_bitstream_cea708_sort_flush(mpeg_bitstream_t* packet, caption_frame_t* frame, caption_ticks_t dts)
 {
     _mpeg_bitstream_cea708_sort(packet);
     // Loop will terminate on LIBCAPTION_READY
-    while (packet->latent && packet->status == LIBCAPTION_OK && _mpeg_bitstream_cea708_front(packet)->timestamp < dts) {
+    while (packet->latent && packet->status == LIBCAPTION_OK && _mpeg_bitstream_cea708_presented(packet, _mpeg_bitstream_cea708_front(packet)->ticks, dts)) {
         mpeg_bitstream_flush(packet, frame);
     }
 }
 
+// Presents the earliest frames until no more than reorder are waiting, the way a
+// decoder bumps its picture buffer. The depth is capped until the SPS is seen
+static void _mpeg_bitstream_bump(mpeg_bitstream_t* packet)
+{
+    size_t i, earliest;
+    size_t reorder = 0 <= packet->reorder ? (size_t)packet->reorder : MPEG_BITSTREAM_MAX_REORDER;
+
+    while (packet->waiting > reorder) {
+        for (i = 1, earliest = 0; i < packet->waiting; ++i) {
+            earliest = packet->waiting_pts[i] < packet->waiting_pts[earliest] ? i : earliest;
+        }
+
+        if (!packet->presented_known || packet->presented < packet->waiting_pts[earliest]) {
+            packet->presented = packet->waiting_pts[earliest];
+            packet->presented_known = 1;
+        }
+
+        packet->waiting_pts[earliest] = packet->waiting_pts[--packet->waiting];
+    }
+}
+
+static void _mpeg_bitstream_frame(mpeg_bitstream_t* packet, caption_ticks_t pts)
+{
+    if (packet->frame_known && pts == packet->frame_pts) {
+        return;
+    }
+
+    packet->frame_known = 1;
+    packet->frame_pts = pts;
+    packet->waiting_pts[packet->waiting++] = pts;
+    _mpeg_bitstream_bump(packet);
+}
+
+// The SPS usually arrives with the first frame, which was counted before it was parsed
+static void _mpeg_bitstream_set_reorder(mpeg_bitstream_t* packet, int reorder)
+{
+    if (0 <= reorder) {
+        packet->reorder = reorder;
+        _mpeg_bitstream_bump(packet);
+    }
+}
+
 size_t mpeg_bitstream_parse(mpeg_bitstream_t* packet, caption_frame_t* frame, const uint8_t* data, size_t size, unsigned stream_type, double dts, double cts)
+{
+    return mpeg_bitstream_parse_ticks(packet, frame, data, size, stream_type, caption_ticks_from_seconds(dts), caption_ticks_from_seconds(dts + cts) - caption_ticks_from_seconds(dts));
+}
+
+// Processes one NALU of size bytes from the front of the buffer
+static void _mpeg_bitstream_nalu(mpeg_bitstream_t* packet, caption_frame_t* frame, unsigned stream_type, size_t scpos)
+{
+    sei_t sei;
+    size_t header_size;
+    caption_ticks_t dts = packet->dts, pts = packet->dts + packet->cts;
+
+    switch (mpeg_bitstream_packet_type(packet, stream_type)) {
+    default:
+        break;
+    case H264_SPS_PACKET:
+        if (STREAM_TYPE_H264 == stream_type && scpos > 4) {
+            _mpeg_bitstream_set_reorder(packet, h264_sps_reorder(&packet->data[4], scpos - 4));
+        }
+        break;
+    case H265_SPS_PACKET:
+        if (STREAM_TYPE_H265 == stream_type && scpos > 5) {
+            _mpeg_bitstream_set_reorder(packet, h265_sps_reorder(&packet->data[5], scpos - 5));
+        }
+        break;
+    case H262_EXTENSION_PACKET:
+        if (STREAM_TYPE_H262 == stream_type && scpos > 4) {
+            _mpeg_bitstream_set_reorder(packet, h262_sequence_extension_reorder(&packet->data[4], scpos - 4));
+        }
+        break;
+    case H262_SEI_PACKET:
+        header_size = 4;
+        if (STREAM_TYPE_H262 == stream_type && scpos > header_size) {
+            cea708_t* cea708 = _mpeg_bitstream_cea708_emplace_back(packet, frame, pts);
+            packet->status = libcaption_status_update(packet->status, cea708_parse_h262(&packet->data[header_size], scpos - header_size, cea708));
+            _mpeg_bitstream_cea708_drop_padding(packet);
+            _mpeg_bitstream_cea708_sort_flush(packet, frame, dts);
+        }
+        break;
+    case H264_SEI_PACKET:
+    case H265_SEI_PACKET:
+        header_size = STREAM_TYPE_H264 == stream_type ? 4 : STREAM_TYPE_H265 == stream_type ? 5 : 0;
+        if (header_size && scpos > header_size) {
+            packet->status = libcaption_status_update(packet->status, sei_parse_ticks(&sei, &packet->data[header_size], scpos - header_size, pts));
+            for (sei_message_t* msg = sei_message_head(&sei); msg; msg = sei_message_next(msg)) {
+                if (sei_type_user_data_registered_itu_t_t35 == sei_message_type(msg)) {
+                    cea708_t* cea708 = _mpeg_bitstream_cea708_emplace_back(packet, frame, pts);
+                    packet->status = libcaption_status_update(packet->status, cea708_parse_h264(sei_message_data(msg), sei_message_size(msg), cea708));
+                    _mpeg_bitstream_cea708_drop_padding(packet);
+                    _mpeg_bitstream_cea708_sort_flush(packet, frame, dts);
+                }
+            }
+            sei_free(&sei);
+        }
+        break;
+    }
+
+    packet->size -= scpos;
+    memmove(&packet->data[0], &packet->data[scpos], packet->size);
+}
+
+// Processes every NALU followed by a start code, then any payloads the current frame has presented
+static void _mpeg_bitstream_parse_nalus(mpeg_bitstream_t* packet, caption_frame_t* frame, unsigned stream_type)
+{
+    size_t scpos;
+
+    while (packet->status == LIBCAPTION_OK && 0 < (scpos = find_start_code(&packet->data[0], packet->size))) {
+        _mpeg_bitstream_nalu(packet, frame, stream_type, scpos);
+    }
+
+    // This frame may have presented earlier ones. Not done before the loop, a
+    // frame returned there would leave this call's data to be stamped with the next dts
+    if (LIBCAPTION_OK == packet->status) {
+        _mpeg_bitstream_cea708_sort_flush(packet, frame, packet->dts);
+    }
+}
+
+size_t mpeg_bitstream_parse_ticks(mpeg_bitstream_t* packet, caption_frame_t* frame, const uint8_t* data, size_t size, unsigned stream_type, caption_ticks_t dts, caption_ticks_t cts)
 {
     if (MAX_NALU_SIZE <= packet->size) {
         packet->status = LIBCAPTION_ERROR;
@@ -684,46 +1233,32 @@ size_t mpeg_bitstream_parse(mpeg_bitstream_t* packet, caption_frame_t* frame, co
         size = MAX_NALU_SIZE - packet->size;
     }
 
-    sei_t sei;
-    size_t header_size, scpos;
     packet->status = LIBCAPTION_OK;
+    packet->dts = dts;
+    packet->cts = cts;
     memcpy(&packet->data[packet->size], data, size);
     packet->size += size;
 
-    while (packet->status == LIBCAPTION_OK && 0 < (scpos = find_start_code(&packet->data[0], packet->size))) {
-        switch (mpeg_bitstream_packet_type(packet, stream_type)) {
-        default:
-            break;
-        case H262_SEI_PACKET:
-            header_size = 4;
-            if (STREAM_TYPE_H262 == stream_type && scpos > header_size) {
-                cea708_t* cea708 = _mpeg_bitstream_cea708_emplace_back(packet, dts + cts);
-                packet->status = libcaption_status_update(packet->status, cea708_parse_h262(&packet->data[header_size], scpos - header_size, cea708));
-                _mpeg_bitstream_cea708_sort_flush(packet, frame, dts);
-            }
-            break;
-        case H264_SEI_PACKET:
-        case H265_SEI_PACKET:
-            header_size = STREAM_TYPE_H264 == stream_type ? 4 : STREAM_TYPE_H265 == stream_type ? 5 : 0;
-            if (header_size && scpos > header_size) {
-                packet->status = libcaption_status_update(packet->status, sei_parse(&sei, &packet->data[header_size], scpos - header_size, dts + cts));
-                for (sei_message_t* msg = sei_message_head(&sei); msg; msg = sei_message_next(msg)) {
-                    if (sei_type_user_data_registered_itu_t_t35 == sei_message_type(msg)) {
-                        cea708_t* cea708 = _mpeg_bitstream_cea708_emplace_back(packet, dts + cts);
-                        packet->status = libcaption_status_update(packet->status, cea708_parse_h264(sei_message_data(msg), sei_message_size(msg), cea708));
-                        _mpeg_bitstream_cea708_sort_flush(packet, frame, dts);
-                    }
-                }
-                sei_free(&sei);
-            }
-            break;
-        }
+    _mpeg_bitstream_frame(packet, dts + cts);
+    _mpeg_bitstream_parse_nalus(packet, frame, stream_type);
+    return size;
+}
+
+libcaption_stauts_t mpeg_bitstream_end(mpeg_bitstream_t* packet, caption_frame_t* frame, unsigned stream_type)
+{
+    packet->status = LIBCAPTION_OK;
+    _mpeg_bitstream_parse_nalus(packet, frame, stream_type);
 
-        packet->size -= scpos;
-        memmove(&packet->data[0], &packet->data[scpos], packet->size);
+    // The last NALU has no start code after it
+    if (LIBCAPTION_OK == packet->status && packet->size) {
+        _mpeg_bitstream_nalu(packet, frame, stream_type, packet->size);
+
+        if (LIBCAPTION_OK == packet->status) {
+            _mpeg_bitstream_cea708_sort_flush(packet, frame, packet->dts);
+        }
     }
 
-    return size;
+    return packet->status;
 }
 ////////////////////////////////////////////////////////////////////////////////
 // // h262
@@ -52,9 +52,16 @@ scc_t* scc_free(scc_t* scc)
     return NULL;
 }
 
-double scc_time_to_timestamp(int hh, int mm, int ss, int ff)
+double scc_timecode_to_timestamp(int hh, int mm, int ss, int ff, int drop_frame)
 {
-    return (hh * 3600.0) + (mm * 60.0) + ss + (ff / 29.97);
+    int64_t minutes = (int64_t)hh * 60 + mm;
+    int64_t frame = (minutes * 60 + ss) * 30 + ff;
+
+    if (drop_frame) {
+        frame -= 2 * (minutes - minutes / 10);
+    }
+
+    return (double)(frame * 1001) / 30000.0;
 }
 
 // 00:00:25:16  9420 9440 aeae ae79 ef75 2068 6176 e520 79ef 75f2 20f2 ef62 eff4 e9e3 732c 2061 6e64 2049 94fe 9723 ea75 73f4 20f7 616e f420 f4ef 2062 e520 61f7 e573 ef6d e520 e96e 2073 7061 e3e5 ae80 942c 8080 8080 942f
@@ -62,6 +69,7 @@ size_t scc_to_608(scc_t** scc, const utf8_char_t* data)
 {
     size_t llen, size = 0;
     int v1 = 0, v2 = 0, hh = 0, mm = 0, ss = 0, ff = 0, cc_data = 0;
+    char sep[2];
 
     if (0 == data) {
         return 0;
@@ -85,14 +93,14 @@ size_t scc_to_608(scc_t** scc, const utf8_char_t* data)
         data += 1, size += 1;
     }
 
-    if (4 == sscanf(data, "%2d:%2d:%2d%*1[:;]%2d", &hh, &mm, &ss, &ff)) {
+    if (5 == sscanf(data, "%2d:%2d:%2d%1[:;.,]%2d", &hh, &mm, &ss, sep, &ff)) {
         data += 12, size += 12;
         // Get length of the remaining charcters
         llen = utf8_line_length(data);
         llen = utf8_trimmed_length(data, llen);
         int max_cc_count = 1 + (llen / 5);
         (*scc) = scc_relloc((*scc), max_cc_count * 1.5);
-        (*scc)->timestamp = scc_time_to_timestamp(hh, mm, ss, ff);
+        (*scc)->timestamp = scc_timecode_to_timestamp(hh, mm, ss, ff, ';' == sep[0] || ',' == sep[0]);
         (*scc)->cc_size = 0;
 
 
@@ -105,3 +113,309 @@ size_t scc_to_608(scc_t** scc, const utf8_char_t* data)
 
     return size;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+// Hex digit value plus one, zero for anything else
+static const uint8_t _scc_hex[256] = {
+    ['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5, ['5'] = 6, ['6'] = 7, ['7'] = 8, ['8'] = 9, ['9'] = 10,
+    ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+    ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+};
+
+static int scc_is_space(utf8_char_t c) { return ' ' == c || '\t' == c || '\r' == c || '\n' == c; }
+static int scc_is_digit(utf8_char_t c) { return '0' <= c && '9' >= c; }
+static int scc_is_separator(utf8_char_t c) { return ':' == c || ';' == c || '.' == c || ',' == c; }
+static int scc_digits(const utf8_char_t* c) { return 10 * (c[0] - '0') + (c[1] - '0'); }
+
+static libcaption_stauts_t scc_file_line(scc_file_t* scc, const utf8_char_t* pos, const utf8_char_t* end)
+{
+    while (pos < end && scc_is_space(*pos)) {
+        ++pos;
+    }
+
+    if (13 <= end - pos && 0 == memcmp(pos, "Scenarist_SCC", 13)) {
+        return (18 <= end - pos && 0 == memcmp(pos + 13, " V1.0", 5)) ? LIBCAPTION_OK : LIBCAPTION_ERROR;
+    }
+
+    // HH:MM:SS:FF, the last separator is ';' for drop-frame. '.' and ',' are
+    // sometimes used for the second field
+    if (11 > end - pos || !scc_is_digit(pos[0]) || !scc_is_digit(pos[1]) || ':' != pos[2]
+        || !scc_is_digit(pos[3]) || !scc_is_digit(pos[4]) || ':' != pos[5]
+        || !scc_is_digit(pos[6]) || !scc_is_digit(pos[7]) || !scc_is_separator(pos[8])
+        || !scc_is_digit(pos[9]) || !scc_is_digit(pos[10]) || (11 < end - pos && !scc_is_space(pos[11]))) {
+        return LIBCAPTION_OK;
+    }
+
+    scc_line_t line;
+    line.timestamp = scc_timecode_to_timestamp(scc_digits(pos), scc_digits(pos + 3), scc_digits(pos + 6), scc_digits(pos + 9), ';' == pos[8] || ',' == pos[8]);
+    line.offset = scc->cc_size;
+
+    for (pos += 11;;) {
+        while (pos < end && scc_is_space(*pos)) {
+            ++pos;
+        }
+
+        if (4 > end - pos || (4 < end - pos && !scc_is_space(pos[4]))) {
+            break;
+        }
+
+        const uint8_t* hex = (const uint8_t*)pos;
+        uint8_t a = _scc_hex[hex[0]], b = _scc_hex[hex[1]], c = _scc_hex[hex[2]], d = _scc_hex[hex[3]];
+
+        if (!a || !b || !c || !d) {
+            break;
+        }
+
+        scc->cc_data[scc->cc_size++] = (uint16_t)(((a - 1) << 12) | ((b - 1) << 8) | ((c - 1) << 4) | (d - 1));
+        pos += 4;
+    }
+
+    line.size = scc->cc_size - line.offset;
+
+    if (0 == line.size) {
+        return LIBCAPTION_OK;
+    }
+
+    if (scc->line_size == scc->line_capacity) {
+        size_t capacity = scc->line_capacity ? 2 * scc->line_capacity : 256;
+        scc_line_t* lines = (scc_line_t*)realloc(scc->line, capacity * sizeof(scc_line_t));
+
+        if (!lines) {
+            return LIBCAPTION_ERROR;
+        }
+
+        scc->line = lines;
+        scc->line_capacity = capacity;
+    }
+
+    scc->line[scc->line_size++] = line;
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t scc_file_parse(scc_file_t* scc, const utf8_char_t* data, size_t size)
+{
+    const utf8_char_t* end = data + size;
+
+    memset(scc, 0, sizeof(scc_file_t));
+
+    // Every word is followed by a space or line ending, except possibly the last
+    if (NULL == (scc->cc_data = (uint16_t*)malloc((1 + size / 5) * sizeof(uint16_t)))) {
+        return LIBCAPTION_ERROR;
+    }
+
+    // UTF-8 BOM
+    if (3 <= size && 0 == memcmp(data, "\xEF\xBB\xBF", 3)) {
+        data += 3;
+    }
+
+    // Files with classic Mac line endings
+    utf8_char_t eol = memchr(data, '\n', end - data) ? '\n' : '\r';
+
+    while (data < end) {
+        const utf8_char_t* next = (const utf8_char_t*)memchr(data, eol, end - data);
+
+        if (LIBCAPTION_OK != scc_file_line(scc, data, next ? next : end)) {
+            return LIBCAPTION_ERROR;
+        }
+
+        data = next ? next + 1 : end;
+    }
+
+    if (scc->cc_size) {
+        uint16_t* cc_data = (uint16_t*)realloc(scc->cc_data, scc->cc_size * sizeof(uint16_t));
+        scc->cc_data = cc_data ? cc_data : scc->cc_data;
+    }
+
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t scc_file_load(scc_file_t* scc, const char* path)
+{
+    size_t size;
+    utf8_char_t* data = utf8_map_text_file(path, &size);
+
+    if (!data) {
+        memset(scc, 0, sizeof(scc_file_t));
+        return LIBCAPTION_ERROR;
+    }
+
+    libcaption_stauts_t status = scc_file_parse(scc, data, size);
+    utf8_unmap_text_file(data, size);
+    return status;
+}
+
+void scc_file_free(scc_file_t* scc)
+{
+    free(scc->line);
+    free(scc->cc_data);
+    memset(scc, 0, sizeof(scc_file_t));
+}
+
+size_t scc_file_seek(const scc_file_t* scc, double timestamp)
+{
+    size_t lo = 0, hi = scc->line_size;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (scc->line[mid].timestamp < timestamp) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int64_t scc_timestamp_to_frame(double timestamp)
+{
+    return 0 < timestamp ? (int64_t)(timestamp * 30000.0 / 1001.0 + 0.5) : 0;
+}
+
+int64_t scc_ticks_to_frame(caption_ticks_t ticks)
+{
+    return 0 < ticks ? caption_ticks_to_rational(ticks, 1001, 30000) : 0;
+}
+
+static void scc_format_digits(utf8_char_t* data, int64_t value)
+{
+    data[0] = (utf8_char_t)('0' + (value / 10) % 10);
+    data[1] = (utf8_char_t)('0' + value % 10);
+}
+
+size_t scc_format_timecode(utf8_char_t* data, int64_t frame, int drop_frame)
+{
+    if (drop_frame) {
+        // Put back the two frame numbers skipped every minute, except every tenth
+        int64_t d = frame / 17982, m = frame % 17982;
+        frame += 18 * d + (2 <= m ? 2 * ((m - 2) / 1798) : 0);
+    }
+
+    scc_format_digits(data + 0, frame / 108000);
+    data[2] = ':';
+    scc_format_digits(data + 3, (frame / 1800) % 60);
+    data[5] = ':';
+    scc_format_digits(data + 6, (frame / 30) % 60);
+    data[8] = drop_frame ? ';' : ':';
+    scc_format_digits(data + 9, frame % 30);
+    return SCC_TIMECODE_SIZE;
+}
+
+int scc_write_line(utf8_writer_t* writer, int64_t frame, const uint16_t* cc_data, size_t size, int drop_frame)
+{
+    static const char hex[] = "0123456789abcdef";
+    utf8_char_t timecode[SCC_TIMECODE_SIZE];
+
+    utf8_writer_write(writer, timecode, scc_format_timecode(timecode, frame, drop_frame));
+
+    for (size_t i = 0; i < size; ++i) {
+        utf8_char_t word[5] = { 0 == i ? '\t' : ' ', hex[(cc_data[i] >> 12) & 0x0F], hex[(cc_data[i] >> 8) & 0x0F], hex[(cc_data[i] >> 4) & 0x0F], hex[cc_data[i] & 0x0F] };
+        utf8_writer_write(writer, word, 5);
+    }
+
+    return utf8_writer_write(writer, "\r\n\r\n", 4);
+}
+
+// Preambles, mid-row codes, special and extended charcters and commands
+static int scc_is_control_code(uint16_t cc_data) { return 0x1000 == (0x7000 & cc_data); }
+
+size_t scc_encode_popon(const utf8_char_t* text, int cc, uint16_t* cc_data, size_t size)
+{
+    size_t i, count = 0;
+    uint16_t body[EIA608_ENCODE_TEXT_MAX_WORDS];
+    size_t body_size = eia608_encode_text(text, cc, body, EIA608_ENCODE_TEXT_MAX_WORDS);
+
+#define SCC_ENCODE_WORD(word)       \
+    do {                            \
+        if (count >= size) {        \
+            return 0;               \
+        }                           \
+        cc_data[count++] = (word);  \
+    } while (0)
+
+    for (i = 0; i < 2; ++i) {
+        SCC_ENCODE_WORD(eia608_control_command(eia608_control_resume_caption_loading, cc));
+    }
+
+    for (i = 0; i < 2; ++i) {
+        SCC_ENCODE_WORD(eia608_control_command(eia608_control_erase_non_displayed_memory, cc));
+    }
+
+    for (i = 0; i < body_size; ++i) {
+        SCC_ENCODE_WORD(body[i]);
+
+        if (scc_is_control_code(body[i])) {
+            SCC_ENCODE_WORD(body[i]);
+        }
+    }
+
+    for (i = 0; i < 2; ++i) {
+        SCC_ENCODE_WORD(eia608_control_command(eia608_control_end_of_caption, cc));
+    }
+
+#undef SCC_ENCODE_WORD
+    return count;
+}
+
+int scc_writer_init(scc_writer_t* writer, utf8_writer_t* dest, int cc, int drop_frame)
+{
+    writer->writer = dest;
+    writer->cc = cc;
+    writer->drop_frame = drop_frame;
+    writer->next_frame = 0;
+    writer->clear_frame = -1;
+    return utf8_writer_string(dest, "Scenarist_SCC V1.0\r\n\r\n");
+}
+
+static int scc_writer_clear(scc_writer_t* writer, int64_t frame)
+{
+    uint16_t edm = eia608_control_command(eia608_control_erase_display_memory, writer->cc);
+    uint16_t cc_data[2] = { edm, edm };
+
+    writer->clear_frame = -1;
+    writer->next_frame = frame + 2;
+    return scc_write_line(writer->writer, frame, cc_data, 2, writer->drop_frame);
+}
+
+int scc_writer_cue(scc_writer_t* writer, caption_ticks_t start, caption_ticks_t end, const uint16_t* cc_data, size_t size)
+{
+    int ret = 1;
+    int64_t frame = scc_ticks_to_frame(start) - (2 <= size ? (int64_t)size - 2 : 0);
+
+    if (0 > frame) {
+        frame = 0;
+    }
+
+    if (0 <= writer->clear_frame) {
+        int64_t clear = writer->clear_frame < writer->next_frame ? writer->next_frame : writer->clear_frame;
+
+        if (clear + 2 <= frame) {
+            ret = scc_writer_clear(writer, clear);
+        } else {
+            writer->clear_frame = -1;
+        }
+    }
+
+    if (frame < writer->next_frame) {
+        frame = writer->next_frame;
+    }
+
+    if (!scc_write_line(writer->writer, frame, cc_data, size, writer->drop_frame)) {
+        ret = 0;
+    }
+
+    writer->next_frame = frame + size;
+    writer->clear_frame = scc_ticks_to_frame(end);
+    return ret;
+}
+
+int scc_writer_finish(scc_writer_t* writer)
+{
+    if (0 > writer->clear_frame) {
+        return 1;
+    }
+
+    return scc_writer_clear(writer, writer->clear_frame < writer->next_frame ? writer->next_frame : writer->clear_frame);
+}
@@ -0,0 +1,296 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "sei_cache.h"
+#include "mpeg.h"
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Minimal locking and atomics so the cache can be shared between threads
+#if defined(_WIN32)
+#include <windows.h>
+typedef CRITICAL_SECTION sei_cache_mutex_t;
+static void sei_cache_mutex_init(sei_cache_mutex_t* m) { InitializeCriticalSection(m); }
+static void sei_cache_mutex_destroy(sei_cache_mutex_t* m) { DeleteCriticalSection(m); }
+static void sei_cache_mutex_lock(sei_cache_mutex_t* m) { EnterCriticalSection(m); }
+static void sei_cache_mutex_unlock(sei_cache_mutex_t* m) { LeaveCriticalSection(m); }
+static long sei_cache_refs_add(volatile long* refs, long n) { return InterlockedExchangeAdd(refs, n) + n; }
+#else
+#include <pthread.h>
+typedef pthread_mutex_t sei_cache_mutex_t;
+static void sei_cache_mutex_init(sei_cache_mutex_t* m) { pthread_mutex_init(m, 0); }
+static void sei_cache_mutex_destroy(sei_cache_mutex_t* m) { pthread_mutex_destroy(m); }
+static void sei_cache_mutex_lock(sei_cache_mutex_t* m) { pthread_mutex_lock(m); }
+static void sei_cache_mutex_unlock(sei_cache_mutex_t* m) { pthread_mutex_unlock(m); }
+static long sei_cache_refs_add(volatile long* refs, long n) { return __sync_add_and_fetch(refs, n); }
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#define SEI_CACHE_BUCKETS 1024
+#define SEI_CACHE_PREFIX_SIZE 4
+
+struct _sei_cache_entry_t {
+    volatile long refs;
+    uint32_t hash;
+    struct _sei_cache_entry_t* next; //< bucket chain
+    struct _sei_cache_entry_t* newer; //< insertion order, for eviction
+    const utf8_char_t* text; //< NULL for clear
+    size_t nalu_size;
+    uint8_t* avcc; //< length + nalu
+    uint8_t* annexb; //< start code + nalu
+};
+
+struct _sei_cache_t {
+    sei_cache_mutex_t mutex;
+    size_t capacity, count;
+    sei_cache_entry_t* oldest;
+    sei_cache_entry_t* newest;
+    sei_cache_entry_t* bucket[SEI_CACHE_BUCKETS];
+};
+
+// FNV-1a
+static uint32_t sei_cache_hash(const utf8_char_t* text)
+{
+    uint32_t hash = 2166136261u;
+
+    if (!text) {
+        return 0;
+    }
+
+    for (; *text; ++text) {
+        hash = (hash ^ (uint8_t)(*text)) * 16777619u;
+    }
+
+    return hash;
+}
+
+static int sei_cache_entry_match(const sei_cache_entry_t* entry, uint32_t hash, const utf8_char_t* text)
+{
+    if (entry->hash != hash) {
+        return 0;
+    }
+
+    if (!entry->text || !text) {
+        return entry->text == text;
+    }
+
+    return 0 == strcmp(entry->text, text);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static sei_cache_entry_t* sei_cache_entry_new(const utf8_char_t* text, uint32_t hash)
+{
+    sei_t sei;
+    sei_init(&sei, 0);
+
+    if (text) {
+        caption_frame_t frame;
+        caption_frame_init(&frame);
+        caption_frame_from_text(&frame, text);
+        sei_from_caption_frame(&sei, &frame);
+    } else {
+        sei_from_caption_clear(&sei);
+    }
+
+    size_t text_size = text ? strlen(text) + 1 : 0;
+    size_t nalu_size = sei_render_size(&sei);
+    sei_cache_entry_t* entry = (sei_cache_entry_t*)malloc(sizeof(sei_cache_entry_t) + 2 * (SEI_CACHE_PREFIX_SIZE + nalu_size) + text_size);
+
+    if (!entry) {
+        sei_free(&sei);
+        return 0;
+    }
+
+    entry->refs = 1;
+    entry->hash = hash;
+    entry->next = 0;
+    entry->newer = 0;
+    entry->avcc = (uint8_t*)(entry + 1);
+    entry->nalu_size = sei_render(&sei, entry->avcc + SEI_CACHE_PREFIX_SIZE);
+    entry->annexb = entry->avcc + SEI_CACHE_PREFIX_SIZE + entry->nalu_size;
+    sei_free(&sei);
+
+    entry->avcc[0] = (uint8_t)(entry->nalu_size >> 24);
+    entry->avcc[1] = (uint8_t)(entry->nalu_size >> 16);
+    entry->avcc[2] = (uint8_t)(entry->nalu_size >> 8);
+    entry->avcc[3] = (uint8_t)(entry->nalu_size >> 0);
+    entry->annexb[0] = 0;
+    entry->annexb[1] = 0;
+    entry->annexb[2] = 0;
+    entry->annexb[3] = 1;
+    memcpy(entry->annexb + SEI_CACHE_PREFIX_SIZE, entry->avcc + SEI_CACHE_PREFIX_SIZE, entry->nalu_size);
+
+    if (text) {
+        utf8_char_t* copy = (utf8_char_t*)(entry->annexb + SEI_CACHE_PREFIX_SIZE + entry->nalu_size);
+        memcpy(copy, text, text_size);
+        entry->text = copy;
+    } else {
+        entry->text = 0;
+    }
+
+    return entry;
+}
+
+sei_cache_entry_t* sei_cache_entry_retain(sei_cache_entry_t* entry)
+{
+    sei_cache_refs_add(&entry->refs, 1);
+    return entry;
+}
+
+void sei_cache_entry_release(sei_cache_entry_t* entry)
+{
+    if (entry && 0 == sei_cache_refs_add(&entry->refs, -1)) {
+        free(entry);
+    }
+}
+
+const uint8_t* sei_cache_entry_nalu(const sei_cache_entry_t* entry, size_t* size)
+{
+    (*size) = entry->nalu_size;
+    return entry->avcc + SEI_CACHE_PREFIX_SIZE;
+}
+
+const uint8_t* sei_cache_entry_avcc(const sei_cache_entry_t* entry, size_t* size)
+{
+    (*size) = SEI_CACHE_PREFIX_SIZE + entry->nalu_size;
+    return entry->avcc;
+}
+
+const uint8_t* sei_cache_entry_annexb(const sei_cache_entry_t* entry, size_t* size)
+{
+    (*size) = SEI_CACHE_PREFIX_SIZE + entry->nalu_size;
+    return entry->annexb;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+sei_cache_t* sei_cache_new(size_t capacity)
+{
+    sei_cache_t* cache = (sei_cache_t*)malloc(sizeof(sei_cache_t));
+
+    if (!cache) {
+        return 0;
+    }
+
+    memset(cache, 0, sizeof(sei_cache_t));
+    sei_cache_mutex_init(&cache->mutex);
+    cache->capacity = 0 < capacity ? capacity : 1;
+    return cache;
+}
+
+void sei_cache_free(sei_cache_t* cache)
+{
+    if (!cache) {
+        return;
+    }
+
+    while (cache->oldest) {
+        sei_cache_entry_t* entry = cache->oldest;
+        cache->oldest = entry->newer;
+        sei_cache_entry_release(entry);
+    }
+
+    sei_cache_mutex_destroy(&cache->mutex);
+    free(cache);
+}
+
+// must be called with the mutex held
+static sei_cache_entry_t* sei_cache_find(sei_cache_t* cache, uint32_t hash, const utf8_char_t* text)
+{
+    sei_cache_entry_t* entry;
+    for (entry = cache->bucket[hash % SEI_CACHE_BUCKETS]; entry; entry = entry->next) {
+        if (sei_cache_entry_match(entry, hash, text)) {
+            return sei_cache_entry_retain(entry);
+        }
+    }
+
+    return 0;
+}
+
+// must be called with the mutex held. Takes the cache's reference to the oldest entry
+static void sei_cache_evict(sei_cache_t* cache)
+{
+    sei_cache_entry_t* entry = cache->oldest;
+    sei_cache_entry_t** link = &cache->bucket[entry->hash % SEI_CACHE_BUCKETS];
+
+    while (*link != entry) {
+        link = &(*link)->next;
+    }
+
+    (*link) = entry->next;
+    cache->oldest = entry->newer;
+    cache->newest = cache->oldest ? cache->newest : 0;
+    --cache->count;
+    sei_cache_entry_release(entry);
+}
+
+sei_cache_entry_t* sei_cache_text(sei_cache_t* cache, const utf8_char_t* text)
+{
+    uint32_t hash = sei_cache_hash(text);
+
+    sei_cache_mutex_lock(&cache->mutex);
+    sei_cache_entry_t* entry = sei_cache_find(cache, hash, text);
+    sei_cache_mutex_unlock(&cache->mutex);
+
+    if (entry) {
+        return entry;
+    }
+
+    // Render without holding the lock. If another thread rendered the same text
+    // in the mean time, its entry wins and ours is discarded
+    sei_cache_entry_t* new_entry = sei_cache_entry_new(text, hash);
+
+    if (!new_entry) {
+        return 0;
+    }
+
+    sei_cache_mutex_lock(&cache->mutex);
+    entry = sei_cache_find(cache, hash, text);
+
+    if (!entry) {
+        entry = sei_cache_entry_retain(new_entry); // one for the cache, one for the caller
+        entry->next = cache->bucket[hash % SEI_CACHE_BUCKETS];
+        cache->bucket[hash % SEI_CACHE_BUCKETS] = entry;
+
+        if (cache->newest) {
+            cache->newest->newer = entry;
+        } else {
+            cache->oldest = entry;
+        }
+
+        cache->newest = entry;
+        ++cache->count;
+
+        while (cache->count > cache->capacity) {
+            sei_cache_evict(cache);
+        }
+    }
+
+    sei_cache_mutex_unlock(&cache->mutex);
+
+    if (entry != new_entry) {
+        sei_cache_entry_release(new_entry);
+    }
+
+    return entry;
+}
@@ -43,17 +43,39 @@ vtt_t* srt_parse(const utf8_char_t* data, size_t size)
     return _vtt_parse(data, size, 1);
 }
 
-void srt_dump(srt_t* srt)
+srt_t* srt_parse_file(const char* path)
+{
+    return _vtt_parse_file(path, 1);
+}
+
+int srt_write_cue(utf8_writer_t* writer, srt_cue_t* cue, unsigned int index)
 {
-    int i;
-    vtt_block_t* block;
+    utf8_writer_uint(writer, index);
+    utf8_writer_write(writer, "\r\n", 2);
+    utf8_writer_ms(writer, caption_ticks_to_ms(cue->ticks), ',');
+    utf8_writer_write(writer, " --> ", 5);
+    utf8_writer_ms(writer, caption_ticks_to_ms(cue->ticks + (0 < cue->duration_ticks ? cue->duration_ticks : 0)), ',');
+    utf8_writer_write(writer, "\r\n", 2);
+    return _vtt_write_text(writer, srt_cue_data(cue));
+}
 
-    for (block = srt->cue_head, i = 1; block; block = block->next, ++i) {
-        int hh1, hh2, mm1, mm2, ss1, ss2, ms1, ms2;
-        vtt_crack_time(block->timestamp, &hh1, &mm1, &ss1, &ms1);
-        vtt_crack_time(block->timestamp + block->duration, &hh2, &mm2, &ss2, &ms2);
+int srt_write(utf8_writer_t* writer, srt_t* srt)
+{
+    unsigned int i;
+    srt_cue_t* cue;
 
-        printf("%02d\r\n%d:%02d:%02d,%03d --> %02d:%02d:%02d,%03d\r\n%s\r\n", i,
-            hh1, mm1, ss1, ms1, hh2, mm2, ss2, ms2, vtt_block_data(block));
+    for (cue = srt->cue_head, i = 1; cue; cue = cue->next, ++i) {
+        srt_write_cue(writer, cue, i);
     }
+
+    return !writer->error;
+}
+
+void srt_dump(srt_t* srt)
+{
+    utf8_writer_t writer;
+    fflush(stdout);
+    utf8_writer_init_fd(&writer, 1);
+    srt_write(&writer, srt);
+    utf8_writer_free(&writer);
 }
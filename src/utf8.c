@@ -27,6 +27,450 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32)
+#include <windows.h>
+#include <io.h>
+#define write _write
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Block kernels. The per charcter helpers are built from three primitives that
+// can run many bytes at a time:
+//   ascii_length  number of leading bytes below 0x80
+//   char_count    number of bytes that are not continuation bytes (10xxxxxx)
+//   valid_length  number of leading bytes that form complete, well formed utf8
+// An implementation is picked from the cpu on first use. valid_length does not
+// treat 0x00 as special, callers that stop at the null terminator bound size first
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && 2 <= _M_IX86_FP)
+#define UTF8_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(UTF8_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTF8_AVX2 1
+#include <immintrin.h>
+#endif
+
+typedef struct {
+    size_t (*ascii_length)(const uint8_t* data, size_t size);
+    size_t (*char_count)(const uint8_t* data, size_t size);
+    size_t (*valid_length)(const uint8_t* data, size_t size);
+} utf8_kernels_t;
+
+static inline int utf8_continuation(uint8_t c) { return 0x80 == (c & 0xC0); }
+
+static inline unsigned int utf8_ctz(uint32_t x)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_ctz(x);
+#else
+    unsigned int n = 0;
+    for (; !(x & 1); x >>= 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+static inline size_t utf8_popcount(uint32_t x)
+{
+#if defined(__GNUC__)
+    return (size_t)__builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    return (size_t)((((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+#endif
+}
+
+// Length of the well formed sequence at data, or 0. See table 3-7 of the Unicode standard
+static size_t utf8_valid_char(const uint8_t* data, size_t size)
+{
+    uint8_t c = data[0], lo = 0x80, hi = 0xBF;
+    size_t i, bytes;
+
+    if (0x80 > c) {
+        return 1;
+    } else if (0xC2 <= c && 0xDF >= c) {
+        bytes = 2;
+    } else if (0xE0 <= c && 0xEF >= c) {
+        bytes = 3, lo = 0xE0 == c ? 0xA0 : lo, hi = 0xED == c ? 0x9F : hi;
+    } else if (0xF0 <= c && 0xF4 >= c) {
+        bytes = 4, lo = 0xF0 == c ? 0x90 : lo, hi = 0xF4 == c ? 0x8F : hi;
+    } else {
+        return 0;
+    }
+
+    if (size < bytes || lo > data[1] || hi < data[1]) {
+        return 0;
+    }
+
+    for (i = 2; i < bytes; ++i) {
+        if (!utf8_continuation(data[i])) {
+            return 0;
+        }
+    }
+
+    return bytes;
+}
+
+static size_t utf8_ascii_length_scalar(const uint8_t* data, size_t size)
+{
+    size_t i = 0;
+    uint64_t word;
+
+    for (; i + 8 <= size; i += 8) {
+        memcpy(&word, &data[i], 8);
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+    }
+
+    for (; i < size && 0x80 > data[i]; ++i) {
+    }
+
+    return i;
+}
+
+static size_t utf8_char_count_scalar(const uint8_t* data, size_t size)
+{
+    size_t i, count = 0;
+
+    for (i = 0; i < size; ++i) {
+        count += !utf8_continuation(data[i]);
+    }
+
+    return count;
+}
+
+#if !defined(UTF8_SSE2)
+static size_t utf8_valid_length_scalar(const uint8_t* data, size_t size)
+{
+    size_t i = 0, bytes;
+
+    while (i < size) {
+        i += utf8_ascii_length_scalar(&data[i], size - i);
+
+        // Multibyte text tends to stay multibyte, avoid restarting the ascii scan per charcter
+        while (i < size && 0x80 <= data[i]) {
+            if (0 == (bytes = utf8_valid_char(&data[i], size - i))) {
+                return i;
+            }
+
+            i += bytes;
+        }
+    }
+
+    return i;
+}
+
+static const utf8_kernels_t utf8_kernels_scalar = {
+    utf8_ascii_length_scalar,
+    utf8_char_count_scalar,
+    utf8_valid_length_scalar,
+};
+#endif
+
+#if defined(UTF8_SSE2)
+static size_t utf8_ascii_length_sse2(const uint8_t* data, size_t size)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)&data[i]));
+
+        if (mask) {
+            return i + utf8_ctz(mask);
+        }
+    }
+
+    return i + utf8_ascii_length_scalar(&data[i], size - i);
+}
+
+static size_t utf8_char_count_sse2(const uint8_t* data, size_t size)
+{
+    size_t i = 0, count = 0;
+    // Continuation bytes are 0x80-0xBF, the lowest signed values
+    const __m128i cont = _mm_set1_epi8((char)0xBF);
+
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&data[i]);
+        count += utf8_popcount((uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(v, cont)));
+    }
+
+    return count + utf8_char_count_scalar(&data[i], size - i);
+}
+
+static size_t utf8_valid_length_sse2(const uint8_t* data, size_t size)
+{
+    size_t i = 0, bytes;
+
+    while (i < size) {
+        i += utf8_ascii_length_sse2(&data[i], size - i);
+
+        while (i < size && 0x80 <= data[i]) {
+            if (0 == (bytes = utf8_valid_char(&data[i], size - i))) {
+                return i;
+            }
+
+            i += bytes;
+        }
+    }
+
+    return i;
+}
+
+static const utf8_kernels_t utf8_kernels_sse2 = {
+    utf8_ascii_length_sse2,
+    utf8_char_count_sse2,
+    utf8_valid_length_sse2,
+};
+#endif
+
+#if defined(UTF8_AVX2)
+#define UTF8_AVX2_TARGET __attribute__((target("avx2")))
+
+UTF8_AVX2_TARGET static size_t utf8_ascii_length_avx2(const uint8_t* data, size_t size)
+{
+    size_t i = 0;
+
+    for (; i + 32 <= size; i += 32) {
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)&data[i]));
+
+        if (mask) {
+            return i + utf8_ctz(mask);
+        }
+    }
+
+    return i + utf8_ascii_length_sse2(&data[i], size - i);
+}
+
+UTF8_AVX2_TARGET static size_t utf8_char_count_avx2(const uint8_t* data, size_t size)
+{
+    size_t i = 0, count = 0;
+    const __m256i cont = _mm256_set1_epi8((char)0xBF);
+
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&data[i]);
+        count += utf8_popcount((uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, cont)));
+    }
+
+    return count + utf8_char_count_sse2(&data[i], size - i);
+}
+
+// Byte pair classification from Keiser and Lemire, "Validating UTF-8 In Less
+// Than One Instruction Per Byte". Every byte is checked against the byte before
+// it with three 16 entry table lookups, 3 and 4 byte sequences also need the
+// bytes two and three back to agree on how many continuations are expected
+#define UTF8_TOO_SHORT (1 << 0)
+#define UTF8_TOO_LONG (1 << 1)
+#define UTF8_OVERLONG_3 (1 << 2)
+#define UTF8_TOO_LARGE (1 << 3)
+#define UTF8_SURROGATE (1 << 4)
+#define UTF8_OVERLONG_2 (1 << 5)
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+#define UTF8_OVERLONG_4 (1 << 6)
+#define UTF8_TWO_CONTS (1 << 7)
+#define UTF8_CARRY (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+#define UTF8_TABLE(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) \
+    _mm256_setr_epi8(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p)
+
+UTF8_AVX2_TARGET static inline __m256i utf8_avx2_prev(__m256i input, __m256i prev_input, int n)
+{
+    __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+
+    switch (n) {
+    case 1:
+        return _mm256_alignr_epi8(input, shifted, 15);
+    case 2:
+        return _mm256_alignr_epi8(input, shifted, 14);
+    default:
+        return _mm256_alignr_epi8(input, shifted, 13);
+    }
+}
+
+UTF8_AVX2_TARGET static inline __m256i utf8_avx2_high_nibble(__m256i v)
+{
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+}
+
+// Nonzero bytes mark errors in input, given the 32 bytes that preceded it
+UTF8_AVX2_TARGET static __m256i utf8_avx2_errors(__m256i input, __m256i prev_input)
+{
+    const __m256i byte_1_high_table = UTF8_TABLE(
+        // 0_______ ________ <ASCII in byte 1>
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        // 10______ ________ <continuation in byte 1>
+        UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+        // 1100____ ________ <two byte lead in byte 1>
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+        // 1101____ ________ <two byte lead in byte 1>
+        UTF8_TOO_SHORT,
+        // 1110____ ________ <three byte lead in byte 1>
+        UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+        // 1111____ ________ <four+ byte lead in byte 1>
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4);
+
+    const __m256i byte_1_low_table = UTF8_TABLE(
+        // ____0000 ________
+        UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+        // ____0001 ________
+        UTF8_CARRY | UTF8_OVERLONG_2,
+        // ____001_ ________
+        UTF8_CARRY, UTF8_CARRY,
+        // ____0100 ________
+        UTF8_CARRY | UTF8_TOO_LARGE,
+        // ____0101 ________
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        // ____011_ ________
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        // ____1___ ________
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        // ____1101 ________
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000);
+
+    const __m256i byte_2_high_table = UTF8_TABLE(
+        // ________ 0_______ <ASCII in byte 2>
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        // ________ 1000____
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+        // ________ 1001____
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+        // ________ 101_____
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        // ________ 11______
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT);
+
+    __m256i prev1 = utf8_avx2_prev(input, prev_input, 1);
+    __m256i special = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(byte_1_high_table, utf8_avx2_high_nibble(prev1)),
+            _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)))),
+        _mm256_shuffle_epi8(byte_2_high_table, utf8_avx2_high_nibble(input)));
+
+    // Bytes two after a 3 or 4 byte lead, or three after a 4 byte lead, must be continuations.
+    // TWO_CONTS was flagged for each of them, clear it where it was expected
+    __m256i prev2 = utf8_avx2_prev(input, prev_input, 2);
+    __m256i prev3 = utf8_avx2_prev(input, prev_input, 3);
+    __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+    return _mm256_xor_si256(must23, special);
+}
+
+UTF8_AVX2_TARGET static size_t utf8_valid_length_avx2(const uint8_t* data, size_t size)
+{
+    size_t i = 0, j;
+    __m256i prev_input = _mm256_setzero_si256();
+    int incomplete = 0;
+
+    for (; i + 32 <= size; i += 32) {
+        __m256i input = _mm256_loadu_si256((const __m256i*)&data[i]);
+
+        if (0 == _mm256_movemask_epi8(input)) {
+            if (incomplete) {
+                break;
+            }
+        } else {
+            __m256i errors = utf8_avx2_errors(input, prev_input);
+
+            if (!_mm256_testz_si256(errors, errors)) {
+                break;
+            }
+        }
+
+        // A sequence that continues into the next block is checked there
+        incomplete = 0xC0 <= data[i + 31] || 0xE0 <= data[i + 30] || 0xF0 <= data[i + 29];
+        prev_input = input;
+    }
+
+    // Everything before i is valid, except a sequence that began in the last
+    // block and did not finish. Restart the scalar check at its lead byte
+    if (incomplete) {
+        for (j = i - 1; i - 3 < j && utf8_continuation(data[j]); --j) {
+        }
+        i = j;
+    }
+
+    return i + utf8_valid_length_sse2(&data[i], size - i);
+}
+
+static const utf8_kernels_t utf8_kernels_avx2 = {
+    utf8_ascii_length_avx2,
+    utf8_char_count_avx2,
+    utf8_valid_length_avx2,
+};
+#endif
+
+static const utf8_kernels_t* utf8_kernels_select(void)
+{
+#if defined(UTF8_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return &utf8_kernels_avx2;
+    }
+#endif
+#if defined(UTF8_SSE2)
+    return &utf8_kernels_sse2;
+#else
+    return &utf8_kernels_scalar;
+#endif
+}
+
+// Selected once, later calls only read the pointer
+static const utf8_kernels_t* utf8_kernels_selected = 0;
+
+#if defined(_WIN32)
+static INIT_ONCE utf8_kernels_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK utf8_kernels_init(PINIT_ONCE once, PVOID param, PVOID* context)
+{
+    utf8_kernels_selected = utf8_kernels_select();
+    return TRUE;
+}
+
+static const utf8_kernels_t* utf8_kernels(void)
+{
+    InitOnceExecuteOnce(&utf8_kernels_once, utf8_kernels_init, 0, 0);
+    return utf8_kernels_selected;
+}
+#else
+static pthread_once_t utf8_kernels_once = PTHREAD_ONCE_INIT;
+
+static void utf8_kernels_init(void)
+{
+    utf8_kernels_selected = utf8_kernels_select();
+}
+
+static const utf8_kernels_t* utf8_kernels(void)
+{
+    pthread_once(&utf8_kernels_once, utf8_kernels_init);
+    return utf8_kernels_selected;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
 const utf8_char_t* utf8_char_next(const utf8_char_t* c)
 {
     const utf8_char_t* n = c + utf8_char_length(c);
@@ -73,6 +517,10 @@ size_t utf8_string_length(const utf8_char_t* data, utf8_size_t size)
         size = utf8_char_count(data, 0);
     }
 
+    // Each ascii byte is a charcter. data is not read past size bytes or the null terminator
+    byts = utf8_kernels()->ascii_length((const uint8_t*)data, strnlen(data, size));
+    data += byts, size -= byts;
+
     for (; 0 < size; --size) {
         if (0 == (char_length = utf8_char_length(data))) {
             break;
@@ -101,32 +549,59 @@ size_t utf8_char_copy(utf8_char_t* dst, const utf8_char_t* src)
 // to count until the a null terminator, pass 0 for size
 utf8_size_t utf8_char_count(const char* data, size_t size)
 {
-    size_t i, bytes = 0;
+    const utf8_kernels_t* kernels = utf8_kernels();
+    const uint8_t* bytes = (const uint8_t*)data;
+    size_t i = 0, valid, length;
     utf8_size_t count = 0;
 
-    if (0 == size) {
-        size = strlen(data);
-    }
+    // Counting stops at the null terminator
+    size = 0 == size ? strlen(data) : strnlen(data, size);
 
-    for (i = 0; i < size; ++count, i += bytes) {
-        if (0 == (bytes = utf8_char_length(&data[i]))) {
-            break;
+    while (i < size) {
+        // Well formed runs are counted without looking at charcter boundaries
+        valid = kernels->valid_length(&bytes[i], size - i);
+        count += kernels->char_count(&bytes[i], valid);
+        i += valid;
+
+        // Anything else is stepped over by its lead byte, as before
+        if (i < size) {
+            if (0 == (length = utf8_char_length(&data[i]))) {
+                break;
+            }
+
+            ++count, i += length;
         }
     }
 
     return count;
 }
 
+size_t utf8_valid_length(const utf8_char_t* data, size_t size)
+{
+    return utf8_kernels()->valid_length((const uint8_t*)data, size);
+}
+
 // returns the length of the line in bytes triming not printable charcters at the end
 size_t utf8_trimmed_length(const utf8_char_t* data, utf8_size_t charcters)
 {
-    size_t l, t = 0, split_at = 0;
-    for (size_t c = 0; (*data) && c < charcters; ++c) {
+    size_t l, t, c, split_at = 0;
+
+    // An ascii prefix is one charcter per byte, search it backwards for the last printable
+    t = c = utf8_kernels()->ascii_length((const uint8_t*)data, strnlen(data, charcters));
+
+    for (l = t; 0 < l; --l) {
+        if (!utf8_char_whitespace(&data[l - 1])) {
+            split_at = l;
+            break;
+        }
+    }
+
+    for (data += t; (*data) && c < charcters; ++c) {
         l = utf8_char_length(data);
         if (!utf8_char_whitespace(data)) {
             split_at = t + l;
         }
-         t += l, data += l;
+        t += l, data += l;
     }
 
     return split_at;
@@ -146,17 +621,10 @@ size_t _utf8_newline(const utf8_char_t* data)
 // auto detects between windows(CRLF), unix(LF), mac(CR) and riscos (LFCR) line endings
 size_t utf8_line_length(const utf8_char_t* data)
 {
-    size_t n, len = 0;
-
-    for (len = 0; 0 != data[len]; ++len) {
-        if (0 < (n = _utf8_newline(data))) {
-            return len + n;
-        }
-
-        data += utf8_char_length(data);
-    }
-
-    return len;
+    // Neither byte can appear inside a multibyte charcter, so the search can ignore
+    // charcter boundaries. strcspn is vectorized by the C library
+    size_t len = strcspn(data, "\r\n");
+    return len + _utf8_newline(&data[len]);
 }
 
 // returns number of chars to include before split
@@ -226,6 +694,231 @@ utf8_char_t* utf8_load_text_file(const char* path, size_t* size)
     return data;
 }
 
+#if defined(_WIN32)
+utf8_char_t* utf8_map_text_file(const char* path, size_t* size)
+{
+    (*size) = 0;
+    return utf8_load_text_file(path, size);
+}
+
+void utf8_unmap_text_file(utf8_char_t* data, size_t size)
+{
+    free(data);
+}
+#else
+// Rounded up to whole pages, with at least one byte past the end of the file
+static size_t utf8_map_length(size_t size)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return ((size + page) / page) * page;
+}
+
+utf8_char_t* utf8_map_text_file(const char* path, size_t* size)
+{
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    if (0 > fd) {
+        return NULL;
+    }
+
+    if (0 != fstat(fd, &st) || 0 > st.st_size) {
+        close(fd);
+        return NULL;
+    }
+
+    // Reserve zero filled memory, then map the file over the start of it. The
+    // bytes following the file are zero and can be used as a null terminator
+    (*size) = (size_t)st.st_size;
+    size_t length = utf8_map_length(*size);
+    void* data = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == data) {
+        close(fd);
+        return NULL;
+    }
+
+    if (0 < (*size) && MAP_FAILED == mmap(data, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0)) {
+        munmap(data, length);
+        close(fd);
+        return NULL;
+    }
+
+    close(fd);
+    return (utf8_char_t*)data;
+}
+
+void utf8_unmap_text_file(utf8_char_t* data, size_t size)
+{
+    if (data) {
+        munmap(data, utf8_map_length(size));
+    }
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+void utf8_writer_init(utf8_writer_t* writer, utf8_char_t* data, size_t capacity)
+{
+    writer->data = data;
+    writer->size = 0;
+    writer->capacity = data ? capacity : 0;
+    writer->fd = -1;
+    writer->error = 0;
+}
+
+void utf8_writer_init_fd(utf8_writer_t* writer, int fd)
+{
+    utf8_writer_init(writer, (utf8_char_t*)malloc(UTF8_WRITER_FLUSH_SIZE), UTF8_WRITER_FLUSH_SIZE);
+    writer->fd = fd;
+    writer->error = writer->data ? 0 : 1;
+}
+
+int utf8_writer_free(utf8_writer_t* writer)
+{
+    int ret = utf8_writer_flush(writer);
+    free(writer->data);
+    utf8_writer_init(writer, 0, 0);
+    return ret;
+}
+
+static int utf8_writer_write_fd(utf8_writer_t* writer, const utf8_char_t* data, size_t size)
+{
+    while (0 < size) {
+        int bytes = (int)write(writer->fd, data, (unsigned int)(size < 0x40000000 ? size : 0x40000000));
+
+        if (0 > bytes) {
+#if !defined(_WIN32)
+            if (EINTR == errno) {
+                continue;
+            }
+#endif
+            writer->error = 1;
+            return 0;
+        }
+
+        data += bytes, size -= bytes;
+    }
+
+    return 1;
+}
+
+int utf8_writer_flush(utf8_writer_t* writer)
+{
+    if (writer->error) {
+        return 0;
+    }
+
+    if (0 <= writer->fd && 0 < writer->size) {
+        size_t size = writer->size;
+        writer->size = 0;
+        return utf8_writer_write_fd(writer, writer->data, size);
+    }
+
+    return 1;
+}
+
+int utf8_writer_write(utf8_writer_t* writer, const utf8_char_t* data, size_t size)
+{
+    if (writer->error) {
+        return 0;
+    }
+
+    if (writer->capacity - writer->size < size) {
+        if (0 <= writer->fd) {
+            if (!utf8_writer_flush(writer)) {
+                return 0;
+            }
+
+            // Too big to be worth copying
+            if (writer->capacity < size) {
+                return utf8_writer_write_fd(writer, data, size);
+            }
+        } else {
+            size_t capacity = writer->capacity ? writer->capacity : 4096;
+
+            while (capacity - writer->size < size) {
+                capacity *= 2;
+            }
+
+            utf8_char_t* grown = (utf8_char_t*)realloc(writer->data, capacity);
+
+            if (!grown) {
+                writer->error = 1;
+                return 0;
+            }
+
+            writer->data = grown;
+            writer->capacity = capacity;
+        }
+    }
+
+    memcpy(&writer->data[writer->size], data, size);
+    writer->size += size;
+    return 1;
+}
+
+int utf8_writer_string(utf8_writer_t* writer, const utf8_char_t* data)
+{
+    return utf8_writer_write(writer, data, strlen(data));
+}
+
+// Writes at least digits digits, right to left, returns the position of the first
+static utf8_char_t* utf8_format_uint(utf8_char_t* end, uint64_t value, int digits)
+{
+    do {
+        *(--end) = (utf8_char_t)('0' + (value % 10));
+        value /= 10;
+    } while (0 < --digits || 0 < value);
+
+    return end;
+}
+
+int utf8_writer_uint(utf8_writer_t* writer, uint64_t value)
+{
+    utf8_char_t data[20];
+    utf8_char_t* first = utf8_format_uint(&data[20], value, 1);
+    return utf8_writer_write(writer, first, &data[20] - first);
+}
+
+size_t utf8_format_ms(utf8_char_t* data, int64_t ms, utf8_char_t separator)
+{
+    uint64_t ss = 0 < ms ? (uint64_t)ms / 1000 : 0;
+    uint64_t tt = 0 < ms ? (uint64_t)ms % 1000 : 0;
+    utf8_char_t hours[20];
+    utf8_char_t* first = utf8_format_uint(&hours[20], ss / 3600, 2);
+    size_t size = &hours[20] - first;
+
+    memcpy(data, first, size);
+    data[size + 0] = ':';
+    data[size + 1] = (utf8_char_t)('0' + (ss / 60 % 60) / 10);
+    data[size + 2] = (utf8_char_t)('0' + (ss / 60 % 60) % 10);
+    data[size + 3] = ':';
+    data[size + 4] = (utf8_char_t)('0' + (ss % 60) / 10);
+    data[size + 5] = (utf8_char_t)('0' + (ss % 60) % 10);
+    data[size + 6] = separator;
+    data[size + 7] = (utf8_char_t)('0' + tt / 100);
+    data[size + 8] = (utf8_char_t)('0' + (tt % 100) / 10);
+    data[size + 9] = (utf8_char_t)('0' + (tt % 10));
+    return size + 10;
+}
+
+size_t utf8_format_timestamp(utf8_char_t* data, double timestamp, utf8_char_t separator)
+{
+    return utf8_format_ms(data, 0 < timestamp ? (int64_t)(timestamp * 1000.0 + 0.5) : 0, separator);
+}
+
+int utf8_writer_ms(utf8_writer_t* writer, int64_t ms, utf8_char_t separator)
+{
+    utf8_char_t data[UTF8_TIMESTAMP_MAX_SIZE];
+    return utf8_writer_write(writer, data, utf8_format_ms(data, ms, separator));
+}
+
+int utf8_writer_timestamp(utf8_writer_t* writer, double timestamp, utf8_char_t separator)
+{
+    utf8_char_t data[UTF8_TIMESTAMP_MAX_SIZE];
+    return utf8_writer_write(writer, data, utf8_format_timestamp(data, timestamp, separator));
+}
+
 #ifndef strnstr
 char* strnstr(const char* string1, const char* string2, size_t len)
 {
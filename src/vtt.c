@@ -22,13 +22,93 @@
 /* THE SOFTWARE.                                                                              */
 /**********************************************************************************************/
 #include "vtt.h"
+#include "srt.h"
 #include "utf8.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-vtt_block_t* vtt_block_free_head(vtt_block_t* head);
+////////////////////////////////////////////////////////////////////////////////
+#define VTT_ARENA_MIN_CHUNK (64 * 1024)
+#define VTT_ARENA_ALIGN(size) (((size) + 7) & ~(size_t)7)
 
+static void* vtt_arena_alloc(vtt_arena_t* arena, size_t size)
+{
+    size = VTT_ARENA_ALIGN(size);
+
+    if (arena->used + size > arena->capacity) {
+        // Chunks double in size so a file needs few of them
+        size_t capacity = arena->capacity ? 2 * arena->capacity : VTT_ARENA_MIN_CHUNK;
+        size_t header = VTT_ARENA_ALIGN(sizeof(void*));
+
+        if (capacity < header + size) {
+            capacity = header + size;
+        }
+
+        void** chunk = (void**)malloc(capacity);
+
+        if (!chunk) {
+            return NULL;
+        }
+
+        (*chunk) = arena->chunk;
+        arena->chunk = chunk;
+        arena->used = header;
+        arena->capacity = capacity;
+    }
+
+    void* data = (uint8_t*)arena->chunk + arena->used;
+    arena->used += size;
+    return data;
+}
+
+static void vtt_arena_free(vtt_arena_t* arena)
+{
+    for (vtt_arena_heap_t* heap = arena->heap; heap; heap = heap->next) {
+        free(heap->block);
+    }
+
+    while (arena->chunk) {
+        void* prev = *(void**)arena->chunk;
+        free(arena->chunk);
+        arena->chunk = prev;
+    }
+
+    free(arena);
+}
+
+static void* vtt_alloc(vtt_t* vtt, size_t size)
+{
+    return (vtt && vtt->arena) ? vtt_arena_alloc(vtt->arena, size) : malloc(size);
+}
+
+// Heap blocks linked into a vtt_t that was parsed in place are recorded in its
+// arena, so vtt_free releases them along with the arena
+libcaption_stauts_t _vtt_block_adopt(vtt_t* vtt, vtt_block_t* block)
+{
+    if (!vtt->arena) {
+        return LIBCAPTION_OK;
+    }
+
+    vtt_arena_heap_t* heap = (vtt_arena_heap_t*)vtt_arena_alloc(vtt->arena, sizeof(vtt_arena_heap_t));
+
+    if (!heap) {
+        return LIBCAPTION_ERROR;
+    }
+
+    heap->block = block;
+    heap->next = vtt->arena->heap;
+    vtt->arena->heap = heap;
+    return LIBCAPTION_OK;
+}
+
+// Blocks in an arena are freed with the vtt_t
+static vtt_block_t* vtt_block_release(vtt_t* vtt, vtt_block_t* head)
+{
+    return vtt->arena ? head->next : vtt_block_free_head(head);
+}
+
+////////////////////////////////////////////////////////////////////////////////
 vtt_t* vtt_new()
 {
     vtt_t* vtt = malloc(sizeof(vtt_t));
@@ -38,6 +118,13 @@ vtt_t* vtt_new()
 
 void vtt_free(vtt_t* vtt)
 {
+    if (vtt->arena) {
+        vtt_arena_free(vtt->arena);
+        utf8_unmap_text_file(vtt->mapped, vtt->mapped_size);
+        free(vtt);
+        return;
+    }
+
     while (vtt->region_head != NULL) {
         vtt->region_head = vtt_block_free_head(vtt->region_head);
     }
@@ -50,18 +137,11 @@ void vtt_free(vtt_t* vtt)
     free(vtt);
 }
 
-vtt_block_t* vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enum VTT_BLOCK_TYPE type)
+static void vtt_block_link(vtt_t* vtt, vtt_block_t* block)
 {
-    vtt_block_t* block = malloc(sizeof(vtt_block_t) + size + 1);
     block->next = NULL;
-    block->type = type;
-    block->timestamp = 0.0;
-    block->duration = 0.0;
-    block->cue_settings = NULL;
-    block->cue_id = NULL;
-    block->text_size = size;
 
-    switch (type) {
+    switch (block->type) {
     case VTT_REGION:
         if (vtt->region_head == NULL) {
             vtt->region_head = block;
@@ -89,8 +169,42 @@ vtt_block_t* vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enu
     case VTT_NOTE:
         break;
     }
+}
 
-    utf8_char_t* dest = (utf8_char_t*)vtt_block_data(block);
+libcaption_stauts_t vtt_block_append(vtt_t* vtt, vtt_block_t* block)
+{
+    if (LIBCAPTION_OK != _vtt_block_adopt(vtt, block)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    vtt_block_link(vtt, block);
+    return LIBCAPTION_OK;
+}
+
+// Text, cue id and cue settings share one allocation
+static vtt_block_t* _vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enum VTT_BLOCK_TYPE type,
+    const utf8_char_t* cue_id, size_t cue_id_size, const utf8_char_t* cue_settings, size_t cue_settings_size)
+{
+    size_t extra = (cue_id ? cue_id_size + 1 : 0) + (cue_settings ? cue_settings_size + 1 : 0);
+    vtt_block_t* block = vtt_alloc(vtt, sizeof(vtt_block_t) + size + 1 + extra);
+
+    if (!block) {
+        return NULL;
+    }
+
+    block->next = NULL;
+    block->type = type;
+    vtt_cue_set_ticks(block, 0, 0);
+    block->cue_settings = NULL;
+    block->cue_id = NULL;
+    block->text_size = size;
+    block->block_text = (utf8_char_t*)block + sizeof(vtt_block_t);
+
+    if (vtt) {
+        vtt_block_link(vtt, block);
+    }
+
+    utf8_char_t* dest = block->block_text;
     if (data) {
         memcpy(dest, data, size);
     } else {
@@ -98,25 +212,69 @@ vtt_block_t* vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enu
     }
 
     dest[size] = '\0';
+    dest += size + 1;
+
+    if (cue_id) {
+        block->cue_id = dest;
+        memcpy(dest, cue_id, cue_id_size);
+        dest[cue_id_size] = '\0';
+        dest += cue_id_size + 1;
+    }
+
+    if (cue_settings) {
+        block->cue_settings = dest;
+        memcpy(dest, cue_settings, cue_settings_size);
+        dest[cue_settings_size] = '\0';
+    }
+
     return block;
 }
 
-vtt_block_t* vtt_block_free_head(vtt_block_t* head)
+// Only the header is allocated, strings are null terminated where they are in the source
+static vtt_block_t* _vtt_block_place(vtt_t* vtt, utf8_char_t* data, size_t size, enum VTT_BLOCK_TYPE type,
+    utf8_char_t* cue_id, size_t cue_id_size, utf8_char_t* cue_settings, size_t cue_settings_size)
 {
-    vtt_block_t* next = head->next;
-    if (head->cue_id != NULL) {
-        free(head->cue_id);
+    vtt_block_t* block = vtt_arena_alloc(vtt->arena, sizeof(vtt_block_t));
+
+    if (!block) {
+        return NULL;
     }
-    if (head->cue_settings != NULL) {
-        free(head->cue_settings);
+
+    block->next = NULL;
+    block->type = type;
+    vtt_cue_set_ticks(block, 0, 0);
+    block->cue_settings = cue_settings;
+    block->cue_id = cue_id;
+    block->text_size = size;
+    block->block_text = data;
+    data[size] = '\0';
+
+    if (cue_id) {
+        cue_id[cue_id_size] = '\0';
+    }
+
+    if (cue_settings) {
+        cue_settings[cue_settings_size] = '\0';
     }
+
+    return block;
+}
+
+vtt_block_t* vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enum VTT_BLOCK_TYPE type)
+{
+    return _vtt_block_new(vtt, data, size, type, NULL, 0, NULL, 0);
+}
+
+vtt_block_t* vtt_block_free_head(vtt_block_t* head)
+{
+    vtt_block_t* next = head->next;
     free(head);
     return next;
 }
 
 void vtt_cue_free_head(vtt_t* vtt)
 {
-    vtt->cue_head = vtt_block_free_head(vtt->cue_head);
+    vtt->cue_head = vtt_block_release(vtt, vtt->cue_head);
     if (vtt->cue_head == NULL) {
         vtt->cue_tail = NULL;
     }
@@ -124,7 +282,7 @@ void vtt_cue_free_head(vtt_t* vtt)
 
 void vtt_style_free_head(vtt_t* vtt)
 {
-    vtt->style_head = vtt_block_free_head(vtt->style_head);
+    vtt->style_head = vtt_block_release(vtt, vtt->style_head);
     if (vtt->style_head == NULL) {
         vtt->style_tail = NULL;
     }
@@ -132,164 +290,545 @@ void vtt_style_free_head(vtt_t* vtt)
 
 void vtt_region_free_head(vtt_t* vtt)
 {
-    vtt->region_head = vtt_block_free_head(vtt->region_head);
+    vtt->region_head = vtt_block_release(vtt, vtt->region_head);
     if (vtt->region_head == NULL) {
         vtt->region_tail = NULL;
     }
 }
 
-#define VTTTIME2SECONDS(HH, MM, SS, MS) ((HH * 3600.0) + (MM * 60.0) + SS + (MS / 1000.0))
-double parse_timestamp(const utf8_char_t* line)
+////////////////////////////////////////////////////////////////////////////////
+// Parser. Lines are found with memchr, every byte is looked at a constant number of times
+typedef struct {
+    const utf8_char_t* pos;
+    const utf8_char_t* end;
+    utf8_char_t eol;
+} vtt_reader_t;
+
+// Returns the next line without its line ending, or NULL at the end of data
+static const utf8_char_t* vtt_reader_line(vtt_reader_t* reader, size_t* size, const utf8_char_t** next)
 {
-    int hh, mm, ss, ms;
-    if (sscanf(line, "%d:%2d:%2d%*1[,.]%3d", &hh, &mm, &ss, &ms) == 4) {
-        return VTTTIME2SECONDS(hh, mm, ss, ms);
+    const utf8_char_t* line = reader->pos;
+
+    if (line >= reader->end) {
+        return NULL;
     }
-    if (sscanf(line, "%2d:%2d%*1[,.]%3d", &mm, &ss, &ms) == 3) {
-        return VTTTIME2SECONDS(0.0, mm, ss, ms);
+
+    const utf8_char_t* eol = (const utf8_char_t*)memchr(line, reader->eol, reader->end - line);
+    const utf8_char_t* stop = eol ? eol : reader->end;
+    (*next) = eol ? eol + 1 : reader->end;
+
+    // CRLF
+    if (stop > line && '\r' == stop[-1]) {
+        --stop;
+    }
+
+    (*size) = stop - line;
+    return line;
+}
+
+static int vtt_is_space(utf8_char_t c) { return ' ' == c || '\t' == c || '\r' == c || '\n' == c || '\f' == c; }
+
+static int vtt_line_blank(const utf8_char_t* line, size_t size)
+{
+    for (; 0 < size; ++line, --size) {
+        if (!vtt_is_space(*line)) {
+            return 0;
+        }
     }
-    return -1.0;
+
+    return 1;
 }
 
-void parse_timestamps(const utf8_char_t* line, double* start_pts, double* end_pts, char** cue_settings)
+static int vtt_line_keyword(const utf8_char_t* line, size_t size, const char* keyword, size_t keyword_size)
 {
-    char start_str[32];
-    char end_str[32];
-    char cue_str[1024];
+    return size >= keyword_size && 0 == memcmp(line, keyword, keyword_size) && (size == keyword_size || vtt_is_space(line[keyword_size]));
+}
 
-    int matches = sscanf(line, " %31s --> %31s%1023[^\n\r]", start_str, end_str, cue_str);
-    *start_pts = -1;
-    *cue_settings = NULL;
+static const utf8_char_t* vtt_find_arrow(const utf8_char_t* line, size_t size)
+{
+    const utf8_char_t* end = line + size;
 
-    printf("Matches: %d\n", matches);
+    while (line + 3 <= end && NULL != (line = (const utf8_char_t*)memchr(line, '-', end - line - 2))) {
+        if ('-' == line[1] && '>' == line[2]) {
+            return line;
+        }
 
-    if (matches >= 1) {
-        *start_pts = parse_timestamp(start_str);
-        printf("Start pts: %f\n", *start_pts);
+        ++line;
     }
-    if (matches >= 2) {
-        *end_pts = parse_timestamp(end_str);
+
+    return NULL;
+}
+
+// Reads a run of decimal digits, returns the count
+static int vtt_parse_digits(const utf8_char_t** pos, const utf8_char_t* end, uint64_t* value)
+{
+    int digits = 0;
+
+    for ((*value) = 0; (*pos) < end && '0' <= **pos && '9' >= **pos; ++(*pos), ++digits) {
+        (*value) = (*value) * 10 + (**pos - '0');
     }
-    if ((matches == 3) && (strlen(cue_str) > 0)) {
-        int cue_size = strlen(cue_str);
-        *cue_settings = malloc(cue_size + 1);
-        strncpy(*cue_settings, cue_str, cue_size);
-        (*cue_settings)[cue_size] = '\0';
+
+    return digits;
+}
+
+// [hh:]mm:ss.ttt, ',' is accepted in place of '.' for SRT. Returns ticks, -1 on error
+static caption_ticks_t vtt_parse_timestamp(const utf8_char_t** pos, const utf8_char_t* end)
+{
+    uint64_t hh = 0, mm, ss, ms;
+    int digits = vtt_parse_digits(pos, end, &mm);
+
+    // 19 digits always fit in uint64_t, the hour limit below is much lower
+    if (0 == digits || 19 < digits || (*pos) >= end || ':' != **pos) {
+        return -1;
     }
+
+    ++(*pos);
+
+    if (2 != vtt_parse_digits(pos, end, &ss)) {
+        return -1;
+    }
+
+    if ((*pos) < end && ':' == **pos) {
+        ++(*pos);
+        hh = mm, mm = ss;
+
+        if (2 != vtt_parse_digits(pos, end, &ss)) {
+            return -1;
+        }
+    }
+
+    if ((*pos) >= end || ('.' != **pos && ',' != **pos)) {
+        return -1;
+    }
+
+    ++(*pos);
+    digits = vtt_parse_digits(pos, end, &ms);
+
+    // Leaves room for minutes, seconds and milliseconds below INT64_MAX ticks
+    if (0 == digits || 3 < digits || 59 < mm || 59 < ss || INT64_MAX / (3600 * CAPTION_TICKS_PER_SECOND) <= hh) {
+        return -1;
+    }
+
+    for (; digits < 3; ++digits) {
+        ms *= 10;
+    }
+
+    return caption_ticks_from_ms((int64_t)(((hh * 60 + mm) * 60 + ss) * 1000 + ms));
 }
 
-vtt_t* vtt_parse(const utf8_char_t* data, size_t size)
+static const utf8_char_t* vtt_skip_space(const utf8_char_t* pos, const utf8_char_t* end)
 {
-    return _vtt_parse(data, size, 0);
+    while (pos < end && vtt_is_space(*pos)) {
+        ++pos;
+    }
+
+    return pos;
 }
 
-vtt_t* _vtt_parse(const utf8_char_t* data, size_t size, int srt_mode)
+// start --> end [settings]
+static int vtt_parse_timing(const utf8_char_t* line, size_t size, caption_ticks_t* start, caption_ticks_t* end, const utf8_char_t** settings, size_t* settings_size)
 {
-    vtt_t* vtt = NULL;
-    double str_pts = 0, end_pts = 0;
-    size_t line_length = 0, trimmed_length = 0;
-    char* cue_settings;
-    enum VTT_BLOCK_TYPE block_type;
-    size_t cue_id_length = 0;
-    const utf8_char_t* cue_id = NULL;
+    const utf8_char_t* stop = line + size;
+    const utf8_char_t* pos = vtt_skip_space(line, stop);
 
-    if (!data || !size || size < 6) {
-        return NULL;
+    if (0 > ((*start) = vtt_parse_timestamp(&pos, stop))) {
+        return 0;
     }
 
-    // TODO: Support UTF-8 BOM?
-    if (!srt_mode && strncmp(data, "WEBVTT", 6) != 0) {
-        // WebVTT files must start with WEBVTT
-        fprintf(stderr, "Invalid webvtt header: %.*s\n", 6, data);
-        return NULL;
+    pos = vtt_skip_space(pos, stop);
+
+    if (pos + 3 > stop || 0 != memcmp(pos, "-->", 3)) {
+        return 0;
     }
 
-    data += 6;
-    size -= 6;
+    pos = vtt_skip_space(pos + 3, stop);
 
-    vtt = vtt_new();
+    if (0 > ((*end) = vtt_parse_timestamp(&pos, stop))) {
+        return 0;
+    }
 
-    for (;;) {
-        line_length = 0;
-
-        do {
-            data += line_length;
-            size -= line_length;
-            line_length = utf8_line_length(data); // Line length
-            trimmed_length = utf8_trimmed_length(data, line_length);
-            // Skip empty lines
-        } while (0 < line_length && 0 == trimmed_length);
-
-        // line length only zero at EOF
-        if (0 == line_length) {
-            break;
+    pos = vtt_skip_space(pos, stop);
+
+    while (pos < stop && vtt_is_space(stop[-1])) {
+        --stop;
+    }
+
+    (*settings) = pos < stop ? pos : NULL;
+    (*settings_size) = stop - pos;
+    return 1;
+}
+
+// Parses a single block, data must not contain blank lines. If in_place is set
+// the block is allocated from its arena and refers to data, which is modified
+static libcaption_stauts_t vtt_parse_block(const utf8_char_t* data, size_t size, utf8_char_t eol, vtt_t* in_place, vtt_block_t** block)
+{
+    size_t line_size;
+    enum VTT_BLOCK_TYPE type;
+    caption_ticks_t start = 0, end = 0;
+    const utf8_char_t *line, *next;
+    const utf8_char_t *cue_id = NULL, *settings = NULL;
+    size_t cue_id_size = 0, settings_size = 0;
+    vtt_reader_t reader = { data, data + size, eol };
+
+    (*block) = NULL;
+
+    if (NULL == (line = vtt_reader_line(&reader, &line_size, &next))) {
+        return LIBCAPTION_OK;
+    }
+
+    reader.pos = next;
+
+    if (vtt_find_arrow(line, line_size)) {
+        type = VTT_CUE;
+    } else if (vtt_line_keyword(line, line_size, "REGION", 6)) {
+        type = VTT_REGION;
+    } else if (vtt_line_keyword(line, line_size, "STYLE", 5)) {
+        type = VTT_STYLE;
+    } else if (vtt_line_keyword(line, line_size, "NOTE", 4)) {
+        type = VTT_NOTE;
+    } else {
+        // Cue identifier, the timing must follow on the next line
+        cue_id = line, cue_id_size = line_size;
+        line = vtt_reader_line(&reader, &line_size, &next);
+        type = (line && vtt_find_arrow(line, line_size)) ? VTT_CUE : VTT_NOTE;
+        reader.pos = next;
+    }
+
+    if (VTT_CUE == type && !vtt_parse_timing(line, line_size, &start, &end, &settings, &settings_size)) {
+        type = VTT_NOTE; // Unparsable cues are dropped
+    }
+
+    // Comments and invalid blocks are ignored
+    if (VTT_NOTE == type) {
+        return LIBCAPTION_OK;
+    }
+
+    // Block text is the rest of the block, and keeps its line endings
+    if (in_place) {
+        (*block) = _vtt_block_place(in_place, (utf8_char_t*)reader.pos, reader.end - reader.pos, type,
+            (utf8_char_t*)cue_id, cue_id_size, (utf8_char_t*)settings, settings_size);
+    } else {
+        (*block) = _vtt_block_new(NULL, reader.pos, reader.end - reader.pos, type, cue_id, cue_id_size, settings, settings_size);
+    }
+
+    if (!(*block)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    if (VTT_CUE == type) {
+        vtt_cue_set_ticks(*block, start, end - start);
+    }
+
+    return LIBCAPTION_OK;
+}
+
+void vtt_parser_init(vtt_parser_t* parser, int srt_mode, vtt_parser_callback_t callback, void* opaque)
+{
+    memset(parser, 0, sizeof(vtt_parser_t));
+    parser->srt_mode = srt_mode;
+    parser->callback = callback;
+    parser->opaque = opaque;
+}
+
+void vtt_parser_free(vtt_parser_t* parser)
+{
+    free(parser->data);
+    vtt_parser_init(parser, parser->srt_mode, parser->callback, parser->opaque);
+}
+
+static libcaption_stauts_t vtt_parser_block(vtt_parser_t* parser, const utf8_char_t* data, size_t size)
+{
+    vtt_block_t* block;
+
+    if (vtt_parser_header == parser->state) {
+        // WebVTT files must start with WEBVTT, the header runs until the first blank line
+        if (6 > size || 0 != memcmp(data, "WEBVTT", 6) || (6 < size && !vtt_is_space(data[6]))) {
+            fprintf(stderr, "Invalid webvtt header: %.*s\n", (int)(6 < size ? 6 : size), data);
+            return LIBCAPTION_ERROR;
         }
 
-        if (strnstr(data, "REGION", line_length) != NULL) {
-            block_type = VTT_REGION;
-        } else if (strnstr(data, "STYLE", line_length) != NULL) {
-            block_type = VTT_STYLE;
-        } else if (strnstr(data, "NOTE", line_length) != NULL) {
-            block_type = VTT_NOTE;
-        } else if (strnstr(data, "-->", line_length) != NULL) {
-            block_type = VTT_CUE;
-            parse_timestamps(data, &str_pts, &end_pts, &cue_settings);
-            if (str_pts == -1) {
-                // Failed to parse timestamps
-                fprintf(stderr, "Bad timestamp: %.*s\n", (int)line_length, data);
-                return NULL;
-            }
+        parser->state = vtt_parser_blocks;
+        return LIBCAPTION_OK;
+    }
+
+    if (LIBCAPTION_OK != vtt_parse_block(data, size, parser->eol, parser->in_place, &block)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    if (block) {
+        parser->callback(parser->opaque, block);
+    }
+
+    return LIBCAPTION_OK;
+}
+
+// Emits every complete block in data. used receives the number of bytes no longer needed
+static libcaption_stauts_t vtt_parser_process(vtt_parser_t* parser, const utf8_char_t* data, size_t size, int final, size_t* used)
+{
+    const utf8_char_t* pos = data;
+    const utf8_char_t* end = data + size;
+
+    (*used) = 0;
+
+    if (vtt_parser_start == parser->state) {
+        // Wait until we know if there is a UTF-8 BOM
+        if (3 > size && !final && 0 == memcmp(data, "\xEF\xBB\xBF", size)) {
+            return LIBCAPTION_OK;
+        }
+
+        if (3 <= size && 0 == memcmp(data, "\xEF\xBB\xBF", 3)) {
+            pos += 3;
+        }
+
+        parser->state = parser->srt_mode ? vtt_parser_blocks : vtt_parser_header;
+        parser->scan = 0;
+    }
+
+    if (!parser->eol) {
+        // CRLF and LF files are split on LF, files with classic Mac line endings on CR
+        const utf8_char_t* lf = (const utf8_char_t*)memchr(pos, '\n', end - pos);
+        const utf8_char_t* cr = (const utf8_char_t*)memchr(pos, '\r', (lf ? lf : end) - pos);
+
+        if (cr && cr + 1 < end) {
+            parser->eol = '\n' == cr[1] ? '\n' : '\r';
+        } else if (cr && final) {
+            parser->eol = '\r';
+        } else if (lf || final) {
+            parser->eol = '\n';
         } else {
-            if (cue_id != NULL) {
-                // Invalid text found
-                fprintf(stderr, "ERR: Unrecognized block\n");
-                return NULL;
+            (*used) = pos - data;
+            return LIBCAPTION_OK;
+        }
+    }
+
+    for (;;) {
+        // A block starts at pos and ends at the first blank line. Lines before
+        // pos + scan were already looked at by a previous call
+        const utf8_char_t* line = pos + parser->scan;
+        const utf8_char_t* block_end = NULL;
+
+        while (!block_end) {
+            const utf8_char_t* eol = line < end ? (const utf8_char_t*)memchr(line, parser->eol, end - line) : NULL;
+            const utf8_char_t* next = eol ? eol + 1 : end;
+
+            if (!eol && !(final && line < end)) {
+                break;
             }
 
-            cue_id = data;
-            cue_id_length = line_length;
+            if (!vtt_line_blank(line, next - line)) {
+                line = next;
+            } else if (line == pos) {
+                pos = line = next; // Blank lines between blocks
+            } else {
+                block_end = line, line = next;
+            }
+        }
 
-            data += line_length;
-            size -= line_length;
-            continue;
+        if (!block_end && final && pos < end) {
+            block_end = end;
         }
 
-        data += line_length;
-        size -= line_length;
+        if (!block_end) {
+            parser->scan = line - pos;
+            break;
+        }
 
-        // Caption text starts here
-        const utf8_char_t* text = data;
-        size_t text_size = 0;
+        parser->scan = 0;
 
-        line_length = 0;
+        if (LIBCAPTION_OK != vtt_parser_block(parser, pos, block_end - pos)) {
+            parser->state = vtt_parser_error;
+            return LIBCAPTION_ERROR;
+        }
 
-        do {
-            text_size += line_length;
-            line_length = utf8_line_length(data);
-            trimmed_length = utf8_trimmed_length(data, line_length);
-            // printf ("cap (%d): '%.*s'\n", line_length, (int) trimmed_length, data);
-            data += line_length;
-            size -= line_length;
-        } while (trimmed_length);
+        pos = line;
+    }
 
-        // should we trim here?
+    (*used) = pos - data;
+    return LIBCAPTION_OK;
+}
 
-        vtt_block_t* block = vtt_block_new(vtt, text, text_size, block_type);
+static libcaption_stauts_t vtt_parser_keep(vtt_parser_t* parser, const utf8_char_t* data, size_t size)
+{
+    if (0 == size) {
+        return LIBCAPTION_OK;
+    }
 
-        if (block_type == VTT_CUE) {
-            block->timestamp = str_pts;
-            block->duration = end_pts - str_pts;
-            block->cue_settings = cue_settings;
-            if (cue_id != NULL) {
-                block->cue_id = malloc(cue_id_length + 1);
-                memcpy(block->cue_id, cue_id, cue_id_length);
-                block->cue_id[cue_id_length] = '\0';
-            }
+    if (parser->size + size > parser->capacity) {
+        size_t capacity = parser->capacity ? parser->capacity : VTT_PARSER_MIN_CAPACITY;
+
+        while (parser->size + size > capacity) {
+            capacity *= 2;
+        }
+
+        utf8_char_t* buffer = (utf8_char_t*)realloc(parser->data, capacity);
+
+        if (!buffer) {
+            return LIBCAPTION_ERROR;
         }
 
-        cue_id = NULL;
+        parser->data = buffer;
+        parser->capacity = capacity;
     }
 
+    memcpy(parser->data + parser->size, data, size);
+    parser->size += size;
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t vtt_parser_push(vtt_parser_t* parser, const utf8_char_t* data, size_t size)
+{
+    size_t used;
+
+    if (vtt_parser_error == parser->state) {
+        return LIBCAPTION_ERROR;
+    }
+
+    if (0 == size) {
+        return LIBCAPTION_OK;
+    }
+
+    // Nothing buffered, complete blocks are parsed straight from data
+    if (0 == parser->size) {
+        if (LIBCAPTION_OK != vtt_parser_process(parser, data, size, 0, &used)) {
+            return LIBCAPTION_ERROR;
+        }
+
+        return vtt_parser_keep(parser, data + used, size - used);
+    }
+
+    if (LIBCAPTION_OK != vtt_parser_keep(parser, data, size)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    if (LIBCAPTION_OK != vtt_parser_process(parser, parser->data, parser->size, 0, &used)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    memmove(parser->data, parser->data + used, parser->size - used);
+    parser->size -= used;
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t vtt_parser_finish(vtt_parser_t* parser)
+{
+    size_t used;
+    libcaption_stauts_t status = LIBCAPTION_ERROR;
+
+    if (vtt_parser_error != parser->state) {
+        status = LIBCAPTION_OK;
+
+        // An empty WebVTT document is missing its header
+        if (vtt_parser_start == parser->state && !parser->srt_mode) {
+            parser->state = vtt_parser_header;
+        }
+
+        if (parser->size) {
+            status = vtt_parser_process(parser, parser->data, parser->size, 1, &used);
+        }
+    }
+
+    if (vtt_parser_header == parser->state) {
+        fprintf(stderr, "Missing webvtt header\n");
+        status = LIBCAPTION_ERROR;
+    }
+
+    // Ready for the next document
+    parser->size = 0;
+    parser->scan = 0;
+    parser->eol = 0;
+    parser->state = vtt_parser_start;
+    return status;
+}
+
+// Blocks are either copies or, when parsing in place, already in the arena
+static void vtt_parser_append(void* opaque, vtt_block_t* block)
+{
+    vtt_block_link((vtt_t*)opaque, block);
+}
+
+vtt_t* vtt_parse(const utf8_char_t* data, size_t size)
+{
+    return _vtt_parse(data, size, 0);
+}
+
+vtt_t* _vtt_parse(const utf8_char_t* data, size_t size, int srt_mode)
+{
+    vtt_parser_t parser;
+    libcaption_stauts_t status;
+
+    if (!data || !size) {
+        return NULL;
+    }
+
+    vtt_t* vtt = vtt_new();
+    vtt_parser_init(&parser, srt_mode, vtt_parser_append, vtt);
+    status = vtt_parser_push(&parser, data, size);
+    status = libcaption_status_update(status, vtt_parser_finish(&parser));
+    vtt_parser_free(&parser);
+
+    if (LIBCAPTION_ERROR == status) {
+        vtt_free(vtt);
+        return NULL;
+    }
+
+    return vtt;
+}
+
+vtt_t* vtt_parse_in_place(utf8_char_t* data, size_t size, int srt_mode)
+{
+    size_t used;
+    vtt_parser_t parser;
+    libcaption_stauts_t status;
+
+    if (!data || !size) {
+        return NULL;
+    }
+
+    vtt_t* vtt = vtt_new();
+    if (NULL == (vtt->arena = (vtt_arena_t*)calloc(1, sizeof(vtt_arena_t)))) {
+        vtt_free(vtt);
+        return NULL;
+    }
+
+    vtt_parser_init(&parser, srt_mode, vtt_parser_append, vtt);
+    parser.in_place = vtt;
+
+    // Everything is parsed straight from data, the parser never buffers
+    status = vtt_parser_process(&parser, data, size, 1, &used);
+    status = libcaption_status_update(status, vtt_parser_finish(&parser));
+    vtt_parser_free(&parser);
+
+    if (LIBCAPTION_ERROR == status) {
+        vtt_free(vtt);
+        return NULL;
+    }
+
+    return vtt;
+}
+
+vtt_t* vtt_parse_file(const char* path)
+{
+    return _vtt_parse_file(path, 0);
+}
+
+vtt_t* _vtt_parse_file(const char* path, int srt_mode)
+{
+    size_t size;
+    utf8_char_t* data = utf8_map_text_file(path, &size);
+
+    if (!data) {
+        return NULL;
+    }
+
+    vtt_t* vtt = vtt_parse_in_place(data, size, srt_mode);
+
+    if (!vtt) {
+        utf8_unmap_text_file(data, size);
+        return NULL;
+    }
+
+    vtt->mapped = data;
+    vtt->mapped_size = size;
     return vtt;
 }
 
@@ -301,8 +840,8 @@ int vtt_cue_to_caption_frame(vtt_block_t* cue, caption_frame_t* frame)
 
 vtt_block_t* vtt_cue_from_caption_frame(caption_frame_t* frame, vtt_t* vtt)
 {
-    if (vtt->cue_tail && 0 >= vtt->cue_tail->duration) {
-        vtt->cue_tail->duration = frame->timestamp - vtt->cue_tail->timestamp;
+    if (vtt->cue_tail && 0 >= vtt->cue_tail->duration_ticks) {
+        vtt_cue_set_ticks(vtt->cue_tail, vtt->cue_tail->ticks, frame->ticks - vtt->cue_tail->ticks);
     }
 
     // CRLF per row, plus an extra at the end
@@ -310,49 +849,140 @@ vtt_block_t* vtt_cue_from_caption_frame(caption_frame_t* frame, vtt_t* vtt)
     utf8_char_t* data = vtt_block_data(cue);
 
     caption_frame_to_text(frame, data);
-    cue->timestamp = frame->timestamp;
+    vtt_cue_set_ticks(cue, frame->ticks, 0);
     // vtt requires an extra new line
     strcat((char*)data, "\r\n");
     return cue;
 }
 
-static void _dump(vtt_t* vtt)
+// Block text normally keeps the new line of its last line
+int _vtt_write_text(utf8_writer_t* writer, const utf8_char_t* text)
 {
-    vtt_block_t* block;
-    printf("WEBVTT\r\n\r\n");
-
-    block = vtt->region_head;
-    while (block != NULL) {
-        printf("REGION\r\n%s\r\n", vtt_block_data(block));
-        block = block->next;
-    }
+    size_t size = strlen(text);
+    utf8_writer_write(writer, text, size);
 
-    block = vtt->style_head;
-    while (block != NULL) {
-        printf("STYLE\r\n%s\r\n", vtt_block_data(block));
-        block = block->next;
+    if (0 < size && '\n' != text[size - 1]) {
+        utf8_writer_write(writer, "\r\n", 2);
     }
 
-    block = vtt->cue_head;
-    while (block != NULL) {
-        int hh1, hh2, mm1, mm2, ss1, ss2, ms1, ms2;
-        vtt_crack_time(block->timestamp, &hh1, &mm1, &ss1, &ms1);
-        vtt_crack_time(block->timestamp + block->duration, &hh2, &mm2, &ss2, &ms2);
+    return utf8_writer_write(writer, "\r\n", 2);
+}
 
+int vtt_write_block(utf8_writer_t* writer, vtt_block_t* block)
+{
+    switch (block->type) {
+    case VTT_REGION:
+        utf8_writer_write(writer, "REGION\r\n", 8);
+        break;
+    case VTT_STYLE:
+        utf8_writer_write(writer, "STYLE\r\n", 7);
+        break;
+    case VTT_NOTE:
+        utf8_writer_write(writer, "NOTE\r\n", 6);
+        break;
+    case VTT_CUE: {
         if (block->cue_id != NULL) {
-            printf("%s\n", block->cue_id);
+            utf8_writer_string(writer, block->cue_id);
+            utf8_writer_write(writer, "\r\n", 2);
         }
 
-        printf("%02d:%02d:%02d.%03d --> %02d:%02d:%02d.%03d",
-            hh1, mm1, ss1, ms1, hh2, mm2, ss2, ms2);
+        utf8_writer_ms(writer, caption_ticks_to_ms(block->ticks), '.');
+        utf8_writer_write(writer, " --> ", 5);
+        utf8_writer_ms(writer, caption_ticks_to_ms(block->ticks + (0 < block->duration_ticks ? block->duration_ticks : 0)), '.');
 
         if (block->cue_settings != NULL) {
-            printf(" %s", block->cue_settings);
+            const char* settings = block->cue_settings;
+
+            while (' ' == (*settings) || '\t' == (*settings)) {
+                ++settings;
+            }
+
+            utf8_writer_write(writer, " ", 1);
+            utf8_writer_string(writer, settings);
         }
 
-        printf("\r\n%s\r\n", vtt_block_data(block));
-        block = block->next;
+        utf8_writer_write(writer, "\r\n", 2);
+    } break;
+    }
+
+    return _vtt_write_text(writer, vtt_block_data(block));
+}
+
+int vtt_write_header(utf8_writer_t* writer, vtt_t* vtt)
+{
+    vtt_block_t* block;
+    utf8_writer_write(writer, "WEBVTT\r\n\r\n", 10);
+
+    for (block = vtt->region_head; block; block = block->next) {
+        vtt_write_block(writer, block);
+    }
+
+    for (block = vtt->style_head; block; block = block->next) {
+        vtt_write_block(writer, block);
+    }
+
+    return !writer->error;
+}
+
+int vtt_write(utf8_writer_t* writer, vtt_t* vtt)
+{
+    vtt_block_t* block;
+    vtt_write_header(writer, vtt);
+
+    for (block = vtt->cue_head; block; block = block->next) {
+        vtt_write_block(writer, block);
     }
+
+    return !writer->error;
+}
+
+void vtt_dump(vtt_t* vtt)
+{
+    utf8_writer_t writer;
+    fflush(stdout);
+    utf8_writer_init_fd(&writer, 1);
+    vtt_write(&writer, vtt);
+    utf8_writer_free(&writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int vtt_sink_init(vtt_sink_t* sink, utf8_writer_t* writer, int srt_mode)
+{
+    memset(sink, 0, sizeof(vtt_sink_t));
+    sink->srt_mode = srt_mode;
+    sink->writer = writer;
+    sink->cue.type = VTT_CUE;
+    sink->cue.block_text = sink->text;
+    return srt_mode ? !writer->error : utf8_writer_write(writer, "WEBVTT\r\n\r\n", 10);
+}
+
+static int vtt_sink_write(vtt_sink_t* sink)
+{
+    sink->pending = 0;
+    ++sink->index;
+    return sink->srt_mode ? srt_write_cue(sink->writer, &sink->cue, sink->index) : vtt_write_block(sink->writer, &sink->cue);
+}
+
+int vtt_sink_frame(vtt_sink_t* sink, caption_frame_t* frame)
+{
+    int ret = 1;
+
+    if (sink->pending) {
+        vtt_cue_set_ticks(&sink->cue, sink->cue.ticks, frame->ticks - sink->cue.ticks);
+        ret = vtt_sink_write(sink);
+    }
+
+    vtt_cue_set_ticks(&sink->cue, frame->ticks, 0);
+    sink->cue.text_size = caption_frame_to_text(frame, sink->text);
+    // vtt requires an extra new line
+    memcpy(&sink->text[sink->cue.text_size], "\r\n", 3);
+    sink->cue.text_size += 2;
+    sink->pending = 1;
+    return ret;
+}
+
+int vtt_sink_finish(vtt_sink_t* sink)
+{
+    return sink->pending ? vtt_sink_write(sink) : !sink->writer->error;
 }
 
-void vtt_dump(vtt_t* head) { _dump(head); }
@@ -0,0 +1,295 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "vtt_index.h"
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Small subtrees are scanned linearly rather than walked
+#define VTT_INDEX_SCAN_LEVEL 3
+// Enough for any array that fits in memory
+#define VTT_INDEX_STACK_SIZE 128
+
+static double vtt_index_max(double a, double b) { return a > b ? a : b; }
+
+// Stable bottom up merge sort on start time, skipped when already sorted
+static libcaption_stauts_t vtt_index_sort(vtt_index_entry_t* entry, size_t size)
+{
+    size_t i, width;
+
+    for (i = 1; i < size && entry[i - 1].start <= entry[i].start; ++i) {
+    }
+
+    if (i >= size) {
+        return LIBCAPTION_OK;
+    }
+
+    vtt_index_entry_t* temp = (vtt_index_entry_t*)malloc(size * sizeof(vtt_index_entry_t));
+    vtt_index_entry_t *src = entry, *dst = temp;
+
+    if (!temp) {
+        return LIBCAPTION_ERROR;
+    }
+
+    for (width = 1; width < size; width *= 2) {
+        for (i = 0; i < size; i += 2 * width) {
+            size_t l = i, m = i + width < size ? i + width : size, h = i + 2 * width < size ? i + 2 * width : size;
+            size_t r = m, o = i;
+
+            while (l < m && r < h) {
+                dst[o++] = src[r].start < src[l].start ? src[r++] : src[l++];
+            }
+
+            memcpy(&dst[o], &src[l], (m - l) * sizeof(vtt_index_entry_t)), o += m - l;
+            memcpy(&dst[o], &src[r], (h - r) * sizeof(vtt_index_entry_t));
+        }
+
+        vtt_index_entry_t* swap = src;
+        src = dst, dst = swap;
+    }
+
+    if (src != entry) {
+        memcpy(entry, src, size * sizeof(vtt_index_entry_t));
+    }
+
+    free(temp);
+    return LIBCAPTION_OK;
+}
+
+// Fills max_end for every node, level by level. Nodes past the end of the array
+// are treated as if they held the largest end time of the last subtree
+static void vtt_index_build(vtt_index_t* index)
+{
+    size_t i, k, last_i = 0;
+    double last = 0;
+    vtt_index_entry_t* entry = index->entry;
+
+    for (i = 0; i < index->size; i += 2) {
+        last_i = i;
+        last = entry[i].max_end = entry[i].end;
+    }
+
+    for (k = 1; ((size_t)1 << k) <= index->size; ++k) {
+        size_t x = (size_t)1 << (k - 1);
+
+        for (i = (x << 1) - 1; i < index->size; i += x << 2) {
+            double left = entry[i - x].max_end;
+            double right = i + x < index->size ? entry[i + x].max_end : last;
+            entry[i].max_end = vtt_index_max(entry[i].end, vtt_index_max(left, right));
+        }
+
+        last_i = ((last_i >> k) & 1) ? last_i - x : last_i + x;
+
+        if (last_i < index->size) {
+            last = vtt_index_max(last, entry[last_i].max_end);
+        }
+    }
+}
+
+libcaption_stauts_t vtt_index_init(vtt_index_t* index, vtt_t* vtt)
+{
+    size_t size = 0;
+    vtt_block_t* cue;
+
+    memset(index, 0, sizeof(vtt_index_t));
+
+    for (cue = vtt->cue_head; cue; cue = cue->next) {
+        ++size;
+    }
+
+    if (0 == size) {
+        return LIBCAPTION_OK;
+    }
+
+    if (NULL == (index->entry = (vtt_index_entry_t*)malloc(size * sizeof(vtt_index_entry_t)))) {
+        return LIBCAPTION_ERROR;
+    }
+
+    index->capacity = size;
+
+    for (cue = vtt->cue_head; cue; cue = cue->next, ++index->size) {
+        vtt_index_entry_t* entry = &index->entry[index->size];
+        entry->start = cue->timestamp;
+        entry->end = cue->timestamp + cue->duration;
+        entry->cue = cue;
+    }
+
+    if (LIBCAPTION_OK != vtt_index_sort(index->entry, index->size)) {
+        vtt_index_free(index);
+        return LIBCAPTION_ERROR;
+    }
+
+    vtt_index_build(index);
+    return LIBCAPTION_OK;
+}
+
+void vtt_index_free(vtt_index_t* index)
+{
+    free(index->entry);
+    memset(index, 0, sizeof(vtt_index_t));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Entries that overlap [start, end). If point is set, entries containing start
+static size_t vtt_index_query(const vtt_index_t* index, double start, double end, int point, vtt_block_t** cues, size_t size)
+{
+    struct {
+        size_t x;
+        int k, w;
+    } stack[VTT_INDEX_STACK_SIZE];
+    int k, t = 0;
+    size_t count = 0;
+    const vtt_index_entry_t* entry = index->entry;
+
+#define VTT_INDEX_BEFORE_END(i) (point ? entry[i].start <= end : entry[i].start < end)
+#define VTT_INDEX_FOUND(i)                         \
+    do {                                           \
+        if (start < entry[i].end) {                \
+            if (count < size && cues) {            \
+                cues[count] = entry[i].cue;        \
+            }                                      \
+            ++count;                               \
+        }                                          \
+    } while (0)
+
+    if (0 == index->size) {
+        return 0;
+    }
+
+    for (k = 0; ((size_t)1 << (k + 1)) <= index->size; ++k) {
+    }
+
+    stack[t].x = ((size_t)1 << k) - 1, stack[t].k = k, stack[t++].w = 0;
+
+    while (t) {
+        size_t x = stack[--t].x, i;
+        int w = stack[t].w;
+        k = stack[t].k;
+
+        if (VTT_INDEX_SCAN_LEVEL >= k) {
+            size_t i1 = ((x >> k) << k) + ((size_t)1 << (k + 1)) - 1;
+
+            for (i = (x >> k) << k; i < i1 && i < index->size && VTT_INDEX_BEFORE_END(i); ++i) {
+                VTT_INDEX_FOUND(i);
+            }
+        } else if (0 == w) {
+            // Visit the left subtree first, then come back to this node
+            size_t y = x - ((size_t)1 << (k - 1));
+            stack[t].x = x, stack[t].k = k, stack[t++].w = 1;
+
+            if (y >= index->size || entry[y].max_end > start) {
+                stack[t].x = y, stack[t].k = k - 1, stack[t++].w = 0;
+            }
+        } else if (x < index->size && VTT_INDEX_BEFORE_END(x)) {
+            VTT_INDEX_FOUND(x);
+            stack[t].x = x + ((size_t)1 << (k - 1)), stack[t].k = k - 1, stack[t++].w = 0;
+        }
+    }
+
+#undef VTT_INDEX_BEFORE_END
+#undef VTT_INDEX_FOUND
+    return count;
+}
+
+size_t vtt_index_active(const vtt_index_t* index, double timestamp, vtt_block_t** cues, size_t size)
+{
+    return vtt_index_query(index, timestamp, timestamp, 1, cues, size);
+}
+
+size_t vtt_index_range(const vtt_index_t* index, double start, double end, vtt_block_t** cues, size_t size)
+{
+    return start < end ? vtt_index_query(index, start, end, 0, cues, size) : 0;
+}
+
+size_t vtt_index_seek(const vtt_index_t* index, double timestamp)
+{
+    size_t lo = 0, hi = index->size;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (index->entry[mid].start < timestamp) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+// prototype for function in vtt.c
+libcaption_stauts_t _vtt_block_adopt(vtt_t* vtt, vtt_block_t* block);
+libcaption_stauts_t vtt_index_insert(vtt_index_t* index, vtt_t* vtt, vtt_block_t* cue)
+{
+    size_t lo = 0, hi = index->size;
+
+    if (index->size == index->capacity) {
+        size_t capacity = index->capacity ? 2 * index->capacity : 16;
+        vtt_index_entry_t* entry = (vtt_index_entry_t*)realloc(index->entry, capacity * sizeof(vtt_index_entry_t));
+
+        if (!entry) {
+            return LIBCAPTION_ERROR;
+        }
+
+        index->entry = entry;
+        index->capacity = capacity;
+    }
+
+    if (LIBCAPTION_OK != _vtt_block_adopt(vtt, cue)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    // After every cue that starts at the same time
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (index->entry[mid].start <= cue->timestamp) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (0 == lo) {
+        cue->next = vtt->cue_head;
+        vtt->cue_head = cue;
+    } else {
+        vtt_block_t* prev = index->entry[lo - 1].cue;
+        cue->next = prev->next;
+        prev->next = cue;
+    }
+
+    if (NULL == cue->next) {
+        vtt->cue_tail = cue;
+    }
+
+    memmove(&index->entry[lo + 1], &index->entry[lo], (index->size - lo) * sizeof(vtt_index_entry_t));
+    index->entry[lo].start = cue->timestamp;
+    index->entry[lo].end = cue->timestamp + cue->duration;
+    index->entry[lo].cue = cue;
+    index->size += 1;
+    vtt_index_build(index);
+    return LIBCAPTION_OK;
+}
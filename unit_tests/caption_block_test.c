@@ -0,0 +1,102 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "caption.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_BLOCK_SIZE 64
+
+// Padding runs long enough to fill whole groups of 8, single padding words, bad
+// parity and valid words of every class, with repeats for duplicate detection
+static size_t random_block(uint16_t* cc_data)
+{
+    size_t size = rand() % (MAX_BLOCK_SIZE + 1);
+
+    for (size_t i = 0; i < size;) {
+        int kind = rand() % 10;
+
+        if (0 == kind) {
+            for (size_t run = 8 + rand() % 17; run && i < size; --run) {
+                cc_data[i++] = 0x8080;
+            }
+        } else if (3 > kind) {
+            cc_data[i++] = 0x8080;
+        } else if (4 > kind) {
+            cc_data[i++] = eia608_parity(rand() & 0x7F7F) ^ (rand() % 2 ? 0x0080 : 0x8000);
+        } else if (5 > kind && i) {
+            cc_data[i] = cc_data[i - 1], ++i;
+        } else if (7 > kind) {
+            cc_data[i++] = eia608_control_command((eia608_control_t)(0x1420 + rand() % 16), rand() % 4);
+        } else {
+            cc_data[i++] = eia608_parity(rand() & 0x7F7F);
+        }
+    }
+
+    return size;
+}
+
+static int frame_equal(const caption_frame_t* a, const caption_frame_t* b)
+{
+    uint8_t snap_a[CAPTION_FRAME_SNAPSHOT_SIZE], snap_b[CAPTION_FRAME_SNAPSHOT_SIZE];
+    caption_frame_snapshot(a, snap_a, sizeof(snap_a));
+    caption_frame_snapshot(b, snap_b, sizeof(snap_b));
+    return 0 == memcmp(snap_a, snap_b, sizeof(snap_a)) && a->timestamp == b->timestamp;
+}
+
+// caption_frame_decode_block must behave exactly like decoding one word at a time
+int main(int argc, char** argv)
+{
+    int errors = 0;
+    uint16_t cc_data[MAX_BLOCK_SIZE];
+    caption_frame_t block, word;
+
+    srand(708);
+
+    for (int run = 0; run < 100; ++run) {
+        int frames = 0;
+        caption_frame_init(&block);
+        caption_frame_init(&word);
+
+        for (int i = 0; i < 200; ++i) {
+            // some blocks share a frame with the previous one
+            size_t size = random_block(cc_data);
+            double timestamp = (frames += rand() % 2) * 1001 / 30000.0;
+            libcaption_stauts_t want = LIBCAPTION_OK;
+            libcaption_stauts_t have = caption_frame_decode_block(&block, cc_data, size, timestamp);
+
+            for (size_t j = 0; j < size; ++j) {
+                want = libcaption_status_update(want, caption_frame_decode(&word, cc_data[j], timestamp));
+            }
+
+            if (want != have || !frame_equal(&block, &word)) {
+                fprintf(stderr, "run %d block %d of %zu words: status %d, expected %d%s\n", run, i, size, have, want, frame_equal(&block, &word) ? "" : ", frames differ");
+                ++errors;
+                break;
+            }
+        }
+    }
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,226 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "caption.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_WORDS 256
+
+typedef struct {
+    size_t size;
+    uint16_t cc_data[MAX_WORDS];
+} stream_t;
+
+static void put(stream_t* s, uint16_t cc_data) { s->cc_data[s->size++] = cc_data; }
+
+// Control codes are sent twice, as encoders do
+static void put_control(stream_t* s, eia608_control_t cmd)
+{
+    put(s, eia608_control_command(cmd, 0));
+    put(s, eia608_control_command(cmd, 0));
+}
+
+static void put_text(stream_t* s, const char* text)
+{
+    for (; text[0] && text[1]; text += 2) {
+        char c1[2] = { text[0], 0 }, c2[2] = { text[1], 0 };
+        put(s, eia608_from_utf8_2(c1, c2));
+    }
+
+    if (text[0]) {
+        char c1[2] = { text[0], 0 };
+        put(s, eia608_from_utf8_1(c1, 0));
+    }
+}
+
+// Program name, the checksum is not verified by the decoder
+static void put_xds(stream_t* s, const char* name)
+{
+    put(s, eia608_parity(0x0103));
+
+    for (; name[0] && name[1]; name += 2) {
+        put(s, eia608_parity((uint16_t)((name[0] << 8) | name[1])));
+    }
+
+    put(s, eia608_parity(0x0F00));
+}
+
+// A roll-up caption, then a pop-on caption loaded while an XDS packet arrives
+static void make_stream(stream_t* s)
+{
+    s->size = 0;
+    put_control(s, eia608_control_roll_up_3);
+    put(s, eia608_row_column_pramble(14, 0, 0, 0));
+    put_text(s, "First line");
+    put_control(s, eia608_control_carriage_return);
+    put_text(s, "Second line");
+    put_control(s, eia608_control_carriage_return);
+    put(s, eia608_row_column_pramble(14, 4, 0, 1));
+    put_text(s, "Third");
+    put_control(s, eia608_control_resume_caption_loading);
+    put_control(s, eia608_control_erase_non_displayed_memory);
+    put(s, eia608_row_column_pramble(10, 0, 0, 0));
+    put_text(s, "Loading a pop-on");
+    put_xds(s, "Test program");
+    put(s, eia608_row_column_pramble(11, 8, 0, 0));
+    put_text(s, "caption");
+    put_control(s, eia608_control_end_of_caption);
+    put_control(s, eia608_control_erase_non_displayed_memory);
+    put(s, eia608_row_column_pramble(12, 0, 0, 0));
+    put_text(s, "Next");
+    put_control(s, eia608_control_end_of_caption);
+}
+
+static caption_ticks_t word_ticks(size_t i) { return (caption_ticks_t)(i / 2) * 3003; }
+
+static int snapshot_equal(const caption_frame_t* a, const caption_frame_t* b)
+{
+    uint8_t snap_a[CAPTION_FRAME_SNAPSHOT_SIZE], snap_b[CAPTION_FRAME_SNAPSHOT_SIZE];
+    caption_frame_snapshot(a, snap_a, sizeof(snap_a));
+    caption_frame_snapshot(b, snap_b, sizeof(snap_b));
+    return 0 == memcmp(snap_a, snap_b, sizeof(snap_a)) && a->timestamp == b->timestamp;
+}
+
+// Snapshots the decoder after every word, restores it into another frame, and
+// checks both decode the rest of the stream identically
+static int test_round_trip()
+{
+    int errors = 0;
+    stream_t s;
+    make_stream(&s);
+
+    for (size_t cut = 0; cut <= s.size; ++cut) {
+        caption_frame_t frame, restored;
+        uint8_t snap[CAPTION_FRAME_SNAPSHOT_SIZE];
+        caption_frame_init(&frame);
+
+        for (size_t i = 0; i < cut; ++i) {
+            caption_frame_decode_ticks(&frame, s.cc_data[i], word_ticks(i));
+        }
+
+        if (CAPTION_FRAME_SNAPSHOT_SIZE != caption_frame_snapshot(&frame, snap, sizeof(snap))) {
+            fprintf(stderr, "cut %zu: snapshot failed\n", cut);
+            return errors + 1;
+        }
+
+        memset(&restored, 0xA5, sizeof(restored));
+
+        if (LIBCAPTION_OK != caption_frame_restore(&restored, snap, sizeof(snap))) {
+            fprintf(stderr, "cut %zu: restore failed\n", cut);
+            ++errors;
+            continue;
+        }
+
+        if (!snapshot_equal(&frame, &restored)) {
+            fprintf(stderr, "cut %zu: restored frame differs\n", cut);
+            ++errors;
+            continue;
+        }
+
+        for (size_t i = cut; i < s.size; ++i) {
+            libcaption_stauts_t want = caption_frame_decode_ticks(&frame, s.cc_data[i], word_ticks(i));
+            libcaption_stauts_t have = caption_frame_decode_ticks(&restored, s.cc_data[i], word_ticks(i));
+
+            if (want != have || !snapshot_equal(&frame, &restored)) {
+                fprintf(stderr, "cut %zu: word %zu %04X decodes differently after restore, status %d, expected %d\n", cut, i, s.cc_data[i], have, want);
+                ++errors;
+                break;
+            }
+        }
+    }
+
+    return errors;
+}
+
+typedef struct {
+    const char* name;
+    size_t offset;
+    uint8_t value;
+} corrupt_case_t;
+
+// Offsets are those of the snapshot layout
+static const corrupt_case_t corrupt_cases[] = {
+    { "bad magic", 0, 'x' },
+    { "bad version", 3, 1 },
+    { "status out of range", 12, LIBCAPTION_READY + 1 },
+    { "write buffer out of range", 13, caption_frame_write_back + 1 },
+    { "negative row", 15, 0xFF },
+    { "row past the screen", 15, SCREEN_ROWS },
+    { "negative column", 16, 0xFF },
+    { "column past the screen", 16, SCREEN_COLS + 1 },
+    { "odd xds size", 25, 3 },
+    { "xds size over 32", 25, 34 },
+    { "xds size over 32 in the high byte", 28, 1 },
+};
+
+// Rejected blobs must leave the frame untouched
+static int test_reject()
+{
+    int errors = 0;
+    stream_t s;
+    caption_frame_t frame, before;
+    uint8_t snap[CAPTION_FRAME_SNAPSHOT_SIZE], blob[CAPTION_FRAME_SNAPSHOT_SIZE];
+
+    make_stream(&s);
+    caption_frame_init(&frame);
+
+    for (size_t i = 0; i < s.size / 2; ++i) {
+        caption_frame_decode_ticks(&frame, s.cc_data[i], word_ticks(i));
+    }
+
+    caption_frame_snapshot(&frame, snap, sizeof(snap));
+    memcpy(&before, &frame, sizeof(caption_frame_t));
+
+    if (LIBCAPTION_ERROR != caption_frame_restore(&frame, snap, sizeof(snap) - 1) || !snapshot_equal(&frame, &before)) {
+        fprintf(stderr, "short blob was not rejected\n");
+        ++errors;
+    }
+
+    for (size_t i = 0; i < sizeof(corrupt_cases) / sizeof(corrupt_cases[0]); ++i) {
+        memcpy(blob, snap, sizeof(blob));
+        blob[corrupt_cases[i].offset] = corrupt_cases[i].value;
+
+        if (LIBCAPTION_ERROR != caption_frame_restore(&frame, blob, sizeof(blob)) || !snapshot_equal(&frame, &before)) {
+            fprintf(stderr, "%s was not rejected\n", corrupt_cases[i].name);
+            ++errors;
+        }
+    }
+
+    // The largest valid values must still be accepted
+    memcpy(blob, snap, sizeof(blob));
+    blob[15] = SCREEN_ROWS - 1, blob[16] = SCREEN_COLS, blob[25] = 32;
+
+    if (LIBCAPTION_OK != caption_frame_restore(&frame, blob, sizeof(blob))) {
+        fprintf(stderr, "valid blob was rejected\n");
+        ++errors;
+    }
+
+    return errors;
+}
+
+int main(int argc, char** argv)
+{
+    int errors = test_round_trip() + test_reject();
+    return errors ? 1 : 0;
+}
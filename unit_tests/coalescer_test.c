@@ -0,0 +1,185 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "coalescer.h"
+#include "eia608_encoder.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char* text = "Alice was beginning to get very tired of sitting by her sister on the bank, and of having nothing to do: "
+                          "once or twice she had peeped into the book her sister was reading, but it had no pictures or conversations in it, "
+                          "and what is the use of a book, thought Alice without pictures or conversations? So she was considering in her own "
+                          "mind (as well as she could, for the hot day made her feel very sleepy and stupid), whether the pleasure of making "
+                          "a daisy-chain would be worth the trouble of getting up and picking the daisies, when suddenly a White Rabbit with "
+                          "pink eyes ran close by her.";
+
+#define SECONDS_PER_WORD 0.3
+#define MAX_WORDS 4096
+
+static int cell_equal(const caption_frame_cell_t* a, const caption_frame_cell_t* b)
+{
+    return 0 == strcmp(&a->data[0], &b->data[0]) && (0 == a->data[0] || (a->sty == b->sty && a->uln == b->uln));
+}
+
+// Compares the display, leaving out the base row of a roll-up caption
+static int screen_equal(const caption_frame_t* a, const caption_frame_t* b, int skip_row)
+{
+    for (int r = 0; r < SCREEN_ROWS; ++r) {
+        for (int c = 0; r != skip_row && c < SCREEN_COLS; ++c) {
+            if (!cell_equal(&a->front.cell[r][c], &b->front.cell[r][c])) {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+static int errors = 0;
+
+// Checks a new event against the previous one
+static void check_event(const char* mode, caption_coalescer_t* coalescer, caption_frame_t* last, int* events)
+{
+    caption_frame_t* event = caption_coalescer_event(coalescer);
+    caption_ticks_t min_duration = caption_ticks_from_seconds(CAPTION_COALESCER_MIN_DURATION);
+
+    if (*events && screen_equal(event, last, -1)) {
+        fprintf(stderr, "%s: event %d at %f repeats the previous one\n", mode, *events, event->timestamp);
+        ++errors;
+    }
+
+    if (*events && event->ticks < last->ticks + min_duration) {
+        fprintf(stderr, "%s: event %d at %f starts %f after the previous one\n", mode, *events, event->timestamp, event->timestamp - last->timestamp);
+        ++errors;
+    }
+
+    memcpy(last, event, sizeof(caption_frame_t));
+    ++(*events);
+}
+
+// Live text typed one word every SECONDS_PER_WORD and sent one cc_data word per
+// frame. Every charcter makes the decoder READY, the coalescer must turn those into
+// about one event per second for paint-on and one per completed line for roll-up
+static void test_live_text(eia608_encoder_mode_t mode, const char* name)
+{
+    static uint16_t cc_data[MAX_WORDS];
+    size_t size = 0, sent = 0;
+    const char* data = text;
+    caption_ticks_t next_word = 0, ticks = 0;
+    int ready = 0, events = 0, changes = 0, rollup = eia608_encoder_rollup_2 <= mode;
+    eia608_encoder_t enc;
+    caption_frame_t frame, last, shown;
+    caption_coalescer_t coalescer;
+
+    eia608_encoder_init(&enc, mode, 0);
+    caption_frame_init(&frame);
+    caption_frame_init(&shown);
+    caption_coalescer_init(&coalescer, NULL);
+
+    for (int f = 0; (*data) || sent < size; ++f) {
+        ticks = caption_ticks_from_rational(f, 1001, 30000);
+
+        if ((*data) && ticks >= next_word) {
+            char word[64];
+            size_t length = strcspn(data, " ");
+            length += data[length] ? 1 : 0;
+            memcpy(word, data, length), word[length] = 0;
+            data += length;
+            size += eia608_encoder_append_text(&enc, word, &cc_data[size], MAX_WORDS - size, 0);
+            next_word += caption_ticks_from_seconds(SECONDS_PER_WORD);
+        }
+
+        if (sent < size && LIBCAPTION_READY == caption_frame_decode_ticks(&frame, cc_data[sent++], ticks)) {
+            int base = rollup && 0 <= frame.state.row ? frame.state.row : -1;
+            ++ready;
+
+            // Brute force count of displayed changes, roll-up lines are shown once scrolled up
+            if (!screen_equal(&frame, &shown, base)) {
+                memcpy(&shown, &frame, sizeof(caption_frame_t));
+                memset(&shown.front.cell[0 <= base ? base : 0], 0, 0 <= base ? sizeof(shown.front.cell[0]) : 0);
+                ++changes;
+            }
+
+            if (LIBCAPTION_READY == caption_coalescer_push(&coalescer, &frame)) {
+                check_event(name, &coalescer, &last, &events);
+            }
+        }
+    }
+
+    if (LIBCAPTION_READY == caption_coalescer_flush(&coalescer)) {
+        check_event(name, &coalescer, &last, &events);
+    }
+
+    double seconds = caption_ticks_to_seconds(ticks);
+
+    if (!screen_equal(&last, &shown, -1)) {
+        fprintf(stderr, "%s: the last event is not the final display\n", name);
+        ++errors;
+    }
+
+    if (rollup ? events != changes : (events > seconds / CAPTION_COALESCER_MIN_DURATION + 1 || events < seconds / (2 * CAPTION_COALESCER_MIN_DURATION))) {
+        fprintf(stderr, "%s: %d READY frames, %d changes in %f seconds became %d events\n", name, ready, changes, seconds, events);
+        ++errors;
+    }
+}
+
+// Cells keep bytes after the null terminator from earlier charcters, and blank
+// cells may keep a style. Neither is displayed, so neither starts an event
+static void test_hidden_bytes()
+{
+    caption_frame_t stale, fresh;
+    caption_coalescer_t coalescer;
+
+    caption_frame_init(&stale);
+    caption_frame_init(&fresh);
+    caption_coalescer_init(&coalescer, NULL);
+    stale.write = fresh.write = caption_frame_write_front;
+
+    caption_frame_write_char(&stale, 0, 0, eia608_style_white, 0, EIA608_CHAR_LATIN_SMALL_LETTER_E_WITH_ACUTE);
+    caption_frame_write_char(&stale, 0, 0, eia608_style_white, 0, "a");
+    stale.front.cell[0][1].sty = eia608_style_red;
+    caption_frame_write_char(&fresh, 0, 0, eia608_style_white, 0, "a");
+
+    stale.ticks = 0;
+    caption_coalescer_push(&coalescer, &stale);
+
+    if (LIBCAPTION_READY != caption_coalescer_flush(&coalescer)) {
+        fprintf(stderr, "hidden bytes: no event\n");
+        ++errors;
+    }
+
+    fresh.ticks = 10 * CAPTION_TICKS_PER_SECOND;
+
+    if (LIBCAPTION_OK != caption_coalescer_push(&coalescer, &fresh) || LIBCAPTION_OK != caption_coalescer_flush(&coalescer)) {
+        fprintf(stderr, "hidden bytes: an unchanged display started an event\n");
+        ++errors;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    test_hidden_bytes();
+    test_live_text(eia608_encoder_painton, "paint-on");
+    test_live_text(eia608_encoder_rollup_3, "roll-up");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,415 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "dtvcc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Minimal 708 decoder. Packets are rebuilt from the triples, every service block
+// must carry whole commands, and the commands are applied to eight windows
+typedef struct {
+    int defined, visible;
+    uint8_t text[SCREEN_ROWS][SCREEN_COLS][2];
+    int italics[SCREEN_ROWS][SCREEN_COLS];
+    int uln[SCREEN_ROWS][SCREEN_COLS];
+} window_t;
+
+typedef struct {
+    int service;
+    unsigned int sequence; //< expected sequence number of the next packet
+    int packets;
+    int current, row, col, italics, uln;
+    window_t window[8];
+} decoder_t;
+
+static int errors = 0;
+
+static size_t command_size(const uint8_t* data)
+{
+    switch (data[0]) {
+    case dtvcc_c0_ext1:
+        return 2;
+    case dtvcc_c1_clw:
+    case dtvcc_c1_dsw:
+    case dtvcc_c1_hdw:
+    case dtvcc_c1_tgw:
+    case dtvcc_c1_dlw:
+        return 2;
+    case dtvcc_c1_spa:
+    case dtvcc_c1_spl:
+        return 3;
+    case dtvcc_c1_spc:
+        return 4;
+    }
+
+    if (dtvcc_c1_df0 <= data[0] && 0xA0 > data[0]) {
+        return 7;
+    }
+
+    if (dtvcc_c1_cw0 <= data[0] && dtvcc_c1_clw > data[0]) {
+        return 1;
+    }
+
+    return (0x20 <= data[0] && 0x80 > data[0]) || 0xA0 <= data[0] ? 1 : 0;
+}
+
+static void put_char(decoder_t* dec, const uint8_t* data, size_t size)
+{
+    window_t* window = &dec->window[dec->current];
+
+    if (!window->defined || SCREEN_ROWS <= dec->row || SCREEN_COLS <= dec->col) {
+        fprintf(stderr, "charcter 0x%02X outside of a window at %d, %d\n", data[size - 1], dec->row, dec->col);
+        ++errors;
+        return;
+    }
+
+    memset(&window->text[dec->row][dec->col], 0, 2);
+    memcpy(&window->text[dec->row][dec->col], data, size);
+    window->italics[dec->row][dec->col] = dec->italics;
+    window->uln[dec->row][dec->col] = dec->uln;
+    ++dec->col;
+}
+
+static void decode_command(decoder_t* dec, const uint8_t* data)
+{
+    int w;
+
+    switch (data[0]) {
+    case dtvcc_c0_ext1:
+        put_char(dec, data, 2);
+        return;
+    case dtvcc_c1_dsw:
+    case dtvcc_c1_hdw:
+    case dtvcc_c1_dlw:
+        for (w = 0; w < 8; ++w) {
+            if (data[1] & (1 << w)) {
+                dec->window[w].visible = dtvcc_c1_dsw == data[0];
+                dec->window[w].defined = dtvcc_c1_dlw != data[0] && dec->window[w].defined;
+            }
+        }
+        return;
+    case dtvcc_c1_spa:
+        dec->italics = !!(data[2] & 0x80), dec->uln = !!(data[2] & 0x40);
+        return;
+    case dtvcc_c1_spl:
+        dec->row = data[1], dec->col = data[2];
+        return;
+    case dtvcc_c1_spc:
+    case dtvcc_c1_clw:
+    case dtvcc_c1_tgw:
+        return;
+    }
+
+    if (dtvcc_c1_df0 <= data[0] && 0xA0 > data[0]) {
+        w = data[0] - dtvcc_c1_df0;
+
+        if (!dec->window[w].defined) {
+            memset(&dec->window[w], 0, sizeof(window_t));
+        }
+
+        if (SCREEN_ROWS - 1 != data[4] || SCREEN_COLS - 1 != data[5]) {
+            fprintf(stderr, "window %d is %d x %d\n", w, data[4] + 1, data[5] + 1);
+            ++errors;
+        }
+
+        dec->window[w].defined = 1;
+        dec->window[w].visible = !!(data[1] & 0x20);
+        dec->current = w, dec->row = 0, dec->col = 0;
+    } else if (dtvcc_c1_cw0 <= data[0] && dtvcc_c1_clw > data[0]) {
+        dec->current = data[0] - dtvcc_c1_cw0;
+    } else {
+        put_char(dec, data, 1);
+    }
+}
+
+static void decode_packet(decoder_t* dec, const uint8_t* packet, size_t size)
+{
+    size_t i, j, block_size;
+    size_t packet_size = (packet[0] & 0x3F) ? 2 * (packet[0] & 0x3F) : DTVCC_PACKET_MAX_SIZE;
+
+    if (packet_size != size) {
+        fprintf(stderr, "packet %d is %d bytes, the header says %d\n", dec->packets, (int)size, (int)packet_size);
+        ++errors;
+    }
+
+    if (dec->sequence != (unsigned int)(packet[0] >> 6)) {
+        fprintf(stderr, "packet %d has sequence number %d, expected %d\n", dec->packets, packet[0] >> 6, dec->sequence);
+        ++errors;
+    }
+
+    dec->sequence = (dec->sequence + 1) & 0x03;
+    ++dec->packets;
+
+    for (i = 1; i < size; i += 1 + block_size) {
+        block_size = packet[i] & 0x1F;
+
+        // A null block header pads the packet to a whole number of pairs
+        if (0 == packet[i] && i + 1 == size) {
+            break;
+        }
+
+        if (dec->service != packet[i] >> 5 || 0 == block_size || size < i + 1 + block_size) {
+            fprintf(stderr, "bad service block header 0x%02X, %d bytes left in packet\n", packet[i], (int)(size - i - 1));
+            ++errors;
+            return;
+        }
+
+        for (j = i + 1; j < i + 1 + block_size; j += command_size(&packet[j])) {
+            if (0 == command_size(&packet[j]) || i + 1 + block_size < j + command_size(&packet[j])) {
+                fprintf(stderr, "command 0x%02X does not fit in its service block\n", packet[j]);
+                ++errors;
+                return;
+            }
+
+            decode_command(dec, &packet[j]);
+        }
+    }
+}
+
+// Splits cc_data into 608 words and 708 packets, returns the number of service bytes
+static size_t decode_cc_data(decoder_t* dec, caption_frame_t* frame, const cc_data_t* cc_data, size_t count, uint8_t* service, size_t service_size)
+{
+    size_t i, size = 0, packet_size = 0, service_count = 0;
+    uint8_t packet[2 * (DTVCC_PACKET_MAX_SIZE + 1)];
+
+    for (i = 0; i <= count; ++i) {
+        cea708_cc_type_t type = i < count ? (cea708_cc_type_t)cc_data[i].cc_type : cc_type_dtvcc_packet_start;
+
+        if (cc_type_dtvcc_packet_start == type && packet_size) {
+            decode_packet(dec, packet, packet_size);
+
+            // service block bytes, without the packet and block headers
+            for (size = 1; size < packet_size && packet[size]; size += 1 + (packet[size] & 0x1F)) {
+                memcpy(&service[service_count], &packet[size + 1], packet[size] & 0x1F);
+                service_count += packet[size] & 0x1F;
+            }
+
+            packet_size = 0;
+        }
+
+        if (i == count) {
+            break;
+        }
+
+        if (cc_type_ntsc_cc_field_1 == type) {
+            caption_frame_decode(frame, cc_data[i].cc_data, 0);
+        } else if (cc_type_ntsc_cc_field_2 == type) {
+            fprintf(stderr, "CC1 written to field 2\n");
+            ++errors;
+        } else if (cc_type_dtvcc_packet_data == type && 0 == packet_size) {
+            fprintf(stderr, "packet data before a packet start\n");
+            ++errors;
+        } else if (packet_size < sizeof(packet) - 1) {
+            packet[packet_size++] = cc_data[i].cc_data >> 8;
+            packet[packet_size++] = cc_data[i].cc_data & 0xFF;
+        }
+    }
+
+    return service_count < service_size ? service_count : service_size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Both decoders must show the frame that was sent
+static void check_display(const char* name, decoder_t* dec, caption_frame_t* decoded, caption_frame_t* frame)
+{
+    int r, c, w, visible = -1, blank = 1, uln, decoded_uln;
+    eia608_style_t sty, decoded_sty;
+
+    for (w = 0; w < 8; ++w) {
+        if (dec->window[w].defined && dec->window[w].visible) {
+            if (0 <= visible) {
+                fprintf(stderr, "%s: windows %d and %d are both displayed\n", name, visible, w);
+                ++errors;
+            }
+
+            visible = w;
+        }
+    }
+
+    for (r = 0; r < SCREEN_ROWS; ++r) {
+        for (c = 0; c < SCREEN_COLS; ++c) {
+            uint8_t data[2] = { 0, 0 };
+            const utf8_char_t* chr = caption_frame_read_char(frame, r, c, &sty, &uln);
+            const utf8_char_t* decoded_chr = caption_frame_read_char(decoded, r, c, &decoded_sty, &decoded_uln);
+
+            if (strcmp(chr, decoded_chr) || (chr[0] && (sty != decoded_sty || uln != decoded_uln))) {
+                fprintf(stderr, "%s: 608 shows '%s' at %d, %d, expected '%s'\n", name, decoded_chr, r, c, chr);
+                ++errors;
+            }
+
+            if (!dtvcc_from_utf8(chr, data)) {
+                if (0 <= visible && dec->window[visible].text[r][c][0]) {
+                    fprintf(stderr, "%s: 708 shows 0x%02X at %d, %d, expected nothing\n", name, dec->window[visible].text[r][c][0], r, c);
+                    ++errors;
+                }
+
+                continue;
+            }
+
+            blank = 0;
+
+            if (0 > visible) {
+                continue;
+            }
+
+            if (memcmp(&dec->window[visible].text[r][c], data, 2)) {
+                fprintf(stderr, "%s: 708 shows 0x%02X at %d, %d, expected '%s'\n", name, dec->window[visible].text[r][c][0], r, c, chr);
+                ++errors;
+            } else if (dec->window[visible].italics[r][c] != (eia608_style_italics == sty) || dec->window[visible].uln[r][c] != uln) {
+                fprintf(stderr, "%s: 708 pen at %d, %d does not match the 608 style\n", name, r, c);
+                ++errors;
+            }
+        }
+    }
+
+    if (blank != (0 > visible)) {
+        fprintf(stderr, "%s: %s window displayed\n", name, blank ? "a" : "no");
+        ++errors;
+    }
+}
+
+static cc_data_t cc_data[DTVCC_ENCODER_MAX_CC_DATA];
+static uint8_t service[DTVCC_ENCODER_MAX_CC_DATA * 2];
+
+// Encodes frame, decodes the result and checks both displays. Returns the number of service bytes
+static size_t send_frame(const char* name, dtvcc_encoder_t* enc, decoder_t* dec, caption_frame_t* decoded, caption_frame_t* frame)
+{
+    size_t count = dtvcc_encoder_from_caption_frame(enc, frame, cc_data, DTVCC_ENCODER_MAX_CC_DATA);
+    size_t service_count = decode_cc_data(dec, decoded, cc_data, count, service, sizeof(service));
+    check_display(name, dec, decoded, frame);
+    return service_count;
+}
+
+static void check_service(const char* name, size_t size, const uint8_t* expected, size_t expected_size)
+{
+    if (size != expected_size || memcmp(service, expected, size)) {
+        fprintf(stderr, "%s: %d service bytes do not match the %d expected\n", name, (int)size, (int)expected_size);
+        ++errors;
+    }
+}
+
+// Exact command streams for two short captions and a clear
+static void test_small()
+{
+    dtvcc_encoder_t enc;
+    decoder_t dec;
+    caption_frame_t frame, decoded;
+    static const uint8_t first[] = {
+        dtvcc_c1_df0 | 0, 0x18, 0x80 | 10, 10, SCREEN_ROWS - 1, SCREEN_COLS - 1, (2 << 3) | 1,
+        dtvcc_c1_spl, SCREEN_ROWS - 1, 4,
+        dtvcc_c1_spa, 0x05, 0x00,
+        dtvcc_c1_spc, 0x2A, 0x00, 0x00,
+        'H', 'i',
+        dtvcc_c1_dsw, 0x01
+    };
+    static const uint8_t second[] = {
+        dtvcc_c1_df0 | 1, 0x18, 0x80 | 10, 10, SCREEN_ROWS - 1, SCREEN_COLS - 1, (2 << 3) | 1,
+        dtvcc_c1_spl, 0, 0,
+        dtvcc_c1_spa, 0x05, 0x40,
+        dtvcc_c1_spc, 0x2A, 0x00, 0x00,
+        dtvcc_c0_ext1, 0x32,
+        dtvcc_c1_dsw, 0x02,
+        dtvcc_c1_dlw, 0x01
+    };
+    static const uint8_t clear[] = { dtvcc_c1_dlw, 0x03 };
+
+    memset(&dec, 0, sizeof(dec));
+    dec.service = DTVCC_SERVICE_PRIMARY;
+    dtvcc_encoder_init(&enc, 0, DTVCC_SERVICE_PRIMARY);
+    caption_frame_init(&decoded);
+
+    caption_frame_init(&frame);
+    frame.write = caption_frame_write_front;
+    caption_frame_write_char(&frame, SCREEN_ROWS - 1, 4, eia608_style_white, 0, "H");
+    caption_frame_write_char(&frame, SCREEN_ROWS - 1, 5, eia608_style_white, 0, "i");
+    check_service("first", send_frame("first", &enc, &dec, &decoded, &frame), first, sizeof(first));
+
+    caption_frame_init(&frame);
+    frame.write = caption_frame_write_front;
+    caption_frame_write_char(&frame, 0, 0, eia608_style_white, 1, EIA608_CHAR_RIGHT_SINGLE_QUOTATION_MARK);
+    check_service("second", send_frame("second", &enc, &dec, &decoded, &frame), second, sizeof(second));
+
+    caption_frame_init(&frame);
+    check_service("clear", send_frame("clear", &enc, &dec, &decoded, &frame), clear, sizeof(clear));
+
+    // A repeat sends nothing
+    if (0 != dtvcc_encoder_from_caption_frame(&enc, &frame, cc_data, DTVCC_ENCODER_MAX_CC_DATA)) {
+        fprintf(stderr, "repeat: a blank frame was sent twice\n");
+        ++errors;
+    }
+
+    if (3 != dec.packets) {
+        fprintf(stderr, "small: %d packets, expected 3\n", dec.packets);
+        ++errors;
+    }
+}
+
+// Full frames need several service blocks and packets, and wrap the sequence number
+static void test_random()
+{
+    static const char* chars[] = { "a", "Z", "0", " ", "?", EIA608_CHAR_LATIN_SMALL_LETTER_E_WITH_ACUTE, EIA608_CHAR_EIGHTH_NOTE,
+        EIA608_CHAR_RIGHT_SINGLE_QUOTATION_MARK, EIA608_CHAR_FULL_BLOCK };
+    static const eia608_style_t styles[] = { eia608_style_white, eia608_style_red, eia608_style_italics };
+    dtvcc_encoder_t enc;
+    decoder_t dec;
+    caption_frame_t frame, decoded;
+    char name[32];
+
+    memset(&dec, 0, sizeof(dec));
+    dec.service = 2;
+    dtvcc_encoder_init(&enc, 0, 2);
+    caption_frame_init(&decoded);
+    srand(708);
+
+    for (int i = 0; i < 64; ++i) {
+        caption_frame_init(&frame);
+        frame.write = caption_frame_write_front;
+
+        for (int r = 0, rows = rand() % (SCREEN_ROWS + 1); r < rows; ++r) {
+            int row = rand() % SCREEN_ROWS;
+
+            for (int c = 0; c < SCREEN_COLS; ++c) {
+                if (rand() % 4) {
+                    caption_frame_write_char(&frame, row, c, styles[rand() % 3], rand() % 2, chars[rand() % 9]);
+                }
+            }
+        }
+
+        sprintf(name, "random %d", i);
+        send_frame(name, &enc, &dec, &decoded, &frame);
+    }
+
+    if (8 > dec.packets) {
+        fprintf(stderr, "random: only %d packets\n", dec.packets);
+        ++errors;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    test_small();
+    test_random();
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,111 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "eia608.h"
+#include <stdio.h>
+#include <string.h>
+
+// Checks src/eia608_decode_table.c against the eia608_is_* predicates. Run with
+// --generate to print a new table after changing them
+static eia608_decoded_t eia608_classify(uint16_t cc_data)
+{
+    int chan, c1, c2, row, col, uln;
+    eia608_style_t sty;
+    eia608_decoded_t word = (eia608_test_second_channel_bit(cc_data) ? 0x10 : 0x00)
+        | ((eia608_is_specialna(cc_data) || eia608_is_control(cc_data)) ? 0x20 : 0x00);
+
+    if (!eia608_parity_varify(cc_data)) {
+        return eia608_class_parity_error;
+    } else if (eia608_is_padding(cc_data)) {
+        return eia608_class_padding;
+    } else if (eia608_is_xds(cc_data)) {
+        return word | eia608_class_xds;
+    } else if (eia608_is_control(cc_data)) {
+        return word | eia608_class_control | (eia608_parse_control(cc_data, &chan) << 8);
+    } else if (eia608_is_basicna(cc_data) || eia608_is_specialna(cc_data) || eia608_is_westeu(cc_data)) {
+        eia608_to_index(cc_data, &chan, &c1, &c2);
+        word |= eia608_is_basicna(cc_data) ? eia608_class_basicna : eia608_is_specialna(cc_data) ? eia608_class_specialna : eia608_class_westeu;
+        return word | ((c1 & 0xFF) << 8) | ((c2 & 0xFF) << 16);
+    } else if (eia608_is_preamble(cc_data)) {
+        eia608_parse_preamble(cc_data, &row, &col, &sty, &chan, &uln);
+        return word | eia608_class_preamble | ((row & 0x0F) << 8) | (col << 12) | (sty << 17) | (uln << 20);
+    } else if (eia608_is_midrowchange(cc_data)) {
+        eia608_parse_midrowchange(cc_data, &chan, &sty, &uln);
+        return word | eia608_class_midrowchange | (sty << 17) | (uln << 20);
+    }
+
+    return word | eia608_class_unhandled;
+}
+
+static void generate(FILE* license)
+{
+    char line[256];
+
+    while (fgets(line, sizeof(line), license)) {
+        fputs(line, stdout);
+    }
+
+    printf("#include \"eia608.h\"\n\n");
+    printf("// Generated by unit_tests/eia608_decode_table_test.c --generate, do not edit\n");
+    printf("static const eia608_decoded_t _eia608_decode_table[0x10000] = {\n");
+
+    for (int i = 0; i < 0x10000; i += 16) {
+        printf("   ");
+
+        for (int j = i; j < i + 16; ++j) {
+            printf(" 0x%x,", eia608_classify((uint16_t)j));
+        }
+
+        printf("\n");
+    }
+
+    printf("};\n\nconst eia608_decoded_t* eia608_decode_table() { return &_eia608_decode_table[0]; }\n");
+}
+
+int main(int argc, const char** argv)
+{
+    int errors = 0;
+    const eia608_decoded_t* table = eia608_decode_table();
+
+    if (3 == argc && 0 == strcmp("--generate", argv[1])) {
+        FILE* license = fopen(argv[2], "r");
+
+        if (!license) {
+            fprintf(stderr, "Usage: %s --generate license.txt > src/eia608_decode_table.c\n", argv[0]);
+            return 1;
+        }
+
+        generate(license);
+        fclose(license);
+        return 0;
+    }
+
+    for (int i = 0; i < 0x10000; ++i) {
+        if (table[i] != eia608_classify((uint16_t)i)) {
+            fprintf(stderr, "cc_data 0x%04x decodes to 0x%x, expected 0x%x\n", i, table[i], eia608_classify((uint16_t)i));
+            ++errors;
+        }
+    }
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,264 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "eia608_encoder.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Every frame is encoded into buffers of these sizes, the small ones are below a
+// single step and must still make progress
+static const size_t buffer_sizes[] = { 1, 2, 3, 5, 9, 10, 11, 17, 64 };
+#define BUFFER_SIZE_COUNT (sizeof(buffer_sizes) / sizeof(buffer_sizes[0]))
+#define MAX_CALLS 100000
+
+static const char* mode_names[] = { "pop-on", "paint-on", "roll-up 2", "roll-up 3", "roll-up 4" };
+
+static int cell_equal(const caption_frame_cell_t* a, const caption_frame_cell_t* b)
+{
+    if (strcmp(&a->data[0], &b->data[0])) {
+        return 0;
+    }
+
+    return 0 == a->data[0] || (a->sty == b->sty && a->uln == b->uln);
+}
+
+// Returns the first row in first to last that differs, or -1
+static int buffer_diff(const caption_frame_buffer_t* a, const caption_frame_buffer_t* b, int first, int last)
+{
+    for (int r = first; r <= last; ++r) {
+        for (int c = 0; c < SCREEN_COLS; ++c) {
+            if (!cell_equal(&a->cell[r][c], &b->cell[r][c])) {
+                return r;
+            }
+        }
+    }
+
+    return -1;
+}
+
+// A random charcter that 608 can carry
+static const char* random_char()
+{
+    for (;;) {
+        const char* c = eia608_char_map[rand() % EIA608_CHAR_COUNT];
+
+        if (c[0] && eia608_from_utf8_1(c, 0)) {
+            return c;
+        }
+    }
+}
+
+static void random_cell(caption_frame_t* frame, int row, int col)
+{
+    eia608_style_t sty = (eia608_style_t)(rand() % 4 ? eia608_style_white : rand() % 8);
+    caption_frame_write_char(frame, row, col, sty, rand() % 4 ? 0 : 1, random_char());
+}
+
+// Fills rows first to last with runs of text, or changes a few cells of the previous frame
+static void random_frame(caption_frame_t* frame, int first, int last)
+{
+    frame->write = caption_frame_write_front;
+
+    if (rand() % 2) {
+        for (int n = rand() % 8; 0 < n; --n) {
+            int row = first + rand() % (last - first + 1), col = rand() % SCREEN_COLS;
+
+            if (rand() % 3) {
+                random_cell(frame, row, col);
+            } else {
+                memset(&frame->front.cell[row][col], 0, sizeof(caption_frame_cell_t));
+            }
+        }
+
+        return;
+    }
+
+    memset(&frame->front, 0, sizeof(caption_frame_buffer_t));
+
+    for (int r = first; r <= last; ++r) {
+        if (rand() % 3) {
+            int col = rand() % SCREEN_COLS, end = col + rand() % (SCREEN_COLS - col + 1);
+
+            for (; col < end; ++col) {
+                random_cell(frame, r, col);
+            }
+        }
+    }
+}
+
+static int errors = 0;
+
+static void check(const char* mode, size_t size, const char* what, caption_frame_t* decoded, caption_frame_t* shadow, caption_frame_t* target, int first, int last)
+{
+    int row;
+
+    if (0 <= (row = buffer_diff(&decoded->front, &shadow->front, 0, SCREEN_ROWS - 1)) || 0 <= (row = buffer_diff(&decoded->back, &shadow->back, 0, SCREEN_ROWS - 1))) {
+        fprintf(stderr, "%s, %zu words per call, %s: decoder and encoder shadow differ on row %d\n", mode, size, what, row);
+        ++errors;
+    } else if (decoded->state.row != shadow->state.row || decoded->state.col != shadow->state.col) {
+        fprintf(stderr, "%s, %zu words per call, %s: decoder cursor %d,%d, encoder shadow %d,%d\n", mode, size, what, decoded->state.row, decoded->state.col, shadow->state.row, shadow->state.col);
+        ++errors;
+    } else if (target && 0 <= (row = buffer_diff(&decoded->front, &target->front, first, last))) {
+        fprintf(stderr, "%s, %zu words per call, %s: row %d does not match the frame\n", mode, size, what, row);
+        caption_frame_dump(target);
+        caption_frame_dump(decoded);
+        ++errors;
+    }
+}
+
+static void test_frames(eia608_encoder_mode_t mode, size_t size)
+{
+    uint16_t cc_data[64];
+    eia608_encoder_t enc;
+    caption_frame_t target, decoded;
+    int cc = rand() % 4;
+    int first = eia608_encoder_rollup_2 <= mode ? SCREEN_ROWS - (int)mode : 0;
+
+    eia608_encoder_init(&enc, mode, cc);
+    caption_frame_init(&target);
+    caption_frame_init(&decoded);
+
+    for (int i = 0; i < 50; ++i) {
+        size_t count, calls = 0;
+        random_frame(&target, first, SCREEN_ROWS - 1);
+
+        do {
+            count = eia608_encoder_from_caption_frame(&enc, &target, cc_data, size);
+
+            if (count > size) {
+                fprintf(stderr, "%s, %zu words per call: %zu words written\n", mode_names[mode], size, count);
+                ++errors;
+                return;
+            }
+
+            for (size_t j = 0; j < count; ++j) {
+                caption_frame_decode(&decoded, cc_data[j], 0);
+            }
+        } while (count && ++calls < MAX_CALLS);
+
+        if (MAX_CALLS == calls) {
+            fprintf(stderr, "%s, %zu words per call: frame %d never finished\n", mode_names[mode], size, i);
+            ++errors;
+            return;
+        }
+
+        check(mode_names[mode], size, "frame", &decoded, &enc.shadow, &target, first, SCREEN_ROWS - 1);
+    }
+}
+
+// Words of random charcters separated by spaces and the occasional new line
+static void random_text(char* text, size_t size)
+{
+    size_t length = 0;
+
+    for (int words = 1 + rand() % 6; 0 < words; --words) {
+        for (int chars = 1 + rand() % 12; 0 < chars; --chars) {
+            const char* c = random_char();
+
+            if (!utf8_char_whitespace(c) && length + strlen(c) + 2 < size) {
+                strcpy(&text[length], c);
+                length += strlen(c);
+            }
+        }
+
+        text[length++] = rand() % 8 ? ' ' : '\n';
+    }
+
+    text[length] = 0;
+}
+
+// Appends the same text a few bytes at a time through a small buffer, and all at
+// once through a large one. Both must leave the screen the same
+static void test_text(eia608_encoder_mode_t mode, size_t size)
+{
+    char text[256];
+    uint16_t cc_data[EIA608_ENCODE_TEXT_MAX_WORDS];
+    eia608_encoder_t enc, ref;
+    caption_frame_t decoded, expected;
+    int cc = rand() % 4;
+
+    eia608_encoder_init(&enc, mode, cc);
+    eia608_encoder_init(&ref, mode, cc);
+    caption_frame_init(&decoded);
+    caption_frame_init(&expected);
+
+    for (int i = 0; i < 100; ++i) {
+        size_t count, used, calls = 0;
+        const char* data = text;
+        random_text(text, sizeof(text));
+
+        count = eia608_encoder_append_text(&ref, text, cc_data, EIA608_ENCODE_TEXT_MAX_WORDS, &used);
+
+        for (size_t j = 0; j < count; ++j) {
+            caption_frame_decode(&expected, cc_data[j], 0);
+        }
+
+        if (used != strlen(text)) {
+            fprintf(stderr, "%s: %zu of %zu bytes appended\n", mode_names[mode], used, strlen(text));
+            ++errors;
+            return;
+        }
+
+        // Keep calling once the text is used up, until the queued words are returned
+        do {
+            count = eia608_encoder_append_text(&enc, data, cc_data, size, &used);
+            data += used;
+
+            if (count > size) {
+                fprintf(stderr, "%s, %zu words per call: %zu words written\n", mode_names[mode], size, count);
+                ++errors;
+                return;
+            }
+
+            for (size_t j = 0; j < count; ++j) {
+                caption_frame_decode(&decoded, cc_data[j], 0);
+            }
+        } while ((count || (*data)) && ++calls < MAX_CALLS);
+
+        if (MAX_CALLS == calls) {
+            fprintf(stderr, "%s, %zu words per call: text %d never finished\n", mode_names[mode], size, i);
+            ++errors;
+            return;
+        }
+
+        check(mode_names[mode], size, "text", &decoded, &enc.shadow, &expected, 0, SCREEN_ROWS - 1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    srand(608);
+
+    for (int mode = eia608_encoder_popon; mode <= eia608_encoder_rollup_4; ++mode) {
+        for (size_t i = 0; i < BUFFER_SIZE_COUNT; ++i) {
+            test_frames((eia608_encoder_mode_t)mode, buffer_sizes[i]);
+
+            if (eia608_encoder_popon != mode) {
+                test_text((eia608_encoder_mode_t)mode, buffer_sizes[i]);
+            }
+        }
+    }
+
+    return errors ? 1 : 0;
+}
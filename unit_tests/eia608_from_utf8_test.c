@@ -0,0 +1,124 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "eia608.h"
+#include <stdio.h>
+#include <string.h>
+
+// Charcters that are deliberately shown as a different 608 charcter
+static const char* eia608_aliases[][2] = {
+    { "`", EIA608_CHAR_LEFT_SINGLE_QUOTATION_MARK },
+};
+
+static const char* alias(const char* c)
+{
+    for (size_t i = 0; i < sizeof(eia608_aliases) / sizeof(eia608_aliases[0]); ++i) {
+        if (0 == strcmp(c, eia608_aliases[i][0])) {
+            return eia608_aliases[i][1];
+        }
+    }
+
+    return c;
+}
+
+static size_t from_code_point(char* c, unsigned cp)
+{
+    size_t size = cp < 0x80 ? 1 : cp < 0x800 ? 2 : 3;
+
+    if (1 == size) {
+        c[0] = (char)cp;
+    } else if (2 == size) {
+        c[0] = (char)(0xC0 | (cp >> 6)), c[1] = (char)(0x80 | (cp & 0x3F));
+    } else {
+        c[0] = (char)(0xE0 | (cp >> 12)), c[1] = (char)(0x80 | ((cp >> 6) & 0x3F)), c[2] = (char)(0x80 | (cp & 0x3F));
+    }
+
+    c[size] = 0;
+    return size;
+}
+
+// Every charcter of eia608_char_map must map back to its own index. The three byte
+// charcters share a hash table, two of them in one slot can not both map back
+static int test_char_map()
+{
+    int errors = 0;
+
+    for (int i = 0; i < EIA608_CHAR_COUNT; ++i) {
+        for (int chan = 0; chan < 2; ++chan) {
+            int c1, c2, to_chan;
+            uint16_t cc_data = eia608_from_utf8_1(eia608_char_map[i], chan);
+
+            if (!cc_data) {
+                fprintf(stderr, "eia608_char_map[%d] '%s' is not mapped\n", i, eia608_char_map[i]);
+                ++errors;
+                continue;
+            }
+
+            eia608_to_index(cc_data, &to_chan, &c1, &c2);
+
+            if (c1 != i || -1 != c2 || (eia608_is_basicna(cc_data) ? 0 : chan) != (0 != to_chan)) {
+                fprintf(stderr, "eia608_char_map[%d] '%s' channel %d maps to %04X, index %d %d channel %d\n", i, eia608_char_map[i], chan, cc_data, c1, c2, to_chan ? 1 : 0);
+                ++errors;
+            }
+        }
+    }
+
+    return errors;
+}
+
+// Any other code point must either be unmapped or map to a charcter displayed the same
+static int test_code_points()
+{
+    int errors = 0;
+
+    for (unsigned cp = 1; cp < 0x10000; ++cp) {
+        int c1, c2, chan;
+        char c[4];
+
+        if (0xD800 <= cp && 0xE000 > cp) {
+            continue; // surrogates
+        }
+
+        from_code_point(c, cp);
+        uint16_t cc_data = eia608_from_utf8_1(c, 0);
+
+        if (!cc_data) {
+            continue;
+        }
+
+        eia608_to_index(cc_data, &chan, &c1, &c2);
+
+        if (0 > c1 || 0 != strcmp(alias(c), eia608_char_map[c1])) {
+            fprintf(stderr, "U+%04X '%s' maps to %04X '%s'\n", cp, c, cc_data, 0 > c1 ? "" : eia608_char_map[c1]);
+            ++errors;
+        }
+    }
+
+    return errors;
+}
+
+int main(int argc, char** argv)
+{
+    int errors = test_char_map() + test_code_points();
+    return errors ? 1 : 0;
+}
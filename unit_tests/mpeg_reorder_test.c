@@ -0,0 +1,180 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "mpeg.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Sequence parameter sets, escaped as they appear in a stream, and the reorder
+// depth mpeg_bitstream_reorder must report after parsing them
+typedef struct {
+    const char* name;
+    unsigned stream_type;
+    const char* nalu;
+    int reorder;
+} reorder_case_t;
+
+static const reorder_case_t reorder_cases[] = {
+    { "h264 vui restriction and hrd", STREAM_TYPE_H264, "67640028acd940780227e5ffc00040005a808080d2800001f480007530684801f4801f4400fa800fa5bdef81b41108b2c0", 2 },
+    { "h264 vui restriction reorder 0", STREAM_TYPE_H264, "67640028acd940780227e5ffc00040005a808080d2800001f480007530684801f4801f4400fa800fa5bdef81b41108cb", 0 },
+    { "h264 scaling lists", STREAM_TYPE_H264, "67640028ad9522a4548a9152282548a91522a4548a91522a4548a91522a4548a91522a4548a91522a4548ad940780227e5ffc00040005a808080d2800001f480007530684801f4801f4400fa800fa5bdef81b4110898b0", 5 },
+    { "h264 poc type 2", STREAM_TYPE_H264, "67640028acb280f0044fca80", 0 },
+    { "h264 no vui, max dpb frames", STREAM_TYPE_H264, "67640028acd940780227e540", 4 },
+    { "h264 vui without restriction, poc type 1", STREAM_TYPE_H264, "67640028aca32110b1c501e0089f97ff000100016a0202034a000007d20001d4c108", 4 },
+    { "h264 baseline level 3.0", STREAM_TYPE_H264, "6742001eeca05a093f2a", 5 },
+    { "h264 main level 3.1 fields", STREAM_TYPE_H264, "674d001feca028059f95", 5 },
+    { "h264 high intra", STREAM_TYPE_H264, "67641028acd940780227e540", 0 },
+    { "h265 three sub-layers", STREAM_TYPE_H265, "420105016000000300900000030000030078d000000300000300000300000300000300005a5aa003c08010e72f966cca6278", 3 },
+    { "h265 one sub-layer", STREAM_TYPE_H265, "420101016000000300900000030000030078a003c08010e72f9667e0", 2 },
+    { "h265 highest sub-layer only", STREAM_TYPE_H265, "420105016000000300900000030000030078d000000300000300000300000300000300005a5aa003c08010e72f9465e0", 1 },
+    { "h262 low_delay", STREAM_TYPE_H262, "b5148a00010080", 0 },
+    { "h262 reordered", STREAM_TYPE_H262, "b5148a00010000", 1 },
+};
+
+// Prefixes a start code
+static size_t from_hex(uint8_t* data, const char* hex)
+{
+    size_t size = 3;
+    data[0] = 0, data[1] = 0, data[2] = 1;
+
+    for (; hex[0] && hex[1]; hex += 2, ++size) {
+        unsigned int byte;
+        sscanf(hex, "%2x", &byte);
+        data[size] = (uint8_t)byte;
+    }
+
+    return size;
+}
+
+static mpeg_bitstream_t packet;
+
+static int test_reorder(const reorder_case_t* test)
+{
+    uint8_t data[256];
+    caption_frame_t frame;
+    size_t size = from_hex(data, test->nalu);
+
+    caption_frame_init(&frame);
+    mpeg_bitstream_init(&packet);
+
+    if (-1 != mpeg_bitstream_reorder(&packet)) {
+        fprintf(stderr, "%s: reorder is known before the sequence parameters\n", test->name);
+        return 1;
+    }
+
+    mpeg_bitstream_parse_ticks(&packet, &frame, data, size, test->stream_type, 0, 0);
+    mpeg_bitstream_end(&packet, &frame, test->stream_type);
+
+    if (test->reorder != mpeg_bitstream_reorder(&packet)) {
+        fprintf(stderr, "%s: expected reorder %d, got %d\n", test->name, test->reorder, mpeg_bitstream_reorder(&packet));
+        return 1;
+    }
+
+    return 0;
+}
+
+// Returns the number of access units parsed after the one carrying the caption
+// before it was decoded. Frames are stamped as an encoder using two B-frames
+// would, each decode time is two frames before its presentation time, so only
+// the reorder depth tells the caption frame is presented before a later dts does
+static int caption_latency(const char* sps)
+{
+    sei_t sei;
+    uint8_t data[4096];
+    caption_frame_t frame;
+    static const uint8_t aud[] = { 0, 0, 1, 0x09, 0xF0 };
+    const caption_ticks_t frame_ticks = 3003, cts = 2 * frame_ticks;
+
+    caption_frame_init(&frame);
+    caption_frame_from_text(&frame, "zero latency");
+    sei_init(&sei, 0);
+    sei_from_caption_frame(&sei, &frame);
+
+    size_t size = sps ? from_hex(data, sps) : 0;
+    data[size++] = 0, data[size++] = 0, data[size++] = 1;
+
+    if (sizeof(data) < size + sei_render_size(&sei)) {
+        sei_free(&sei);
+        return -1;
+    }
+
+    size += sei_render(&sei, &data[size]);
+    sei_free(&sei);
+
+    caption_frame_init(&frame);
+    mpeg_bitstream_init(&packet);
+
+    // The caption is in the access unit presented first, at 0
+    for (int latency = 0; latency <= MPEG_BITSTREAM_MAX_REORDER; ++latency) {
+        caption_ticks_t dts = latency * frame_ticks - cts;
+        libcaption_stauts_t status;
+
+        if (0 == latency) {
+            mpeg_bitstream_parse_ticks(&packet, &frame, data, size, STREAM_TYPE_H264, dts, cts);
+        } else {
+            mpeg_bitstream_parse_ticks(&packet, &frame, aud, sizeof(aud), STREAM_TYPE_H264, dts, cts);
+        }
+
+        if (LIBCAPTION_OK == (status = mpeg_bitstream_status(&packet))) {
+            status = mpeg_bitstream_end(&packet, &frame, STREAM_TYPE_H264);
+        }
+
+        if (LIBCAPTION_READY == status) {
+            return 0 == caption_frame_ticks(&frame) ? latency : -1;
+        }
+
+        if (LIBCAPTION_ERROR == status) {
+            return -1;
+        }
+    }
+
+    return -1;
+}
+
+int main(int argc, const char** argv)
+{
+    int errors = 0, latency;
+
+    for (size_t i = 0; i < sizeof(reorder_cases) / sizeof(reorder_cases[0]); ++i) {
+        errors += test_reorder(&reorder_cases[i]);
+    }
+
+    if (0 != (latency = caption_latency(reorder_cases[1].nalu))) {
+        fprintf(stderr, "reorder 0: expected the caption without latency, got %d\n", latency);
+        ++errors;
+    }
+
+    if (2 != (latency = caption_latency(reorder_cases[0].nalu))) {
+        fprintf(stderr, "reorder 2: expected the caption after 2 frames, got %d\n", latency);
+        ++errors;
+    }
+
+    // Without an SPS the caption waits for a later decode time
+    if (3 != (latency = caption_latency(NULL))) {
+        fprintf(stderr, "unknown reorder: expected the caption after 3 frames, got %d\n", latency);
+        ++errors;
+    }
+
+    return errors ? 1 : 0;
+}
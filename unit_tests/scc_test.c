@@ -0,0 +1,189 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "scc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Drop-frame timecodes skip frame numbers 0 and 1 at the start of every minute
+// except every tenth, non-drop timecodes count every frame
+typedef struct {
+    int64_t frame;
+    int drop_frame;
+    const char* timecode;
+} timecode_case_t;
+
+static const timecode_case_t timecode_cases[] = {
+    { 0, 1, "00:00:00;00" },
+    { 1799, 1, "00:00:59;29" },
+    { 1800, 1, "00:01:00;02" },
+    { 3597, 1, "00:01:59;29" },
+    { 3598, 1, "00:02:00;02" },
+    { 17981, 1, "00:09:59;29" },
+    { 17982, 1, "00:10:00;00" },
+    { 17983, 1, "00:10:00;01" },
+    { 19781, 1, "00:10:59;29" },
+    { 19782, 1, "00:11:00;02" },
+    { 107892, 1, "01:00:00;00" },
+    { 1800, 0, "00:01:00:00" },
+    { 18000, 0, "00:10:00:00" },
+    { 108000, 0, "01:00:00:00" },
+};
+
+static double frame_seconds(int64_t frame) { return (double)(frame * 1001) / 30000.0; }
+
+static int test_timecodes()
+{
+    int errors = 0;
+
+    for (size_t i = 0; i < sizeof(timecode_cases) / sizeof(timecode_cases[0]); ++i) {
+        const timecode_case_t* test = &timecode_cases[i];
+        utf8_char_t timecode[SCC_TIMECODE_SIZE + 1] = { 0 };
+        int hh, mm, ss, ff;
+
+        scc_format_timecode(timecode, test->frame, test->drop_frame);
+
+        if (0 != strcmp(timecode, test->timecode)) {
+            fprintf(stderr, "frame %lld: expected %s, got %s\n", (long long)test->frame, test->timecode, timecode);
+            ++errors;
+        }
+
+        sscanf(test->timecode, "%2d:%2d:%2d%*c%2d", &hh, &mm, &ss, &ff);
+
+        if (frame_seconds(test->frame) != scc_timecode_to_timestamp(hh, mm, ss, ff, test->drop_frame)) {
+            fprintf(stderr, "%s: expected %f, got %f\n", test->timecode, frame_seconds(test->frame), scc_timecode_to_timestamp(hh, mm, ss, ff, test->drop_frame));
+            ++errors;
+        }
+    }
+
+    return errors;
+}
+
+static int test_round_trip(int64_t frame, int drop_frame)
+{
+    utf8_char_t timecode[SCC_TIMECODE_SIZE + 1] = { 0 };
+    int hh, mm, ss, ff;
+
+    scc_format_timecode(timecode, frame, drop_frame);
+    sscanf(timecode, "%2d:%2d:%2d%*c%2d", &hh, &mm, &ss, &ff);
+    double timestamp = scc_timecode_to_timestamp(hh, mm, ss, ff, drop_frame);
+
+    if (frame != scc_timestamp_to_frame(timestamp) || frame != scc_ticks_to_frame(caption_ticks_from_seconds(timestamp))) {
+        fprintf(stderr, "frame %lld: %s does not round trip\n", (long long)frame, timecode);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Every frame of the first twelve minutes, then both sides of each minute for a day
+static int test_round_trips()
+{
+    int errors = 0;
+
+    for (int drop_frame = 0; drop_frame < 2; ++drop_frame) {
+        for (int64_t frame = 0; frame < 12 * 1800; ++frame) {
+            errors += test_round_trip(frame, drop_frame);
+        }
+
+        for (int64_t minute = 12; minute < 24 * 60; ++minute) {
+            int64_t frame = drop_frame ? (minute / 10) * 17982 + (minute % 10 ? 1800 + (minute % 10 - 1) * 1798 : 0) : minute * 1800;
+            errors += test_round_trip(frame - 1, drop_frame);
+            errors += test_round_trip(frame, drop_frame);
+        }
+    }
+
+    return errors;
+}
+
+static int check_last_line(const char* name, const scc_file_t* scc)
+{
+    const scc_line_t* last = &scc->line[scc->line_size - 1];
+    const uint16_t* cc_data = scc_file_cc_data(scc, scc->line_size - 1);
+
+    if (76 != scc->line_size) {
+        fprintf(stderr, "%s: expected 76 lines, got %zu\n", name, scc->line_size);
+        return 1;
+    }
+
+    if (scc_timecode_to_timestamp(0, 9, 24, 24, 0) != last->timestamp || 17 != last->size || 0x9420 != cc_data[0] || 0x942f != cc_data[16]) {
+        fprintf(stderr, "%s: last line was not kept\n", name);
+        return 1;
+    }
+
+    return 0;
+}
+
+// The last line of a file is kept whether or not it ends with a line ending
+static int test_file(const char* path)
+{
+    int errors = 0;
+    scc_file_t scc;
+    size_t size;
+    utf8_char_t* data = utf8_load_text_file(path, &size);
+
+    if (!data) {
+        fprintf(stderr, "%s: could not be read\n", path);
+        return 1;
+    }
+
+    if (LIBCAPTION_OK != scc_file_load(&scc, path)) {
+        fprintf(stderr, "%s: failed to load\n", path);
+        ++errors;
+    } else {
+        errors += check_last_line("loaded", &scc);
+    }
+
+    scc_file_free(&scc);
+
+    while (0 < size && ('\r' == data[size - 1] || '\n' == data[size - 1])) {
+        --size;
+    }
+
+    if (LIBCAPTION_OK != scc_file_parse(&scc, data, size)) {
+        fprintf(stderr, "%s: failed to parse without a final line ending\n", path);
+        ++errors;
+    } else {
+        errors += check_last_line("no final line ending", &scc);
+    }
+
+    scc_file_free(&scc);
+    free(data);
+    return errors;
+}
+
+int main(int argc, const char** argv)
+{
+    int errors = 0;
+
+    if (2 > argc) {
+        fprintf(stderr, "Usage: %s tos.scc\n", argv[0]);
+        return 1;
+    }
+
+    errors += test_timecodes();
+    errors += test_round_trips();
+    errors += test_file(argv[1]);
+    return errors ? 1 : 0;
+}
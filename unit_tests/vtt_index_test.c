@@ -0,0 +1,205 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "vtt_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_CUES 400
+
+// The cues in the order the index must return them: start time, then insertion order
+typedef struct {
+    size_t size;
+    vtt_block_t* cue[MAX_CUES];
+} expected_t;
+
+static void expected_insert(expected_t* expected, vtt_block_t* cue)
+{
+    size_t i = expected->size++;
+
+    for (; 0 < i && expected->cue[i - 1]->timestamp > cue->timestamp; --i) {
+        expected->cue[i] = expected->cue[i - 1];
+    }
+
+    expected->cue[i] = cue;
+}
+
+// Starts on a coarse grid so that many cues share start and end times
+static vtt_block_t* random_cue(vtt_t* vtt)
+{
+    vtt_block_t* cue = vtt_block_new(vtt, "cue", 3, VTT_CUE);
+    caption_ticks_t duration = rand() % 8 ? (rand() % 80) * CAPTION_TICKS_PER_SECOND / 4 : -1;
+
+    if (cue) {
+        vtt_cue_set_ticks(cue, (rand() % 400) * CAPTION_TICKS_PER_SECOND / 4, duration);
+    }
+
+    return cue;
+}
+
+static double random_time()
+{
+    // grid points hit start and end times exactly
+    return rand() % 2 ? (rand() % 440) / 4.0 : (rand() % 44000) / 400.0 - 1.0;
+}
+
+static int errors = 0;
+
+// Brute force equivalent of the index queries
+static void check_query(const char* what, const vtt_index_t* index, const expected_t* expected, double start, double end, int point)
+{
+    vtt_block_t* cues[MAX_CUES];
+    size_t want = 0, have, i;
+
+    if (point) {
+        have = vtt_index_active(index, start, cues, MAX_CUES);
+    } else {
+        have = vtt_index_range(index, start, end, cues, MAX_CUES);
+    }
+
+    for (i = 0; i < expected->size; ++i) {
+        const vtt_block_t* cue = expected->cue[i];
+        double cue_end = cue->timestamp + cue->duration;
+        int match = point ? (cue->timestamp <= start && start < cue_end) : (start < end && cue->timestamp < end && start < cue_end);
+
+        if (match) {
+            if (want >= have || cues[want] != cue) {
+                fprintf(stderr, "%s %f %f: cue %zu (%f to %f) missing or out of order\n", what, start, end, i, cue->timestamp, cue_end);
+                ++errors;
+                return;
+            }
+
+            ++want;
+        }
+    }
+
+    if (want != have) {
+        fprintf(stderr, "%s %f %f: %zu cues, expected %zu\n", what, start, end, have, want);
+        ++errors;
+    }
+}
+
+static void check_seek(const vtt_index_t* index, const expected_t* expected, double timestamp)
+{
+    size_t want;
+
+    for (want = 0; want < expected->size && expected->cue[want]->timestamp < timestamp; ++want) {
+    }
+
+    if (want != vtt_index_seek(index, timestamp)) {
+        fprintf(stderr, "seek %f: %zu, expected %zu\n", timestamp, vtt_index_seek(index, timestamp), want);
+        ++errors;
+    }
+}
+
+static void check_index(const vtt_index_t* index, const expected_t* expected)
+{
+    for (int i = 0; i < 50; ++i) {
+        double start = random_time(), end = rand() % 4 ? start + (rand() % 40) / 4.0 : random_time();
+        check_query("active", index, expected, start, start, 1);
+        check_query("range", index, expected, start, end, 0);
+        check_seek(index, expected, start);
+    }
+}
+
+// Cue list order after inserting into a sorted list must still be sorted, and the
+// list must hold every cue
+static void check_list(vtt_t* vtt, const expected_t* expected, int sorted)
+{
+    size_t count = 0;
+    vtt_block_t *cue, *prev = 0;
+
+    for (cue = vtt->cue_head; cue; prev = cue, cue = cue->next, ++count) {
+        if (sorted && cue != expected->cue[count]) {
+            fprintf(stderr, "cue list position %zu out of order\n", count);
+            ++errors;
+            return;
+        }
+    }
+
+    if (count != expected->size || prev != vtt->cue_tail) {
+        fprintf(stderr, "cue list holds %zu cues, expected %zu\n", count, expected->size);
+        ++errors;
+    }
+}
+
+static void test_index(size_t size, size_t inserts, int sorted)
+{
+    vtt_index_t index;
+    expected_t expected = { 0 };
+    vtt_t* vtt = vtt_new();
+
+    // Unsorted lists are indexed in random order, sorted ones are linked in start order
+    for (size_t i = 0; i < size; ++i) {
+        expected_insert(&expected, random_cue(sorted ? 0 : vtt));
+    }
+
+    for (size_t i = 0; sorted && i < expected.size; ++i) {
+        vtt_block_append(vtt, expected.cue[i]);
+    }
+
+    if (LIBCAPTION_OK != vtt_index_init(&index, vtt)) {
+        fprintf(stderr, "vtt_index_init failed\n");
+        ++errors;
+        vtt_free(vtt);
+        return;
+    }
+
+    check_index(&index, &expected);
+
+    for (size_t i = 0; i < inserts; ++i) {
+        vtt_block_t* cue = random_cue(0);
+
+        if (LIBCAPTION_OK != vtt_index_insert(&index, vtt, cue)) {
+            fprintf(stderr, "vtt_index_insert failed\n");
+            ++errors;
+            break;
+        }
+
+        expected_insert(&expected, cue);
+
+        if (index.size != expected.size) {
+            fprintf(stderr, "index holds %zu cues, expected %zu\n", index.size, expected.size);
+            ++errors;
+            break;
+        }
+
+        check_index(&index, &expected);
+        check_list(vtt, &expected, sorted);
+    }
+
+    vtt_index_free(&index);
+    vtt_free(vtt);
+}
+
+int main(int argc, char** argv)
+{
+    srand(4242);
+
+    for (int run = 0; run < 200; ++run) {
+        size_t size = rand() % 4 ? rand() % 64 : rand() % 300;
+        test_index(size, rand() % 40, run % 2);
+    }
+
+    return errors ? 1 : 0;
+}
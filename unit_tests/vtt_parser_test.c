@@ -0,0 +1,256 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "vtt.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Every document is pushed split at each byte offset, and one byte at a time, and
+// must give the same blocks as a single vtt_parse
+static const char* vtt_lf = "WEBVTT - title\n"
+                            "\n"
+                            "STYLE\n"
+                            "::cue { color: yellow }\n"
+                            "\n"
+                            "REGION\n"
+                            "id:bottom width:40%\n"
+                            "\n"
+                            "NOTE a comment\n"
+                            "that is dropped\n"
+                            "\n"
+                            "1\n"
+                            "00:00:01.000 --> 00:00:02.500 align:start\n"
+                            "First line\n"
+                            "Second line\n"
+                            "\n"
+                            "\n"
+                            "00:01:02.250 --> 00:01:03.000\n"
+                            "Ünïcödé\n"
+                            "\n"
+                            "not a timing\n"
+                            "dropped\n"
+                            "\n"
+                            "01:00:00.000 --> 01:00:01.000\n"
+                            "Last cue without a blank line";
+
+static const char* srt_lf = "1\n"
+                            "00:00:01,000 --> 00:00:02,500\n"
+                            "First line\n"
+                            "Second line\n"
+                            "\n"
+                            "2\n"
+                            "00:00:03,000 --> 00:00:04,000\n"
+                            "Second cue\n"
+                            "\n";
+
+typedef struct {
+    vtt_block_t* head;
+    vtt_block_t* tail;
+    size_t count;
+} block_list_t;
+
+static void block_list_append(void* opaque, vtt_block_t* block)
+{
+    block_list_t* list = (block_list_t*)opaque;
+    block->next = NULL;
+
+    if (list->tail) {
+        list->tail->next = block;
+    } else {
+        list->head = block;
+    }
+
+    list->tail = block;
+    ++list->count;
+}
+
+static void block_list_free(block_list_t* list)
+{
+    while (list->head) {
+        list->head = vtt_block_free_head(list->head);
+    }
+
+    list->tail = NULL;
+    list->count = 0;
+}
+
+static int string_equal(const char* a, const char* b) { return (!a && !b) || (a && b && 0 == strcmp(a, b)); }
+
+static int block_equal(const vtt_block_t* a, const vtt_block_t* b)
+{
+    return a->type == b->type && a->timestamp == b->timestamp && a->duration == b->duration
+        && a->text_size == b->text_size && 0 == memcmp(a->block_text, b->block_text, a->text_size)
+        && string_equal(a->cue_id, b->cue_id) && string_equal(a->cue_settings, b->cue_settings);
+}
+
+// Blocks of vtt in document order, cues are the only type that can repeat
+static int list_equal(block_list_t* list, vtt_t* vtt)
+{
+    vtt_block_t* heads[] = { vtt->style_head, vtt->region_head, vtt->cue_head };
+    vtt_block_t* block = list->head;
+
+    for (int i = 0; i < 3; ++i) {
+        for (vtt_block_t* expected = heads[i]; expected; expected = expected->next, block = block->next) {
+            if (!block || !block_equal(block, expected)) {
+                return 0;
+            }
+        }
+    }
+
+    return NULL == block;
+}
+
+// Converts LF line endings to eol and optionally adds a BOM
+static char* convert(const char* data, const char* eol, int bom)
+{
+    char* out = (char*)malloc(3 + 2 * strlen(data) + 1);
+    char* pos = out;
+
+    if (bom) {
+        memcpy(pos, "\xEF\xBB\xBF", 3), pos += 3;
+    }
+
+    for (; *data; ++data) {
+        if ('\n' == *data) {
+            memcpy(pos, eol, strlen(eol)), pos += strlen(eol);
+        } else {
+            *pos++ = *data;
+        }
+    }
+
+    *pos = '\0';
+    return out;
+}
+
+static int test_document(const char* name, const char* data, int srt_mode, size_t blocks)
+{
+    int errors = 0;
+    size_t size = strlen(data);
+    vtt_t* vtt = _vtt_parse(data, size, srt_mode);
+    vtt_parser_t parser;
+    block_list_t list = { NULL, NULL, 0 };
+
+    vtt_parser_init(&parser, srt_mode, block_list_append, &list);
+
+    if (!vtt) {
+        fprintf(stderr, "%s: failed to parse\n", name);
+        return 1;
+    }
+
+    // Guards against a reference that is wrong in the same way as the push parser
+    if (LIBCAPTION_OK != vtt_parser_push(&parser, data, size) || LIBCAPTION_OK != vtt_parser_finish(&parser) || blocks != list.count) {
+        fprintf(stderr, "%s: expected %zu blocks, got %zu\n", name, blocks, list.count);
+        ++errors;
+    }
+
+    block_list_free(&list);
+
+    for (size_t split = 0; split <= size; ++split) {
+        libcaption_stauts_t status = vtt_parser_push(&parser, data, split);
+        status = libcaption_status_update(status, vtt_parser_push(&parser, data + split, size - split));
+        status = libcaption_status_update(status, vtt_parser_finish(&parser));
+
+        if (LIBCAPTION_OK != status || !list_equal(&list, vtt)) {
+            fprintf(stderr, "%s: mismatch when split at %zu\n", name, split);
+            ++errors;
+        }
+
+        block_list_free(&list);
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        vtt_parser_push(&parser, data + i, 1);
+    }
+
+    if (LIBCAPTION_OK != vtt_parser_finish(&parser) || !list_equal(&list, vtt)) {
+        fprintf(stderr, "%s: mismatch when pushed one byte at a time\n", name);
+        ++errors;
+    }
+
+    block_list_free(&list);
+    vtt_parser_free(&parser);
+    vtt_free(vtt);
+    return errors;
+}
+
+// Hours are only limited by the range of caption_ticks_t. Larger values, and digit
+// runs long enough to wrap while parsing, must drop the cue
+static int test_timestamp(const char* timestamp, caption_ticks_t expected)
+{
+    char data[256];
+    vtt_t* vtt;
+    caption_ticks_t ticks = -1;
+
+    snprintf(data, sizeof(data), "WEBVTT\n\n%s --> %s\ntext\n", timestamp, timestamp);
+
+    if (!(vtt = vtt_parse(data, strlen(data)))) {
+        fprintf(stderr, "%s: failed to parse\n", timestamp);
+        return 1;
+    }
+
+    if (vtt->cue_head) {
+        ticks = vtt->cue_head->ticks;
+    }
+
+    vtt_free(vtt);
+
+    if (expected != ticks) {
+        fprintf(stderr, "%s: expected %lld ticks, got %lld\n", timestamp, (long long)expected, (long long)ticks);
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, const char** argv)
+{
+    int errors = 0;
+    const char* eols[] = { "\n", "\r\n", "\r" };
+    const char* names[] = { "LF", "CRLF", "CR" };
+
+    for (int e = 0; e < 3; ++e) {
+        for (int bom = 0; bom < 2; ++bom) {
+            char name[32];
+            char* data = convert(vtt_lf, eols[e], bom);
+            snprintf(name, sizeof(name), "vtt %s%s", names[e], bom ? " BOM" : "");
+            errors += test_document(name, data, 0, 5);
+            free(data);
+
+            data = convert(srt_lf, eols[e], bom);
+            snprintf(name, sizeof(name), "srt %s%s", names[e], bom ? " BOM" : "");
+            errors += test_document(name, data, 1, 2);
+            free(data);
+        }
+    }
+
+    const caption_ticks_t hour = 3600 * (caption_ticks_t)CAPTION_TICKS_PER_SECOND;
+    errors += test_timestamp("01:02:03.456", hour + caption_ticks_from_ms(2 * 60 * 1000 + 3456));
+    errors += test_timestamp("28467197643:59:59.999", 28467197643LL * hour + caption_ticks_from_ms(3599999));
+    errors += test_timestamp("28467197644:00:00.000", -1);
+    errors += test_timestamp("99999999999999999999:00:00.000", -1);
+    errors += test_timestamp("18446744073709551617:00:00.000", -1);
+    errors += test_timestamp("18446744073709551617:00.000", -1);
+
+    return errors ? 1 : 0;
+}